@@ -0,0 +1,114 @@
+//$$CDS-header$$
+
+#ifndef __CDS_ALGO_PARALLEL_FOR_H
+#define __CDS_ALGO_PARALLEL_FOR_H
+
+#include <thread>
+#include <vector>
+#include <exception>
+#include <system_error>
+#include <cds/threading/model.h>
+#include <cds/os/topology.h>
+
+namespace cds { namespace algo {
+
+    //@cond
+    namespace details {
+        // Attaches the current thread to libcds for the life time of the object if the thread is not attached yet
+        class scoped_thread_attach
+        {
+            bool const m_bAttached;
+        public:
+            scoped_thread_attach()
+                : m_bAttached( !cds::threading::Manager::isThreadAttached() )
+            {
+                if ( m_bAttached )
+                    cds::threading::Manager::attachThread();
+            }
+            ~scoped_thread_attach()
+            {
+                if ( m_bAttached )
+                    cds::threading::Manager::detachThread();
+            }
+        };
+    } // namespace details
+    //@endcond
+
+    /// Processes the range <tt>[nFirst, nLast)</tt> by several threads
+    /** @ingroup cds_cxx11_stdlib_wrapper
+        The range is split into \p nThreads contiguous subranges of almost equal length,
+        and <tt>f( nRangeFirst, nRangeLast )</tt> is called for each subrange.
+        The first subrange is processed by the calling thread, the others - by <tt>nThreads - 1</tt>
+        temporary threads created by the function. If a thread cannot be created its subrange is processed
+        by the calling thread.
+
+        Each thread (including the calling one) is attached to libcds by \p cds::threading::Manager::attachThread()
+        for the time of processing if it is not attached yet, so \p f may use any libcds container.
+
+        If \p nThreads is 0, the processor count is used. \p nThreads is limited by the range length.
+        \p f is called concurrently for the different subranges, so it should be thread-safe.
+
+        The function returns when all subranges are processed. If \p f throws an exception,
+        the exception of the first failed subrange is rethrown after all threads are joined.
+
+        The function is intended for long whole-container passes like parallel clearing or traversing
+        of a hash table; creating the threads costs tens of microseconds, so for short ranges a plain loop is faster.
+    */
+    template <typename Func>
+    void parallel_for_range( size_t nFirst, size_t nLast, size_t nThreads, Func f )
+    {
+        if ( nFirst >= nLast )
+            return;
+
+        size_t const nCount = nLast - nFirst;
+        if ( nThreads == 0 )
+            nThreads = cds::OS::topology::processor_count();
+        if ( nThreads > nCount )
+            nThreads = nCount;
+        if ( nThreads <= 1 ) {
+            details::scoped_thread_attach attach;
+            f( nFirst, nLast );
+            return;
+        }
+
+        // The first nCount % nThreads subranges are one item longer
+        size_t const nQuot = nCount / nThreads;
+        size_t const nRem = nCount % nThreads;
+        std::vector< std::exception_ptr > arrErrors( nThreads );
+
+        auto worker = [&]( size_t nPart ) {
+            size_t const nRangeFirst = nFirst + nPart * nQuot + ( nPart < nRem ? nPart : nRem );
+            size_t const nRangeLast = nRangeFirst + nQuot + ( nPart < nRem ? 1 : 0 );
+            try {
+                details::scoped_thread_attach attach;
+                f( nRangeFirst, nRangeLast );
+            }
+            catch ( ... ) {
+                arrErrors[nPart] = std::current_exception();
+            }
+        };
+
+        std::vector< std::thread > arrThreads;
+        arrThreads.reserve( nThreads - 1 );
+        for ( size_t nPart = 1; nPart < nThreads; ++nPart ) {
+            try {
+                arrThreads.push_back( std::thread( worker, nPart ));
+            }
+            catch ( std::system_error& ) {
+                worker( nPart );
+            }
+        }
+        worker( 0 );
+
+        for ( size_t i = 0; i < arrThreads.size(); ++i )
+            arrThreads[i].join();
+
+        for ( size_t i = 0; i < arrErrors.size(); ++i ) {
+            if ( arrErrors[i] )
+                std::rethrow_exception( arrErrors[i] );
+        }
+    }
+
+}} // namespace cds::algo
+
+#endif // #ifndef __CDS_ALGO_PARALLEL_FOR_H
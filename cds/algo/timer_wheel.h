@@ -0,0 +1,341 @@
+//$$CDS-header$$
+
+#ifndef __CDS_ALGO_TIMER_WHEEL_H
+#define __CDS_ALGO_TIMER_WHEEL_H
+
+#include <cds/cxx11_atomic.h>
+#include <cds/opt/options.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace algo {
+
+    /// Lock-free hierarchical timer wheel
+    /** @ingroup cds_cxx11_stdlib_wrapper
+        @anchor cds_timer_wheel_description
+
+        The namespace contains \p wheel - a hierarchical timing wheel (see [1987] G.Varghese, T.Lauck
+        "Hashed and hierarchical timing wheels") adapted for concurrent use:
+        - the time is measured in integer ticks. The wheel has \p level_count levels of \p slot_count slots,
+            a slot of level \p L covers <tt>slot_count^L</tt> ticks;
+        - each slot is a lock-free stack of timer records. \p wheel::schedule() pushes the record
+            to the slot that corresponds to its tick, so the scheduling is lock-free and O(1);
+        - \p wheel::advance() processes the slots up to the current tick: the due records are passed
+            to the user functor, the records of upper level slots are moved (cascaded) to the lower levels.
+            The slot is detached as a whole by one atomic exchange. Only one thread advances the wheel
+            at a time; if the wheel is being advanced by another thread, \p advance() returns immediately.
+            \p advance() does not step over the empty ticks: it jumps to the nearest tick that has
+            a non-empty slot on some level.
+
+        \p advance() publishes its target tick before it processes the slots, so the record scheduled
+        concurrently is placed relative to the target tick. If \p schedule() finds after the push that
+        the wheel has been advanced meanwhile, it redistributes the slot relative to the new current tick.
+        Thus the record is never processed earlier than its tick, and the record scheduled concurrently
+        with \p advance() is processed not later than by the next \p advance() call.
+    */
+    namespace timer_wheel {
+
+        /// Timer wheel default traits
+        struct type_traits
+        {
+            /// Record allocator, default is \ref CDS_DEFAULT_ALLOCATOR
+            typedef CDS_DEFAULT_ALLOCATOR   allocator;
+
+            /// Log2 of slot count per level, default is 6 (64 slots)
+            enum { slot_bits = 6 };
+
+            /// Level count, default is 4, so the wheel covers <tt>2^24</tt> ticks
+            enum { level_count = 4 };
+        };
+
+        /// [type-option] Log2 of slot count per level for \p wheel
+        template <unsigned int Bits>
+        struct slot_bits {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { slot_bits = Bits };
+            };
+            //@endcond
+        };
+
+        /// [type-option] Level count for \p wheel
+        template <unsigned int Count>
+        struct level_count {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { level_count = Count };
+            };
+            //@endcond
+        };
+
+        /// Metafunction converting option list to traits for \p wheel
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options are:
+            - \p opt::allocator - record allocator, default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p timer_wheel::slot_bits - log2 of slot count per level, default is 6
+            - \p timer_wheel::level_count - level count, default is 4
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+        /// Hierarchical timer wheel
+        /**
+            Template parameters:
+            - \p T - type of data of timer record, it must be copy-constructible
+            - \p Traits - type traits, see \p timer_wheel::type_traits
+        */
+        template <typename T, typename Traits = type_traits >
+        class wheel
+        {
+        public:
+            typedef T       value_type  ;   ///< Timer record data
+            typedef Traits  options     ;   ///< Traits template parameter
+            typedef unsigned long long tick_type;   ///< Tick type
+
+            static CDS_CONSTEXPR_CONST size_t c_nSlotBits = options::slot_bits;     ///< Log2 of slot count per level
+            static CDS_CONSTEXPR_CONST size_t c_nSlotCount = size_t(1) << c_nSlotBits;    ///< Slot count per level
+            static CDS_CONSTEXPR_CONST size_t c_nLevelCount = options::level_count; ///< Level count
+
+            static_assert( c_nSlotBits * c_nLevelCount < sizeof(tick_type) * 8, "The wheel is too large" );
+
+        protected:
+            //@cond
+            struct record {
+                value_type  m_Data;
+                tick_type   m_nTick;
+                record *    m_pNext;
+
+                record( value_type const& data, tick_type nTick )
+                    : m_Data( data )
+                    , m_nTick( nTick )
+                    , m_pNext( nullptr )
+                {}
+            };
+            typedef cds::details::Allocator< record, typename options::allocator > record_allocator;
+            typedef atomics::atomic<record *>   slot_type;
+            //@endcond
+
+        protected:
+            //@cond
+            slot_type                   m_Slots[c_nLevelCount][c_nSlotCount];
+            atomics::atomic<tick_type>  m_nCurTick  ;   // the last processed tick
+            atomics::atomic<size_t>     m_nPending  ;   // count of scheduled records
+            atomics::atomic<bool>       m_bAdvancing;
+            //@endcond
+
+        public:
+            /// Initializes empty wheel, \p nStartTick is the tick that is considered as already processed
+            wheel( tick_type nStartTick = 0 )
+                : m_nCurTick( nStartTick )
+                , m_nPending( 0 )
+                , m_bAdvancing( false )
+            {
+                for ( size_t nLevel = 0; nLevel < c_nLevelCount; ++nLevel ) {
+                    for ( size_t i = 0; i < c_nSlotCount; ++i )
+                        m_Slots[nLevel][i].store( nullptr, atomics::memory_order_relaxed );
+                }
+            }
+
+            /// Destroys the wheel, all pending records are freed without processing
+            ~wheel()
+            {
+                for ( size_t nLevel = 0; nLevel < c_nLevelCount; ++nLevel ) {
+                    for ( size_t i = 0; i < c_nSlotCount; ++i ) {
+                        record * p = m_Slots[nLevel][i].load( atomics::memory_order_relaxed );
+                        while ( p ) {
+                            record * pNext = p->m_pNext;
+                            record_allocator().Delete( p );
+                            p = pNext;
+                        }
+                    }
+                }
+            }
+
+            /// Schedules the record with data \p data for the tick \p nTick
+            /**
+                The record with the tick that is not greater than \p current_tick() is scheduled for the next tick.
+                The function is lock-free.
+            */
+            void schedule( value_type const& data, tick_type nTick )
+            {
+                m_nPending.fetch_add( 1, atomics::memory_order_relaxed );
+
+                record * pRec = record_allocator().New( data, nTick );
+                tick_type nCurTick = m_nCurTick.load( atomics::memory_order_acquire );
+                slot_type * pSlot = push( pRec, nCurTick );
+
+                // If the wheel has been advanced while we were pushing, our slot may be already passed.
+                // Re-push the records of the slot relative to the new current tick
+                while ( true ) {
+                    atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                    tick_type nNewTick = m_nCurTick.load( atomics::memory_order_acquire );
+                    if ( nNewTick == nCurTick )
+                        break;
+                    nCurTick = nNewTick;
+
+                    record * p = pSlot->exchange( nullptr, atomics::memory_order_acquire );
+                    slot_type * pNewSlot = nullptr;
+                    while ( p ) {
+                        record * pNext = p->m_pNext;
+                        slot_type * pDest = push( p, nCurTick );
+                        if ( p == pRec )
+                            pNewSlot = pDest;
+                        p = pNext;
+                    }
+
+                    // If our record has been taken by advance(), it is placed properly
+                    if ( !pNewSlot )
+                        break;
+                    pSlot = pNewSlot;
+                }
+            }
+
+            /// Processes the wheel up to tick \p nNow
+            /**
+                The functor \p f is called for each record which tick is not greater than \p nNow:
+                \code
+                void f( value_type& data, tick_type nTick );
+                \endcode
+                The function returns the count of records processed. If the wheel is being advanced
+                by another thread, the function returns 0 immediately.
+            */
+            template <typename Func>
+            size_t advance( tick_type nNow, Func f )
+            {
+                bool bExpected = false;
+                if ( !m_bAdvancing.compare_exchange_strong( bExpected, true, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                    return 0;
+
+                size_t nCount = 0;
+                tick_type nTick = m_nCurTick.load( atomics::memory_order_relaxed );
+                if ( nTick < nNow ) {
+                    // From now on schedule() places the records relative to nNow;
+                    // the fence pairs with the fence in schedule()
+                    m_nCurTick.store( nNow, atomics::memory_order_release );
+                    atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                }
+
+                while ( nTick < nNow ) {
+                    if ( m_nPending.load( atomics::memory_order_acquire ) == 0 )
+                        break;
+
+                    nTick = next_tick( nTick, nNow );
+
+                    // Cascade the upper levels whose slot boundary is reached
+                    for ( size_t nLevel = 1; nLevel < c_nLevelCount; ++nLevel ) {
+                        if ( nTick & (( tick_type(1) << ( c_nSlotBits * nLevel )) - 1 ))
+                            break;
+                        nCount += process_slot( nLevel, slot_index( nTick, nLevel ), nTick, f );
+                    }
+                    nCount += process_slot( 0, slot_index( nTick, 0 ), nTick, f );
+                }
+
+                m_bAdvancing.store( false, atomics::memory_order_release );
+                return nCount;
+            }
+
+            /// Returns the last processed tick, or the target tick of \p advance() that is in progress
+            tick_type current_tick() const
+            {
+                return m_nCurTick.load( atomics::memory_order_acquire );
+            }
+
+            /// Returns the count of scheduled records
+            size_t size() const
+            {
+                return m_nPending.load( atomics::memory_order_relaxed );
+            }
+
+            /// Checks if the wheel is empty
+            bool empty() const
+            {
+                return size() == 0;
+            }
+
+        protected:
+            //@cond
+            static size_t slot_index( tick_type nTick, size_t nLevel )
+            {
+                return static_cast<size_t>( nTick >> ( c_nSlotBits * nLevel )) & ( c_nSlotCount - 1 );
+            }
+
+            // Returns the nearest tick in (nTick, nNow] when a non-empty slot is processed, or nNow
+            tick_type next_tick( tick_type nTick, tick_type nNow ) const
+            {
+                tick_type nNext = nNow;
+                for ( size_t nLevel = 0; nLevel < c_nLevelCount; ++nLevel ) {
+                    // The slot of level nLevel is processed each (slot_count^nLevel) ticks
+                    tick_type const nStep = tick_type(1) << ( c_nSlotBits * nLevel );
+                    tick_type t = ( nTick / nStep + 1 ) * nStep;
+                    for ( size_t i = 0; i < c_nSlotCount && t < nNext; ++i, t += nStep ) {
+                        if ( m_Slots[nLevel][ slot_index( t, nLevel ) ].load( atomics::memory_order_relaxed ) ) {
+                            nNext = t;
+                            break;
+                        }
+                    }
+                }
+                return nNext;
+            }
+
+            slot_type * push( record * pRec, tick_type nCurTick )
+            {
+                tick_type nTick = pRec->m_nTick > nCurTick ? pRec->m_nTick : nCurTick + 1;
+                tick_type nDelta = nTick - nCurTick;
+
+                size_t nLevel = 0;
+                while ( nLevel < c_nLevelCount - 1 && nDelta >= ( tick_type(1) << ( c_nSlotBits * ( nLevel + 1 ))) )
+                    ++nLevel;
+                if ( nLevel == c_nLevelCount - 1 && nDelta >= ( tick_type(1) << ( c_nSlotBits * c_nLevelCount ))) {
+                    // Out of the wheel range: park the record in the farthest slot, it will be cascaded again
+                    nTick = nCurTick + ( tick_type(1) << ( c_nSlotBits * c_nLevelCount )) - 1;
+                }
+
+                slot_type& slot = m_Slots[nLevel][ slot_index( nTick, nLevel ) ];
+                record * pHead = slot.load( atomics::memory_order_relaxed );
+                do {
+                    pRec->m_pNext = pHead;
+                } while ( !slot.compare_exchange_weak( pHead, pRec, atomics::memory_order_release, atomics::memory_order_relaxed ));
+                return &slot;
+            }
+
+            template <typename Func>
+            size_t process_slot( size_t nLevel, size_t nSlot, tick_type nTick, Func& f )
+            {
+                slot_type& slot = m_Slots[nLevel][nSlot];
+                if ( slot.load( atomics::memory_order_relaxed ) == nullptr )
+                    return 0;
+
+                size_t nCount = 0;
+                record * p = slot.exchange( nullptr, atomics::memory_order_acquire );
+                while ( p ) {
+                    record * pNext = p->m_pNext;
+                    if ( p->m_nTick <= nTick ) {
+                        f( p->m_Data, p->m_nTick );
+                        record_allocator().Delete( p );
+                        m_nPending.fetch_sub( 1, atomics::memory_order_relaxed );
+                        ++nCount;
+                    }
+                    else
+                        push( p, nTick );
+                    p = pNext;
+                }
+                return nCount;
+            }
+            //@endcond
+        };
+
+    } // namespace timer_wheel
+}} // namespace cds::algo
+
+#endif // #ifndef __CDS_ALGO_TIMER_WHEEL_H
@@ -0,0 +1,723 @@
+//$$CDS-header$$
+
+#ifndef __CDS_ALGO_WORK_STEALING_H
+#define __CDS_ALGO_WORK_STEALING_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <algorithm>
+#include <cds/container/chase_lev_deque.h>
+#include <cds/container/msqueue.h>
+#include <cds/threading/model.h>
+#include <cds/os/topology.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/details/allocator.h>
+#include <cds/details/aligned_allocator.h>
+
+//@cond
+#ifdef CDS_CXX11_THREAD_LOCAL_SUPPORT
+#   define CDS_WORK_STEALING_TLS    thread_local
+#else
+#   define CDS_WORK_STEALING_TLS    __declspec( thread )
+#endif
+//@endcond
+
+namespace cds { namespace algo {
+
+    /// Work-stealing task executor
+    /** @ingroup cds_cxx11_stdlib_wrapper
+        @anchor cds_work_stealing_description
+
+        The namespace contains \p executor - a pool of worker threads that executes the tasks
+        with work-stealing scheduling:
+        - each worker owns a \p cds::container::ChaseLevDeque. The tasks spawned by a task
+            (for example, by \p executor::task_group::run() or \p executor::parallel_for() called in a worker)
+            are pushed to the worker's deque and popped by the worker in LIFO order;
+        - an idle worker steals the tasks from other workers. The victims are probed in the order
+            of processor distance: the worker \p i is associated with the processor <tt>i % cds::OS::topology::processor_count()</tt>,
+            the workers associated with the neighbour processors are probed first (under the assumption
+            of \p cds::OS::topology that the neighbour processor numbers share the caches);
+        - the tasks submitted by non-worker threads are pushed to the shared injection queue
+            \p cds::container::MSQueue, the workers pop it when no task can be stolen;
+        - an idle worker spins with \p back_off for \p spin_count rounds, then parks on a condition variable
+            until a new task is pushed.
+
+        The workers are attached to libcds (see \p cds::threading::Manager) for their life time,
+        so the tasks may use any libcds container without explicit \p attachThread() call.
+    */
+    namespace work_stealing {
+
+        /// Executor internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type    m_nSpawn    ;   ///< Count of the tasks pushed by the workers to their deques
+            counter_type    m_nSubmit   ;   ///< Count of the tasks pushed by non-worker threads to the injection queue
+            counter_type    m_nExecute  ;   ///< Count of the tasks executed
+            counter_type    m_nSteal    ;   ///< Count of the tasks stolen from other workers
+            counter_type    m_nInject   ;   ///< Count of the tasks taken from the injection queue
+            counter_type    m_nPark     ;   ///< Count of worker parking
+            counter_type    m_nWakeup   ;   ///< Count of wake-up notifications
+
+            //@cond
+            void onSpawn()      { ++m_nSpawn; }
+            void onSubmit()     { ++m_nSubmit; }
+            void onExecute()    { ++m_nExecute; }
+            void onSteal()      { ++m_nSteal; }
+            void onInject()     { ++m_nInject; }
+            void onPark()       { ++m_nPark; }
+            void onWakeup()     { ++m_nWakeup; }
+            //@endcond
+        };
+
+        /// Executor dummy statistics, no overhead
+        struct empty_stat
+        {
+            //@cond
+            void onSpawn() const    {}
+            void onSubmit() const   {}
+            void onExecute() const  {}
+            void onSteal() const    {}
+            void onInject() const   {}
+            void onPark() const     {}
+            void onWakeup() const   {}
+            //@endcond
+        };
+
+        /// Executor default traits
+        struct type_traits
+        {
+            /// Back-off strategy of idle worker before parking, default is <tt>exponential< hint, yield ></tt>
+            typedef cds::backoff::exponential< cds::backoff::hint, cds::backoff::yield >  back_off;
+
+            /// Count of idle rounds (each round is an attempt to find a task and a \p back_off call) before parking
+            enum { spin_count = 64 };
+
+            /// Internal statistics, possible predefined types are \ref stat, \ref empty_stat (the default)
+            typedef work_stealing::empty_stat   stat;
+
+            /// Task allocator, default is \ref CDS_DEFAULT_ALLOCATOR
+            typedef CDS_DEFAULT_ALLOCATOR       allocator;
+        };
+
+        /// [type-option] Count of idle rounds before parking for \p executor
+        template <unsigned int Count>
+        struct spin_count {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { spin_count = Count };
+            };
+            //@endcond
+        };
+
+        /// Metafunction converting option list to traits for \p executor
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options are:
+            - \p opt::back_off - back-off strategy of idle worker, default is <tt>exponential< hint, yield ></tt>
+            - \p work_stealing::spin_count - count of idle rounds before parking, default is 64
+            - \p opt::stat - internal statistics, possible type: \ref stat, \ref empty_stat (the default)
+            - \p opt::allocator - task allocator, default is \ref CDS_DEFAULT_ALLOCATOR
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+
+            // Pending task counter of a task group
+            // The last decrement is done under the mutex, so the waiter that has observed zero
+            // and has passed through the mutex may destroy the group safely
+            class group_state
+            {
+                atomics::atomic<size_t>     m_nPending;
+                std::mutex                  m_Mutex;
+                std::condition_variable     m_cvDone;
+
+            public:
+                group_state()
+                    : m_nPending( 0 )
+                {}
+
+                void add()
+                {
+                    m_nPending.fetch_add( 1, atomics::memory_order_relaxed );
+                }
+
+                void done()
+                {
+                    size_t n = m_nPending.load( atomics::memory_order_relaxed );
+                    while ( n > 1 ) {
+                        if ( m_nPending.compare_exchange_weak( n, n - 1, atomics::memory_order_release, atomics::memory_order_relaxed ))
+                            return;
+                    }
+
+                    std::unique_lock< std::mutex > l( m_Mutex );
+                    if ( m_nPending.fetch_sub( 1, atomics::memory_order_acq_rel ) == 1 )
+                        m_cvDone.notify_all();
+                }
+
+                bool finished() const
+                {
+                    return m_nPending.load( atomics::memory_order_acquire ) == 0;
+                }
+
+                // Waits for the last done() exit
+                void sync()
+                {
+                    std::unique_lock< std::mutex > l( m_Mutex );
+                }
+
+                // Blocks until all tasks are done
+                void wait()
+                {
+                    std::unique_lock< std::mutex > l( m_Mutex );
+                    while ( !finished() )
+                        m_cvDone.wait( l );
+                }
+            };
+
+            class task
+            {
+            public:
+                group_state *   m_pGroup;
+
+            public:
+                explicit task( group_state * pGroup )
+                    : m_pGroup( pGroup )
+                {}
+
+                virtual ~task()
+                {}
+
+                virtual void execute() = 0;
+                virtual void dispose() = 0;
+            };
+
+            template <typename Func, class Allocator>
+            class function_task: public task
+            {
+                typedef cds::details::Allocator< function_task, Allocator > cxx_allocator;
+                Func    m_Func;
+
+            public:
+                function_task( group_state * pGroup, Func const& f )
+                    : task( pGroup )
+                    , m_Func( f )
+                {}
+
+                virtual void execute()
+                {
+                    m_Func();
+                }
+
+                virtual void dispose()
+                {
+                    cxx_allocator().Delete( this );
+                }
+
+                static task * make( group_state * pGroup, Func const& f )
+                {
+                    return cxx_allocator().New( pGroup, f );
+                }
+            };
+
+        } // namespace details
+        //@endcond
+
+        /// Work-stealing executor
+        /**
+            See \ref cds_work_stealing_description "work stealing" for the scheduling details.
+
+            Template parameters:
+            - \p GC - garbage collector of the worker deques and the injection queue,
+                possible types are \p cds::gc::HP (the default) and \p cds::gc::PTB
+            - \p Traits - executor traits, default is \p work_stealing::type_traits.
+                \p work_stealing::make_traits metafunction can be used to construct the traits.
+
+            The tasks are the functors with <tt>void operator()()</tt>. The tasks must not throw exceptions.
+            The thread that calls \p submit(), \p parallel_for() or \p task_group functions must be attached
+            to libcds; the worker threads are attached automatically.
+
+            The destructor waits until all pending tasks are executed and stops the workers.
+
+            Example:
+            \code
+            #include <cds/algo/work_stealing.h>
+
+            cds::algo::work_stealing::executor<> ex;
+
+            // Fork-join
+            struct fib {
+                cds::algo::work_stealing::executor<>& ex;
+                int n;
+                int& result;
+                void operator()() const
+                {
+                    if ( n < 2 ) {
+                        result = n;
+                        return;
+                    }
+                    int r1, r2;
+                    cds::algo::work_stealing::executor<>::task_group g( ex );
+                    g.run( fib{ ex, n - 1, r1 } );
+                    fib{ ex, n - 2, r2 }();
+                    g.wait();
+                    result = r1 + r2;
+                }
+            };
+            int r;
+            fib{ ex, 30, r }();
+
+            // Parallel loop over the buckets of a hash set
+            ex.parallel_for( size_t(0), nBucketCount, process_bucket() );
+            \endcode
+        */
+        template <class GC = cds::gc::HP, typename Traits = type_traits >
+        class executor
+        {
+        public:
+            typedef GC      gc      ;   ///< Garbage collector
+            typedef Traits  options ;   ///< Executor traits
+
+            typedef typename options::back_off  back_off    ;   ///< Back-off strategy of idle worker
+            typedef typename options::stat      stat        ;   ///< Internal statistics type
+            typedef typename options::allocator allocator   ;   ///< Task allocator
+
+            static CDS_CONSTEXPR_CONST unsigned int c_nSpinCount = options::spin_count; ///< Count of idle rounds before parking
+
+        protected:
+            //@cond
+            typedef details::task           task;
+            typedef details::group_state    group_state;
+
+            typedef cds::container::ChaseLevDeque< gc, task * > deque_type;
+            typedef cds::container::MSQueue< gc, task * >       queue_type;
+
+            struct worker
+            {
+                executor *          m_pExecutor;
+                size_t const        m_nIndex;
+                unsigned int const  m_nProcessor    ;   // associated processor
+                deque_type          m_Deque;
+                std::vector<size_t> m_arrVictims    ;   // other workers in order of processor distance
+                std::thread         m_Thread;
+
+                worker( executor * pExecutor, size_t nIndex, unsigned int nProcessor )
+                    : m_pExecutor( pExecutor )
+                    , m_nIndex( nIndex )
+                    , m_nProcessor( nProcessor )
+                {}
+            };
+
+            struct victim_less
+            {
+                worker const& m_Thief;
+                std::vector< worker * > const& m_arrWorkers;
+
+                victim_less( worker const& thief, std::vector< worker * > const& arr )
+                    : m_Thief( thief )
+                    , m_arrWorkers( arr )
+                {}
+
+                unsigned int distance( size_t nVictim ) const
+                {
+                    unsigned int nProc = m_arrWorkers[nVictim]->m_nProcessor;
+                    return nProc > m_Thief.m_nProcessor ? nProc - m_Thief.m_nProcessor : m_Thief.m_nProcessor - nProc;
+                }
+
+                size_t ring( size_t nVictim ) const
+                {
+                    return ( nVictim + m_arrWorkers.size() - m_Thief.m_nIndex ) % m_arrWorkers.size();
+                }
+
+                bool operator()( size_t v1, size_t v2 ) const
+                {
+                    unsigned int d1 = distance( v1 );
+                    unsigned int d2 = distance( v2 );
+                    return d1 < d2 || ( d1 == d2 && ring( v1 ) < ring( v2 ));
+                }
+            };
+
+            // worker contains the cache-aligned deque, so it is allocated with its alignment
+            typedef cds::details::AlignedAllocator< worker > worker_allocator;
+
+            struct worker_thread
+            {
+                worker * m_pWorker;
+                void operator()() const
+                {
+                    m_pWorker->m_pExecutor->run( *m_pWorker );
+                }
+            };
+            //@endcond
+
+        public:
+            /// Task group
+            /**
+                The group tracks the tasks spawned by \p run(). \p wait() returns when all the tasks are done.
+                If \p wait() is called by a worker, the worker executes other tasks while waiting.
+                If \p wait() is called by non-worker thread, the thread is blocked.
+
+                The destructor calls \p wait().
+            */
+            class task_group
+            {
+                //@cond
+                executor&   m_Executor;
+                group_state m_State;
+                //@endcond
+
+            public:
+                /// Creates the group for executor \p ex
+                explicit task_group( executor& ex )
+                    : m_Executor( ex )
+                {}
+
+                /// Waits for all tasks of the group
+                ~task_group()
+                {
+                    wait();
+                }
+
+                /// Spawns the task \p f in the group
+                template <typename Func>
+                void run( Func const& f )
+                {
+                    m_State.add();
+                    m_Executor.spawn( details::function_task< Func, allocator >::make( &m_State, f ));
+                }
+
+                /// Waits until all tasks of the group are done
+                void wait()
+                {
+                    m_Executor.wait( m_State );
+                }
+
+            private:
+                //@cond
+                task_group( task_group const& );
+                task_group& operator=( task_group const& );
+                //@endcond
+            };
+
+        protected:
+            //@cond
+            template <typename Index, typename Func>
+            struct range_task
+            {
+                task_group *    m_pGroup;
+                Index           m_First;
+                Index           m_Last;
+                Func const *    m_pFunc;
+                size_t          m_nGrain;
+
+                void operator()() const
+                {
+                    Index first = m_First;
+                    Index last = m_Last;
+
+                    // Split the range: the right half is spawned, the left half is processed by the current thread
+                    while ( static_cast<size_t>( last - first ) > m_nGrain ) {
+                        Index mid = first + ( last - first ) / 2;
+                        range_task right = { m_pGroup, mid, last, m_pFunc, m_nGrain };
+                        m_pGroup->run( right );
+                        last = mid;
+                    }
+
+                    for ( ; first != last; ++first )
+                        (*m_pFunc)( first );
+                }
+            };
+            //@endcond
+
+        protected:
+            //@cond
+            std::vector< worker * >     m_arrWorkers;
+            queue_type                  m_InjectionQueue;
+
+            atomics::atomic<bool>       m_bStop;
+            atomics::atomic<size_t>     m_nParked   ;   // count of parked (or going to park) workers
+            atomics::atomic<size_t>     m_nEpoch    ;   // incremented on each wake-up, protected by m_ParkMutex
+            std::mutex                  m_ParkMutex;
+            std::condition_variable     m_cvPark;
+
+            stat                        m_Stat;
+
+            static CDS_WORK_STEALING_TLS worker * s_pCurrentWorker ;   // worker of the current thread
+            //@endcond
+
+        public:
+            /// Starts \p nWorkerCount workers
+            /**
+                If \p nWorkerCount is 0, the count of workers is equal to the processor count \p cds::OS::topology::processor_count().
+            */
+            explicit executor( size_t nWorkerCount = 0 )
+                : m_bStop( false )
+                , m_nParked( 0 )
+                , m_nEpoch( 0 )
+            {
+                unsigned int const nProcCount = cds::OS::topology::processor_count();
+                if ( nWorkerCount == 0 )
+                    nWorkerCount = nProcCount ? nProcCount : 1;
+
+                m_arrWorkers.reserve( nWorkerCount );
+                for ( size_t i = 0; i < nWorkerCount; ++i )
+                    m_arrWorkers.push_back( worker_allocator().New( alignof( worker ), this, i, nProcCount ? static_cast<unsigned int>( i % nProcCount ) : 0u ));
+
+                for ( size_t i = 0; i < nWorkerCount; ++i ) {
+                    worker& w = *m_arrWorkers[i];
+                    for ( size_t j = 0; j < nWorkerCount; ++j ) {
+                        if ( j != i )
+                            w.m_arrVictims.push_back( j );
+                    }
+                    std::sort( w.m_arrVictims.begin(), w.m_arrVictims.end(), victim_less( w, m_arrWorkers ));
+                }
+
+                for ( size_t i = 0; i < nWorkerCount; ++i ) {
+                    worker_thread f = { m_arrWorkers[i] };
+                    m_arrWorkers[i]->m_Thread = std::thread( f );
+                }
+            }
+
+            /// Executes all pending tasks and stops the workers
+            ~executor()
+            {
+                {
+                    std::unique_lock< std::mutex > l( m_ParkMutex );
+                    m_bStop.store( true, atomics::memory_order_seq_cst );
+                    m_cvPark.notify_all();
+                }
+
+                for ( size_t i = 0; i < m_arrWorkers.size(); ++i )
+                    m_arrWorkers[i]->m_Thread.join();
+                for ( size_t i = 0; i < m_arrWorkers.size(); ++i )
+                    worker_allocator().Delete( m_arrWorkers[i] );
+            }
+
+            /// Returns the count of workers
+            size_t worker_count() const
+            {
+                return m_arrWorkers.size();
+            }
+
+            /// Checks if the current thread is a worker of the executor
+            bool is_worker() const
+            {
+                return current_worker() != nullptr;
+            }
+
+            /// Submits the task \p f for execution
+            /**
+                The function does not wait for the task.
+                If the current thread is a worker, the task is pushed to its deque,
+                otherwise, to the injection queue.
+            */
+            template <typename Func>
+            void submit( Func const& f )
+            {
+                spawn( details::function_task< Func, allocator >::make( nullptr, f ));
+            }
+
+            /// Calls <tt>f( i )</tt> for each \p i in range <tt>[first, last)</tt> in parallel
+            /**
+                \p Index is an integral type or a random access iterator. The range is split in halves
+                recursively until the size of a part is not greater than \p nGrainSize, the parts are executed
+                as the tasks. If \p nGrainSize is 0, the grain is chosen to produce about 8 parts per worker.
+
+                The function returns when all calls of \p f are done. The current thread takes part in the execution.
+                The functor \p f is called concurrently, it is not copied.
+
+                The typical usage is the processing of container segments, for example, the buckets of a hash set.
+            */
+            template <typename Index, typename Func>
+            void parallel_for( Index first, Index last, Func const& f, size_t nGrainSize = 0 )
+            {
+                if ( !( first < last ))
+                    return;
+
+                if ( nGrainSize == 0 ) {
+                    nGrainSize = static_cast<size_t>( last - first ) / ( worker_count() * 8 );
+                    if ( nGrainSize == 0 )
+                        nGrainSize = 1;
+                }
+
+                task_group g( *this );
+                range_task< Index, Func > root = { &g, first, last, &f, nGrainSize };
+                root();
+                g.wait();
+            }
+
+            /// Returns internal statistics
+            stat const& statistics() const
+            {
+                return m_Stat;
+            }
+
+        protected:
+            //@cond
+            worker * current_worker() const
+            {
+                worker * w = s_pCurrentWorker;
+                return w && w->m_pExecutor == this ? w : nullptr;
+            }
+
+            void spawn( task * t )
+            {
+                worker * w = current_worker();
+                if ( w ) {
+                    w->m_Deque.push( t );
+                    m_Stat.onSpawn();
+                }
+                else {
+                    m_InjectionQueue.push( t );
+                    m_Stat.onSubmit();
+                }
+                wakeup();
+            }
+
+            void wait( group_state& state )
+            {
+                worker * w = current_worker();
+                if ( w ) {
+                    // Help to execute the tasks while waiting
+                    back_off bkoff;
+                    while ( !state.finished() ) {
+                        task * t = find_task( *w );
+                        if ( t ) {
+                            execute( t );
+                            bkoff.reset();
+                        }
+                        else
+                            bkoff();
+                    }
+                    state.sync();
+                }
+                else
+                    state.wait();
+            }
+
+            task * find_task( worker& w )
+            {
+                task * t;
+                if ( w.m_Deque.pop( t ))
+                    return t;
+
+                for ( size_t i = 0; i < w.m_arrVictims.size(); ++i ) {
+                    if ( m_arrWorkers[ w.m_arrVictims[i] ]->m_Deque.steal( t )) {
+                        m_Stat.onSteal();
+                        return t;
+                    }
+                }
+
+                if ( m_InjectionQueue.pop( t )) {
+                    m_Stat.onInject();
+                    return t;
+                }
+                return nullptr;
+            }
+
+            bool has_task() const
+            {
+                if ( !m_InjectionQueue.empty() )
+                    return true;
+                for ( size_t i = 0; i < m_arrWorkers.size(); ++i ) {
+                    if ( !m_arrWorkers[i]->m_Deque.empty() )
+                        return true;
+                }
+                return false;
+            }
+
+            void execute( task * t )
+            {
+                t->execute();
+                group_state * pGroup = t->m_pGroup;
+                t->dispose();
+                m_Stat.onExecute();
+                if ( pGroup )
+                    pGroup->done();
+            }
+
+            void wakeup()
+            {
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                if ( m_nParked.load( atomics::memory_order_relaxed ) != 0 ) {
+                    std::unique_lock< std::mutex > l( m_ParkMutex );
+                    m_nEpoch.fetch_add( 1, atomics::memory_order_relaxed );
+                    m_cvPark.notify_one();
+                    m_Stat.onWakeup();
+                }
+            }
+
+            void park()
+            {
+                size_t const nEpoch = m_nEpoch.load( atomics::memory_order_acquire );
+                m_nParked.fetch_add( 1, atomics::memory_order_relaxed );
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+
+                // Recheck after the announcement: a task pushed before has to be visible here,
+                // a task pushed after will increment the epoch
+                if ( !has_task() ) {
+                    std::unique_lock< std::mutex > l( m_ParkMutex );
+                    m_Stat.onPark();
+                    while ( m_nEpoch.load( atomics::memory_order_relaxed ) == nEpoch && !m_bStop.load( atomics::memory_order_relaxed ))
+                        m_cvPark.wait( l );
+                }
+
+                m_nParked.fetch_sub( 1, atomics::memory_order_relaxed );
+            }
+
+            void run( worker& w )
+            {
+                cds::threading::Manager::attachThread();
+                s_pCurrentWorker = &w;
+
+                back_off bkoff;
+                unsigned int nIdle = 0;
+                while ( true ) {
+                    task * t = find_task( w );
+                    if ( t ) {
+                        execute( t );
+                        nIdle = 0;
+                        bkoff.reset();
+                    }
+                    else if ( m_bStop.load( atomics::memory_order_acquire ))
+                        break;
+                    else if ( ++nIdle < c_nSpinCount )
+                        bkoff();
+                    else {
+                        park();
+                        nIdle = 0;
+                        bkoff.reset();
+                    }
+                }
+
+                s_pCurrentWorker = nullptr;
+                cds::threading::Manager::detachThread();
+            }
+            //@endcond
+        };
+
+        //@cond
+        template <class GC, typename Traits>
+        CDS_WORK_STEALING_TLS typename executor<GC, Traits>::worker * executor<GC, Traits>::s_pCurrentWorker = nullptr;
+        //@endcond
+
+    } // namespace work_stealing
+}} // namespace cds::algo
+
+#endif // #ifndef __CDS_ALGO_WORK_STEALING_H
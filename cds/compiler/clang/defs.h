@@ -52,6 +52,12 @@
 #define CDS_CLASS_ALIGNMENT(n)  __attribute__ ((aligned (n)))
 #define CDS_DATA_ALIGNMENT(n)   __attribute__ ((aligned (n)))
 
+// Initial-exec TLS model for the thread-specific data pointer of cds::threading::Manager.
+// Define CDS_TLS_INITIAL_EXEC as empty if libcds is loaded by dlopen() and static TLS is exhausted
+#ifndef CDS_TLS_INITIAL_EXEC
+#   define CDS_TLS_INITIAL_EXEC __attribute__ ((tls_model ("initial-exec")))
+#endif
+
 
 #include <cds/compiler/gcc/compiler_barriers.h>
 
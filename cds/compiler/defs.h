@@ -37,4 +37,8 @@
 #   define CDS_EXPORT_API
 #endif
 
+#ifndef CDS_TLS_INITIAL_EXEC
+#   define CDS_TLS_INITIAL_EXEC
+#endif
+
 #endif  // #ifndef __CDS_ARH_COMPILER_DEFS_H
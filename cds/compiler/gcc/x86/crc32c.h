@@ -0,0 +1,59 @@
+//$$CDS-header$$
+
+#ifndef __CDS_COMPILER_GCC_X86_CRC32C_H
+#define __CDS_COMPILER_GCC_X86_CRC32C_H
+
+#include <cpuid.h>
+#include <cstring>  // memcpy
+
+//@cond none
+/*
+    SSE4.2 CRC32C instructions for x86 and amd64.
+    The instructions are written by inline assembler, so -msse4.2 compiler flag is not required.
+    The instructions may be executed only if cpuid reports SSE4.2 support, see crc32c_supported()
+*/
+namespace cds { namespace crc32c {
+    namespace gcc { namespace x86 {
+
+#       define CDS_crc32c_hw_defined
+
+        static inline bool crc32c_supported()
+        {
+            unsigned int eax, ebx, ecx, edx;
+            if ( !__get_cpuid( 1, &eax, &ebx, &ecx, &edx ))
+                return false;
+            return (ecx & (1 << 20)) != 0;  // CPUID.01H.ECX.SSE4_2[bit 20]
+        }
+
+        static inline uint32_t crc32c_hw( uint32_t nCrc, void const * pData, size_t nSize )
+        {
+            unsigned char const * p = reinterpret_cast<unsigned char const *>( pData );
+
+#       if CDS_BUILD_BITS == 64
+            uint64_t nCrc64 = nCrc;
+            for ( ; nSize >= 8; nSize -= 8, p += 8 ) {
+                uint64_t v;
+                memcpy( &v, p, sizeof(v) );
+                __asm__ ( "crc32q %1, %0" : "+r" (nCrc64) : "rm" (v) );
+            }
+            nCrc = static_cast<uint32_t>( nCrc64 );
+#       endif
+            for ( ; nSize >= 4; nSize -= 4, p += 4 ) {
+                uint32_t v;
+                memcpy( &v, p, sizeof(v) );
+                __asm__ ( "crc32l %1, %0" : "+r" (nCrc) : "rm" (v) );
+            }
+            for ( ; nSize; --nSize, ++p )
+                __asm__ ( "crc32b %1, %0" : "+r" (nCrc) : "rm" (*p) );
+            return nCrc;
+        }
+
+    }} // namespace gcc::x86
+
+    namespace platform {
+        using namespace gcc::x86;
+    }
+}}  // namespace cds::crc32c
+//@endcond
+
+#endif  // #ifndef __CDS_COMPILER_GCC_X86_CRC32C_H
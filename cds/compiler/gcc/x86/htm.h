@@ -0,0 +1,65 @@
+//$$CDS-header$$
+
+#ifndef __CDS_COMPILER_GCC_X86_HTM_H
+#define __CDS_COMPILER_GCC_X86_HTM_H
+
+#include <cpuid.h>
+
+//@cond none
+/*
+    Intel RTM (Restricted Transactional Memory) primitives for x86 and amd64.
+    The instructions are emitted as raw bytes, so neither -mrtm compiler flag
+    nor RTM-aware assembler is required.
+    The instructions may be executed only if cpuid reports RTM support, see rtm_supported()
+*/
+namespace cds { namespace htm {
+    namespace gcc { namespace x86 {
+
+#       define CDS_htm_rtm_defined
+
+        static inline bool rtm_supported()
+        {
+            unsigned int nMaxLeaf = __get_cpuid_max( 0, nullptr );
+            if ( nMaxLeaf < 7 )
+                return false;
+
+            unsigned int eax, ebx, ecx, edx;
+            __cpuid_count( 7, 0, eax, ebx, ecx, edx );
+            return (ebx & (1 << 11)) != 0;   // CPUID.07H.EBX.RTM[bit 11]
+        }
+
+        static inline unsigned int xbegin()
+        {
+            unsigned int nStatus = ~0u;
+            // xbegin with zero offset: on abort the execution continues with the next instruction
+            __asm__ __volatile__ ( ".byte 0xc7, 0xf8; .long 0" : "+a" (nStatus) :: "memory" );
+            return nStatus;
+        }
+
+        static inline void xend()
+        {
+            __asm__ __volatile__ ( ".byte 0x0f, 0x01, 0xd5" ::: "memory" );
+        }
+
+        template <unsigned char Code>
+        static inline void xabort()
+        {
+            __asm__ __volatile__ ( ".byte 0xc6, 0xf8, %P0" :: "i" (Code) : "memory" );
+        }
+
+        static inline bool xtest()
+        {
+            unsigned char bActive;
+            __asm__ __volatile__ ( ".byte 0x0f, 0x01, 0xd6; setnz %0" : "=r" (bActive) :: "memory", "cc" );
+            return bActive != 0;
+        }
+
+    }} // namespace gcc::x86
+
+    namespace platform {
+        using namespace gcc::x86;
+    }
+}}  // namespace cds::htm
+//@endcond
+
+#endif  // #ifndef __CDS_COMPILER_GCC_X86_HTM_H
@@ -0,0 +1,120 @@
+//$$CDS-header$$
+
+#ifndef __CDS_COMPILER_HTM_H
+#define __CDS_COMPILER_HTM_H
+
+#include <cds/details/defs.h>
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC || (CDS_COMPILER == CDS_COMPILER_INTEL && CDS_OS_INTERFACE == CDS_OSI_WINDOWS)
+#   if CDS_PROCESSOR_ARCH == CDS_PROCESSOR_X86 || CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64
+#       include <cds/compiler/vc/x86/htm.h>
+#   endif
+#elif CDS_COMPILER == CDS_COMPILER_GCC || CDS_COMPILER == CDS_COMPILER_CLANG || CDS_COMPILER == CDS_COMPILER_INTEL
+#   if CDS_PROCESSOR_ARCH == CDS_PROCESSOR_X86 || CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64
+#       include <cds/compiler/gcc/x86/htm.h>
+#   endif
+#endif
+
+namespace cds {
+    /// Hardware transactional memory primitives
+    /**
+        The namespace contains thin wrappers over Intel RTM (Restricted Transactional Memory) instructions.
+        RTM availability is checked at run-time by \p cpuid, so the code compiled with RTM support
+        can be run on any processor: if RTM is not supported, \ref is_supported returns \p false
+        and the caller should use a non-transactional code path. Other RTM functions may be called
+        only if \p is_supported() returns \p true.
+
+        On the platforms where RTM is not known to the library, \p is_supported() always returns \p false.
+    */
+    namespace htm {
+
+        /// \p xbegin() result: the transaction is started
+        static unsigned int const c_nStarted        = ~0u;
+        /// Abort status bit: the transaction was aborted by \p xabort(), see \ref abort_code
+        static unsigned int const c_nAbortExplicit  = 1 << 0;
+        /// Abort status bit: the transaction may succeed on a retry
+        static unsigned int const c_nAbortRetry     = 1 << 1;
+        /// Abort status bit: another processor conflicted with a memory address of the transaction
+        static unsigned int const c_nAbortConflict  = 1 << 2;
+        /// Abort status bit: an internal buffer overflowed
+        static unsigned int const c_nAbortCapacity  = 1 << 3;
+        /// Abort status bit: the transaction was aborted in a nested transaction
+        static unsigned int const c_nAbortNested    = 1 << 5;
+
+        /// Returns the argument of \p xabort() from the abort status \p nStatus
+        static inline unsigned int abort_code( unsigned int nStatus )
+        {
+            return (nStatus >> 24) & 0xFF;
+        }
+
+#   ifdef CDS_htm_rtm_defined
+        /// Checks if the processor supports RTM
+        /**
+            The check is performed once, the result is cached.
+        */
+        static inline bool is_supported()
+        {
+            static bool const s_bSupported = platform::rtm_supported();
+            return s_bSupported;
+        }
+
+        /// Starts a transaction
+        /**
+            Returns \ref c_nStarted when the transaction is started. If the transaction is aborted
+            the execution continues from \p xbegin() which returns abort status.
+        */
+        static inline unsigned int xbegin()
+        {
+            return platform::xbegin();
+        }
+
+        /// Commits the transaction
+        static inline void xend()
+        {
+            platform::xend();
+        }
+
+        /// Aborts the transaction with abort code \p Code
+        template <unsigned char Code>
+        static inline void xabort()
+        {
+            platform::xabort<Code>();
+        }
+
+        /// Checks if the current thread executes a transaction
+        static inline bool xtest()
+        {
+            return platform::xtest();
+        }
+#   else
+        //@cond
+        static inline bool is_supported()
+        {
+            return false;
+        }
+
+        static inline unsigned int xbegin()
+        {
+            return 0;
+        }
+
+        static inline void xend()
+        {
+            assert( false );
+        }
+
+        template <unsigned char Code>
+        static inline void xabort()
+        {}
+
+        static inline bool xtest()
+        {
+            return false;
+        }
+        //@endcond
+#   endif
+
+    } // namespace htm
+} // namespace cds
+
+#endif  // #ifndef __CDS_COMPILER_HTM_H
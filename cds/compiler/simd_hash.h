@@ -0,0 +1,82 @@
+//$$CDS-header$$
+
+#ifndef __CDS_COMPILER_SIMD_HASH_H
+#define __CDS_COMPILER_SIMD_HASH_H
+
+#include <cds/details/defs.h>
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC || (CDS_COMPILER == CDS_COMPILER_INTEL && CDS_OS_INTERFACE == CDS_OSI_WINDOWS)
+#   if CDS_PROCESSOR_ARCH == CDS_PROCESSOR_X86 || CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64
+#       include <cds/compiler/vc/x86/simd_hash.h>
+#   endif
+#elif CDS_COMPILER == CDS_COMPILER_GCC || CDS_COMPILER == CDS_COMPILER_CLANG || CDS_COMPILER == CDS_COMPILER_INTEL
+#   if CDS_PROCESSOR_ARCH == CDS_PROCESSOR_X86 || CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64
+#       include <cds/compiler/gcc/x86/simd_hash.h>
+#   endif
+#endif
+
+namespace cds {
+    /// SIMD kernel of \p cds::opt::v::striped_hash
+    /**
+        The namespace contains the vectorized accumulation loop of the striped hash algorithm.
+        AVX2 availability is checked at run-time by \p cpuid, so the code can be run on any processor;
+        if AVX2 is not supported, the caller uses the portable implementation that produces the same result.
+    */
+    namespace simd_hash {
+
+#   ifdef CDS_simd_hash_avx2_defined
+        /// Checks if the processor and the OS support AVX2
+        /**
+            The check is performed once, the result is cached.
+        */
+        static inline bool is_avx2_supported()
+        {
+            static bool const s_bSupported = platform::avx2_supported();
+            return s_bSupported;
+        }
+
+        /// Accumulates \p nSize bytes of \p p into eight 64-bit accumulators \p acc by AVX2
+        /**
+            \p nSize should be at least 64. \p pSecret is the array of four 64-bit secret constants.
+            The function is the vectorized version of the following algorithm:
+            \code
+            acc[j] = j < 4 ? nSeed ^ pSecret[j] : nSeed + pSecret[j - 4];
+            key[j] = nSeed ^ pSecret[j];    // j = 0..3
+            // 64-byte stripes; the last stripe (possibly overlapped with the previous one) ends at the end of the data
+            for each stripe {
+                for ( j = 0; j < 8; ++j ) {
+                    v = the j-th 64-bit word of the stripe;
+                    k = v ^ key[j % 4];
+                    acc[j ^ 1] += v;
+                    acc[j] += (k & 0xFFFFFFFF) * (k >> 32);
+                }
+                key[0..3] += pSecret[3];
+                if ( each nBlockStripes stripes and the stripe is not the last one )
+                    acc[0..7] = (acc ^ (acc >> 47)) * 0x9E3779B1;
+            }
+            \endcode
+
+            The function may be called only if \p is_avx2_supported() returns \p true.
+        */
+        static inline void accumulate_avx2( uint64_t * acc, unsigned char const * p, size_t nSize, uint64_t nSeed, uint64_t const * pSecret, size_t nBlockStripes )
+        {
+            platform::accumulate_avx2( acc, p, nSize, nSeed, pSecret, nBlockStripes );
+        }
+#   else
+        //@cond
+        static inline bool is_avx2_supported()
+        {
+            return false;
+        }
+
+        static inline void accumulate_avx2( uint64_t * /*acc*/, unsigned char const * /*p*/, size_t /*nSize*/, uint64_t /*nSeed*/, uint64_t const * /*pSecret*/, size_t /*nBlockStripes*/ )
+        {
+            assert( false );
+        }
+        //@endcond
+#   endif
+
+    } // namespace simd_hash
+} // namespace cds
+
+#endif  // #ifndef __CDS_COMPILER_SIMD_HASH_H
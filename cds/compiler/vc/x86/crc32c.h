@@ -0,0 +1,58 @@
+//$$CDS-header$$
+
+#ifndef __CDS_COMPILER_VC_X86_CRC32C_H
+#define __CDS_COMPILER_VC_X86_CRC32C_H
+
+#include <intrin.h>
+#include <nmmintrin.h>
+#include <cstring>  // memcpy
+
+//@cond none
+/*
+    SSE4.2 CRC32C instructions for x86 and amd64.
+    The instructions may be executed only if cpuid reports SSE4.2 support, see crc32c_supported()
+*/
+namespace cds { namespace crc32c {
+    namespace vc { namespace x86 {
+
+#       define CDS_crc32c_hw_defined
+
+        static inline bool crc32c_supported()
+        {
+            int regs[4];
+            __cpuid( regs, 1 );
+            return (regs[2] & (1 << 20)) != 0;  // CPUID.01H.ECX.SSE4_2[bit 20]
+        }
+
+        static inline uint32_t crc32c_hw( uint32_t nCrc, void const * pData, size_t nSize )
+        {
+            unsigned char const * p = reinterpret_cast<unsigned char const *>( pData );
+
+#       if CDS_BUILD_BITS == 64
+            unsigned __int64 nCrc64 = nCrc;
+            for ( ; nSize >= 8; nSize -= 8, p += 8 ) {
+                unsigned __int64 v;
+                memcpy( &v, p, sizeof(v) );
+                nCrc64 = _mm_crc32_u64( nCrc64, v );
+            }
+            nCrc = static_cast<uint32_t>( nCrc64 );
+#       endif
+            for ( ; nSize >= 4; nSize -= 4, p += 4 ) {
+                unsigned int v;
+                memcpy( &v, p, sizeof(v) );
+                nCrc = _mm_crc32_u32( nCrc, v );
+            }
+            for ( ; nSize; --nSize, ++p )
+                nCrc = _mm_crc32_u8( nCrc, *p );
+            return nCrc;
+        }
+
+    }} // namespace vc::x86
+
+    namespace platform {
+        using namespace vc::x86;
+    }
+}}  // namespace cds::crc32c
+//@endcond
+
+#endif  // #ifndef __CDS_COMPILER_VC_X86_CRC32C_H
@@ -0,0 +1,59 @@
+//$$CDS-header$$
+
+#ifndef __CDS_COMPILER_VC_X86_HTM_H
+#define __CDS_COMPILER_VC_X86_HTM_H
+
+#include <intrin.h>
+#include <immintrin.h>
+
+//@cond none
+/*
+    Intel RTM (Restricted Transactional Memory) primitives for x86 and amd64.
+    The instructions may be executed only if cpuid reports RTM support, see rtm_supported()
+*/
+namespace cds { namespace htm {
+    namespace vc { namespace x86 {
+
+#       define CDS_htm_rtm_defined
+
+        static inline bool rtm_supported()
+        {
+            int regs[4];
+            __cpuid( regs, 0 );
+            if ( regs[0] < 7 )
+                return false;
+
+            __cpuidex( regs, 7, 0 );
+            return (regs[1] & (1 << 11)) != 0;   // CPUID.07H.EBX.RTM[bit 11]
+        }
+
+        static inline unsigned int xbegin()
+        {
+            return _xbegin();
+        }
+
+        static inline void xend()
+        {
+            _xend();
+        }
+
+        template <unsigned char Code>
+        static inline void xabort()
+        {
+            _xabort( Code );
+        }
+
+        static inline bool xtest()
+        {
+            return _xtest() != 0;
+        }
+
+    }} // namespace vc::x86
+
+    namespace platform {
+        using namespace vc::x86;
+    }
+}}  // namespace cds::htm
+//@endcond
+
+#endif  // #ifndef __CDS_COMPILER_VC_X86_HTM_H
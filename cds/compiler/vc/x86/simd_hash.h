@@ -0,0 +1,96 @@
+//$$CDS-header$$
+
+#ifndef __CDS_COMPILER_VC_X86_SIMD_HASH_H
+#define __CDS_COMPILER_VC_X86_SIMD_HASH_H
+
+#include <intrin.h>
+#include <immintrin.h>
+
+//@cond none
+/*
+    AVX2 kernel of the striped hash for x86 and amd64.
+    MSVC allows AVX2 intrinsics without /arch:AVX2 switch.
+    The kernel may be executed only if cpuid reports AVX2 support, see avx2_supported()
+*/
+namespace cds { namespace simd_hash {
+    namespace vc { namespace x86 {
+
+#       define CDS_simd_hash_avx2_defined
+
+        static inline bool avx2_supported()
+        {
+            int regs[4];
+            __cpuid( regs, 1 );
+            if ( !(regs[2] & (1 << 27)))    // CPUID.01H.ECX.OSXSAVE[bit 27]
+                return false;
+
+            // The OS should save YMM registers: XCR0 bits 1 (SSE) and 2 (AVX)
+            if ( (_xgetbv( 0 ) & 6) != 6 )
+                return false;
+
+            __cpuid( regs, 0 );
+            if ( regs[0] < 7 )
+                return false;
+            __cpuidex( regs, 7, 0 );
+            return (regs[1] & (1 << 5)) != 0;   // CPUID.(EAX=07H,ECX=0):EBX.AVX2[bit 5]
+        }
+
+        static inline void accumulate_avx2( uint64_t * acc, unsigned char const * p, size_t nSize, uint64_t nSeed, uint64_t const * pSecret, size_t nBlockStripes )
+        {
+            __m256i const secret = _mm256_loadu_si256( reinterpret_cast<__m256i const *>( pSecret ));
+            __m256i const seed = _mm256_set1_epi64x( static_cast<long long>( nSeed ));
+            __m256i const step = _mm256_set1_epi64x( static_cast<long long>( pSecret[3] ));
+            __m256i const prime = _mm256_set1_epi64x( 0x9E3779B1 );
+            __m256i acc0 = _mm256_xor_si256( seed, secret );
+            __m256i acc1 = _mm256_add_epi64( seed, secret );
+            __m256i key = acc0;
+
+            unsigned char const * const pLast = p + nSize - 64;
+            size_t nStripes = ( nSize - 1 ) / 64;
+            size_t nBlock = 0;
+            while ( true ) {
+                __m256i const d0 = _mm256_loadu_si256( reinterpret_cast<__m256i const *>( p ));
+                __m256i const d1 = _mm256_loadu_si256( reinterpret_cast<__m256i const *>( p + 32 ));
+                __m256i const k0 = _mm256_xor_si256( d0, key );
+                __m256i const k1 = _mm256_xor_si256( d1, key );
+
+                // acc[j] += lo32(k) * hi32(k)
+                acc0 = _mm256_add_epi64( acc0, _mm256_mul_epu32( k0, _mm256_shuffle_epi32( k0, 0x31 )));
+                acc1 = _mm256_add_epi64( acc1, _mm256_mul_epu32( k1, _mm256_shuffle_epi32( k1, 0x31 )));
+
+                // acc[j ^ 1] += v: swap 64-bit lanes in each 128-bit half
+                acc0 = _mm256_add_epi64( acc0, _mm256_shuffle_epi32( d0, 0x4E ));
+                acc1 = _mm256_add_epi64( acc1, _mm256_shuffle_epi32( d1, 0x4E ));
+
+                key = _mm256_add_epi64( key, step );
+
+                if ( nStripes == 0 )
+                    break;
+                if ( --nStripes == 0 )
+                    p = pLast;
+                else {
+                    p += 64;
+                    if ( ++nBlock == nBlockStripes ) {
+                        // acc = (acc ^ (acc >> 47)) * 0x9E3779B1
+                        nBlock = 0;
+                        __m256i x = _mm256_xor_si256( acc0, _mm256_srli_epi64( acc0, 47 ));
+                        acc0 = _mm256_add_epi64( _mm256_mul_epu32( x, prime ), _mm256_slli_epi64( _mm256_mul_epu32( _mm256_srli_epi64( x, 32 ), prime ), 32 ));
+                        x = _mm256_xor_si256( acc1, _mm256_srli_epi64( acc1, 47 ));
+                        acc1 = _mm256_add_epi64( _mm256_mul_epu32( x, prime ), _mm256_slli_epi64( _mm256_mul_epu32( _mm256_srli_epi64( x, 32 ), prime ), 32 ));
+                    }
+                }
+            }
+
+            _mm256_storeu_si256( reinterpret_cast<__m256i *>( acc ), acc0 );
+            _mm256_storeu_si256( reinterpret_cast<__m256i *>( acc + 4 ), acc1 );
+        }
+
+    }} // namespace vc::x86
+
+    namespace platform {
+        using namespace vc::x86;
+    }
+}}  // namespace cds::simd_hash
+//@endcond
+
+#endif  // #ifndef __CDS_COMPILER_VC_X86_SIMD_HASH_H
@@ -0,0 +1,1625 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_ART_MAP_RCU_H
+#define __CDS_CONTAINER_ART_MAP_RCU_H
+
+#include <cstring>      // memcpy, memmove
+#include <vector>
+#include <cds/container/details/art_base.h>
+#include <cds/urcu/details/check_deadlock.h>
+#include <cds/details/allocator.h>
+#include <cds/algo/bitop.h>
+
+#if CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64 || ( CDS_PROCESSOR_ARCH == CDS_PROCESSOR_X86 && defined(__SSE2__) )
+#   include <emmintrin.h>
+#   define CDS_ART_NODE16_SSE2
+#endif
+
+namespace cds { namespace container {
+
+    //@cond
+    namespace art { namespace details {
+        template <typename Key, typename Encoder>
+        struct make_encoder {
+            typedef Encoder type;
+        };
+        template <typename Key>
+        struct make_encoder< Key, opt::none > {
+            typedef art::encoder<Key> type;
+        };
+    }} // namespace art::details
+    //@endcond
+
+    /// Adaptive radix tree map (template specialization for \ref cds_urcu_desc "RCU")
+    /** @ingroup cds_nonintrusive_map
+        \anchor cds_container_ArtMap_rcu
+
+        Source:
+            - [2013] V.Leis, A.Kemper, T.Neumann "The Adaptive Radix Tree: ARTful Indexing for Main-Memory Databases"
+            - [2016] V.Leis, F.Scheibner, A.Kemper, T.Neumann "The ART of Practical Synchronization"
+
+        The adaptive radix tree (ART) is a trie that branches on one byte of the key at each level.
+        The key is converted to a byte string by the key encoder (see \p art::encoder), the order of the map
+        is the lexicographical order of the byte strings. The tree never compares the whole keys
+        except the last step: the search reads one byte of the key per inner node and compares the key
+        with the leaf found. So, the search costs <tt>O(key length)</tt> and it does not depend on the count
+        of items, and a long string key is not compared many times like in a search tree.
+
+        The inner node adapts its layout to the count of children:
+        - \p Node4 and \p Node16 contain sorted arrays of up to 4 or 16 key bytes and children;
+            \p Node16 is searched by one SSE2 comparison on x86 processors;
+        - \p Node48 contains 256-byte index array and up to 48 children;
+        - \p Node256 contains 256 children.
+
+        A node is replaced by the larger one when it is full and by the smaller one when it becomes sparse.
+        The common part of the keys (the compressed path) is stored in the node as the prefix,
+        and the node with one child is removed from the path.
+
+        The synchronization is <b>optimistic lock coupling</b>, like \ref cds_container_BPlusTreeMap_rcu "BPlusTreeMap".
+        The inner node has a version word with the lock bit and the obsolete bit. The reader does not write
+        to shared memory: it validates the version of the node after reading the child pointer, and restarts
+        from the root if the node has been changed. The writer locks only the node it changes, and the parent
+        when the node is replaced. The leaves are immutable: \p ensure() replaces the leaf by the updated copy,
+        so the reader gets the consistent item without any locking. The replaced nodes and the leaves
+        deleted are reclaimed by RCU.
+
+        Since the readers do not protect the nodes visited, the map is provided for RCU only.
+
+        The map supports ordered range scan (\p scan()) and prefix scan (\p scan_prefix()).
+
+        Template arguments:
+        - \p RCU - one of \ref cds_urcu_gc "RCU type"
+        - \p Key - key type. The key encoder for the type should be available
+        - \p T - value type, it should be copy-constructible for \p ensure()
+        - \p Traits - type traits, see \p art::type_traits for explanation.
+
+        It is possible to declare option-based map with \p art::make_traits metafunction instead of \p Traits template
+        argument. Template argument list \p Options of \p %art::make_traits metafunction are:
+        - \p art::key_encoder - the key encoder. Default is \p art::encoder<Key> that supports integral types and \p std::string.
+        - \p opt::item_counter - the type of item counting feature. Default is \p atomicity::empty_item_counter that is no item counting.
+        - \p opt::back_off - back-off strategy used to wait for a locked node. Default is \p cds::backoff::Default.
+        - \p opt::allocator - the allocator for the nodes and the leaves. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - \p opt::stat - internal statistics. Available types: \p art::stat, \p art::empty_stat (the default)
+        - \p opt::rcu_check_deadlock - a deadlock checking policy. Default is \p opt::v::rcu_throw_deadlock
+
+        The modifying member functions retire the nodes, so they should not be called under RCU lock.
+
+        @note Before including <tt><cds/container/art_map_rcu.h></tt> you should include appropriate RCU header file,
+        see \ref cds_urcu_gc "RCU type" for list of existing RCU class and corresponding header files.
+    */
+    template <
+        class RCU,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = art::type_traits
+#else
+        class Traits
+#endif
+    >
+    class ArtMap< cds::urcu::gc<RCU>, Key, T, Traits >
+    {
+    public:
+        typedef cds::urcu::gc<RCU>  gc          ;   ///< RCU Garbage collector
+        typedef Key                 key_type    ;   ///< type of a key stored in the map
+        typedef T                   mapped_type ;   ///< type of value stored in the map
+        typedef std::pair< key_type const, mapped_type >    value_type  ;   ///< Key-value pair stored in the map
+        typedef Traits              options     ;   ///< Traits template parameter
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_encoder  ;    ///< key encoder based on art::key_encoder option
+#   else
+        typedef typename art::details::make_encoder< key_type, typename options::key_encoder >::type key_encoder;
+#endif
+        typedef typename options::item_counter          item_counter    ;   ///< Item counting policy used
+        typedef typename options::back_off              back_off        ;   ///< Back-off strategy
+        typedef typename options::stat                  stat            ;   ///< internal statistics type
+        typedef typename options::rcu_check_deadlock    rcu_check_deadlock  ; ///< Deadlock checking policy
+        typedef typename gc::scoped_lock                rcu_lock        ;   ///< RCU scoped lock
+
+    protected:
+        //@cond
+        typedef unsigned long long version_type;
+
+        static CDS_CONSTEXPR_CONST version_type c_nObsoleteBit = 1;
+        static CDS_CONSTEXPR_CONST version_type c_nLockBit = 2;
+
+        static CDS_CONSTEXPR_CONST int c_nTerminalSlot = -1;    // the slot of the leaf with the key ended at the node
+        static CDS_CONSTEXPR_CONST int c_nNoSlot = -2;
+
+        static CDS_CONSTEXPR_CONST size_t c_nClearBatch = 64;   // count of keys collected by clear() at once
+
+        enum node_type {
+            leaf_type,
+            node4_type,
+            node16_type,
+            node48_type,
+            node256_type
+        };
+
+        typedef cds::urcu::details::check_deadlock_policy< gc, rcu_check_deadlock>   check_deadlock_policy;
+
+        struct node
+        {
+            unsigned char const m_nType;
+            node *              m_pNextRetired;
+
+            explicit node( unsigned char nType )
+                : m_nType( nType )
+                , m_pNextRetired( nullptr )
+            {}
+
+            bool is_leaf() const
+            {
+                return m_nType == leaf_type;
+            }
+        };
+
+        struct leaf_node: public node
+        {
+            value_type  m_Value;
+
+            template <typename K>
+            explicit leaf_node( K const& key )
+                : node( leaf_type )
+                , m_Value( key_type( key ), mapped_type() )
+            {}
+
+            template <typename K, typename V>
+            leaf_node( K const& key, V const& val )
+                : node( leaf_type )
+                , m_Value( key_type( key ), val )
+            {}
+
+            leaf_node( leaf_node const& src )
+                : node( leaf_type )
+                , m_Value( src.m_Value )
+            {}
+        };
+
+        struct inner_node: public node
+        {
+            atomics::atomic<version_type>   m_nVersion;
+            atomics::atomic<unsigned int>   m_nCount;       // count of children excluding the terminal leaf
+            atomics::atomic<unsigned int>   m_nPrefixLen;   // the prefix may be shortened by the path split
+            unsigned int const              m_nPrefixCapacity;
+            unsigned char *                 m_pPrefix;      // the prefix is allocated after the node
+            leaf_node *                     m_pTerminal;
+
+            inner_node( unsigned char nType, unsigned int nPrefixLen )
+                : node( nType )
+                , m_nVersion( 0 )
+                , m_nCount( 0 )
+                , m_nPrefixLen( nPrefixLen )
+                , m_nPrefixCapacity( nPrefixLen )
+                , m_pPrefix( nullptr )
+                , m_pTerminal( nullptr )
+            {}
+
+            size_t count() const
+            {
+                return m_nCount.load( atomics::memory_order_relaxed );
+            }
+
+            void count( size_t n )
+            {
+                m_nCount.store( static_cast<unsigned int>( n ), atomics::memory_order_relaxed );
+            }
+
+            size_t prefix_len() const
+            {
+                return m_nPrefixLen.load( atomics::memory_order_relaxed );
+            }
+
+            void prefix_len( size_t n )
+            {
+                m_nPrefixLen.store( static_cast<unsigned int>( n ), atomics::memory_order_relaxed );
+            }
+        };
+
+        struct node4: public inner_node
+        {
+            unsigned char   m_Keys[4];
+            node *          m_Children[4];
+
+            explicit node4( unsigned int nPrefixLen )
+                : inner_node( node4_type, nPrefixLen )
+            {}
+        };
+
+        struct node16: public inner_node
+        {
+            unsigned char   m_Keys[16];
+            node *          m_Children[16];
+
+            explicit node16( unsigned int nPrefixLen )
+                : inner_node( node16_type, nPrefixLen )
+            {}
+        };
+
+        struct node48: public inner_node
+        {
+            unsigned char   m_Index[256];   // 0 - no child, otherwise the index of the child plus 1
+            node *          m_Children[48];
+
+            explicit node48( unsigned int nPrefixLen )
+                : inner_node( node48_type, nPrefixLen )
+            {
+                memset( m_Index, 0, sizeof( m_Index ));
+                for ( size_t i = 0; i < 48; ++i )
+                    m_Children[i] = nullptr;
+            }
+        };
+
+        struct node256: public inner_node
+        {
+            node *          m_Children[256];
+
+            explicit node256( unsigned int nPrefixLen )
+                : inner_node( node256_type, nPrefixLen )
+            {
+                for ( size_t i = 0; i < 256; ++i )
+                    m_Children[i] = nullptr;
+            }
+        };
+
+        typedef typename options::allocator::template rebind<leaf_node>::other  leaf_allocator_type;
+        typedef cds::details::Allocator< leaf_node, leaf_allocator_type >       cxx_leaf_allocator;
+        typedef typename options::allocator::template rebind<char>::other       node_allocator_type; // inner node with the prefix
+
+        // The list of the nodes to retire after RCU unlock
+        struct retired_list
+        {
+            node * m_pHead;
+
+            retired_list()
+                : m_pHead( nullptr )
+            {}
+
+            void push( node * p )
+            {
+                p->m_pNextRetired = m_pHead;
+                m_pHead = p;
+            }
+
+            ~retired_list()
+            {
+                assert( !gc::is_locked() );
+                while ( m_pHead ) {
+                    node * p = m_pHead;
+                    m_pHead = p->m_pNextRetired;
+                    gc::retire_ptr( p, free_node );
+                }
+            }
+        };
+
+        enum update_result {
+            update_restart,
+            update_inserted,
+            update_updated,
+            update_exists
+        };
+
+        enum erase_result {
+            erase_restart,
+            erase_not_found,
+            erase_success
+        };
+
+        enum scan_action {
+            scan_continue,
+            scan_skip,      // skip the subtree
+            scan_stop       // stop the scan
+        };
+
+        struct scan_bounds {
+            key_encoder const * pLower;     // inclusive lower bound, nullptr - no lower bound
+            key_encoder const * pUpper;     // nullptr - no upper bound
+            bool                bPrefix;    // true - pUpper is the prefix of the keys, false - pUpper is exclusive upper bound
+            size_t              nLimit;
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        inner_node * const  m_pRoot;    // the root is never replaced
+        item_counter        m_ItemCounter;
+        mutable stat        m_Stat;
+        //@endcond
+
+    public:
+        /// Default ctor creates empty map
+        ArtMap()
+            : m_pRoot( alloc_node( node256_type, 0 ))
+        {}
+
+        /// Destroys the map
+        /**
+            The destructor is not thread-safe, it frees all nodes immediately.
+        */
+        ~ArtMap()
+        {
+            destroy( m_pRoot );
+        }
+
+        /// Inserts new item with key \p key and default value
+        /**
+            The function creates an item with key \p key and default value, and then inserts the item into the map.
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            return do_update( cxx_leaf_allocator().New( key ), []( bool, value_type& ) {}, false ).first;
+        }
+
+        /// Inserts new item
+        /**
+            The function creates an item with key \p key and value \p val, and then inserts the item into the map.
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            return do_update( cxx_leaf_allocator().New( key, val ), []( bool, value_type& ) {}, false ).first;
+        }
+
+        /// Inserts new item and initializes its value by the functor
+        /**
+            The function creates an item with key \p key and default value, calls the functor \p func
+            to initialize the value, and then inserts the item into the map.
+            The functor interface is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor is called under the node lock, it should be short.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool insert_key( K const& key, Func func )
+        {
+            return do_update( cxx_leaf_allocator().New( key ), [&func]( bool, value_type& item ) { func( item ); }, false ).first;
+        }
+
+        /// Ensures that the \p key exists in the map
+        /**
+            The operation performs inserting or changing data.
+
+            If the \p key not found in the map, then the new item created from \p key
+            is inserted into the map. Otherwise, the functor \p func is called with the item found.
+            The functor interface is:
+            \code
+            struct functor {
+                void operator()( bool bNew, value_type& item );
+            };
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - the item of the map
+
+            If the key exists, the functor is called for the copy of the item, then the copy replaces the item in the map
+            atomically; so the concurrent reader gets either old or new item.
+            The functor is called under the node lock, it should be short.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successful,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already is in the map.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> ensure( K const& key, Func func )
+        {
+            return do_update( cxx_leaf_allocator().New( key ), func, true );
+        }
+
+        /// Delete \p key from the map
+        /**
+            Return \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return do_erase( key, []( value_type& ) {} );
+        }
+
+        /// Delete \p key from the map
+        /**
+            The function searches an item with key \p key, deletes it from the map and calls \p f functor with the item.
+            If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()( value_type& item );
+            };
+            \endcode
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            return do_erase( key, f );
+        }
+
+        /// Find the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor \p f for the item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type const& item );
+            };
+            \endcode
+            The item cannot be changed, use \p ensure() for that.
+
+            The function applies RCU lock internally.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f ) const
+        {
+            return do_find( key, f );
+        }
+
+        /// Find the key \p key
+        /**
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K>
+        bool find( K const& key ) const
+        {
+            auto f = []( value_type const& ) {};
+            return do_find( key, f );
+        }
+
+        /// Range scan
+        /**
+            The function calls \p f for each item with the key in the range <tt>[from, to)</tt> in ascending order of the keys.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type const& item );
+            };
+            \endcode
+            The scan is not a snapshot: the items inserted or deleted concurrently may be reported or not,
+            but each item is reported once.
+
+            The function applies RCU lock internally; the functor is called under RCU lock,
+            so it cannot modify the map.
+
+            Returns the count of items reported.
+        */
+        template <typename K1, typename K2, typename Func>
+        size_t scan( K1 const& from, K2 const& to, Func f ) const
+        {
+            key_encoder encFrom( from );
+            key_encoder encTo( to );
+            m_Stat.onScan();
+            return do_scan( &encFrom, &encTo, false, ~size_t(0), f );
+        }
+
+        /// Scans up to \p nCount items starting from \p from
+        /**
+            The function is similar to \ref scan( K1 const&, K2 const&, Func ) const "scan()"
+            but it reports up to \p nCount items with the key not less than \p from.
+        */
+        template <typename K, typename Func>
+        size_t scan_n( K const& from, size_t nCount, Func f ) const
+        {
+            key_encoder encFrom( from );
+            m_Stat.onScan();
+            return do_scan( &encFrom, nullptr, false, nCount, f );
+        }
+
+        /// Prefix scan
+        /**
+            The function calls \p f for each item which encoded key starts with encoded \p prefix
+            in ascending order of the keys. For \p std::string key, it is the items with the key
+            starting with \p prefix.
+
+            The function is similar to \ref scan( K1 const&, K2 const&, Func ) const "scan()".
+        */
+        template <typename K, typename Func>
+        size_t scan_prefix( K const& prefix, Func f ) const
+        {
+            key_encoder encPrefix( prefix );
+            m_Stat.onScan();
+            return do_scan( &encPrefix, &encPrefix, true, ~size_t(0), f );
+        }
+
+        /// Clears the map
+        /**
+            The function deletes the items in ascending order of the keys by small portions.
+            It is not atomic: the items inserted concurrently may stay in the map.
+        */
+        void clear()
+        {
+            std::vector<key_type> arrKeys;
+            arrKeys.reserve( c_nClearBatch );
+            auto f = [&arrKeys]( value_type const& item ) { arrKeys.push_back( item.first ); };
+            for (;;) {
+                arrKeys.clear();
+                do_scan( nullptr, nullptr, false, c_nClearBatch, f );
+                if ( arrKeys.empty() )
+                    break;
+                for ( typename std::vector<key_type>::const_iterator it = arrKeys.begin(); it != arrKeys.end(); ++it )
+                    erase( *it );
+            }
+        }
+
+        /// Checks if the map is empty
+        bool empty() const
+        {
+            auto f = []( value_type const& ) {};
+            return do_scan( nullptr, nullptr, false, 1, f ) == 0;
+        }
+
+        /// Returns item count in the map
+        /**
+            The value returned depends on item counter type provided by \p Traits template parameter.
+            If it is \p atomicity::empty_item_counter this function always returns 0.
+            Therefore, the function is not suitable for checking the tree emptiness, use \p empty()
+            member function for this purpose.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+        /// Checks internal consistency (not atomic, not thread-safe)
+        /**
+            The debugging function to check internal consistency of the tree:
+            each leaf key starts with the path to the leaf, the node layouts are correct,
+            each inner node except the root has two entries at least.
+        */
+        bool check_consistency() const
+        {
+            std::vector<unsigned char> path;
+            return check_node( m_pRoot, path );
+        }
+
+    protected:
+        //@cond
+
+        // Memory management
+
+        static inner_node * alloc_node( unsigned char nType, size_t nPrefixLen )
+        {
+            switch ( nType ) {
+            case node4_type:
+                return alloc_node_of< node4 >( nPrefixLen );
+            case node16_type:
+                return alloc_node_of< node16 >( nPrefixLen );
+            case node48_type:
+                return alloc_node_of< node48 >( nPrefixLen );
+            default:
+                assert( nType == node256_type );
+                return alloc_node_of< node256 >( nPrefixLen );
+            }
+        }
+
+        template <class Node>
+        static Node * alloc_node_of( size_t nPrefixLen )
+        {
+            char * pMem = node_allocator_type().allocate( sizeof(Node) + nPrefixLen );
+            Node * p = new ( pMem ) Node( static_cast<unsigned int>( nPrefixLen ));
+            p->m_pPrefix = reinterpret_cast<unsigned char *>( pMem + sizeof(Node) );
+            return p;
+        }
+
+        template <class Node>
+        static void free_node_of( Node * p )
+        {
+            size_t const nSize = sizeof(Node) + p->m_nPrefixCapacity;
+            p->~Node();
+            node_allocator_type().deallocate( reinterpret_cast<char *>( p ), nSize );
+        }
+
+        static void free_node( node * p )
+        {
+            switch ( p->m_nType ) {
+            case leaf_type:
+                cxx_leaf_allocator().Delete( static_cast<leaf_node *>( p ));
+                break;
+            case node4_type:
+                free_node_of( static_cast<node4 *>( p ));
+                break;
+            case node16_type:
+                free_node_of( static_cast<node16 *>( p ));
+                break;
+            case node48_type:
+                free_node_of( static_cast<node48 *>( p ));
+                break;
+            default:
+                assert( p->m_nType == node256_type );
+                free_node_of( static_cast<node256 *>( p ));
+            }
+        }
+
+        static void destroy( node * p )
+        {
+            if ( !p->is_leaf() ) {
+                inner_node * pInner = static_cast<inner_node *>( p );
+                if ( pInner->m_pTerminal )
+                    destroy( pInner->m_pTerminal );
+                for_each_child( pInner, []( unsigned char, node * pChild ) { destroy( pChild ); } );
+            }
+            free_node( p );
+        }
+
+        // Version protocol
+
+        static version_type read_lock( inner_node * p, bool& bRestart )
+        {
+            version_type v = p->m_nVersion.load( atomics::memory_order_acquire );
+            if ( v & c_nLockBit ) {
+                back_off bkoff;
+                do {
+                    bkoff();
+                    v = p->m_nVersion.load( atomics::memory_order_acquire );
+                } while ( v & c_nLockBit );
+            }
+            if ( v & c_nObsoleteBit )
+                bRestart = true;
+            return v;
+        }
+
+        static bool validate( inner_node * p, version_type v )
+        {
+            // The content of the node read before the fence is consistent if the version is not changed
+            atomics::atomic_thread_fence( atomics::memory_order_acquire );
+            return p->m_nVersion.load( atomics::memory_order_relaxed ) == v;
+        }
+
+        static bool upgrade_lock( inner_node * p, version_type v )
+        {
+            return p->m_nVersion.compare_exchange_strong( v, v + c_nLockBit, atomics::memory_order_acquire, atomics::memory_order_relaxed );
+        }
+
+        static void write_lock( inner_node * p )
+        {
+            for (;;) {
+                bool bRestart = false;
+                version_type v = read_lock( p, bRestart );
+                // The caller holds the lock of the parent, so the node cannot become obsolete
+                assert( !bRestart );
+                if ( upgrade_lock( p, v ))
+                    return;
+            }
+        }
+
+        static void write_unlock( inner_node * p )
+        {
+            p->m_nVersion.fetch_add( c_nLockBit, atomics::memory_order_release );
+        }
+
+        static void write_unlock_obsolete( inner_node * p )
+        {
+            p->m_nVersion.fetch_add( c_nLockBit | c_nObsoleteBit, atomics::memory_order_release );
+        }
+
+        // Node layouts
+
+        static size_t capacity( unsigned char nType )
+        {
+            switch ( nType ) {
+            case node4_type:
+                return 4;
+            case node16_type:
+                return 16;
+            case node48_type:
+                return 48;
+            default:
+                return 256;
+            }
+        }
+
+        // The node is replaced by the smaller one if the count of children is not greater than the threshold
+        static size_t shrink_threshold( unsigned char nType )
+        {
+            switch ( nType ) {
+            case node16_type:
+                return 3;
+            case node48_type:
+                return 12;
+            case node256_type:
+                return 37;
+            default:
+                return 0;
+            }
+        }
+
+        static int find_key16( node16 const * p, unsigned char nByte )
+        {
+            size_t const nCount = p->count();
+#ifdef CDS_ART_NODE16_SSE2
+            __m128i const cmp = _mm_cmpeq_epi8( _mm_set1_epi8( static_cast<char>( nByte )),
+                _mm_loadu_si128( reinterpret_cast<__m128i const *>( p->m_Keys )));
+            unsigned int const nMask = static_cast<unsigned int>( _mm_movemask_epi8( cmp )) & (( 1u << nCount ) - 1 );
+            return nMask ? cds::bitop::LSBnz( nMask ) : -1;
+#else
+            for ( size_t i = 0; i < nCount; ++i ) {
+                if ( p->m_Keys[i] == nByte )
+                    return static_cast<int>( i );
+            }
+            return -1;
+#endif
+        }
+
+        static int find_key4( node4 const * p, unsigned char nByte )
+        {
+            size_t const nCount = p->count();
+            for ( size_t i = 0; i < nCount; ++i ) {
+                if ( p->m_Keys[i] == nByte )
+                    return static_cast<int>( i );
+            }
+            return -1;
+        }
+
+        static node * get_child( inner_node * p, int nSlot )
+        {
+            if ( nSlot == c_nTerminalSlot )
+                return p->m_pTerminal;
+
+            unsigned char const nByte = static_cast<unsigned char>( nSlot );
+            switch ( p->m_nType ) {
+            case node4_type:
+                {
+                    node4 * pn = static_cast<node4 *>( p );
+                    int nIdx = find_key4( pn, nByte );
+                    return nIdx >= 0 ? pn->m_Children[nIdx] : nullptr;
+                }
+            case node16_type:
+                {
+                    node16 * pn = static_cast<node16 *>( p );
+                    int nIdx = find_key16( pn, nByte );
+                    return nIdx >= 0 ? pn->m_Children[nIdx] : nullptr;
+                }
+            case node48_type:
+                {
+                    node48 * pn = static_cast<node48 *>( p );
+                    unsigned int nIdx = pn->m_Index[nByte];
+                    return nIdx ? pn->m_Children[nIdx - 1] : nullptr;
+                }
+            default:
+                assert( p->m_nType == node256_type );
+                return static_cast<node256 *>( p )->m_Children[nByte];
+            }
+        }
+
+        // Replaces existing child
+        static void replace_child( inner_node * p, int nSlot, node * pChild )
+        {
+            if ( nSlot == c_nTerminalSlot ) {
+                assert( pChild->is_leaf() );
+                p->m_pTerminal = static_cast<leaf_node *>( pChild );
+                return;
+            }
+
+            unsigned char const nByte = static_cast<unsigned char>( nSlot );
+            switch ( p->m_nType ) {
+            case node4_type:
+                {
+                    node4 * pn = static_cast<node4 *>( p );
+                    int nIdx = find_key4( pn, nByte );
+                    assert( nIdx >= 0 );
+                    pn->m_Children[nIdx] = pChild;
+                }
+                break;
+            case node16_type:
+                {
+                    node16 * pn = static_cast<node16 *>( p );
+                    int nIdx = find_key16( pn, nByte );
+                    assert( nIdx >= 0 );
+                    pn->m_Children[nIdx] = pChild;
+                }
+                break;
+            case node48_type:
+                {
+                    node48 * pn = static_cast<node48 *>( p );
+                    assert( pn->m_Index[nByte] != 0 );
+                    pn->m_Children[pn->m_Index[nByte] - 1] = pChild;
+                }
+                break;
+            default:
+                assert( p->m_nType == node256_type );
+                static_cast<node256 *>( p )->m_Children[nByte] = pChild;
+            }
+        }
+
+        template <class Node>
+        static void insert_sorted( Node * pn, unsigned char nByte, node * pChild )
+        {
+            size_t const nCount = pn->count();
+            size_t nPos = 0;
+            while ( nPos < nCount && pn->m_Keys[nPos] < nByte )
+                ++nPos;
+            for ( size_t i = nCount; i > nPos; --i ) {
+                pn->m_Keys[i] = pn->m_Keys[i - 1];
+                pn->m_Children[i] = pn->m_Children[i - 1];
+            }
+            pn->m_Keys[nPos] = nByte;
+            pn->m_Children[nPos] = pChild;
+        }
+
+        template <class Node>
+        static void remove_sorted( Node * pn, int nIdx )
+        {
+            size_t const nCount = pn->count();
+            assert( nIdx >= 0 );
+            for ( size_t i = static_cast<size_t>( nIdx ) + 1; i < nCount; ++i ) {
+                pn->m_Keys[i - 1] = pn->m_Keys[i];
+                pn->m_Children[i - 1] = pn->m_Children[i];
+            }
+        }
+
+        // Adds new child, the node should not be full
+        static void add_child( inner_node * p, int nSlot, node * pChild )
+        {
+            if ( nSlot == c_nTerminalSlot ) {
+                assert( pChild->is_leaf() );
+                assert( p->m_pTerminal == nullptr );
+                p->m_pTerminal = static_cast<leaf_node *>( pChild );
+                return;
+            }
+
+            unsigned char const nByte = static_cast<unsigned char>( nSlot );
+            assert( p->count() < capacity( p->m_nType ));
+            switch ( p->m_nType ) {
+            case node4_type:
+                insert_sorted( static_cast<node4 *>( p ), nByte, pChild );
+                break;
+            case node16_type:
+                insert_sorted( static_cast<node16 *>( p ), nByte, pChild );
+                break;
+            case node48_type:
+                {
+                    node48 * pn = static_cast<node48 *>( p );
+                    size_t nIdx = 0;
+                    while ( pn->m_Children[nIdx] )
+                        ++nIdx;
+                    assert( nIdx < 48 );
+                    pn->m_Children[nIdx] = pChild;
+                    pn->m_Index[nByte] = static_cast<unsigned char>( nIdx + 1 );
+                }
+                break;
+            default:
+                assert( p->m_nType == node256_type );
+                static_cast<node256 *>( p )->m_Children[nByte] = pChild;
+            }
+            p->count( p->count() + 1 );
+        }
+
+        static void remove_child( inner_node * p, int nSlot )
+        {
+            if ( nSlot == c_nTerminalSlot ) {
+                p->m_pTerminal = nullptr;
+                return;
+            }
+
+            unsigned char const nByte = static_cast<unsigned char>( nSlot );
+            switch ( p->m_nType ) {
+            case node4_type:
+                remove_sorted( static_cast<node4 *>( p ), find_key4( static_cast<node4 *>( p ), nByte ));
+                break;
+            case node16_type:
+                remove_sorted( static_cast<node16 *>( p ), find_key16( static_cast<node16 *>( p ), nByte ));
+                break;
+            case node48_type:
+                {
+                    node48 * pn = static_cast<node48 *>( p );
+                    assert( pn->m_Index[nByte] != 0 );
+                    pn->m_Children[pn->m_Index[nByte] - 1] = nullptr;
+                    pn->m_Index[nByte] = 0;
+                }
+                break;
+            default:
+                assert( p->m_nType == node256_type );
+                static_cast<node256 *>( p )->m_Children[nByte] = nullptr;
+            }
+            p->count( p->count() - 1 );
+        }
+
+        // Calls f( unsigned char nByte, node * pChild ) for each child in ascending order of the key bytes
+        template <typename Func>
+        static void for_each_child( inner_node * p, Func f )
+        {
+            switch ( p->m_nType ) {
+            case node4_type:
+                {
+                    node4 * pn = static_cast<node4 *>( p );
+                    size_t const nCount = pn->count();
+                    for ( size_t i = 0; i < nCount; ++i )
+                        f( pn->m_Keys[i], pn->m_Children[i] );
+                }
+                break;
+            case node16_type:
+                {
+                    node16 * pn = static_cast<node16 *>( p );
+                    size_t const nCount = pn->count();
+                    for ( size_t i = 0; i < nCount; ++i )
+                        f( pn->m_Keys[i], pn->m_Children[i] );
+                }
+                break;
+            case node48_type:
+                {
+                    node48 * pn = static_cast<node48 *>( p );
+                    for ( unsigned int i = 0; i < 256; ++i ) {
+                        unsigned int nIdx = pn->m_Index[i];
+                        if ( nIdx )
+                            f( static_cast<unsigned char>( i ), pn->m_Children[nIdx - 1] );
+                    }
+                }
+                break;
+            default:
+                {
+                    assert( p->m_nType == node256_type );
+                    node256 * pn = static_cast<node256 *>( p );
+                    for ( unsigned int i = 0; i < 256; ++i ) {
+                        if ( pn->m_Children[i] )
+                            f( static_cast<unsigned char>( i ), pn->m_Children[i] );
+                    }
+                }
+            }
+        }
+
+        // Copies the children of pSrc except nSkipSlot to pDest
+        static void copy_children( inner_node * pSrc, inner_node * pDest, int nSkipSlot )
+        {
+            if ( pSrc->m_pTerminal && nSkipSlot != c_nTerminalSlot )
+                pDest->m_pTerminal = pSrc->m_pTerminal;
+            for_each_child( pSrc, [pDest, nSkipSlot]( unsigned char nByte, node * pChild ) {
+                if ( static_cast<int>( nByte ) != nSkipSlot )
+                    add_child( pDest, nByte, pChild );
+            });
+        }
+
+        // Keys
+
+        template <typename Enc1, typename Enc2>
+        static int compare_keys( Enc1 const& e1, Enc2 const& e2 )
+        {
+            size_t const nLen1 = e1.size();
+            size_t const nLen2 = e2.size();
+            size_t const nLen = nLen1 < nLen2 ? nLen1 : nLen2;
+            for ( size_t i = 0; i < nLen; ++i ) {
+                if ( e1[i] != e2[i] )
+                    return e1[i] < e2[i] ? -1 : 1;
+            }
+            return nLen1 < nLen2 ? -1 : ( nLen1 > nLen2 ? 1 : 0 );
+        }
+
+        template <typename Enc1, typename Enc2>
+        static bool starts_with( Enc1 const& e, Enc2 const& prefix )
+        {
+            size_t const nLen = prefix.size();
+            if ( e.size() < nLen )
+                return false;
+            for ( size_t i = 0; i < nLen; ++i ) {
+                if ( e[i] != prefix[i] )
+                    return false;
+            }
+            return true;
+        }
+
+        // Returns the position of the first mismatch between the node prefix and the key starting from nDepth,
+        // or the prefix length if the prefix matches
+        template <typename Enc>
+        static size_t check_prefix( inner_node const * p, Enc const& enc, size_t nDepth, size_t& nPrefixLen )
+        {
+            nPrefixLen = p->prefix_len();
+            size_t const nKeyLen = enc.size();
+            size_t i = 0;
+            for ( ; i < nPrefixLen; ++i ) {
+                if ( nDepth + i >= nKeyLen || p->m_pPrefix[i] != enc[nDepth + i] )
+                    break;
+            }
+            return i;
+        }
+
+        template <typename Enc>
+        static int key_slot( Enc const& enc, size_t nDepth )
+        {
+            return nDepth < enc.size() ? static_cast<int>( enc[nDepth] ) : c_nTerminalSlot;
+        }
+
+        // Find
+
+        // Searches the leaf which may contain the key. Returns false if the search should be restarted
+        template <typename Enc>
+        bool find_leaf( Enc const& enc, leaf_node *& pLeaf ) const
+        {
+            assert( gc::is_locked() );
+
+            bool bRestart = false;
+            inner_node * pNode = m_pRoot;
+            version_type v = read_lock( pNode, bRestart );
+            size_t nDepth = 0;
+
+            pLeaf = nullptr;
+            for (;;) {
+                size_t nPrefixLen;
+                if ( check_prefix( pNode, enc, nDepth, nPrefixLen ) != nPrefixLen )
+                    return validate( pNode, v );
+                nDepth += nPrefixLen;
+
+                node * pChild = get_child( pNode, key_slot( enc, nDepth ));
+                if ( !validate( pNode, v ))
+                    return false;
+                if ( !pChild )
+                    return true;
+                if ( pChild->is_leaf() ) {
+                    // The leaf is immutable, it is protected by RCU
+                    pLeaf = static_cast<leaf_node *>( pChild );
+                    return true;
+                }
+
+                inner_node * pInner = static_cast<inner_node *>( pChild );
+                version_type vChild = read_lock( pInner, bRestart );
+                if ( bRestart || !validate( pNode, v ))
+                    return false;
+                pNode = pInner;
+                v = vChild;
+                ++nDepth;
+            }
+        }
+
+        template <typename K, typename Func>
+        bool do_find( K const& key, Func& f ) const
+        {
+            key_encoder enc( key );
+            rcu_lock l;
+            for (;;) {
+                leaf_node * pLeaf;
+                if ( find_leaf( enc, pLeaf )) {
+                    if ( pLeaf && compare_keys( key_encoder( pLeaf->m_Value.first ), enc ) == 0 ) {
+                        f( pLeaf->m_Value );
+                        m_Stat.onFindSuccess();
+                        return true;
+                    }
+                    m_Stat.onFindFailed();
+                    return false;
+                }
+                m_Stat.onRestart();
+            }
+        }
+
+        // Insert
+
+        template <typename Func>
+        std::pair<bool, bool> do_update( leaf_node * pNew, Func f, bool bAllowUpdate )
+        {
+            check_deadlock_policy::check();
+
+            key_encoder enc( pNew->m_Value.first );
+            retired_list retired;
+            update_result res;
+            {
+                rcu_lock l;
+                while (( res = try_update( enc, pNew, f, bAllowUpdate, retired )) == update_restart )
+                    m_Stat.onRestart();
+            }
+
+            switch ( res ) {
+            case update_inserted:
+                ++m_ItemCounter;
+                if ( bAllowUpdate )
+                    m_Stat.onEnsureNew();
+                else
+                    m_Stat.onInsertSuccess();
+                return std::make_pair( true, true );
+            case update_updated:
+                cxx_leaf_allocator().Delete( pNew );
+                m_Stat.onEnsureExist();
+                return std::make_pair( true, false );
+            default:
+                assert( res == update_exists );
+                cxx_leaf_allocator().Delete( pNew );
+                m_Stat.onInsertFailed();
+                return std::make_pair( false, false );
+            }
+        }
+
+        template <typename Func>
+        update_result try_update( key_encoder const& enc, leaf_node * pNew, Func& f, bool bAllowUpdate, retired_list& retired )
+        {
+            size_t const nKeyLen = enc.size();
+            bool bRestart = false;
+
+            inner_node * pParent = nullptr;
+            version_type vParent = 0;
+            int nParentSlot = 0;
+
+            inner_node * pNode = m_pRoot;
+            version_type v = read_lock( pNode, bRestart );
+            size_t nDepth = 0;
+
+            for (;;) {
+                size_t nPrefixLen;
+                size_t const nMatch = check_prefix( pNode, enc, nDepth, nPrefixLen );
+                if ( nMatch != nPrefixLen ) {
+                    // The key diverges in the compressed path: the new node with the common part of the path
+                    // is inserted above pNode, and the prefix of pNode is shortened
+                    assert( pParent );
+                    if ( !upgrade_lock( pParent, vParent ))
+                        return update_restart;
+                    if ( !upgrade_lock( pNode, v )) {
+                        write_unlock( pParent );
+                        return update_restart;
+                    }
+
+                    inner_node * pSplit = alloc_node( node4_type, nMatch );
+                    memcpy( pSplit->m_pPrefix, pNode->m_pPrefix, nMatch );
+                    add_child( pSplit, pNode->m_pPrefix[nMatch], pNode );
+                    f( true, pNew->m_Value );
+                    add_child( pSplit, key_slot( enc, nDepth + nMatch ), pNew );
+
+                    size_t const nRest = nPrefixLen - nMatch - 1;
+                    memmove( pNode->m_pPrefix, pNode->m_pPrefix + nMatch + 1, nRest );
+                    pNode->prefix_len( nRest );
+
+                    replace_child( pParent, nParentSlot, pSplit );
+                    write_unlock( pNode );
+                    write_unlock( pParent );
+                    m_Stat.onPrefixSplit();
+                    return update_inserted;
+                }
+                nDepth += nPrefixLen;
+
+                int const nSlot = key_slot( enc, nDepth );
+                node * pChild = get_child( pNode, nSlot );
+                if ( !validate( pNode, v ))
+                    return update_restart;
+
+                if ( !pChild ) {
+                    if ( nSlot != c_nTerminalSlot && pNode->count() == capacity( pNode->m_nType )) {
+                        // The node is full: it is replaced by the larger node
+                        assert( pParent );
+                        if ( !upgrade_lock( pParent, vParent ))
+                            return update_restart;
+                        if ( !upgrade_lock( pNode, v )) {
+                            write_unlock( pParent );
+                            return update_restart;
+                        }
+
+                        inner_node * pLarge = alloc_node( pNode->m_nType + 1, nPrefixLen );
+                        memcpy( pLarge->m_pPrefix, pNode->m_pPrefix, nPrefixLen );
+                        copy_children( pNode, pLarge, c_nNoSlot );
+                        f( true, pNew->m_Value );
+                        add_child( pLarge, nSlot, pNew );
+
+                        replace_child( pParent, nParentSlot, pLarge );
+                        write_unlock_obsolete( pNode );
+                        write_unlock( pParent );
+                        retired.push( pNode );
+                        m_Stat.onNodeGrow();
+                        return update_inserted;
+                    }
+
+                    if ( !upgrade_lock( pNode, v ))
+                        return update_restart;
+                    f( true, pNew->m_Value );
+                    add_child( pNode, nSlot, pNew );
+                    write_unlock( pNode );
+                    return update_inserted;
+                }
+
+                if ( pChild->is_leaf() ) {
+                    leaf_node * pLeaf = static_cast<leaf_node *>( pChild );
+                    key_encoder encLeaf( pLeaf->m_Value.first );
+                    if ( compare_keys( encLeaf, enc ) == 0 ) {
+                        if ( !bAllowUpdate )
+                            return update_exists;
+
+                        // The leaf is immutable: the updated copy replaces it
+                        leaf_node * pCopy = cxx_leaf_allocator().New( *pLeaf );
+                        if ( !upgrade_lock( pNode, v )) {
+                            cxx_leaf_allocator().Delete( pCopy );
+                            return update_restart;
+                        }
+                        f( false, pCopy->m_Value );
+                        replace_child( pNode, nSlot, pCopy );
+                        write_unlock( pNode );
+                        retired.push( pLeaf );
+                        return update_updated;
+                    }
+
+                    // The leaf is replaced by the new node with two leaves.
+                    // The keys are equal up to nDepth inclusive, the terminal leaf cannot differ
+                    assert( nSlot != c_nTerminalSlot );
+                    size_t const nStart = nDepth + 1;
+                    size_t const nLeafLen = encLeaf.size();
+                    size_t nPos = nStart;
+                    while ( nPos < nKeyLen && nPos < nLeafLen && enc[nPos] == encLeaf[nPos] )
+                        ++nPos;
+
+                    inner_node * pSplit = alloc_node( node4_type, nPos - nStart );
+                    for ( size_t i = nStart; i < nPos; ++i )
+                        pSplit->m_pPrefix[i - nStart] = enc[i];
+                    add_child( pSplit, key_slot( encLeaf, nPos ), pLeaf );
+
+                    if ( !upgrade_lock( pNode, v )) {
+                        free_node( pSplit );
+                        return update_restart;
+                    }
+                    f( true, pNew->m_Value );
+                    add_child( pSplit, key_slot( enc, nPos ), pNew );
+                    replace_child( pNode, nSlot, pSplit );
+                    write_unlock( pNode );
+                    m_Stat.onLeafSplit();
+                    return update_inserted;
+                }
+
+                inner_node * pInner = static_cast<inner_node *>( pChild );
+                version_type vChild = read_lock( pInner, bRestart );
+                if ( bRestart || !validate( pNode, v ))
+                    return update_restart;
+
+                pParent = pNode;
+                vParent = v;
+                nParentSlot = nSlot;
+                pNode = pInner;
+                v = vChild;
+                ++nDepth;
+            }
+        }
+
+        // Erase
+
+        template <typename K, typename Func>
+        bool do_erase( K const& key, Func f )
+        {
+            check_deadlock_policy::check();
+
+            key_encoder enc( key );
+            retired_list retired;
+            leaf_node * pLeaf = nullptr;
+            erase_result res;
+            {
+                rcu_lock l;
+                while (( res = try_erase( enc, pLeaf, retired )) == erase_restart )
+                    m_Stat.onRestart();
+
+                if ( res == erase_success ) {
+                    // The leaf is unlinked but it is not reclaimed until RCU unlock
+                    f( pLeaf->m_Value );
+                    retired.push( pLeaf );
+                }
+            }
+
+            if ( res == erase_success ) {
+                --m_ItemCounter;
+                m_Stat.onEraseSuccess();
+                return true;
+            }
+            m_Stat.onEraseFailed();
+            return false;
+        }
+
+        erase_result try_erase( key_encoder const& enc, leaf_node *& pLeaf, retired_list& retired )
+        {
+            bool bRestart = false;
+
+            inner_node * pParent = nullptr;
+            version_type vParent = 0;
+            int nParentSlot = 0;
+
+            inner_node * pNode = m_pRoot;
+            version_type v = read_lock( pNode, bRestart );
+            size_t nDepth = 0;
+
+            for (;;) {
+                size_t nPrefixLen;
+                if ( check_prefix( pNode, enc, nDepth, nPrefixLen ) != nPrefixLen )
+                    return validate( pNode, v ) ? erase_not_found : erase_restart;
+                nDepth += nPrefixLen;
+
+                int const nSlot = key_slot( enc, nDepth );
+                node * pChild = get_child( pNode, nSlot );
+                if ( !validate( pNode, v ))
+                    return erase_restart;
+                if ( !pChild )
+                    return erase_not_found;
+
+                if ( !pChild->is_leaf() ) {
+                    inner_node * pInner = static_cast<inner_node *>( pChild );
+                    version_type vChild = read_lock( pInner, bRestart );
+                    if ( bRestart || !validate( pNode, v ))
+                        return erase_restart;
+
+                    pParent = pNode;
+                    vParent = v;
+                    nParentSlot = nSlot;
+                    pNode = pInner;
+                    v = vChild;
+                    ++nDepth;
+                    continue;
+                }
+
+                pLeaf = static_cast<leaf_node *>( pChild );
+                if ( compare_keys( key_encoder( pLeaf->m_Value.first ), enc ) != 0 )
+                    return erase_not_found;
+
+                size_t const nCount = pNode->count();
+                if ( pParent && nCount + ( pNode->m_pTerminal ? 1 : 0 ) == 2 ) {
+                    // Only one entry remains in the node: the node is removed from the path
+                    node * pRest = nullptr;
+                    int nRestSlot = c_nNoSlot;
+                    if ( nSlot != c_nTerminalSlot && pNode->m_pTerminal ) {
+                        pRest = pNode->m_pTerminal;
+                        nRestSlot = c_nTerminalSlot;
+                    }
+                    else {
+                        for_each_child( pNode, [nSlot, &pRest, &nRestSlot]( unsigned char nByte, node * p ) {
+                            if ( static_cast<int>( nByte ) != nSlot ) {
+                                pRest = p;
+                                nRestSlot = nByte;
+                            }
+                        });
+                    }
+                    if ( !validate( pNode, v ))
+                        return erase_restart;
+                    assert( pRest );
+
+                    if ( !upgrade_lock( pParent, vParent ))
+                        return erase_restart;
+                    if ( !upgrade_lock( pNode, v )) {
+                        write_unlock( pParent );
+                        return erase_restart;
+                    }
+
+                    if ( pRest->is_leaf() ) {
+                        // The leaf may be placed at any level of its path
+                        replace_child( pParent, nParentSlot, pRest );
+                    }
+                    else {
+                        // The prefix of the child is concatenated with the prefix of pNode
+                        assert( nRestSlot != c_nTerminalSlot );
+                        inner_node * pRestNode = static_cast<inner_node *>( pRest );
+                        write_lock( pRestNode );
+
+                        size_t const nRestPrefixLen = pRestNode->prefix_len();
+                        inner_node * pMerged = alloc_node( pRestNode->m_nType, nPrefixLen + 1 + nRestPrefixLen );
+                        memcpy( pMerged->m_pPrefix, pNode->m_pPrefix, nPrefixLen );
+                        pMerged->m_pPrefix[nPrefixLen] = static_cast<unsigned char>( nRestSlot );
+                        memcpy( pMerged->m_pPrefix + nPrefixLen + 1, pRestNode->m_pPrefix, nRestPrefixLen );
+                        copy_children( pRestNode, pMerged, c_nNoSlot );
+
+                        replace_child( pParent, nParentSlot, pMerged );
+                        write_unlock_obsolete( pRestNode );
+                        retired.push( pRestNode );
+                    }
+                    write_unlock_obsolete( pNode );
+                    write_unlock( pParent );
+                    retired.push( pNode );
+                    m_Stat.onPathCompress();
+                    return erase_success;
+                }
+
+                if ( pParent && nSlot != c_nTerminalSlot && nCount - 1 <= shrink_threshold( pNode->m_nType )) {
+                    // The node is replaced by the smaller node
+                    if ( !upgrade_lock( pParent, vParent ))
+                        return erase_restart;
+                    if ( !upgrade_lock( pNode, v )) {
+                        write_unlock( pParent );
+                        return erase_restart;
+                    }
+
+                    inner_node * pSmall = alloc_node( pNode->m_nType - 1, nPrefixLen );
+                    memcpy( pSmall->m_pPrefix, pNode->m_pPrefix, nPrefixLen );
+                    copy_children( pNode, pSmall, nSlot );
+
+                    replace_child( pParent, nParentSlot, pSmall );
+                    write_unlock_obsolete( pNode );
+                    write_unlock( pParent );
+                    retired.push( pNode );
+                    m_Stat.onNodeShrink();
+                    return erase_success;
+                }
+
+                if ( !upgrade_lock( pNode, v ))
+                    return erase_restart;
+                remove_child( pNode, nSlot );
+                write_unlock( pNode );
+                return erase_success;
+            }
+        }
+
+        // Scan
+
+        template <typename Func>
+        size_t do_scan( key_encoder const * pLower, key_encoder const * pUpper, bool bPrefix, size_t nLimit, Func& f ) const
+        {
+            if ( nLimit == 0 )
+                return 0;
+
+            scan_bounds bounds = { pLower, pUpper, bPrefix, nLimit };
+            size_t nCount = 0;
+            rcu_lock l;
+            scan_node( m_pRoot, 0, pLower != nullptr, pUpper != nullptr, bounds, f, nCount );
+            return nCount;
+        }
+
+        // Checks the byte at position nPos of the path against the bounds.
+        // bLower (bUpper) is true if the path is equal to the lower (upper) bound so far
+        static scan_action check_path( unsigned char nByte, size_t nPos, bool& bLower, bool& bUpper, scan_bounds const& bounds )
+        {
+            if ( bLower ) {
+                key_encoder const& lower = *bounds.pLower;
+                if ( nPos >= lower.size() || nByte > lower[nPos] )
+                    bLower = false;     // the keys in the subtree are greater than the lower bound
+                else if ( nByte < lower[nPos] )
+                    return scan_skip;
+            }
+            if ( bUpper ) {
+                key_encoder const& upper = *bounds.pUpper;
+                if ( nPos >= upper.size() ) {
+                    if ( !bounds.bPrefix )
+                        return scan_stop;   // the keys are greater than the upper bound
+                    bUpper = false;         // the keys have the prefix
+                }
+                else if ( nByte > upper[nPos] )
+                    return scan_stop;
+                else if ( nByte < upper[nPos] ) {
+                    if ( bounds.bPrefix )
+                        return scan_skip;
+                    bUpper = false;
+                }
+            }
+            return scan_continue;
+        }
+
+        template <typename Func>
+        bool scan_leaf( leaf_node * pLeaf, bool bLower, bool bUpper, scan_bounds const& bounds, Func& f, size_t& nCount ) const
+        {
+            key_encoder enc( pLeaf->m_Value.first );
+            if ( bLower && compare_keys( enc, *bounds.pLower ) < 0 )
+                return true;
+            if ( bUpper ) {
+                // The key is not less than the lower bound here
+                if ( bounds.bPrefix ? !starts_with( enc, *bounds.pUpper ) : compare_keys( enc, *bounds.pUpper ) >= 0 )
+                    return false;
+            }
+            f( pLeaf->m_Value );
+            return ++nCount < bounds.nLimit;
+        }
+
+        // Returns false if the scan should be stopped
+        template <typename Func>
+        bool scan_node( inner_node * pNode, size_t nDepth, bool bLower, bool bUpper, scan_bounds const& bounds, Func& f, size_t& nCount ) const
+        {
+            unsigned char   arrBytes[256];
+            node *          arrChildren[256];
+            size_t          nChildren;
+            leaf_node *     pTerminal;
+            size_t          nPrefixLen;
+            scan_action     action;
+            bool            bLo;
+            bool            bUp;
+
+            // Read the node consistently. The obsolete node is not changed any more,
+            // it is read as is, so the scan is not restarted
+            for (;;) {
+                bool bRestart = false;
+                version_type v = read_lock( pNode, bRestart );
+
+                nPrefixLen = pNode->prefix_len();
+                bLo = bLower;
+                bUp = bUpper;
+                action = scan_continue;
+                for ( size_t i = 0; i < nPrefixLen && action == scan_continue && ( bLo || bUp ); ++i )
+                    action = check_path( pNode->m_pPrefix[i], nDepth + i, bLo, bUp, bounds );
+
+                pTerminal = pNode->m_pTerminal;
+                nChildren = 0;
+                for_each_child( pNode, [&arrBytes, &arrChildren, &nChildren]( unsigned char nByte, node * pChild ) {
+                    arrBytes[nChildren] = nByte;
+                    arrChildren[nChildren] = pChild;
+                    ++nChildren;
+                });
+
+                if ( validate( pNode, v ))
+                    break;
+            }
+
+            if ( action == scan_skip )
+                return true;
+            if ( action == scan_stop )
+                return false;
+            nDepth += nPrefixLen;
+
+            if ( pTerminal && !scan_leaf( pTerminal, bLo, bUp, bounds, f, nCount ))
+                return false;
+
+            for ( size_t i = 0; i < nChildren; ++i ) {
+                bool bChildLo = bLo;
+                bool bChildUp = bUp;
+                scan_action const childAction = check_path( arrBytes[i], nDepth, bChildLo, bChildUp, bounds );
+                if ( childAction == scan_skip )
+                    continue;
+                if ( childAction == scan_stop )
+                    return false;
+
+                node * pChild = arrChildren[i];
+                if ( pChild->is_leaf() ) {
+                    if ( !scan_leaf( static_cast<leaf_node *>( pChild ), bChildLo, bChildUp, bounds, f, nCount ))
+                        return false;
+                }
+                else if ( !scan_node( static_cast<inner_node *>( pChild ), nDepth + 1, bChildLo, bChildUp, bounds, f, nCount ))
+                    return false;
+            }
+            return true;
+        }
+
+        // Consistency check
+
+        static bool check_leaf( leaf_node * pLeaf, std::vector<unsigned char> const& path )
+        {
+            key_encoder enc( pLeaf->m_Value.first );
+            if ( enc.size() < path.size() )
+                return false;
+            for ( size_t i = 0; i < path.size(); ++i ) {
+                if ( enc[i] != path[i] )
+                    return false;
+            }
+            return true;
+        }
+
+        bool check_node( inner_node * p, std::vector<unsigned char>& path ) const
+        {
+            size_t const nPathLen = path.size();
+            path.insert( path.end(), p->m_pPrefix, p->m_pPrefix + p->prefix_len() );
+
+            if ( p->m_pTerminal ) {
+                // The terminal leaf key ends at the node
+                if ( !check_leaf( p->m_pTerminal, path ) || key_encoder( p->m_pTerminal->m_Value.first ).size() != path.size() )
+                    return false;
+            }
+
+            size_t nCount = 0;
+            int nPrevByte = -1;
+            bool bOk = true;
+            for_each_child( p, [&]( unsigned char nByte, node * pChild ) {
+                ++nCount;
+                if ( !bOk )
+                    return;
+                if ( static_cast<int>( nByte ) <= nPrevByte || !pChild ) {
+                    bOk = false;
+                    return;
+                }
+                nPrevByte = nByte;
+                path.push_back( nByte );
+                if ( pChild->is_leaf() )
+                    bOk = check_leaf( static_cast<leaf_node *>( pChild ), path );
+                else
+                    bOk = check_node( static_cast<inner_node *>( pChild ), path );
+                path.pop_back();
+            });
+
+            if ( nCount != p->count() )
+                bOk = false;
+            if ( p != m_pRoot && nCount + ( p->m_pTerminal ? 1 : 0 ) < 2 )
+                bOk = false;
+
+            path.resize( nPathLen );
+            return bOk;
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_ART_MAP_RCU_H
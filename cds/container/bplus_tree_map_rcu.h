@@ -0,0 +1,1062 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_BPLUS_TREE_MAP_RCU_H
+#define __CDS_CONTAINER_BPLUS_TREE_MAP_RCU_H
+
+#include <type_traits>
+#include <cds/container/details/bplus_tree_base.h>
+#include <cds/urcu/details/check_deadlock.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace container {
+
+    /// Concurrent B+tree map with optimistic lock coupling (template specialization for \ref cds_urcu_desc "RCU")
+    /** @ingroup cds_nonintrusive_map
+        \anchor cds_container_BPlusTreeMap_rcu
+
+        Source:
+            - [1981] P.Lehman, S.B.Yao "Efficient Locking for Concurrent Operations on B-Trees"
+            - [2016] V.Leis, F.Scheibner, A.Kemper, T.Neumann "The ART of Practical Synchronization"
+
+        The map is a B+tree with wide nodes: an inner node contains up to \p Traits::node_capacity keys
+        and child pointers, a leaf contains up to \p Traits::node_capacity keys and values in place.
+        The leaves are linked from left to right, so the range scan walks the leaf chain.
+        Since the keys of a node are stored in contiguous array, the search in a node costs a few cache misses
+        only, and the tree height is <tt>log(N) / log(node_capacity / 2)</tt> at most.
+
+        The synchronization is <b>optimistic lock coupling</b>. Each node has a version word that contains a lock bit
+        and an obsolete bit:
+        - a reader does not write to shared memory at all. It reads the version of a node, reads the node content,
+            then validates that the version has not changed. A reader validates the parent after reading the version
+            of the child, so the path from the root to the leaf is consistent. If the validation fails, the operation
+            restarts from the root;
+        - a writer locks only the node it changes: an insertion or a deletion locks the leaf.
+            A full node is split eagerly on the way down by locking the node and its parent;
+            an underfull node is merged with its sibling on the way down by locking the parent and both children.
+            The write locks are always acquired top-down and left-to-right, so the tree is deadlock-free.
+
+        The nodes removed from the tree (the right node of a merge and the collapsed root) are marked obsolete
+        and are reclaimed by RCU after the RCU read-side critical section.
+        Since the reader does not protect each node visited, RCU is the natural reclamation scheme
+        for optimistic lock coupling; the map is provided for RCU only.
+
+        The reader copies the key and the value from the leaf before the validation, so
+        the key and the value are stored by value and they should be trivially copyable and default-constructible,
+        for example, integers, plain structs or pointers. The functors passed to \p find() and \p scan()
+        get the validated copies.
+
+        Template arguments:
+        - \p RCU - one of \ref cds_urcu_gc "RCU type"
+        - \p Key - key type, trivially copyable and default-constructible
+        - \p T - value type, trivially copyable and default-constructible
+        - \p Traits - type traits, see \p bplus_tree::type_traits for explanation.
+
+        It is possible to declare option-based map with \p bplus_tree::make_traits metafunction instead of \p Traits template
+        argument. Template argument list \p Options of \p %bplus_tree::make_traits metafunction are:
+        - \p opt::compare - key compare functor. No default functor is provided.
+            If the option is not specified, \p opt::less is used.
+        - \p opt::less - specifies binary predicate used for key compare. Default is \p std::less<Key>.
+        - \p opt::item_counter - the type of item counting feature. Default is \p atomicity::empty_item_counter that is no item counting.
+        - \p opt::back_off - back-off strategy used to wait for a locked node. Default is \p cds::backoff::Default.
+        - \p opt::allocator - the allocator for the nodes. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - \p opt::stat - internal statistics. Available types: \p bplus_tree::stat, \p bplus_tree::empty_stat (the default)
+        - \p opt::rcu_check_deadlock - a deadlock checking policy. Default is \p opt::v::rcu_throw_deadlock
+        - \p bplus_tree::node_capacity - maximum count of keys in a node, default is 16.
+
+        @note Before including <tt><cds/container/bplus_tree_map_rcu.h></tt> you should include appropriate RCU header file,
+        see \ref cds_urcu_gc "RCU type" for list of existing RCU class and corresponding header files.
+    */
+    template <
+        class RCU,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = bplus_tree::type_traits
+#else
+        class Traits
+#endif
+    >
+    class BPlusTreeMap< cds::urcu::gc<RCU>, Key, T, Traits >
+    {
+    public:
+        typedef cds::urcu::gc<RCU>  gc          ;   ///< RCU Garbage collector
+        typedef Key                 key_type    ;   ///< type of a key stored in the map
+        typedef T                   mapped_type ;   ///< type of value stored in the map
+        typedef Traits              options     ;   ///< Traits template parameter
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator  ;    ///< key compare functor based on opt::compare and opt::less option setter.
+#   else
+        typedef typename opt::details::make_comparator< key_type, options >::type key_comparator;
+#endif
+        typedef typename options::item_counter          item_counter    ;   ///< Item counting policy used
+        typedef typename options::back_off              back_off        ;   ///< Back-off strategy
+        typedef typename options::stat                  stat            ;   ///< internal statistics type
+        typedef typename options::rcu_check_deadlock    rcu_check_deadlock  ; ///< Deadlock checking policy
+        typedef typename gc::scoped_lock                rcu_lock        ;   ///< RCU scoped lock
+
+        static CDS_CONSTEXPR_CONST size_t c_nCapacity = options::node_capacity; ///< Maximum count of keys in a node
+        static_assert( c_nCapacity >= 4, "Node capacity should be at least 4" );
+
+#if !( CDS_COMPILER == CDS_COMPILER_GCC && CDS_COMPILER_VERSION < 50000 )
+        static_assert( std::is_trivially_copyable<key_type>::value, "Key type should be trivially copyable" );
+        static_assert( std::is_trivially_copyable<mapped_type>::value, "Value type should be trivially copyable" );
+#endif
+
+    protected:
+        //@cond
+        typedef unsigned long long version_type;
+
+        static CDS_CONSTEXPR_CONST version_type c_nObsoleteBit = 1;
+        static CDS_CONSTEXPR_CONST version_type c_nLockBit = 2;
+        static CDS_CONSTEXPR_CONST size_t c_nMinCount = c_nCapacity / 4;   // a node with fewer keys is merged eagerly
+
+        typedef cds::urcu::details::check_deadlock_policy< gc, rcu_check_deadlock>   check_deadlock_policy;
+
+        struct node
+        {
+            atomics::atomic<version_type>   m_nVersion;
+            atomics::atomic<unsigned int>   m_nCount;
+            bool const                      m_bLeaf;
+            node *                          m_pNextRetired;
+
+            node( bool bLeaf )
+                : m_nVersion( 0 )
+                , m_nCount( 0 )
+                , m_bLeaf( bLeaf )
+                , m_pNextRetired( nullptr )
+            {}
+
+            size_t count() const
+            {
+                return m_nCount.load( atomics::memory_order_relaxed );
+            }
+
+            void count( size_t n )
+            {
+                m_nCount.store( static_cast<unsigned int>( n ), atomics::memory_order_relaxed );
+            }
+        };
+
+        struct inner_node: public node
+        {
+            key_type    m_Keys[c_nCapacity];
+            node *      m_Children[c_nCapacity + 1];
+
+            inner_node()
+                : node( false )
+            {
+                for ( size_t i = 0; i <= c_nCapacity; ++i )
+                    m_Children[i] = nullptr;
+            }
+        };
+
+        struct leaf_node: public node
+        {
+            leaf_node *     m_pNext;    // right sibling
+            key_type        m_Keys[c_nCapacity];
+            mapped_type     m_Values[c_nCapacity];
+
+            leaf_node()
+                : node( true )
+                , m_pNext( nullptr )
+            {}
+        };
+
+        typedef typename options::allocator::template rebind<inner_node>::other inner_allocator_type;
+        typedef typename options::allocator::template rebind<leaf_node>::other  leaf_allocator_type;
+        typedef cds::details::Allocator< inner_node, inner_allocator_type >     cxx_inner_allocator;
+        typedef cds::details::Allocator< leaf_node, leaf_allocator_type >       cxx_leaf_allocator;
+
+        // The list of the nodes to retire after RCU unlock
+        struct retired_list
+        {
+            node * m_pHead;
+
+            retired_list()
+                : m_pHead( nullptr )
+            {}
+
+            void push( node * p )
+            {
+                p->m_pNextRetired = m_pHead;
+                m_pHead = p;
+            }
+
+            ~retired_list()
+            {
+                assert( !gc::is_locked() );
+                while ( m_pHead ) {
+                    node * p = m_pHead;
+                    m_pHead = p->m_pNextRetired;
+                    gc::retire_ptr( p, free_node );
+                }
+            }
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        atomics::atomic<node *> m_pRoot;
+        item_counter            m_ItemCounter;
+        mutable stat            m_Stat;
+        //@endcond
+
+    public:
+        /// Default ctor creates empty map
+        BPlusTreeMap()
+            : m_pRoot( cxx_leaf_allocator().New() )
+        {}
+
+        /// Destroys the map
+        /**
+            The destructor is not thread-safe, it frees all nodes immediately.
+        */
+        ~BPlusTreeMap()
+        {
+            destroy( m_pRoot.load( atomics::memory_order_relaxed ));
+        }
+
+        /// Inserts new item with key \p key and default value
+        /**
+            The function creates an item with key \p key and default value, and then inserts the item into the map.
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            return do_update( key, []( bool, key_type const&, mapped_type& ) {}, false ).first;
+        }
+
+        /// Inserts new item
+        /**
+            The function creates an item with key \p key and value \p val, and then inserts the item into the map.
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            return do_update( key, [&val]( bool, key_type const&, mapped_type& item ) { item = val; }, false ).first;
+        }
+
+        /// Inserts new item and initializes its value by the functor
+        /**
+            The function creates an item with key \p key and default value, calls the functor \p func
+            to initialize the value, and then inserts the item into the map.
+            The functor interface is:
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type& val );
+            };
+            \endcode
+            The functor is called under the leaf lock, it should be short.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool insert_key( K const& key, Func func )
+        {
+            return do_update( key, [&func]( bool, key_type const& k, mapped_type& item ) { func( k, item ); }, false ).first;
+        }
+
+        /// Ensures that the \p key exists in the map
+        /**
+            The operation performs inserting or changing data.
+
+            If the \p key not found in the map, then the new item created from \p key
+            is inserted into the map (note that in this case the \ref key_type should be
+            constructible from type \p K). Otherwise, the functor \p func is called with the item found.
+            The functor interface is:
+            \code
+            struct functor {
+                void operator()( bool bNew, key_type const& key, mapped_type& val );
+            };
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p key - the key of the item
+            - \p val - the value of the item that the functor may change
+
+            The functor is called under the leaf lock, it should be short.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successful,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already is in the map.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> ensure( K const& key, Func func )
+        {
+            return do_update( key, func, true );
+        }
+
+        /// Delete \p key from the map
+        /**
+            Return \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return do_erase( key, []( key_type const&, mapped_type& ) {} );
+        }
+
+        /// Delete \p key from the map
+        /**
+            The function searches an item with key \p key, calls \p f functor with the item
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()( key_type const& key, mapped_type& val );
+            };
+            \endcode
+            The functor is called under the leaf lock.
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            return do_erase( key, f );
+        }
+
+        /// Find the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor \p f for the copy of the item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type const& val );
+            };
+            \endcode
+            The functor cannot change the item in the map, use \p ensure() for that.
+
+            The function applies RCU lock internally.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f ) const
+        {
+            return do_find( key, f );
+        }
+
+        /// Find the key \p key
+        /**
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K>
+        bool find( K const& key ) const
+        {
+            auto f = []( key_type const&, mapped_type const& ) {};
+            return do_find( key, f );
+        }
+
+        /// Range scan
+        /**
+            The function calls \p f for each item with the key in the range <tt>[from, to)</tt> in ascending order of the keys.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type const& val );
+            };
+            \endcode
+            The functor gets the copy of the item. The items of a leaf are copied and validated
+            as a whole, then the functor is called for them; so each item is reported once.
+            The scan is not a snapshot: the items inserted or deleted concurrently may be reported or not.
+
+            The function applies RCU lock internally; the functor is called under RCU lock,
+            so it cannot delete the items from the map.
+
+            Returns the count of items reported.
+        */
+        template <typename Func>
+        size_t scan( key_type const& from, key_type const& to, Func f ) const
+        {
+            key_comparator cmp;
+            m_Stat.onScan();
+            return do_scan( &from, ~size_t(0), [&cmp, &to]( key_type const& key ) { return cmp( key, to ) >= 0; }, f );
+        }
+
+        /// Scans up to \p nCount items starting from \p from
+        /**
+            The function is similar to \ref scan( key_type const&, key_type const&, Func ) "scan()"
+            but it reports up to \p nCount items with the key not less than \p from.
+        */
+        template <typename Func>
+        size_t scan_n( key_type const& from, size_t nCount, Func f ) const
+        {
+            m_Stat.onScan();
+            return do_scan( &from, nCount, []( key_type const& ) { return false; }, f );
+        }
+
+        /// Clears the map
+        /**
+            The function deletes the items in ascending order of the keys by small portions.
+            It is not atomic: the items inserted concurrently may stay in the map.
+        */
+        void clear()
+        {
+            key_type arrKeys[c_nCapacity];
+            size_t nCount;
+            auto f = [&arrKeys, &nCount]( key_type const& key, mapped_type const& ) { arrKeys[nCount++] = key; };
+            for (;;) {
+                nCount = 0;
+                do_scan( static_cast<key_type const *>( nullptr ), c_nCapacity, []( key_type const& ) { return false; }, f );
+                if ( nCount == 0 )
+                    break;
+                for ( size_t i = 0; i < nCount; ++i )
+                    erase( arrKeys[i] );
+            }
+        }
+
+        /// Checks if the map is empty
+        bool empty() const
+        {
+            auto f = []( key_type const&, mapped_type const& ) {};
+            return do_scan( static_cast<key_type const *>( nullptr ), 1, []( key_type const& ) { return false; }, f ) == 0;
+        }
+
+        /// Returns item count in the map
+        /**
+            Only leaf nodes containing user data are counted.
+
+            The value returned depends on item counter type provided by \p Traits template parameter.
+            If it is \p atomicity::empty_item_counter this function always returns 0.
+            Therefore, the function is not suitable for checking the tree emptiness, use \p empty()
+            member function for this purpose.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+        /// Checks internal consistency (not atomic, not thread-safe)
+        /**
+            The debugging function to check internal consistency of the tree:
+            the keys of each node are ordered and lie in the range defined by the parent,
+            all leaves have the same depth and the leaf chain contains all leaves in order.
+        */
+        bool check_consistency() const
+        {
+            node * pRoot = m_pRoot.load( atomics::memory_order_relaxed );
+            size_t nLeafDepth = 0;
+            leaf_node * pPrevLeaf = nullptr;
+            if ( !check_node( pRoot, nullptr, nullptr, 0, nLeafDepth, pPrevLeaf ))
+                return false;
+            return pPrevLeaf == nullptr || pPrevLeaf->m_pNext == nullptr;
+        }
+
+    protected:
+        //@cond
+        static void free_node( node * p )
+        {
+            if ( p->m_bLeaf )
+                cxx_leaf_allocator().Delete( static_cast<leaf_node *>( p ));
+            else
+                cxx_inner_allocator().Delete( static_cast<inner_node *>( p ));
+        }
+
+        static void destroy( node * p )
+        {
+            if ( !p->m_bLeaf ) {
+                inner_node * pInner = static_cast<inner_node *>( p );
+                for ( size_t i = 0; i <= pInner->count(); ++i )
+                    destroy( pInner->m_Children[i] );
+            }
+            free_node( p );
+        }
+
+        // Version protocol
+
+        static version_type read_lock( node * p, bool& bRestart )
+        {
+            version_type v = p->m_nVersion.load( atomics::memory_order_acquire );
+            if ( v & c_nLockBit ) {
+                back_off bkoff;
+                do {
+                    bkoff();
+                    v = p->m_nVersion.load( atomics::memory_order_acquire );
+                } while ( v & c_nLockBit );
+            }
+            if ( v & c_nObsoleteBit )
+                bRestart = true;
+            return v;
+        }
+
+        static bool validate( node * p, version_type v )
+        {
+            // The content of the node read before the fence is consistent if the version is not changed
+            atomics::atomic_thread_fence( atomics::memory_order_acquire );
+            return p->m_nVersion.load( atomics::memory_order_relaxed ) == v;
+        }
+
+        static bool upgrade_lock( node * p, version_type v )
+        {
+            return p->m_nVersion.compare_exchange_strong( v, v + c_nLockBit, atomics::memory_order_acquire, atomics::memory_order_relaxed );
+        }
+
+        static void write_lock( node * p )
+        {
+            for (;;) {
+                bool bRestart = false;
+                version_type v = read_lock( p, bRestart );
+                // The caller holds the lock of the parent, so the node cannot become obsolete
+                assert( !bRestart );
+                if ( upgrade_lock( p, v ))
+                    return;
+            }
+        }
+
+        static void write_unlock( node * p )
+        {
+            p->m_nVersion.fetch_add( c_nLockBit, atomics::memory_order_release );
+        }
+
+        static void write_unlock_obsolete( node * p )
+        {
+            p->m_nVersion.fetch_add( c_nLockBit | c_nObsoleteBit, atomics::memory_order_release );
+        }
+
+        // Search in a node
+
+        template <typename Q>
+        static size_t lower_bound( key_type const * pKeys, size_t nCount, Q const& key )
+        {
+            // the first position where pKeys[i] >= key
+            key_comparator cmp;
+            size_t nLo = 0;
+            while ( nLo < nCount ) {
+                size_t nMid = ( nLo + nCount ) / 2;
+                if ( cmp( pKeys[nMid], key ) < 0 )
+                    nLo = nMid + 1;
+                else
+                    nCount = nMid;
+            }
+            return nLo;
+        }
+
+        template <typename Q>
+        static size_t upper_bound( key_type const * pKeys, size_t nCount, Q const& key )
+        {
+            // the first position where pKeys[i] > key
+            key_comparator cmp;
+            size_t nLo = 0;
+            while ( nLo < nCount ) {
+                size_t nMid = ( nLo + nCount ) / 2;
+                if ( cmp( pKeys[nMid], key ) <= 0 )
+                    nLo = nMid + 1;
+                else
+                    nCount = nMid;
+            }
+            return nLo;
+        }
+
+        // Locates the leaf for the key (the leftmost leaf if pKey == nullptr).
+        // Returns nullptr if the operation should be restarted
+        template <typename Q>
+        leaf_node * find_leaf( Q const * pKey, version_type& vLeaf ) const
+        {
+            assert( gc::is_locked() );
+
+            bool bRestart = false;
+            node * pNode = m_pRoot.load( atomics::memory_order_acquire );
+            version_type v = read_lock( pNode, bRestart );
+            if ( bRestart || pNode != m_pRoot.load( atomics::memory_order_acquire ))
+                return nullptr;
+
+            while ( !pNode->m_bLeaf ) {
+                inner_node * pInner = static_cast<inner_node *>( pNode );
+                node * pChild = pInner->m_Children[ pKey ? upper_bound( pInner->m_Keys, pInner->count(), *pKey ) : 0 ];
+                if ( !validate( pInner, v ))
+                    return nullptr;
+
+                version_type vChild = read_lock( pChild, bRestart );
+                if ( bRestart || !validate( pInner, v ))
+                    return nullptr;
+
+                pNode = pChild;
+                v = vChild;
+            }
+
+            vLeaf = v;
+            return static_cast<leaf_node *>( pNode );
+        }
+
+        template <typename Q, typename Func>
+        bool do_find( Q const& key, Func& f ) const
+        {
+            key_comparator cmp;
+            rcu_lock l;
+            for (;;) {
+                version_type v;
+                leaf_node * pLeaf = find_leaf( &key, v );
+                if ( pLeaf ) {
+                    size_t nCount = pLeaf->count();
+                    size_t nPos = lower_bound( pLeaf->m_Keys, nCount, key );
+                    bool bFound = nPos < nCount && cmp( pLeaf->m_Keys[nPos], key ) == 0;
+                    key_type k;
+                    mapped_type val;
+                    if ( bFound ) {
+                        k = pLeaf->m_Keys[nPos];
+                        val = pLeaf->m_Values[nPos];
+                    }
+                    if ( validate( pLeaf, v )) {
+                        if ( bFound ) {
+                            f( k, val );
+                            m_Stat.onFindSuccess();
+                        }
+                        else
+                            m_Stat.onFindFailed();
+                        return bFound;
+                    }
+                }
+                m_Stat.onRestart();
+            }
+        }
+
+        template <typename Stop, typename Func>
+        size_t do_scan( key_type const * pFrom, size_t nLimit, Stop stop, Func& f ) const
+        {
+            key_type arrKeys[c_nCapacity];
+            mapped_type arrValues[c_nCapacity];
+
+            size_t nReported = 0;
+            key_type lower;         // the last key reported
+            bool bStarted = false;  // true if lower is valid
+
+            if ( nLimit == 0 )
+                return 0;
+
+            rcu_lock l;
+            for (;;) {
+                version_type v;
+                leaf_node * pLeaf = bStarted ? find_leaf( &lower, v ) : find_leaf( pFrom, v );
+                while ( pLeaf ) {
+                    size_t nCount = pLeaf->count();
+                    size_t nPos = bStarted ? upper_bound( pLeaf->m_Keys, nCount, lower )
+                        : pFrom ? lower_bound( pLeaf->m_Keys, nCount, *pFrom ) : 0;
+                    size_t nCopied = 0;
+                    bool bDone = false;
+                    for ( ; nPos < nCount; ++nPos ) {
+                        if ( nReported + nCopied == nLimit || stop( pLeaf->m_Keys[nPos] )) {
+                            bDone = true;
+                            break;
+                        }
+                        arrKeys[nCopied] = pLeaf->m_Keys[nPos];
+                        arrValues[nCopied] = pLeaf->m_Values[nPos];
+                        ++nCopied;
+                    }
+                    leaf_node * pNext = pLeaf->m_pNext;
+                    if ( !validate( pLeaf, v ))
+                        break;
+
+                    for ( size_t i = 0; i < nCopied; ++i )
+                        f( arrKeys[i], arrValues[i] );
+                    if ( nCopied ) {
+                        nReported += nCopied;
+                        lower = arrKeys[nCopied - 1];
+                        bStarted = true;
+                    }
+                    if ( bDone || nReported == nLimit || !pNext )
+                        return nReported;
+
+                    // Lock coupling on the leaf chain
+                    bool bRestart = false;
+                    version_type vNext = read_lock( pNext, bRestart );
+                    if ( bRestart || !validate( pLeaf, v ))
+                        break;
+                    pLeaf = pNext;
+                    v = vNext;
+                }
+                m_Stat.onRestart();
+            }
+        }
+
+        template <typename Q, typename Func>
+        std::pair<bool, bool> do_update( Q const& key, Func f, bool bAllowUpdate )
+        {
+            key_comparator cmp;
+            rcu_lock l;
+            for ( ;; m_Stat.onRestart() ) {
+                bool bRestart = false;
+                node * pNode = m_pRoot.load( atomics::memory_order_acquire );
+                version_type v = read_lock( pNode, bRestart );
+                if ( bRestart || pNode != m_pRoot.load( atomics::memory_order_acquire ))
+                    continue;
+
+                inner_node * pParent = nullptr;
+                version_type vParent = 0;
+                for (;;) {
+                    if ( pNode->count() == c_nCapacity ) {
+                        // The full node is split eagerly, so the parent always has a room for a new child
+                        if ( pNode->m_bLeaf ) {
+                            leaf_node * pLeaf = static_cast<leaf_node *>( pNode );
+                            size_t nPos = lower_bound( pLeaf->m_Keys, c_nCapacity, key );
+                            if ( nPos < c_nCapacity && cmp( pLeaf->m_Keys[nPos], key ) == 0 )
+                                break;  // no split is needed for existing key
+                        }
+                        split( pParent, vParent, pNode, v );
+                        bRestart = true;
+                        break;
+                    }
+                    if ( pNode->m_bLeaf )
+                        break;
+
+                    inner_node * pInner = static_cast<inner_node *>( pNode );
+                    node * pChild = pInner->m_Children[ upper_bound( pInner->m_Keys, pInner->count(), key ) ];
+                    if ( !validate( pInner, v )) {
+                        bRestart = true;
+                        break;
+                    }
+                    version_type vChild = read_lock( pChild, bRestart );
+                    if ( bRestart || !validate( pInner, v )) {
+                        bRestart = true;
+                        break;
+                    }
+                    pParent = pInner;
+                    vParent = v;
+                    pNode = pChild;
+                    v = vChild;
+                }
+                if ( bRestart )
+                    continue;
+
+                leaf_node * pLeaf = static_cast<leaf_node *>( pNode );
+                if ( !upgrade_lock( pLeaf, v ))
+                    continue;
+
+                size_t nCount = pLeaf->count();
+                size_t nPos = lower_bound( pLeaf->m_Keys, nCount, key );
+                if ( nPos < nCount && cmp( pLeaf->m_Keys[nPos], key ) == 0 ) {
+                    if ( bAllowUpdate ) {
+                        f( false, pLeaf->m_Keys[nPos], pLeaf->m_Values[nPos] );
+                        m_Stat.onEnsureExist();
+                    }
+                    else
+                        m_Stat.onInsertFailed();
+                    write_unlock( pLeaf );
+                    return std::make_pair( bAllowUpdate, false );
+                }
+                if ( nCount == c_nCapacity ) {
+                    // The key has been deleted concurrently, the leaf should be split
+                    write_unlock( pLeaf );
+                    continue;
+                }
+
+                for ( size_t i = nCount; i > nPos; --i ) {
+                    pLeaf->m_Keys[i] = pLeaf->m_Keys[i - 1];
+                    pLeaf->m_Values[i] = pLeaf->m_Values[i - 1];
+                }
+                pLeaf->m_Keys[nPos] = key_type( key );
+                pLeaf->m_Values[nPos] = mapped_type();
+                f( true, pLeaf->m_Keys[nPos], pLeaf->m_Values[nPos] );
+                pLeaf->count( nCount + 1 );
+                write_unlock( pLeaf );
+
+                ++m_ItemCounter;
+                if ( bAllowUpdate )
+                    m_Stat.onEnsureNew();
+                else
+                    m_Stat.onInsertSuccess();
+                return std::make_pair( true, true );
+            }
+        }
+
+        // Splits full pNode. The caller restarts the operation anyway
+        void split( inner_node * pParent, version_type vParent, node * pNode, version_type v )
+        {
+            if ( pParent && !upgrade_lock( pParent, vParent ))
+                return;
+            if ( !upgrade_lock( pNode, v )) {
+                if ( pParent )
+                    write_unlock( pParent );
+                return;
+            }
+            if ( !pParent && pNode != m_pRoot.load( atomics::memory_order_relaxed )) {
+                write_unlock( pNode );
+                return;
+            }
+
+            key_type sep;
+            node * pSibling;
+            size_t const nMid = c_nCapacity / 2;
+            if ( pNode->m_bLeaf ) {
+                leaf_node * pLeaf = static_cast<leaf_node *>( pNode );
+                leaf_node * pRight = cxx_leaf_allocator().New();
+                for ( size_t i = nMid; i < c_nCapacity; ++i ) {
+                    pRight->m_Keys[i - nMid] = pLeaf->m_Keys[i];
+                    pRight->m_Values[i - nMid] = pLeaf->m_Values[i];
+                }
+                pRight->count( c_nCapacity - nMid );
+                pRight->m_pNext = pLeaf->m_pNext;
+                sep = pRight->m_Keys[0];
+
+                pLeaf->m_pNext = pRight;
+                pLeaf->count( nMid );
+                pSibling = pRight;
+                m_Stat.onLeafSplit();
+            }
+            else {
+                inner_node * pInner = static_cast<inner_node *>( pNode );
+                inner_node * pRight = cxx_inner_allocator().New();
+                // The middle key goes up to the parent
+                sep = pInner->m_Keys[nMid];
+                for ( size_t i = nMid + 1; i < c_nCapacity; ++i )
+                    pRight->m_Keys[i - nMid - 1] = pInner->m_Keys[i];
+                for ( size_t i = nMid + 1; i <= c_nCapacity; ++i )
+                    pRight->m_Children[i - nMid - 1] = pInner->m_Children[i];
+                pRight->count( c_nCapacity - nMid - 1 );
+
+                pInner->count( nMid );
+                pSibling = pRight;
+                m_Stat.onInnerSplit();
+            }
+
+            if ( pParent ) {
+                size_t nCount = pParent->count();
+                assert( nCount < c_nCapacity );
+                size_t nPos = upper_bound( pParent->m_Keys, nCount, sep );
+                for ( size_t i = nCount; i > nPos; --i ) {
+                    pParent->m_Keys[i] = pParent->m_Keys[i - 1];
+                    pParent->m_Children[i + 1] = pParent->m_Children[i];
+                }
+                pParent->m_Keys[nPos] = sep;
+                pParent->m_Children[nPos + 1] = pSibling;
+                pParent->count( nCount + 1 );
+
+                write_unlock( pNode );
+                write_unlock( pParent );
+            }
+            else {
+                inner_node * pRoot = cxx_inner_allocator().New();
+                pRoot->m_Keys[0] = sep;
+                pRoot->m_Children[0] = pNode;
+                pRoot->m_Children[1] = pSibling;
+                pRoot->count( 1 );
+                m_pRoot.store( pRoot, atomics::memory_order_release );
+                m_Stat.onHeightInc();
+
+                write_unlock( pNode );
+            }
+        }
+
+        template <typename Q, typename Func>
+        bool do_erase( Q const& key, Func f )
+        {
+            check_deadlock_policy::check();
+
+            key_comparator cmp;
+            retired_list retired;
+            {
+                rcu_lock l;
+                for ( ;; m_Stat.onRestart() ) {
+                    bool bRestart = false;
+                    node * pNode = m_pRoot.load( atomics::memory_order_acquire );
+                    version_type v = read_lock( pNode, bRestart );
+                    if ( bRestart || pNode != m_pRoot.load( atomics::memory_order_acquire ))
+                        continue;
+
+                    while ( !pNode->m_bLeaf ) {
+                        inner_node * pInner = static_cast<inner_node *>( pNode );
+                        size_t nCount = pInner->count();
+                        size_t nIdx = upper_bound( pInner->m_Keys, nCount, key );
+                        node * pChild = pInner->m_Children[nIdx];
+                        if ( !validate( pInner, v )) {
+                            bRestart = true;
+                            break;
+                        }
+
+                        if ( nCount == 0 || ( pChild->count() < c_nMinCount && nCount > 0 )) {
+                            // The underfull child is merged with its sibling eagerly,
+                            // the inner node with one child is the root that is collapsed
+                            if ( merge( pInner, v, nIdx, retired )) {
+                                bRestart = true;
+                                break;
+                            }
+                        }
+
+                        version_type vChild = read_lock( pChild, bRestart );
+                        if ( bRestart || !validate( pInner, v )) {
+                            bRestart = true;
+                            break;
+                        }
+                        pNode = pChild;
+                        v = vChild;
+                    }
+                    if ( bRestart )
+                        continue;
+
+                    leaf_node * pLeaf = static_cast<leaf_node *>( pNode );
+                    if ( !upgrade_lock( pLeaf, v ))
+                        continue;
+
+                    size_t nCount = pLeaf->count();
+                    size_t nPos = lower_bound( pLeaf->m_Keys, nCount, key );
+                    if ( nPos == nCount || cmp( pLeaf->m_Keys[nPos], key ) != 0 ) {
+                        write_unlock( pLeaf );
+                        m_Stat.onEraseFailed();
+                        return false;
+                    }
+
+                    f( pLeaf->m_Keys[nPos], pLeaf->m_Values[nPos] );
+                    for ( size_t i = nPos + 1; i < nCount; ++i ) {
+                        pLeaf->m_Keys[i - 1] = pLeaf->m_Keys[i];
+                        pLeaf->m_Values[i - 1] = pLeaf->m_Values[i];
+                    }
+                    pLeaf->count( nCount - 1 );
+                    write_unlock( pLeaf );
+                    break;
+                }
+            }
+            // retired list is disposed after RCU unlock
+
+            --m_ItemCounter;
+            m_Stat.onEraseSuccess();
+            return true;
+        }
+
+        // Merges the child nIdx of pInner with its sibling if they fit in one node,
+        // or collapses pInner if it is the root with one child.
+        // Returns true if the operation should be restarted, false if nothing is done
+        bool merge( inner_node * pInner, version_type v, size_t nIdx, retired_list& retired )
+        {
+            size_t const nCount = pInner->count();
+            if ( nCount == 0 ) {
+                // The root with one child is collapsed. A non-root inner node with one child
+                // is merged by its parent, so the descent continues
+                if ( pInner != m_pRoot.load( atomics::memory_order_acquire ))
+                    return false;
+                if ( !upgrade_lock( pInner, v ))
+                    return true;
+                if ( pInner == m_pRoot.load( atomics::memory_order_relaxed )) {
+                    m_pRoot.store( pInner->m_Children[0], atomics::memory_order_release );
+                    write_unlock_obsolete( pInner );
+                    retired.push( pInner );
+                    m_Stat.onHeightDec();
+                }
+                else
+                    write_unlock( pInner );
+                return true;
+            }
+
+            size_t const nLeftIdx = nIdx < nCount ? nIdx : nIdx - 1;
+            node * pLeft = pInner->m_Children[nLeftIdx];
+            node * pRight = pInner->m_Children[nLeftIdx + 1];
+            if ( !validate( pInner, v ))
+                return true;
+            if ( !can_merge( pLeft, pRight ))
+                return false;
+
+            if ( !upgrade_lock( pInner, v ))
+                return true;
+            write_lock( pLeft );
+            write_lock( pRight );
+
+            if ( can_merge( pLeft, pRight )) {
+                size_t const nLeft = pLeft->count();
+                size_t const nRight = pRight->count();
+                if ( pLeft->m_bLeaf ) {
+                    leaf_node * pL = static_cast<leaf_node *>( pLeft );
+                    leaf_node * pR = static_cast<leaf_node *>( pRight );
+                    for ( size_t i = 0; i < nRight; ++i ) {
+                        pL->m_Keys[nLeft + i] = pR->m_Keys[i];
+                        pL->m_Values[nLeft + i] = pR->m_Values[i];
+                    }
+                    pL->count( nLeft + nRight );
+                    pL->m_pNext = pR->m_pNext;
+                    m_Stat.onLeafMerge();
+                }
+                else {
+                    inner_node * pL = static_cast<inner_node *>( pLeft );
+                    inner_node * pR = static_cast<inner_node *>( pRight );
+                    // The separator goes down from the parent
+                    pL->m_Keys[nLeft] = pInner->m_Keys[nLeftIdx];
+                    for ( size_t i = 0; i < nRight; ++i )
+                        pL->m_Keys[nLeft + 1 + i] = pR->m_Keys[i];
+                    for ( size_t i = 0; i <= nRight; ++i )
+                        pL->m_Children[nLeft + 1 + i] = pR->m_Children[i];
+                    pL->count( nLeft + nRight + 1 );
+                    m_Stat.onInnerMerge();
+                }
+
+                // Remove the separator and the right child from the parent
+                for ( size_t i = nLeftIdx + 1; i < nCount; ++i ) {
+                    pInner->m_Keys[i - 1] = pInner->m_Keys[i];
+                    pInner->m_Children[i] = pInner->m_Children[i + 1];
+                }
+                pInner->m_Children[nCount] = nullptr;
+                pInner->count( nCount - 1 );
+
+                write_unlock( pLeft );
+                write_unlock_obsolete( pRight );
+                retired.push( pRight );
+            }
+            else {
+                write_unlock( pRight );
+                write_unlock( pLeft );
+            }
+            write_unlock( pInner );
+            return true;
+        }
+
+        static bool can_merge( node * pLeft, node * pRight )
+        {
+            size_t nTotal = pLeft->count() + pRight->count() + ( pLeft->m_bLeaf ? 0 : 1 );
+            // The merged node should not be split at once
+            return nTotal < c_nCapacity;
+        }
+
+        bool check_node( node * p, key_type const * pLow, key_type const * pHigh, size_t nDepth, size_t& nLeafDepth, leaf_node *& pPrevLeaf ) const
+        {
+            key_comparator cmp;
+            size_t nCount = p->count();
+            key_type const * pKeys = p->m_bLeaf ? static_cast<leaf_node *>( p )->m_Keys : static_cast<inner_node *>( p )->m_Keys;
+            for ( size_t i = 0; i < nCount; ++i ) {
+                if ( i > 0 && cmp( pKeys[i - 1], pKeys[i] ) >= 0 )
+                    return false;
+                if ( pLow && cmp( pKeys[i], *pLow ) < 0 )
+                    return false;
+                if ( pHigh && cmp( pKeys[i], *pHigh ) >= 0 )
+                    return false;
+            }
+
+            if ( p->m_bLeaf ) {
+                if ( nLeafDepth == 0 )
+                    nLeafDepth = nDepth + 1;
+                else if ( nLeafDepth != nDepth + 1 )
+                    return false;
+                leaf_node * pLeaf = static_cast<leaf_node *>( p );
+                if ( pPrevLeaf && pPrevLeaf->m_pNext != pLeaf )
+                    return false;
+                pPrevLeaf = pLeaf;
+                return true;
+            }
+
+            inner_node * pInner = static_cast<inner_node *>( p );
+            for ( size_t i = 0; i <= nCount; ++i ) {
+                if ( !check_node( pInner->m_Children[i],
+                        i == 0 ? pLow : &pInner->m_Keys[i - 1],
+                        i == nCount ? pHigh : &pInner->m_Keys[i],
+                        nDepth + 1, nLeafDepth, pPrevLeaf ))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_BPLUS_TREE_MAP_RCU_H
@@ -0,0 +1,190 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_CHASE_LEV_DEQUE_H
+#define __CDS_CONTAINER_CHASE_LEV_DEQUE_H
+
+#include <cds/container/details/chase_lev_deque_base.h>
+
+namespace cds { namespace container {
+
+    /// Chase-Lev work-stealing deque
+    /** @ingroup cds_nonintrusive_deque
+
+        Source:
+        - [2005] David Chase, Yossi Lev "Dynamic Circular Work-Stealing Deque"
+        - [2013] N.M. Le, A. Pop, A. Cohen, F. Zappa Nardelli "Correct and Efficient Work-Stealing for Weak Memory Models"
+
+        The deque has one owner thread and any number of thief threads.
+        The owner pushes and pops the items at the bottom of the deque (LIFO order),
+        the thieves steal the items at the top (FIFO order). The deque is intended to be
+        a run-queue of work-stealing scheduler: each worker thread owns its deque
+        and steals tasks from the deques of other workers when its own deque is empty.
+
+        \p push() and \p pop() do not use CAS in common case, \p pop() uses CAS only to compete
+        with the thieves for the last item. \p steal() uses one CAS on the top index.
+
+        The items are stored in a circular array. When the array is full, \p push() allocates
+        new array of double capacity and copies the items into it. The thieves may read the old
+        array concurrently, so the old array is retired via the garbage collector \p GC
+        and freed when no thief protects it. The array is never shrunk.
+
+        Template parameters:
+        - \p GC - garbage collector, possible types are \p cds::gc::HP, \p cds::gc::PTB.
+            For RCU, see \ref cds_container_ChaseLevDeque_rcu "RCU-based ChaseLevDeque".
+        - \p T - the type of values stored in the deque. The values are stored in \p atomic<T> cells
+            and read by the thieves concurrently with the owner writes, so \p T must be trivially copyable,
+            typically a pointer to the task or an integer.
+        - \p Traits - deque traits, default is \p chase_lev_deque::type_traits.
+            \p chase_lev_deque::make_traits metafunction can be used to construct the traits.
+
+        Only the owner may call \p push(), \p pop() and \p clear(). Any thread may call \p steal(),
+        including the owner. The thief thread must be attached to \p GC; \p steal() uses one guard.
+
+        Example:
+        \code
+        #include <cds/container/chase_lev_deque.h>
+
+        struct task;
+        typedef cds::container::ChaseLevDeque< cds::gc::HP, task * > run_queue;
+
+        // The owner
+        run_queue rq;
+        rq.push( pTask );
+        task * t;
+        if ( rq.pop( t ))
+            execute( t );
+
+        // Another worker
+        if ( rq.steal( t ))
+            execute( t );
+        \endcode
+    */
+    template <class GC, typename T, typename Traits = chase_lev_deque::type_traits >
+    class ChaseLevDeque
+#ifndef CDS_DOXYGEN_INVOKED
+        : protected chase_lev_deque::details::deque_base< T, Traits >
+#endif
+    {
+        //@cond
+        typedef chase_lev_deque::details::deque_base< T, Traits > base_class;
+        //@endcond
+    public:
+        typedef GC      gc          ;   ///< Garbage collector
+        typedef T       value_type  ;   ///< Type of the value stored in the deque
+        typedef Traits  options     ;   ///< Deque traits
+
+        typedef typename base_class::allocator      allocator   ;   ///< Allocator of the circular array
+        typedef typename base_class::back_off       back_off    ;   ///< Back-off strategy for \p steal()
+        typedef typename base_class::stat           stat        ;   ///< Internal statistics type
+        typedef typename base_class::memory_model   memory_model;   ///< Memory ordering. See \p cds::opt::memory_model option
+
+    protected:
+        //@cond
+        typedef typename base_class::array_type     array_type;
+        typedef typename base_class::index_type     index_type;
+        typedef typename base_class::array_disposer array_disposer;
+        //@endcond
+
+    public:
+        /// Constructs empty deque
+        /**
+            \p nCapacity is the initial capacity of the circular array, it is rounded up to power of two.
+        */
+        explicit ChaseLevDeque( size_t nCapacity = 64 )
+            : base_class( nCapacity )
+        {}
+
+        /// Destroys the deque
+        /**
+            The destructor does not dispose the values: if \p T is a pointer, the caller should
+            pop the items before destroying the deque.
+        */
+        ~ChaseLevDeque()
+        {}
+
+        /// Pushes \p val at the bottom of the deque (owner only)
+        /**
+            If the array is full, the function allocates new array of double capacity
+            and retires the old one via \p GC. The function always returns \p true.
+        */
+        bool push( value_type const& val )
+        {
+            array_type * pOld = base_class::do_push( val );
+            if ( pOld )
+                gc::template retire<array_disposer>( pOld );
+            return true;
+        }
+
+        /// Pops an item from the bottom of the deque (owner only)
+        /**
+            If the deque is empty the function returns \p false, \p dest is unchanged.
+            The function returns \p false also if a thief has stolen the last item concurrently.
+        */
+        bool pop( value_type& dest )
+        {
+            return base_class::pop( dest );
+        }
+
+        /// Steals an item from the top of the deque (any thread)
+        /**
+            If the deque is empty the function returns \p false, \p dest is unchanged.
+            If the item has been taken by another thread concurrently, the function
+            retries after \p back_off until the deque is empty.
+        */
+        bool steal( value_type& dest )
+        {
+            typename gc::Guard guard;
+            back_off bkoff;
+            while ( true ) {
+                index_type t = base_class::m_nTop.load( memory_model::memory_order_acquire );
+                atomics::atomic_thread_fence( memory_model::memory_order_seq_cst );
+                index_type b = base_class::m_nBottom.load( memory_model::memory_order_acquire );
+                if ( t >= b ) {
+                    base_class::m_Stat.onStealEmpty();
+                    return false;
+                }
+
+                array_type * a = guard.protect( base_class::m_pArray );
+                if ( base_class::try_steal( a, t, dest ))
+                    return true;
+                bkoff();
+            }
+        }
+
+        /// Returns the number of items in the deque
+        /**
+            The value is approximate if the deque is changed concurrently.
+        */
+        size_t size() const
+        {
+            return base_class::size();
+        }
+
+        /// Checks if the deque is empty
+        bool empty() const
+        {
+            return base_class::empty();
+        }
+
+        /// Pops all items (owner only)
+        void clear()
+        {
+            base_class::clear();
+        }
+
+        /// Returns current capacity of the circular array
+        size_t capacity() const
+        {
+            return base_class::capacity();
+        }
+
+        /// Returns internal statistics
+        stat const& statistics() const
+        {
+            return base_class::statistics();
+        }
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_CHASE_LEV_DEQUE_H
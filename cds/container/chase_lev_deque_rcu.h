@@ -0,0 +1,172 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_CHASE_LEV_DEQUE_RCU_H
+#define __CDS_CONTAINER_CHASE_LEV_DEQUE_RCU_H
+
+#include <cds/container/chase_lev_deque.h>
+#include <cds/urcu/details/check_deadlock.h>
+
+namespace cds { namespace container {
+
+    /// Chase-Lev work-stealing deque (template specialization for \ref cds_urcu_desc "RCU")
+    /** @ingroup cds_nonintrusive_deque
+        @anchor cds_container_ChaseLevDeque_rcu
+
+        The deque is the same as \ref ChaseLevDeque but the old circular arrays are protected
+        by RCU: \p steal() reads the array in RCU critical section, \p push() retires the old array
+        via \p retire_ptr() of RCU.
+
+        Template arguments:
+        - \p RCU - one of \ref cds_urcu_gc "RCU type"
+        - \p T - the type of values stored in the deque, must be trivially copyable
+        - \p Traits - deque traits, default is \p chase_lev_deque::type_traits
+
+        @note Before including <tt><cds/container/chase_lev_deque_rcu.h></tt> you should include appropriate RCU header file,
+        see \ref cds_urcu_gc "RCU type" for list of existing RCU class and corresponding header files.
+
+        The owner must not call \p push() in RCU critical section since the growth of the array
+        may call \p synchronize(). \p steal() locks RCU itself, so it may be called
+        both inside and outside RCU critical section.
+    */
+    template <typename RCU, typename T, typename Traits>
+    class ChaseLevDeque< cds::urcu::gc<RCU>, T, Traits >
+#ifndef CDS_DOXYGEN_INVOKED
+        : protected chase_lev_deque::details::deque_base< T, Traits >
+#endif
+    {
+        //@cond
+        typedef chase_lev_deque::details::deque_base< T, Traits > base_class;
+        //@endcond
+    public:
+        typedef cds::urcu::gc<RCU>  gc      ;   ///< RCU schema used
+        typedef T       value_type  ;   ///< Type of the value stored in the deque
+        typedef Traits  options     ;   ///< Deque traits
+
+        typedef typename base_class::allocator      allocator   ;   ///< Allocator of the circular array
+        typedef typename base_class::back_off       back_off    ;   ///< Back-off strategy for \p steal()
+        typedef typename base_class::stat           stat        ;   ///< Internal statistics type
+        typedef typename base_class::memory_model   memory_model;   ///< Memory ordering. See \p cds::opt::memory_model option
+
+        typedef typename options::rcu_check_deadlock rcu_check_deadlock; ///< RCU deadlock checking policy
+
+        typedef typename gc::scoped_lock    rcu_lock ;  ///< RCU scoped lock
+
+    protected:
+        //@cond
+        typedef typename base_class::array_type     array_type;
+        typedef typename base_class::index_type     index_type;
+        typedef typename base_class::array_disposer array_disposer;
+
+        typedef cds::urcu::details::check_deadlock_policy< gc, rcu_check_deadlock > check_deadlock_policy;
+        //@endcond
+
+    public:
+        /// Constructs empty deque
+        /**
+            \p nCapacity is the initial capacity of the circular array, it is rounded up to power of two.
+        */
+        explicit ChaseLevDeque( size_t nCapacity = 64 )
+            : base_class( nCapacity )
+        {}
+
+        /// Destroys the deque
+        /**
+            The destructor does not dispose the values: if \p T is a pointer, the caller should
+            pop the items before destroying the deque.
+        */
+        ~ChaseLevDeque()
+        {}
+
+        /// Pushes \p val at the bottom of the deque (owner only)
+        /**
+            If the array is full, the function allocates new array of double capacity
+            and retires the old one via RCU. The function always returns \p true.
+
+            RCU must not be locked by the caller. The deadlock checking policy \p rcu_check_deadlock
+            is applied before pushing.
+        */
+        bool push( value_type const& val )
+        {
+            check_deadlock_policy::check();
+
+            array_type * pOld = base_class::do_push( val );
+            if ( pOld )
+                gc::template retire_ptr<array_disposer>( pOld );
+            return true;
+        }
+
+        /// Pops an item from the bottom of the deque (owner only)
+        /**
+            If the deque is empty the function returns \p false, \p dest is unchanged.
+            The function returns \p false also if a thief has stolen the last item concurrently.
+        */
+        bool pop( value_type& dest )
+        {
+            return base_class::pop( dest );
+        }
+
+        /// Steals an item from the top of the deque (any thread)
+        /**
+            If the deque is empty the function returns \p false, \p dest is unchanged.
+            If the item has been taken by another thread concurrently, the function
+            retries after \p back_off until the deque is empty.
+        */
+        bool steal( value_type& dest )
+        {
+            back_off bkoff;
+            while ( true ) {
+                {
+                    rcu_lock l;
+                    index_type t = base_class::m_nTop.load( memory_model::memory_order_acquire );
+                    atomics::atomic_thread_fence( memory_model::memory_order_seq_cst );
+                    index_type b = base_class::m_nBottom.load( memory_model::memory_order_acquire );
+                    if ( t >= b ) {
+                        base_class::m_Stat.onStealEmpty();
+                        return false;
+                    }
+
+                    array_type * a = base_class::m_pArray.load( memory_model::memory_order_acquire );
+                    if ( base_class::try_steal( a, t, dest ))
+                        return true;
+                }
+                bkoff();
+            }
+        }
+
+        /// Returns the number of items in the deque
+        /**
+            The value is approximate if the deque is changed concurrently.
+        */
+        size_t size() const
+        {
+            return base_class::size();
+        }
+
+        /// Checks if the deque is empty
+        bool empty() const
+        {
+            return base_class::empty();
+        }
+
+        /// Pops all items (owner only)
+        void clear()
+        {
+            base_class::clear();
+        }
+
+        /// Returns current capacity of the circular array
+        size_t capacity() const
+        {
+            return base_class::capacity();
+        }
+
+        /// Returns internal statistics
+        stat const& statistics() const
+        {
+            return base_class::statistics();
+        }
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_CHASE_LEV_DEQUE_RCU_H
@@ -0,0 +1,579 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_CLOCK_CACHE_H
+#define __CDS_CONTAINER_CLOCK_CACHE_H
+
+#include <cds/opt/hash.h>
+#include <cds/container/split_list_map.h>
+#include <cds/container/vyukov_mpmc_cycle_queue.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace container {
+
+    /// ClockCache related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace clock_cache {
+
+        /// ClockCache internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type    m_nHit          ;   ///< Count of successful lookups
+            counter_type    m_nMiss         ;   ///< Count of failed lookups
+            counter_type    m_nInsert       ;   ///< Count of inserted items
+            counter_type    m_nInsertFailed ;   ///< Count of failed insertions (the key already exists)
+            counter_type    m_nEvict        ;   ///< Count of items evicted by CLOCK algorithm
+            counter_type    m_nSecondChance ;   ///< Count of items kept by the clock hand since their access bit was set
+            counter_type    m_nStaleSlot    ;   ///< Count of reused slots whose items have been erased explicitly
+            counter_type    m_nFreeSlot     ;   ///< Count of insertions that have used a free slot without eviction
+            counter_type    m_nSlotWait     ;   ///< Count of full clock rounds without a free slot (all slots are busy)
+
+            //@cond
+            void onHit()            { ++m_nHit; }
+            void onMiss()           { ++m_nMiss; }
+            void onInsert()         { ++m_nInsert; }
+            void onInsertFailed()   { ++m_nInsertFailed; }
+            void onEvict()          { ++m_nEvict; }
+            void onSecondChance()   { ++m_nSecondChance; }
+            void onStaleSlot()      { ++m_nStaleSlot; }
+            void onFreeSlot()       { ++m_nFreeSlot; }
+            void onSlotWait()       { ++m_nSlotWait; }
+            //@endcond
+        };
+
+        /// ClockCache dummy statistics, no overhead
+        struct empty_stat
+        {
+            //@cond
+            void onHit() const          {}
+            void onMiss() const         {}
+            void onInsert() const       {}
+            void onInsertFailed() const {}
+            void onEvict() const        {}
+            void onSecondChance() const {}
+            void onStaleSlot() const    {}
+            void onFreeSlot() const     {}
+            void onSlotWait() const     {}
+            //@endcond
+        };
+
+        /// ClockCache default traits
+        struct type_traits
+        {
+            /// Traits of underlying \p SplitListMap
+            /**
+                The traits must specify at least the ordered list and the hash functor,
+                see \ref cds_nonintrusive_SplitListMap_hp "SplitListMap".
+            */
+            typedef split_list::type_traits     map_traits;
+
+            /// Back-off strategy used when all slots of the cache are busy, default is \p cds::backoff::Default
+            typedef cds::backoff::Default       back_off;
+
+            /// Internal statistics, possible predefined types are \ref stat, \ref empty_stat (the default)
+            typedef clock_cache::empty_stat     stat;
+
+            /// Allocator for the clock slot array and the free slot queue, default is \ref CDS_DEFAULT_ALLOCATOR
+            typedef CDS_DEFAULT_ALLOCATOR       allocator;
+        };
+
+        /// [type-option] Traits of underlying \p SplitListMap for \p ClockCache
+        template <typename Traits>
+        struct map_traits {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                typedef Traits map_traits;
+            };
+            //@endcond
+        };
+
+        /// Metafunction converting option list to traits for \p ClockCache
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options are:
+            - \p clock_cache::map_traits - traits of underlying \p SplitListMap, mandatory option
+            - \p opt::back_off - back-off strategy used when all slots of the cache are busy, default is \p cds::backoff::Default
+            - \p opt::stat - internal statistics, possible type: \ref stat, \ref empty_stat (the default)
+            - \p opt::allocator - allocator for the clock slot array and the free slot queue, default is \ref CDS_DEFAULT_ALLOCATOR
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+
+            // Mapped type of underlying map: the value, the access bit and the index of owning slot
+            template <typename Value>
+            struct entry
+            {
+                Value                       m_Value;
+                atomics::atomic<bool>       m_bAccessed;
+                size_t                      m_nSlot;
+
+                template <typename... Args>
+                entry( size_t nSlot, Args&&... args )
+                    : m_Value( std::forward<Args>(args)... )
+                    , m_bAccessed( false )
+                    , m_nSlot( nSlot )
+                {}
+
+                entry( entry const& src )
+                    : m_Value( src.m_Value )
+                    , m_bAccessed( src.m_bAccessed.load( atomics::memory_order_relaxed ))
+                    , m_nSlot( src.m_nSlot )
+                {}
+
+                entry( entry&& src )
+                    : m_Value( std::move( src.m_Value ))
+                    , m_bAccessed( src.m_bAccessed.load( atomics::memory_order_relaxed ))
+                    , m_nSlot( src.m_nSlot )
+                {}
+            };
+
+            // Clock slot. The key is written by the thread that owns the slot (slot_busy state) only
+            template <typename Key>
+            struct slot
+            {
+                atomics::atomic<unsigned int>   m_nState;
+                Key                             m_Key;
+
+                slot()
+                    : m_nState( 0 )
+                {}
+            };
+        } // namespace details
+        //@endcond
+
+    } // namespace clock_cache
+
+    /// Concurrent bounded cache with CLOCK eviction
+    /** @ingroup cds_nonintrusive_map
+        @anchor cds_nonintrusive_ClockCache
+
+        The cache is a map of bounded capacity built on \ref cds_nonintrusive_SplitListMap_hp "SplitListMap".
+        When the cache is full, the insertion evicts an item chosen by CLOCK (second chance) algorithm:
+        - each item has an access bit that is set by successful lookup. The bit lives in the map node,
+            so the lookup is lock-free and it does not write shared data if the bit is already set;
+        - the cache has an array of \p nCapacity slots, each slot refers to the key of one item.
+            The indices of free slots are kept in the bounded queue \p VyukovMPMCCycleQueue;
+        - the inserting thread takes a free slot from the queue. If there is no free slot,
+            the thread advances the clock hand (an atomic counter) and examines the slots until it finds
+            a slot whose item has access bit cleared. The access bit of the item passed is cleared
+            (the item gets second chance);
+        - the victim is erased from the map, and its slot is reused for the new item.
+
+        Thus, the eviction is incremental: each insertion performs the eviction work for one item only.
+        A helper thread may free the slots in advance by calling \p evict(), then the insertions
+        use the free slots without eviction.
+
+        The eviction order is approximate under concurrency. If a key is explicitly erased
+        and inserted again while the clock hand is examining its old slot, the new item may be evicted
+        before its turn.
+
+        Template parameters:
+        - \p GC - garbage collector used, for example, \p gc::HP or \p gc::PTB
+        - \p Key - key type. It must be default-constructible and copy-assignable,
+            since a copy of the key is stored in the clock slot
+        - \p Value - value type
+        - \p Traits - type traits, see \p clock_cache::type_traits. The traits must specify \p map_traits
+            for underlying \p SplitListMap. Instead of declaring \p clock_cache::type_traits -based
+            struct you may apply option-based notation with \p clock_cache::make_traits metafunction.
+
+        As for \p SplitListMap, you should include the header of the ordered list first:
+        \code
+        #include <cds/container/michael_list_hp.h>
+        #include <cds/container/clock_cache.h>
+
+        typedef cds::container::ClockCache< cds::gc::HP, int, std::string,
+            cds::container::clock_cache::make_traits<
+                cds::container::clock_cache::map_traits<
+                    cds::container::split_list::make_traits<
+                        cds::container::split_list::ordered_list< cds::container::michael_list_tag >
+                        ,cds::opt::hash< std::hash<int> >
+                        ,cds::container::split_list::ordered_list_traits<
+                            cds::container::michael_list::make_traits<
+                                cds::opt::less< std::less<int> >
+                            >::type
+                        >
+                    >::type
+                >
+                ,cds::opt::stat< cds::container::clock_cache::stat<> >
+            >::type
+        > page_cache;
+
+        page_cache cache( 1024 );   // up to 1024 items
+        cache.insert( 1, "one" );
+
+        std::string s;
+        if ( cache.get( 1, s )) {
+            // hit
+        }
+        \endcode
+    */
+    template <
+        class GC,
+        typename Key,
+        typename Value,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = clock_cache::type_traits
+#else
+        class Traits
+#endif
+    >
+    class ClockCache
+    {
+    public:
+        typedef GC      gc          ;   ///< Garbage collector
+        typedef Key     key_type    ;   ///< Key type
+        typedef Value   mapped_type ;   ///< Value type
+        typedef Traits  options     ;   ///< Traits template parameter
+
+        typedef typename options::back_off  back_off    ;   ///< Back-off strategy
+        typedef typename options::stat      stat        ;   ///< Internal statistics
+        typedef typename options::allocator allocator   ;   ///< Slot array allocator
+
+    protected:
+        //@cond
+        typedef clock_cache::details::entry< mapped_type >  entry_type;
+        typedef clock_cache::details::slot< key_type >      slot_type;
+        typedef SplitListMap< gc, key_type, entry_type, typename options::map_traits > map_type;
+        typedef typename map_type::value_type   map_value_type;
+        typedef cds::details::Allocator< slot_type, allocator > slot_allocator;
+        typedef VyukovMPMCCycleQueue< size_t,
+            cds::opt::buffer< cds::opt::v::dynamic_buffer< size_t, allocator > >
+        > free_slot_queue;
+
+        enum {
+            slot_free,      // the slot is in the free slot queue
+            slot_busy,      // the slot is owned by a thread
+            slot_ready      // the slot refers to the item in the map
+        };
+
+        // Result of the examination of a slot by the clock hand
+        enum victim_state {
+            victim_stale,       // the item of the slot is not in the map
+            victim_accessed,    // the item has access bit set, the bit is cleared
+            victim_found        // the item is the victim
+        };
+
+        template <typename Func>
+        struct find_func_wrapper {
+            Func&   m_f;
+
+            find_func_wrapper( Func& f )
+                : m_f( f )
+            {}
+
+            void operator()( map_value_type& item )
+            {
+                // Avoid writing shared cache line if the bit is already set
+                if ( !item.second.m_bAccessed.load( atomics::memory_order_relaxed ))
+                    item.second.m_bAccessed.store( true, atomics::memory_order_relaxed );
+                m_f( item.first, item.second.m_Value );
+            }
+        };
+
+        struct clock_functor {
+            size_t          m_nSlot;
+            victim_state    m_State;
+
+            clock_functor( size_t nSlot )
+                : m_nSlot( nSlot )
+                , m_State( victim_stale )
+            {}
+
+            void operator()( map_value_type& item )
+            {
+                if ( item.second.m_nSlot != m_nSlot )
+                    m_State = victim_stale;     // the key has been erased and inserted again to another slot
+                else if ( item.second.m_bAccessed.load( atomics::memory_order_relaxed )) {
+                    item.second.m_bAccessed.store( false, atomics::memory_order_relaxed );
+                    m_State = victim_accessed;
+                }
+                else
+                    m_State = victim_found;
+            }
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        map_type                    m_Map;
+        size_t const                m_nCapacity;
+        slot_type *                 m_arrSlots;
+        free_slot_queue             m_FreeSlots;
+        atomics::atomic<size_t>     m_nHand;
+        stat                        m_Stat;
+        //@endcond
+
+    public:
+        /// Creates the cache of capacity \p nCapacity
+        /**
+            \p nLoadFactor is the load factor of underlying \p SplitListMap.
+        */
+        ClockCache( size_t nCapacity, size_t nLoadFactor = 1 )
+            : m_Map( nCapacity ? nCapacity : 1, nLoadFactor )
+            , m_nCapacity( nCapacity ? nCapacity : 1 )
+            , m_arrSlots( slot_allocator().NewArray( m_nCapacity ))
+            , m_FreeSlots( m_nCapacity < 2 ? 2 : m_nCapacity )
+            , m_nHand( 0 )
+        {
+            for ( size_t i = 0; i < m_nCapacity; ++i )
+                m_FreeSlots.push( i );
+        }
+
+        /// Destroys the cache
+        ~ClockCache()
+        {
+            m_Map.clear();
+            slot_allocator().Delete( m_arrSlots, m_nCapacity );
+        }
+
+        /// Inserts new item
+        /**
+            The function inserts the item with key \p key and value \p val into the cache.
+            If the cache is full, an item is evicted.
+            Returns \p false if the item with key \p key already exists in the cache.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            return emplace( key, val );
+        }
+
+        /// Inserts new item with value constructed from <tt>std::forward<Args>(args)...</tt>
+        /**
+            The function is similar to \p insert().
+        */
+        template <typename K, typename... Args>
+        bool emplace( K const& key, Args&&... args )
+        {
+            // Do not evict an item if the key exists
+            if ( m_Map.find( key )) {
+                m_Stat.onInsertFailed();
+                return false;
+            }
+
+            size_t nSlot = acquire_slot();
+            slot_type& s = m_arrSlots[nSlot];
+            s.m_Key = key;
+            if ( m_Map.emplace( key, nSlot, std::forward<Args>(args)... )) {
+                s.m_nState.store( slot_ready, atomics::memory_order_release );
+                m_Stat.onInsert();
+                return true;
+            }
+            free_slot( nSlot );
+            m_Stat.onInsertFailed();
+            return false;
+        }
+
+        /// Finds the item with key \p key
+        /**
+            The function searches the item with key \p key, marks it as accessed
+            and calls the functor \p f for the item found:
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type& val );
+            };
+            \endcode
+            The functor is called under the protection of the garbage collector,
+            it does not serialize simultaneous access to the item.
+
+            The function returns \p true if \p key is found (the cache hit), \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+            if ( m_Map.find( key, find_func_wrapper<Func>( f ))) {
+                m_Stat.onHit();
+                return true;
+            }
+            m_Stat.onMiss();
+            return false;
+        }
+
+        /// Finds the item with key \p key and copies its value to \p dest
+        /**
+            The function marks the item found as accessed.
+            It returns \p true if \p key is found (the cache hit), \p false otherwise.
+        */
+        template <typename K>
+        bool get( K const& key, mapped_type& dest )
+        {
+            return find( key, [&dest]( key_type const&, mapped_type& val ) { dest = val; } );
+        }
+
+        /// Checks whether the cache contains \p key
+        /**
+            Unlike \p find(), the function neither marks the item as accessed nor counts the hit or miss.
+        */
+        template <typename K>
+        bool contains( K const& key )
+        {
+            return m_Map.find( key );
+        }
+
+        /// Erases the item with key \p key
+        /**
+            The slot of the item is freed later by the clock hand.
+            Returns \p true if \p key is found and erased, \p false otherwise.
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return m_Map.erase( key );
+        }
+
+        /// Evicts up to \p nCount items
+        /**
+            The function advances the clock hand and frees the slots of the victims
+            and of the explicitly erased items.
+            It may be called by a helper thread to keep some slots free, so the insertion
+            does not need to evict. The function examines at most <tt>2 * capacity()</tt> slots.
+            Returns the count of freed slots.
+        */
+        size_t evict( size_t nCount = 1 )
+        {
+            size_t nFreed = 0;
+            for ( size_t nStep = 0; nFreed < nCount && nStep < m_nCapacity * 2; ++nStep ) {
+                slot_type& s = m_arrSlots[ next_slot() ];
+                unsigned int nState = slot_ready;
+                if ( s.m_nState.compare_exchange_strong( nState, slot_busy, atomics::memory_order_acquire, atomics::memory_order_relaxed )) {
+                    if ( try_evict( s, static_cast<size_t>( &s - m_arrSlots ))) {
+                        free_slot( static_cast<size_t>( &s - m_arrSlots ));
+                        ++nFreed;
+                    }
+                    else
+                        s.m_nState.store( slot_ready, atomics::memory_order_release );
+                }
+            }
+            return nFreed;
+        }
+
+        /// Clears the cache
+        /**
+            The slots of erased items are freed later by the clock hand.
+        */
+        void clear()
+        {
+            m_Map.clear();
+        }
+
+        /// Checks if the cache is empty
+        bool empty() const
+        {
+            return m_Map.empty();
+        }
+
+        /// Returns item count in the cache
+        size_t size() const
+        {
+            return m_Map.size();
+        }
+
+        /// Returns the capacity of the cache
+        size_t capacity() const
+        {
+            return m_nCapacity;
+        }
+
+        /// Returns internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        size_t next_slot()
+        {
+            return m_nHand.fetch_add( 1, atomics::memory_order_relaxed ) % m_nCapacity;
+        }
+
+        // Examines the slot owned by current thread; returns true if the slot can be reused
+        bool try_evict( slot_type& s, size_t nSlot )
+        {
+            typename map_type::guarded_ptr gp;
+            clock_functor f( nSlot );
+            if ( m_Map.get( gp, s.m_Key ))
+                f( *gp );
+            if ( f.m_State == victim_stale ) {
+                m_Stat.onStaleSlot();
+                return true;
+            }
+            if ( f.m_State == victim_accessed ) {
+                m_Stat.onSecondChance();
+                return false;
+            }
+
+            // Only the item examined is unlinked: if the key has been erased and inserted again
+            // to another slot meanwhile, the new item is kept
+            if ( m_Map.unlink( gp ))
+                m_Stat.onEvict();
+            return true;
+        }
+
+        void free_slot( size_t nSlot )
+        {
+            m_arrSlots[nSlot].m_nState.store( slot_free, atomics::memory_order_release );
+            CDS_VERIFY( m_FreeSlots.push( nSlot ));
+        }
+
+        bool pop_free_slot( size_t& nSlot )
+        {
+            if ( m_FreeSlots.pop( nSlot )) {
+                m_arrSlots[nSlot].m_nState.store( slot_busy, atomics::memory_order_relaxed );
+                m_Stat.onFreeSlot();
+                return true;
+            }
+            return false;
+        }
+
+        // Returns the index of the slot owned by current thread
+        size_t acquire_slot()
+        {
+            size_t nSlot;
+            if ( pop_free_slot( nSlot ))
+                return nSlot;
+
+            back_off bkoff;
+            size_t nBusy = 0;
+            while ( true ) {
+                nSlot = next_slot();
+                slot_type& s = m_arrSlots[nSlot];
+                unsigned int nState = slot_ready;
+                if ( s.m_nState.compare_exchange_strong( nState, slot_busy, atomics::memory_order_acquire, atomics::memory_order_relaxed )) {
+                    if ( try_evict( s, nSlot ))
+                        return nSlot;
+                    s.m_nState.store( slot_ready, atomics::memory_order_release );
+                }
+                else if ( ++nBusy >= m_nCapacity ) {
+                    // A full round without ready slot: the slots are busy or have been freed by other threads
+                    nBusy = 0;
+                    if ( pop_free_slot( nSlot ))
+                        return nSlot;
+                    m_Stat.onSlotWait();
+                    bkoff();
+                }
+            }
+        }
+        //@endcond
+    };
+
+}}  // namespace cds::container
+
+#endif  // #ifndef __CDS_CONTAINER_CLOCK_CACHE_H
@@ -20,7 +20,7 @@ namespace cds { namespace container {
             typedef Traits original_type_traits;
             typedef typename original_type_traits::probeset_type probeset_type;
             static bool const store_hash = original_type_traits::store_hash;
-            static unsigned int const store_hash_count = store_hash ? ((unsigned int) std::tuple_size< typename original_type_traits::hash::hash_tuple_type >::value) : 0;
+            static unsigned int const store_hash_count = store_hash ? ((unsigned int) original_type_traits::hash::size) : 0;
 
             struct node_type: public intrusive::cuckoo::node<probeset_type, store_hash_count>
             {
@@ -176,6 +176,8 @@ namespace cds { namespace container {
             The hash functors are passed as <tt> std::tuple< H1, H2, ... Hn > </tt>. The number of hash functors specifies
             the number \p k - the count of hash tables in cuckoo hashing. If the compiler supports variadic templates
             then k is unlimited, otherwise up to 10 different hash functors are supported.
+            Instead of the tuple, \p cds::opt::v::derived_hash_list may be used: it computes one 128-bit hash
+            and derives \p k hash values from it.
         - opt::mutex_policy - concurrent access policy.
             Available policies: cuckoo::striping, cuckoo::refinable.
             Default is cuckoo::striping.
@@ -745,6 +747,24 @@ namespace cds { namespace container {
             base_class::clear_and_dispose( node_disposer() );
         }
 
+        /// Calls \p f for each item of the map
+        /**
+            The functor \p Func interface is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The map is locked entirely while the items are being traversed,
+            see \p intrusive::CuckooSet::for_each() for details.
+            The functor may change <tt>item.second</tt>.
+        */
+        template <typename Func>
+        void for_each( Func f )
+        {
+            base_class::for_each( [&f]( node_type& node ) { f( node.m_val ); } );
+        }
+
         /// Checks if the map is empty
         /**
             Emptiness is checked by item counting: if item count is zero then the map is empty.
@@ -0,0 +1,236 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_DETAILS_ART_BASE_H
+#define __CDS_CONTAINER_DETAILS_ART_BASE_H
+
+#include <string>
+#include <type_traits>
+#include <cds/container/details/base.h>
+#include <cds/urcu/options.h>
+#include <cds/algo/backoff_strategy.h>
+
+namespace cds { namespace container {
+
+    /// ArtMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace art {
+
+        /// ArtMap internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type    m_nFindSuccess      ;   ///< Count of success \p find() call
+            counter_type    m_nFindFailed       ;   ///< Count of failed \p find() call
+            counter_type    m_nInsertSuccess    ;   ///< Count of success \p insert() call
+            counter_type    m_nInsertFailed     ;   ///< Count of failed \p insert() call
+            counter_type    m_nEnsureExist      ;   ///< Count of \p ensure() call for existing key
+            counter_type    m_nEnsureNew        ;   ///< Count of \p ensure() call for new key
+            counter_type    m_nEraseSuccess     ;   ///< Count of success \p erase() call
+            counter_type    m_nEraseFailed      ;   ///< Count of failed \p erase() call
+            counter_type    m_nScan             ;   ///< Count of scan calls
+            counter_type    m_nNodeGrow         ;   ///< Count of node replacements by a larger node
+            counter_type    m_nNodeShrink       ;   ///< Count of node replacements by a smaller node
+            counter_type    m_nLeafSplit        ;   ///< Count of leaf replacements by a new node with two leaves
+            counter_type    m_nPrefixSplit      ;   ///< Count of compressed path splits
+            counter_type    m_nPathCompress     ;   ///< Count of nodes with one child removed from the path
+            counter_type    m_nRestart          ;   ///< Count of operation restarts caused by concurrent node modification
+
+            //@cond
+            void    onFindSuccess()     { ++m_nFindSuccess      ; }
+            void    onFindFailed()      { ++m_nFindFailed       ; }
+            void    onInsertSuccess()   { ++m_nInsertSuccess    ; }
+            void    onInsertFailed()    { ++m_nInsertFailed     ; }
+            void    onEnsureExist()     { ++m_nEnsureExist      ; }
+            void    onEnsureNew()       { ++m_nEnsureNew        ; }
+            void    onEraseSuccess()    { ++m_nEraseSuccess     ; }
+            void    onEraseFailed()     { ++m_nEraseFailed      ; }
+            void    onScan()            { ++m_nScan             ; }
+            void    onNodeGrow()        { ++m_nNodeGrow         ; }
+            void    onNodeShrink()      { ++m_nNodeShrink       ; }
+            void    onLeafSplit()       { ++m_nLeafSplit        ; }
+            void    onPrefixSplit()     { ++m_nPrefixSplit      ; }
+            void    onPathCompress()    { ++m_nPathCompress     ; }
+            void    onRestart()         { ++m_nRestart          ; }
+            //@endcond
+        };
+
+        /// ArtMap empty statistics
+        struct empty_stat {
+            //@cond
+            void    onFindSuccess()     const {}
+            void    onFindFailed()      const {}
+            void    onInsertSuccess()   const {}
+            void    onInsertFailed()    const {}
+            void    onEnsureExist()     const {}
+            void    onEnsureNew()       const {}
+            void    onEraseSuccess()    const {}
+            void    onEraseFailed()     const {}
+            void    onScan()            const {}
+            void    onNodeGrow()        const {}
+            void    onNodeShrink()      const {}
+            void    onLeafSplit()       const {}
+            void    onPrefixSplit()     const {}
+            void    onPathCompress()    const {}
+            void    onRestart()         const {}
+            //@endcond
+        };
+
+        /// Default key encoder
+        /**
+            The radix tree orders the keys by their binary representation, so the key should be converted
+            to a byte string that is compared lexicographically in the same order as the keys.
+            The encoder is a light-weight object constructed from the key; it has the following interface:
+            \code
+            struct encoder {
+                encoder( key_type const& key );
+                // Returns length of the byte string
+                size_t size() const;
+                // Returns i-th byte of the string
+                unsigned char operator[]( size_t i ) const;
+            };
+            \endcode
+            The encoder is constructed from the argument of \p find(), \p erase() and other member functions,
+            so it may support other argument types, for example, <tt>char const *</tt> for \p std::string key.
+
+            The library provides the encoders for integral types (big-endian byte order, the sign bit of signed type is inverted)
+            and for \p std::string (the characters compared as <tt>unsigned char</tt> like \p std::string::compare() does).
+            A string may be a prefix of another string.
+        */
+        template <typename Key, typename Enable = void>
+        struct encoder;
+
+        //@cond
+        template <typename Key>
+        struct encoder< Key, typename std::enable_if< std::is_integral<Key>::value >::type >
+        {
+            unsigned char   m_Bytes[ sizeof(Key) ];
+
+            encoder( Key key )
+            {
+                typedef typename std::make_unsigned<Key>::type unsigned_key;
+                unsigned_key n = static_cast<unsigned_key>( key );
+                if ( std::is_signed<Key>::value )
+                    n ^= unsigned_key( unsigned_key(1) << ( sizeof(Key) * 8 - 1 ));
+                for ( size_t i = sizeof(Key); i > 0; --i ) {
+                    m_Bytes[i - 1] = static_cast<unsigned char>( n & 0xFF );
+                    n = static_cast<unsigned_key>( n >> 8 );
+                }
+            }
+
+            size_t size() const
+            {
+                return sizeof(Key);
+            }
+
+            unsigned char operator[]( size_t i ) const
+            {
+                return m_Bytes[i];
+            }
+        };
+
+        template <>
+        struct encoder< std::string >
+        {
+            char const *    m_pStr;
+            size_t          m_nLen;
+
+            encoder( std::string const& s )
+                : m_pStr( s.data() )
+                , m_nLen( s.size() )
+            {}
+
+            encoder( char const * s )
+                : m_pStr( s )
+                , m_nLen( std::char_traits<char>::length( s ))
+            {}
+
+            size_t size() const
+            {
+                return m_nLen;
+            }
+
+            unsigned char operator[]( size_t i ) const
+            {
+                return static_cast<unsigned char>( m_pStr[i] );
+            }
+        };
+        //@endcond
+
+        /// ArtMap default type traits
+        struct type_traits
+        {
+            /// Key encoder
+            /**
+                If the option is not specified, \p art::encoder<Key> is used.
+                See \p art::encoder for the encoder interface.
+            */
+            typedef opt::none                       key_encoder;
+
+            /// Item counter
+            /**
+                The type for item counting feature,
+                 by default it is disabled (\p atomicity::empty_item_counter)
+            */
+            typedef atomicity::empty_item_counter   item_counter;
+
+            /// Back-off strategy used to wait for a locked node, default is \p cds::backoff::Default
+            typedef cds::backoff::Default           back_off;
+
+            /// Allocator for the nodes and the leaves, default is \ref CDS_DEFAULT_ALLOCATOR
+            typedef CDS_DEFAULT_ALLOCATOR           allocator;
+
+            /// Internal statistics, by default it is disabled (\p art::empty_stat)
+            typedef empty_stat                      stat;
+
+            /// RCU deadlock checking policy
+            /**
+                List of available options see \p opt::rcu_check_deadlock
+            */
+            typedef opt::v::rcu_throw_deadlock      rcu_check_deadlock;
+        };
+
+        /// [type-option] Key encoder for \p ArtMap
+        /**
+            See \p art::encoder for the encoder interface.
+        */
+        template <typename Encoder>
+        struct key_encoder {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                typedef Encoder key_encoder;
+            };
+            //@endcond
+        };
+
+        /// Metafunction converting option list to ArtMap traits
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options list see \ref ArtMap.
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+    } // namespace art
+
+    // Forward declarations
+    //@cond
+    template < class GC, typename Key, typename T, class Traits = art::type_traits >
+    class ArtMap;
+    //@endcond
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_DETAILS_ART_BASE_H
@@ -24,6 +24,21 @@ namespace container {
         using namespace cds::intrusive::opt;
     }   // namespace opt
 
+    //@cond
+    namespace details {
+        // Selects node allocator by opt::allocator and opt::node_pool options
+        template <typename Node, typename Allocator, typename NodePool>
+        struct select_node_allocator {
+            typedef typename NodePool::template rebind<Node>::other type;
+        };
+
+        template <typename Node, typename Allocator>
+        struct select_node_allocator< Node, Allocator, cds::opt::none > {
+            typedef typename Allocator::template rebind<Node>::other type;
+        };
+    }   // namespace details
+    //@endcond
+
     /// @defgroup cds_nonintrusive_containers Non-intrusive containers
     /** @defgroup cds_nonintrusive_helper Helper structs for non-intrusive containers
         @ingroup cds_nonintrusive_containers
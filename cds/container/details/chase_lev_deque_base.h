@@ -0,0 +1,328 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_DETAILS_CHASE_LEV_DEQUE_BASE_H
+#define __CDS_CONTAINER_DETAILS_CHASE_LEV_DEQUE_BASE_H
+
+#include <cds/container/details/base.h>
+#include <cds/opt/options.h>
+#include <cds/details/allocator.h>
+#include <cds/algo/int_algo.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/cxx11_atomic.h>
+#include <cds/urcu/options.h>
+
+namespace cds { namespace container {
+
+    /// ChaseLevDeque related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace chase_lev_deque {
+
+        /// ChaseLevDeque internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type    m_nPush         ;   ///< Count of push operations
+            counter_type    m_nPop          ;   ///< Count of success pop operations
+            counter_type    m_nPopEmpty     ;   ///< Count of pop operations from empty deque
+            counter_type    m_nPopContended ;   ///< Count of pop operations that have lost the last item to a thief
+            counter_type    m_nSteal        ;   ///< Count of success steal operations
+            counter_type    m_nStealEmpty   ;   ///< Count of steal operations from empty deque
+            counter_type    m_nStealContended;  ///< Count of failed CAS on the top index in steal operations
+            counter_type    m_nGrow         ;   ///< Count of array growths
+
+            //@cond
+            void onPush()           { ++m_nPush; }
+            void onPop()            { ++m_nPop; }
+            void onPopEmpty()       { ++m_nPopEmpty; }
+            void onPopContended()   { ++m_nPopContended; }
+            void onSteal()          { ++m_nSteal; }
+            void onStealEmpty()     { ++m_nStealEmpty; }
+            void onStealContended() { ++m_nStealContended; }
+            void onGrow()           { ++m_nGrow; }
+            //@endcond
+        };
+
+        /// ChaseLevDeque dummy statistics, no overhead
+        struct empty_stat
+        {
+            //@cond
+            void onPush() const           {}
+            void onPop() const            {}
+            void onPopEmpty() const       {}
+            void onPopContended() const   {}
+            void onSteal() const          {}
+            void onStealEmpty() const     {}
+            void onStealContended() const {}
+            void onGrow() const           {}
+            //@endcond
+        };
+
+        /// ChaseLevDeque default type traits
+        struct type_traits
+        {
+            /// Allocator of the circular array, default is \ref CDS_DEFAULT_ALLOCATOR
+            typedef CDS_DEFAULT_ALLOCATOR   allocator;
+
+            /// Back-off strategy for \p steal(), default is \p cds::backoff::Default
+            typedef cds::backoff::Default   back_off;
+
+            /// Internal statistics, possible predefined types are \ref stat, \ref empty_stat (the default)
+            typedef chase_lev_deque::empty_stat stat;
+
+            /// Memory model, default is \p opt::v::relaxed_ordering. See \p cds::opt::memory_model for the full list of possible types
+            typedef opt::v::relaxed_ordering    memory_model;
+
+            /// Alignment of the top and bottom indices, default is cache line alignment. See \p cds::opt::alignment option specification
+            enum { alignment = opt::cache_line_alignment };
+
+            /// RCU deadlock checking policy (only for \ref cds_container_ChaseLevDeque_rcu "RCU-based ChaseLevDeque")
+            /**
+                List of available options see \p opt::rcu_check_deadlock
+            */
+            typedef opt::v::rcu_throw_deadlock      rcu_check_deadlock;
+        };
+
+        /// Metafunction converting option list to traits for ChaseLevDeque
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options are:
+            - \p opt::allocator - the allocator of the circular array, default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::back_off - back-off strategy used when \p steal() has lost the race with another thief,
+                default is \p cds::backoff::Default
+            - \p opt::stat - internal statistics, possible type: \ref stat, \ref empty_stat (the default)
+            - \p opt::memory_model - C++ memory ordering model.
+                List of all available memory ordering see \p opt::memory_model.
+                Default is \p cds::opt::v::relaxed_ordering
+            - \p opt::alignment - the alignment of the top and bottom indices, default is \p opt::cache_line_alignment.
+                The owner modifies the bottom index and the thieves modify the top one, so the indices
+                should not share a cache line.
+            - \p opt::rcu_check_deadlock - a deadlock checking policy for \ref cds_container_ChaseLevDeque_rcu "RCU-based deque".
+                Default is \p opt::v::rcu_throw_deadlock
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+
+            // Circular array of the deque
+            template <typename T, class Allocator>
+            class circular_array
+            {
+            public:
+                typedef T                       value_type;
+                typedef atomics::atomic<T>      cell;
+                typedef int64_t                 index_type;
+
+            private:
+                typedef cds::details::Allocator< cell, Allocator >    cell_allocator;
+
+                size_t const    m_nCapacity;
+                size_t const    m_nMask;
+                cell *          m_arrCells;
+
+            public:
+                explicit circular_array( size_t nCapacity )
+                    : m_nCapacity( nCapacity )
+                    , m_nMask( nCapacity - 1 )
+                    , m_arrCells( cell_allocator().NewArray( nCapacity ))
+                {
+                    assert( cds::beans::is_power2( nCapacity ));
+                }
+
+                ~circular_array()
+                {
+                    cell_allocator().Delete( m_arrCells, m_nCapacity );
+                }
+
+                size_t capacity() const
+                {
+                    return m_nCapacity;
+                }
+
+                value_type get( index_type i ) const
+                {
+                    return m_arrCells[ static_cast<size_t>(i) & m_nMask ].load( atomics::memory_order_relaxed );
+                }
+
+                void put( index_type i, value_type const& v )
+                {
+                    m_arrCells[ static_cast<size_t>(i) & m_nMask ].store( v, atomics::memory_order_relaxed );
+                }
+            };
+
+            template <typename T, class Traits>
+            class deque_base
+            {
+            public:
+                typedef T       value_type;
+                typedef Traits  options;
+
+                typedef typename options::allocator     allocator;
+                typedef typename options::back_off      back_off;
+                typedef typename options::stat          stat;
+                typedef typename options::memory_model  memory_model;
+
+            protected:
+                typedef circular_array< value_type, allocator >     array_type;
+                typedef typename array_type::index_type             index_type;
+                typedef cds::details::Allocator< array_type, allocator >    array_allocator;
+
+                typedef typename opt::details::alignment_setter< atomics::atomic<index_type>, options::alignment >::type aligned_index;
+                typedef typename opt::details::alignment_setter< atomics::atomic<array_type *>, options::alignment >::type aligned_array_ptr;
+
+                struct array_disposer {
+                    void operator()( array_type * p )
+                    {
+                        free_array( p );
+                    }
+                };
+
+            protected:
+                aligned_index       m_nTop      ;   // modified by thieves and by the owner for the last item
+                aligned_index       m_nBottom   ;   // modified by the owner only
+                aligned_array_ptr   m_pArray    ;   // replaced by the owner only
+                stat                m_Stat;
+
+            protected:
+                explicit deque_base( size_t nCapacity )
+                    : m_nTop( 0 )
+                    , m_nBottom( 0 )
+                    , m_pArray( array_allocator().New( cds::beans::ceil2( nCapacity < 2 ? 2 : nCapacity )))
+                {}
+
+                ~deque_base()
+                {
+                    free_array( m_pArray.load( atomics::memory_order_relaxed ));
+                }
+
+                static void free_array( array_type * p )
+                {
+                    array_allocator().Delete( p );
+                }
+
+                // Owner: pushes v; if the array is full, the function returns the old array that must be retired
+                array_type * do_push( value_type const& v )
+                {
+                    index_type b = m_nBottom.load( memory_model::memory_order_relaxed );
+                    index_type t = m_nTop.load( memory_model::memory_order_acquire );
+                    array_type * a = m_pArray.load( memory_model::memory_order_relaxed );
+                    array_type * pOld = nullptr;
+
+                    if ( b - t > static_cast<index_type>( a->capacity() ) - 1 ) {
+                        pOld = a;
+                        a = grow( a, t, b );
+                    }
+
+                    a->put( b, v );
+                    atomics::atomic_thread_fence( memory_model::memory_order_release );
+                    m_nBottom.store( b + 1, memory_model::memory_order_relaxed );
+                    m_Stat.onPush();
+                    return pOld;
+                }
+
+                // Thief: tries to take the item at index t of array a
+                bool try_steal( array_type * a, index_type t, value_type& dest )
+                {
+                    value_type v = a->get( t );
+                    if ( m_nTop.compare_exchange_strong( t, t + 1, memory_model::memory_order_seq_cst, atomics::memory_order_relaxed )) {
+                        dest = v;
+                        m_Stat.onSteal();
+                        return true;
+                    }
+                    m_Stat.onStealContended();
+                    return false;
+                }
+
+            private:
+                array_type * grow( array_type * a, index_type t, index_type b )
+                {
+                    array_type * pNew = array_allocator().New( a->capacity() * 2 );
+                    for ( index_type i = t; i < b; ++i )
+                        pNew->put( i, a->get( i ));
+                    m_pArray.store( pNew, memory_model::memory_order_release );
+                    m_Stat.onGrow();
+                    return pNew;
+                }
+
+            protected:
+                // Owner: pops from the bottom
+                bool pop( value_type& dest )
+                {
+                    index_type b = m_nBottom.load( memory_model::memory_order_relaxed ) - 1;
+                    array_type * a = m_pArray.load( memory_model::memory_order_relaxed );
+                    m_nBottom.store( b, memory_model::memory_order_relaxed );
+                    atomics::atomic_thread_fence( memory_model::memory_order_seq_cst );
+                    index_type t = m_nTop.load( memory_model::memory_order_relaxed );
+
+                    if ( t <= b ) {
+                        // Non-empty deque
+                        if ( t == b ) {
+                            // The last item: compete with the thieves
+                            if ( !m_nTop.compare_exchange_strong( t, t + 1, memory_model::memory_order_seq_cst, atomics::memory_order_relaxed )) {
+                                m_nBottom.store( b + 1, memory_model::memory_order_relaxed );
+                                m_Stat.onPopContended();
+                                return false;
+                            }
+                            m_nBottom.store( b + 1, memory_model::memory_order_relaxed );
+                        }
+                        dest = a->get( b );
+                        m_Stat.onPop();
+                        return true;
+                    }
+
+                    // Empty deque
+                    m_nBottom.store( b + 1, memory_model::memory_order_relaxed );
+                    m_Stat.onPopEmpty();
+                    return false;
+                }
+
+                size_t size() const
+                {
+                    index_type b = m_nBottom.load( memory_model::memory_order_relaxed );
+                    index_type t = m_nTop.load( memory_model::memory_order_relaxed );
+                    return b > t ? static_cast<size_t>( b - t ) : 0;
+                }
+
+                bool empty() const
+                {
+                    return size() == 0;
+                }
+
+                void clear()
+                {
+                    value_type v;
+                    while ( pop( v ));
+                }
+
+                size_t capacity() const
+                {
+                    return m_pArray.load( memory_model::memory_order_relaxed )->capacity();
+                }
+
+                stat const& statistics() const
+                {
+                    return m_Stat;
+                }
+            };
+
+        } // namespace details
+        //@endcond
+
+    } // namespace chase_lev_deque
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_DETAILS_CHASE_LEV_DEQUE_BASE_H
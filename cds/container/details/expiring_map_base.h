@@ -0,0 +1,167 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_DETAILS_EXPIRING_MAP_BASE_H
+#define __CDS_CONTAINER_DETAILS_EXPIRING_MAP_BASE_H
+
+#include <chrono>
+#include <cds/container/details/base.h>
+#include <cds/opt/compare.h>
+#include <cds/opt/hash.h>
+#include <cds/algo/backoff_strategy.h>
+
+namespace cds { namespace container {
+
+    /// ExpiringHashMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace expiring_map {
+
+        /// ExpiringHashMap internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type    m_nInsert       ;   ///< Count of inserted items
+            counter_type    m_nInsertFailed ;   ///< Count of failed insertions (a live item with the key exists)
+            counter_type    m_nFindHit      ;   ///< Count of successful lookups
+            counter_type    m_nFindMiss     ;   ///< Count of failed lookups, including the expired items found
+            counter_type    m_nTouch        ;   ///< Count of successful expiry time updates
+            counter_type    m_nExpireLazy   ;   ///< Count of expired items removed by lookup or insertion
+            counter_type    m_nExpireTimer  ;   ///< Count of expired items removed by the timer wheel
+            counter_type    m_nStaleTimer   ;   ///< Count of timer records of the items removed or touched before expiration
+            counter_type    m_nTimerRound   ;   ///< Count of \p expire() calls that have advanced the timer wheel
+
+            //@cond
+            void onInsert()         { ++m_nInsert; }
+            void onInsertFailed()   { ++m_nInsertFailed; }
+            void onFindHit()        { ++m_nFindHit; }
+            void onFindMiss()       { ++m_nFindMiss; }
+            void onTouch()          { ++m_nTouch; }
+            void onExpireLazy()     { ++m_nExpireLazy; }
+            void onExpireTimer()    { ++m_nExpireTimer; }
+            void onStaleTimer()     { ++m_nStaleTimer; }
+            void onTimerRound()     { ++m_nTimerRound; }
+            //@endcond
+        };
+
+        /// ExpiringHashMap dummy statistics, no overhead
+        struct empty_stat
+        {
+            //@cond
+            void onInsert() const       {}
+            void onInsertFailed() const {}
+            void onFindHit() const      {}
+            void onFindMiss() const     {}
+            void onTouch() const        {}
+            void onExpireLazy() const   {}
+            void onExpireTimer() const  {}
+            void onStaleTimer() const   {}
+            void onTimerRound() const   {}
+            //@endcond
+        };
+
+        /// ExpiringHashMap default traits
+        struct type_traits
+        {
+            /// Hash functor for the key, mandatory option
+            typedef opt::none       hash;
+
+            /// Key comparison functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+            */
+            typedef opt::none       compare;
+
+            /// Specifies binary predicate used for key comparison.
+            /**
+                Default is \p std::less<Key>.
+            */
+            typedef opt::none       less;
+
+            /// Item counter, default is \p atomicity::item_counter
+            typedef atomicity::item_counter     item_counter;
+
+            /// Allocator for the items, the bucket table and the timer records, default is \ref CDS_DEFAULT_ALLOCATOR
+            typedef CDS_DEFAULT_ALLOCATOR       allocator;
+
+            /// C++ memory ordering model of the bucket lists, default is \p opt::v::relaxed_ordering
+            typedef opt::v::relaxed_ordering    memory_model;
+
+            /// Back-off strategy of the bucket lists, default is \p cds::backoff::Default
+            typedef cds::backoff::Default       back_off;
+
+            /// Internal statistics, possible predefined types are \ref stat, \ref empty_stat (the default)
+            typedef expiring_map::empty_stat    stat;
+
+            /// Clock type, default is \p std::chrono::steady_clock
+            typedef std::chrono::steady_clock   clock;
+
+            /// Resolution of the timer wheel in milliseconds, default is 10
+            enum { resolution = 10 };
+        };
+
+        /// [type-option] Clock type for \p ExpiringHashMap
+        /**
+            The \p Clock should meet the requirements of the standard clock, for example, \p std::chrono::steady_clock.
+        */
+        template <typename Clock>
+        struct clock {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                typedef Clock clock;
+            };
+            //@endcond
+        };
+
+        /// [type-option] Resolution of the timer wheel in milliseconds for \p ExpiringHashMap
+        template <unsigned int Milliseconds>
+        struct resolution {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { resolution = Milliseconds };
+            };
+            //@endcond
+        };
+
+        /// Metafunction converting option list to traits for \p ExpiringHashMap
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options are:
+            - \p opt::hash - hash functor for the key, mandatory option
+            - \p opt::compare - key comparison functor. No default functor is provided.
+                If the option is not specified, the \p opt::less is used.
+            - \p opt::less - specifies binary predicate used for key comparison. Default is \p std::less<Key>.
+            - \p opt::item_counter - item counter, default is \p atomicity::item_counter
+            - \p opt::allocator - allocator for the items, the bucket table and the timer records, default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::memory_model - C++ memory ordering model of the bucket lists, default is \p opt::v::relaxed_ordering
+            - \p opt::back_off - back-off strategy of the bucket lists, default is \p cds::backoff::Default
+            - \p opt::stat - internal statistics, possible type: \ref stat, \ref empty_stat (the default)
+            - \p expiring_map::clock - clock type, default is \p std::chrono::steady_clock
+            - \p expiring_map::resolution - resolution of the timer wheel in milliseconds, default is 10
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+    } // namespace expiring_map
+
+    //@cond
+    // Forward declaration
+    template < class GC, typename Key, typename Value, class Traits = expiring_map::type_traits >
+    class ExpiringHashMap;
+    //@endcond
+
+}}  // namespace cds::container
+
+#endif  // #ifndef __CDS_CONTAINER_DETAILS_EXPIRING_MAP_BASE_H
@@ -0,0 +1,176 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_DETAILS_FAT_SKIP_LIST_BASE_H
+#define __CDS_CONTAINER_DETAILS_FAT_SKIP_LIST_BASE_H
+
+#include <cds/container/details/base.h>
+#include <cds/opt/compare.h>
+#include <cds/urcu/options.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/intrusive/details/skip_list_base.h>
+
+namespace cds { namespace container {
+
+    /// FatSkipListMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace fat_skip_list {
+
+        /// Typedef for \p intrusive::skip_list::random_level_generator template
+        using cds::intrusive::skip_list::random_level_generator;
+        /// Typedef for \p intrusive::skip_list::xorshift class
+        using cds::intrusive::skip_list::xorshift;
+        /// Typedef for \p intrusive::skip_list::turbo_pascal class
+        using cds::intrusive::skip_list::turbo_pascal;
+
+        /// FatSkipListMap internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type    m_nFindSuccess      ;   ///< Count of success \p find() call
+            counter_type    m_nFindFailed       ;   ///< Count of failed \p find() call
+            counter_type    m_nInsertSuccess    ;   ///< Count of success \p insert() call
+            counter_type    m_nInsertFailed     ;   ///< Count of failed \p insert() call
+            counter_type    m_nEnsureExist      ;   ///< Count of \p ensure() call for existing key
+            counter_type    m_nEnsureNew        ;   ///< Count of \p ensure() call for new key
+            counter_type    m_nEraseSuccess     ;   ///< Count of success \p erase() call
+            counter_type    m_nEraseFailed      ;   ///< Count of failed \p erase() call
+            counter_type    m_nScan             ;   ///< Count of \p scan() call
+            counter_type    m_nNodeSplit        ;   ///< Count of node splits
+            counter_type    m_nNodeMerge        ;   ///< Count of node merges
+            counter_type    m_nMergeRejected    ;   ///< Count of underfull nodes not merged since the predecessor has no room
+            counter_type    m_nRestart          ;   ///< Count of operation restarts caused by concurrent node modification
+
+            //@cond
+            void    onFindSuccess()     { ++m_nFindSuccess      ; }
+            void    onFindFailed()      { ++m_nFindFailed       ; }
+            void    onInsertSuccess()   { ++m_nInsertSuccess    ; }
+            void    onInsertFailed()    { ++m_nInsertFailed     ; }
+            void    onEnsureExist()     { ++m_nEnsureExist      ; }
+            void    onEnsureNew()       { ++m_nEnsureNew        ; }
+            void    onEraseSuccess()    { ++m_nEraseSuccess     ; }
+            void    onEraseFailed()     { ++m_nEraseFailed      ; }
+            void    onScan()            { ++m_nScan             ; }
+            void    onNodeSplit()       { ++m_nNodeSplit        ; }
+            void    onNodeMerge()       { ++m_nNodeMerge        ; }
+            void    onMergeRejected()   { ++m_nMergeRejected    ; }
+            void    onRestart()         { ++m_nRestart          ; }
+            //@endcond
+        };
+
+        /// FatSkipListMap empty statistics
+        struct empty_stat {
+            //@cond
+            void    onFindSuccess()     const {}
+            void    onFindFailed()      const {}
+            void    onInsertSuccess()   const {}
+            void    onInsertFailed()    const {}
+            void    onEnsureExist()     const {}
+            void    onEnsureNew()       const {}
+            void    onEraseSuccess()    const {}
+            void    onEraseFailed()     const {}
+            void    onScan()            const {}
+            void    onNodeSplit()       const {}
+            void    onNodeMerge()       const {}
+            void    onMergeRejected()   const {}
+            void    onRestart()         const {}
+            //@endcond
+        };
+
+        /// FatSkipListMap default type traits
+        struct type_traits
+        {
+            /// Key comparison functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+
+                See \p cds::opt::compare option description for functor interface.
+            */
+            typedef opt::none                       compare;
+
+            /// Specifies binary predicate used for key compare.
+            /**
+                See \p cds::opt::less option description for predicate interface.
+            */
+            typedef opt::none                       less;
+
+            /// Item counter
+            /**
+                The type for item counting feature,
+                 by default it is disabled (\p atomicity::empty_item_counter)
+            */
+            typedef atomicity::empty_item_counter   item_counter;
+
+            /// Random level generator
+            /**
+                The random level generator is an important part of skip-list algorithm.
+                The node height in the skip-list have a probabilistic distribution
+                where half of the nodes that have level \p i also have level <tt>i+1</tt>.
+                Available generators are \p fat_skip_list::turbo_pascal (the default) and \p fat_skip_list::xorshift.
+            */
+            typedef turbo_pascal                    random_level_generator;
+
+            /// Back-off strategy used to wait for a locked node, default is \p cds::backoff::Default
+            typedef cds::backoff::Default           back_off;
+
+            /// Node allocator, default is \ref CDS_DEFAULT_ALLOCATOR
+            typedef CDS_DEFAULT_ALLOCATOR           allocator;
+
+            /// Internal statistics, by default it is disabled (\p fat_skip_list::empty_stat)
+            typedef empty_stat                      stat;
+
+            /// RCU deadlock checking policy
+            /**
+                List of available options see \p opt::rcu_check_deadlock
+            */
+            typedef opt::v::rcu_throw_deadlock      rcu_check_deadlock;
+
+            /// Maximum count of the keys in a node, default is 16
+            enum { node_capacity = 16 };
+        };
+
+        /// [type-option] Maximum count of the keys in a node of \p FatSkipListMap
+        /**
+            The capacity should be at least 4. The default capacity 16 places the keys
+            of a node with 8-byte keys and values into two cache lines.
+        */
+        template <unsigned int Capacity>
+        struct node_capacity {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { node_capacity = Capacity };
+            };
+            //@endcond
+        };
+
+        /// Metafunction converting option list to FatSkipListMap traits
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options list see \ref FatSkipListMap.
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+    } // namespace fat_skip_list
+
+    // Forward declarations
+    //@cond
+    template < class GC, typename Key, typename T, class Traits = fat_skip_list::type_traits >
+    class FatSkipListMap;
+    //@endcond
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_DETAILS_FAT_SKIP_LIST_BASE_H
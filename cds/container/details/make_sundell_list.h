@@ -0,0 +1,63 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_DETAILS_MAKE_SUNDELL_LIST_H
+#define __CDS_CONTAINER_DETAILS_MAKE_SUNDELL_LIST_H
+
+#include <cds/details/allocator.h>
+
+namespace cds { namespace container {
+
+    //@cond
+    namespace details {
+
+        template <class GC, typename T, class Traits>
+        struct make_sundell_list
+        {
+            typedef GC      gc;
+            typedef T       value_type;
+
+            struct node_type : public intrusive::sundell_list::node<gc>
+            {
+                value_type  m_Value;
+
+                node_type()
+                {}
+
+                template <typename Q>
+                node_type( Q const& v )
+                    : m_Value(v)
+                {}
+
+                template <typename... Args>
+                node_type( Args&&... args )
+                    : m_Value( std::forward<Args>(args)... )
+                {}
+            };
+
+            typedef Traits original_type_traits;
+
+            typedef typename original_type_traits::allocator::template rebind<node_type>::other  allocator_type;
+            typedef cds::details::Allocator< node_type, allocator_type >                cxx_allocator;
+
+            struct node_deallocator
+            {
+                void operator ()( node_type * pNode )
+                {
+                    cxx_allocator().Delete( pNode );
+                }
+            };
+
+            struct type_traits: public original_type_traits
+            {
+                typedef intrusive::sundell_list::base_hook< opt::gc<gc> >  hook;
+                typedef node_deallocator               disposer;
+            };
+
+            typedef intrusive::SundellList<gc, node_type, type_traits>  type;
+        };
+    }   // namespace details
+    //@endcond
+
+}}  // namespace cds::container
+
+#endif  // #ifndef __CDS_CONTAINER_DETAILS_MAKE_SUNDELL_LIST_H
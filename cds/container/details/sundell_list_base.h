@@ -0,0 +1,72 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_DETAILS_SUNDELL_LIST_BASE_H
+#define __CDS_CONTAINER_DETAILS_SUNDELL_LIST_BASE_H
+
+#include <cds/container/details/base.h>
+#include <cds/intrusive/details/sundell_list_base.h>
+
+namespace cds { namespace container {
+
+    /// SundellList doubly-linked list related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace sundell_list {
+
+        /// SundellList default type traits
+        struct type_traits
+        {
+            typedef CDS_DEFAULT_ALLOCATOR   allocator       ;   ///< allocator used to allocate new node
+
+            /// back-off strategy used
+            /**
+                If the option is not specified, the cds::backoff::Default is used.
+            */
+            typedef cds::backoff::Default           back_off;
+
+            /// Item counter
+            /**
+                The type for item counting feature.
+                Default is no item counter (\ref atomicity::empty_item_counter)
+            */
+            typedef atomicity::empty_item_counter     item_counter;
+
+            /// Link fields checking feature
+            /**
+                Default is \ref intrusive::opt::debug_check_link
+            */
+            static const opt::link_check_type link_checker = opt::debug_check_link;
+
+            /// C++ memory ordering model
+            /**
+                List of available memory ordering see opt::memory_model
+            */
+            typedef opt::v::relaxed_ordering        memory_model;
+        };
+
+        /// Metafunction converting option list to SundellList traits
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            See \ref SundellList, \ref type_traits, \ref cds::opt::make_options.
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, Options... >::type
+                ,Options...
+            >::type   type;
+#endif
+        };
+
+    } // namespace sundell_list
+
+    // Forward declarations
+    template <typename GC, typename T, typename Traits=sundell_list::type_traits>
+    class SundellList;
+
+}}  // namespace cds::container
+
+#endif  // #ifndef __CDS_CONTAINER_DETAILS_SUNDELL_LIST_BASE_H
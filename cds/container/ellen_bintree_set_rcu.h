@@ -607,6 +607,103 @@ namespace cds { namespace container {
             return pNode ? &pNode->m_Value : nullptr;
         }
 
+        /// Finds the item with minimal key greater than \p key
+        /** \anchor cds_nonintrusive_EllenBinTreeSet_rcu_find_next
+            The function searches the successor of \p key, i.e. the item with the least key
+            that is strictly greater than \p key, and returns the pointer to the item found.
+            \p key itself may or may not be in the set.
+            If there is no such item the function returns \p nullptr.
+
+            RCU should be locked before call the function.
+            Returned pointer is valid while RCU is locked.
+        */
+        template <typename Q>
+        value_type * find_next( Q const& key ) const
+        {
+            leaf_node * pNode = base_class::find_next( key );
+            return pNode ? &pNode->m_Value : nullptr;
+        }
+
+        /// Finds the successor of \p key using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeSet_rcu_find_next "find_next(Q const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        value_type * find_next_with( Q const& key, Less pred ) const
+        {
+            leaf_node * pNode = base_class::find_next_with( key,
+                cds::details::predicate_wrapper< leaf_node, Less, typename maker::value_accessor >());
+            return pNode ? &pNode->m_Value : nullptr;
+        }
+
+        /// Finds the item with maximal key less than \p key
+        /** \anchor cds_nonintrusive_EllenBinTreeSet_rcu_find_prev
+            The function searches the predecessor of \p key, i.e. the item with the greatest key
+            that is strictly less than \p key, and returns the pointer to the item found.
+            \p key itself may or may not be in the set.
+            If there is no such item the function returns \p nullptr.
+
+            RCU should be locked before call the function.
+            Returned pointer is valid while RCU is locked.
+        */
+        template <typename Q>
+        value_type * find_prev( Q const& key ) const
+        {
+            leaf_node * pNode = base_class::find_prev( key );
+            return pNode ? &pNode->m_Value : nullptr;
+        }
+
+        /// Finds the predecessor of \p key using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeSet_rcu_find_prev "find_prev(Q const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        value_type * find_prev_with( Q const& key, Less pred ) const
+        {
+            leaf_node * pNode = base_class::find_prev_with( key,
+                cds::details::predicate_wrapper< leaf_node, Less, typename maker::value_accessor >());
+            return pNode ? &pNode->m_Value : nullptr;
+        }
+
+        /// Calls \p f for each item with key in range <tt>[from, to]</tt>
+        /** \anchor cds_nonintrusive_EllenBinTreeSet_rcu_for_each_range
+            The function visits in ascending key order all items whose key \p k satisfies <tt>from <= k <= to</tt>.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor may change non-key fields of \p item only.
+
+            The function applies RCU lock internally for the whole scan. The scan is not a snapshot,
+            see \ref cds_intrusive_EllenBinTree_rcu_for_each_range "intrusive EllenBinTree::for_each_range"
+            for the concurrency notes. The function returns the number of items visited.
+        */
+        template <typename Q, typename Func>
+        size_t for_each_range( Q const& from, Q const& to, Func f ) const
+        {
+            return base_class::for_each_range( from, to, [&f]( leaf_node& node ) { f( node.m_Value ); } );
+        }
+
+        /// Calls \p f for each item in range <tt>[from, to]</tt> using \p pred predicate for key comparing
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeSet_rcu_for_each_range "for_each_range(Q const&, Q const&, Func)"
+            but \p pred is used for key comparing.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less, typename Func>
+        size_t for_each_range_with( Q const& from, Q const& to, Less pred, Func f ) const
+        {
+            return base_class::for_each_range_with( from, to,
+                cds::details::predicate_wrapper< leaf_node, Less, typename maker::value_accessor >(),
+                [&f]( leaf_node& node ) { f( node.m_Value ); } );
+        }
+
         /// Clears the set (non-atomic)
         /**
             The function unlink all items from the tree.
@@ -0,0 +1,530 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_EXPIRING_MAP_H
+#define __CDS_CONTAINER_EXPIRING_MAP_H
+
+#include <limits>
+#include <cds/container/details/expiring_map_base.h>
+#include <cds/container/details/guarded_ptr_cast.h>
+#include <cds/intrusive/impl/michael_list.h>
+#include <cds/intrusive/michael_set.h>
+#include <cds/details/binary_functor_wrapper.h>
+#include <cds/details/allocator.h>
+#include <cds/algo/timer_wheel.h>
+
+namespace cds { namespace container {
+
+    /// Michael's hash map with per-item expiration time
+    /** @ingroup cds_nonintrusive_map
+        \anchor cds_nonintrusive_ExpiringHashMap
+
+        The map is Michael's hash map (see \ref cds_nonintrusive_MichaelHashMap_hp "MichaelHashMap")
+        where each item can have an expiration time. The item without expiration time lives until it is erased.
+        The expired item is considered absent: it cannot be found, and its key can be inserted again.
+
+        The expired items are removed in two ways:
+        - lazily: the lookup or the insertion that meets an expired item unlinks it from its bucket;
+        - proactively: \p expire() removes the expired items tracked by the lock-free hierarchical timer wheel
+            (see \ref cds_timer_wheel_description "timer_wheel"). Each item with expiration time has a timer record
+            that contains its key, so \p expire() does not sweep the table: it costs <tt>O(expired)</tt>
+            plus the count of the wheel slots passed since the previous call.
+            \p expire() should be called periodically, for example, by a housekeeping thread.
+
+        The map is built on intrusive \p MichaelHashSet of the nodes that contain the key-value pair
+        and the expiration time. Since the expired node is removed by \p unlink(), the node re-inserted
+        with the same key is never removed by mistake. An expired node stays expired forever:
+        \p touch() can prolong only the item that has not expired yet.
+
+        The expiration time is measured by \p Traits::clock in milliseconds;
+        the granularity of the timer wheel is \p Traits::resolution milliseconds.
+
+        Template parameters:
+        - \p GC - garbage collector: \p gc::HP or \p gc::PTB
+        - \p Key - key type
+        - \p Value - value type
+        - \p Traits - map traits, default is \p expiring_map::type_traits.
+            Instead of defining \p Traits struct you may use option-based syntax with \p expiring_map::make_traits metafunction.
+
+        There are no specializations of \p %ExpiringHashMap for each GC. You should include
+        the header of the intrusive list for the GC you use:
+        \code
+        #include <cds/intrusive/michael_list_hp.h>
+        #include <cds/container/expiring_map.h>
+
+        typedef cds::container::ExpiringHashMap< cds::gc::HP, std::string, session,
+            cds::container::expiring_map::make_traits<
+                cds::opt::hash< std::hash<std::string> >
+                ,cds::container::expiring_map::resolution< 100 >
+            >::type
+        > session_map;
+
+        session_map sessions( 100000, 4 );
+        sessions.insert( sId, s, std::chrono::minutes( 30 ));
+
+        // Housekeeping thread
+        while ( !bStop ) {
+            sessions.expire();
+            std::this_thread::sleep_for( std::chrono::seconds( 1 ));
+        }
+        \endcode
+    */
+    template <
+        class GC,
+        typename Key,
+        typename Value,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = expiring_map::type_traits
+#else
+        class Traits
+#endif
+    >
+    class ExpiringHashMap
+    {
+    public:
+        typedef GC      gc          ;   ///< Garbage collector
+        typedef Key     key_type    ;   ///< Key type
+        typedef Value   mapped_type ;   ///< Value type
+        typedef std::pair< key_type const, mapped_type> value_type  ;   ///< Key-value pair
+        typedef Traits  options     ;   ///< Traits template parameter
+
+        typedef typename options::clock         clock_type  ;   ///< Clock type
+        typedef std::chrono::milliseconds       duration_type;  ///< Time-to-live type
+        typedef typename options::item_counter  item_counter;   ///< Item counter type
+        typedef typename options::stat          stat        ;   ///< Internal statistics type
+
+        /// Hash functor for \ref key_type
+        typedef typename cds::opt::v::hash_selector< typename options::hash >::type hash;
+
+        static CDS_CONSTEXPR_CONST unsigned int c_nResolution = options::resolution; ///< Timer wheel resolution in milliseconds
+        static_assert( c_nResolution > 0, "Resolution must be positive" );
+
+    protected:
+        //@cond
+        typedef unsigned long long  time_type;  // milliseconds since the clock's epoch
+        static CDS_CONSTEXPR_CONST time_type c_nNever = ~time_type(0);
+
+        struct node_type: public intrusive::michael_list::node<gc>
+        {
+            value_type                  m_Data;
+            atomics::atomic<time_type>  m_nExpire;
+
+            template <typename K>
+            node_type( time_type nExpire, K const& key )
+                : m_Data( key, mapped_type() )
+                , m_nExpire( nExpire )
+            {}
+
+            template <typename K, typename V>
+            node_type( time_type nExpire, K const& key, V const& val )
+                : m_Data( key, val )
+                , m_nExpire( nExpire )
+            {}
+
+            template <typename K, typename... Args>
+            node_type( time_type nExpire, K&& key, Args&&... args )
+                : m_Data( std::forward<K>( key ), std::move( mapped_type( std::forward<Args>( args )... )))
+                , m_nExpire( nExpire )
+            {}
+
+            bool expired( time_type nNow ) const
+            {
+                return m_nExpire.load( atomics::memory_order_acquire ) <= nNow;
+            }
+        };
+
+        typedef typename options::allocator::template rebind<node_type>::other  node_allocator_type;
+        typedef cds::details::Allocator< node_type, node_allocator_type >       cxx_node_allocator;
+
+        struct node_disposer {
+            void operator()( node_type * pNode )
+            {
+                cxx_node_allocator().Delete( pNode );
+            }
+        };
+
+        struct key_field_accessor {
+            key_type const& operator()( node_type const& node )
+            {
+                return node.m_Data.first;
+            }
+        };
+
+        typedef typename opt::details::make_comparator< key_type, options >::type key_comparator;
+
+        struct node_hash {
+            size_t operator()( node_type const& node ) const
+            {
+                return hash()( node.m_Data.first );
+            }
+            template <typename Q>
+            size_t operator()( Q const& key ) const
+            {
+                return hash()( key );
+            }
+        };
+
+        struct bucket_traits: public intrusive::michael_list::type_traits
+        {
+            typedef intrusive::michael_list::base_hook< opt::gc<gc> >   hook;
+            typedef node_disposer                                       disposer;
+            typedef cds::details::compare_wrapper< node_type, key_comparator, key_field_accessor > compare;
+            typedef typename options::memory_model  memory_model;
+            typedef typename options::back_off      back_off;
+        };
+        typedef intrusive::MichaelList< gc, node_type, bucket_traits >  bucket_type;
+
+        struct set_traits: public intrusive::michael_set::type_traits
+        {
+            typedef node_hash                       hash;
+            typedef typename options::item_counter  item_counter;
+            typedef typename options::allocator     allocator;
+        };
+        typedef intrusive::MichaelHashSet< gc, bucket_type, set_traits > set_type;
+
+        typedef cds::algo::timer_wheel::wheel< key_type,
+            typename cds::algo::timer_wheel::make_traits<
+                opt::allocator< typename options::allocator >
+            >::type
+        > wheel_type;
+        typedef typename wheel_type::tick_type  tick_type;
+        //@endcond
+
+    public:
+        /// Guarded pointer
+        typedef cds::gc::guarded_ptr< gc, node_type, value_type, details::guarded_ptr_cast_map<node_type, value_type> > guarded_ptr;
+
+    protected:
+        //@cond
+        set_type    m_Set;
+        wheel_type  m_Wheel;
+        stat        m_Stat;
+        //@endcond
+
+    public:
+        /// Initializes the map
+        /**
+            \p nMaxItemCount and \p nLoadFactor define the size of the bucket table,
+            see \ref cds_nonintrusive_MichaelHashMap_hp "MichaelHashMap" constructor.
+        */
+        ExpiringHashMap(
+            size_t nMaxItemCount,   ///< estimation of max item count in the hash map
+            size_t nLoadFactor      ///< load factor: estimation of max number of items in the bucket
+        )
+            : m_Set( nMaxItemCount, nLoadFactor )
+            , m_Wheel( now() / c_nResolution )
+        {}
+
+        /// Destroys the map, all items are freed
+        ~ExpiringHashMap()
+        {}
+
+        /// Inserts new item without expiration time
+        /**
+            The function creates an item with key \p key and default value.
+            Returns \p true if the item has been inserted, \p false if the map contains a live item with \p key.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            return insert_node( cxx_node_allocator().New( time_type( c_nNever ), key ));
+        }
+
+        /// Inserts new item without expiration time
+        /**
+            The function creates an item with key \p key and value \p val.
+            Returns \p true if the item has been inserted, \p false if the map contains a live item with \p key.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            return insert_node( cxx_node_allocator().New( time_type( c_nNever ), key, val ));
+        }
+
+        /// Inserts new item that expires in \p ttl
+        /**
+            The function creates an item with key \p key and value \p val that expires in \p ttl from now.
+            Returns \p true if the item has been inserted, \p false if the map contains a live item with \p key.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val, duration_type ttl )
+        {
+            return insert_node( cxx_node_allocator().New( expire_time( ttl ), key, val ));
+        }
+
+        /// Inserts new item without expiration time, the value is constructed in-place from \p args
+        /**
+            Returns \p true if the item has been inserted, \p false if the map contains a live item with \p key.
+        */
+        template <typename K, typename... Args>
+        bool emplace( K&& key, Args&&... args )
+        {
+            return insert_node( cxx_node_allocator().New( time_type( c_nNever ), std::forward<K>( key ), std::forward<Args>( args )... ));
+        }
+
+        /// Sets the expiration time of the item with \p key to \p ttl from now
+        /**
+            The function changes the expiration time of the live item only;
+            it returns \p false if the item is not found or has already expired.
+            The item without expiration time becomes expiring.
+        */
+        template <typename K>
+        bool touch( K const& key, duration_type ttl )
+        {
+            typename set_type::guarded_ptr gp;
+            if ( !get_live( gp, key ))
+                return false;
+
+            time_type const nExpire = expire_time( ttl );
+            time_type nOld = gp->m_nExpire.load( atomics::memory_order_acquire );
+            do {
+                if ( nOld <= now() ) {
+                    // Expired concurrently
+                    return false;
+                }
+            } while ( !gp->m_nExpire.compare_exchange_weak( nOld, nExpire, atomics::memory_order_release, atomics::memory_order_acquire ));
+
+            // The timer record of the later expiration time is rescheduled by expire() if needed
+            if ( nExpire < nOld )
+                m_Wheel.schedule( gp->m_Data.first, expire_tick( nExpire ));
+            m_Stat.onTouch();
+            return true;
+        }
+
+        /// Finds the live item with \p key and calls the functor \p f for it
+        /**
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor may change \p item.second, the map does not serialize
+            the access to the item.
+
+            The expired item found is unlinked from the map, the function returns \p false for it.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+            typename set_type::guarded_ptr gp;
+            if ( !get_live( gp, key ))
+                return false;
+            f( gp->m_Data );
+            return true;
+        }
+
+        /// Checks whether the map contains the live item with \p key
+        template <typename K>
+        bool find( K const& key )
+        {
+            typename set_type::guarded_ptr gp;
+            return get_live( gp, key );
+        }
+
+        /// Finds the live item with \p key and returns a guarded pointer to it
+        /**
+            If \p key is not found or the item has expired the function returns \p false.
+            The guarded pointer prevents the item from disposing even if it expires.
+        */
+        template <typename K>
+        bool get( guarded_ptr& ptr, K const& key )
+        {
+            typename set_type::guarded_ptr gp;
+            if ( !get_live( gp, key ))
+                return false;
+            ptr.guard().assign( &*gp );
+            return true;
+        }
+
+        /// Extracts the live item with \p key from the map
+        /**
+            The function unlinks the item with \p key from the map and returns it in \p dest.
+            If the item found has expired it is unlinked too, but the function returns \p false for it.
+        */
+        template <typename K>
+        bool extract( guarded_ptr& dest, K const& key )
+        {
+            typename set_type::guarded_ptr gp;
+            if ( !m_Set.extract( gp, key ))
+                return false;
+            if ( gp->expired( now() )) {
+                m_Stat.onExpireLazy();
+                return false;
+            }
+            dest.guard().assign( &*gp );
+            return true;
+        }
+
+        /// Deletes the item with \p key from the map
+        /**
+            Returns \p true if the live item has been deleted.
+            The expired item is deleted too, but the function returns \p false for it.
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            guarded_ptr gp;
+            return extract( gp, key );
+        }
+
+        /// Removes the expired items tracked by the timer wheel
+        /**
+            The function advances the timer wheel up to the current time and unlinks
+            the items whose timers are due. It returns the count of the items removed.
+
+            If the wheel is being advanced by another thread, the function returns 0 immediately.
+        */
+        size_t expire()
+        {
+            return expire( []( value_type& ) {} );
+        }
+
+        /// Removes the expired items tracked by the timer wheel and calls \p f for each of them
+        /**
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor is called after the item is unlinked from the map.
+        */
+        template <typename Func>
+        size_t expire( Func f )
+        {
+            time_type const nNow = now();
+            size_t nCount = 0;
+            m_Wheel.advance( nNow / c_nResolution, [this, nNow, &nCount, &f]( key_type& key, tick_type ) {
+                typename set_type::guarded_ptr gp;
+                if ( !m_Set.get( gp, key )) {
+                    // The item has already been removed
+                    m_Stat.onStaleTimer();
+                    return;
+                }
+
+                time_type nExpire = gp->m_nExpire.load( atomics::memory_order_acquire );
+                if ( nExpire <= nNow ) {
+                    if ( m_Set.unlink( *gp )) {
+                        f( gp->m_Data );
+                        m_Stat.onExpireTimer();
+                        ++nCount;
+                    }
+                    return;
+                }
+
+                // The item has been prolonged by touch() or re-inserted
+                m_Stat.onStaleTimer();
+                if ( nExpire != c_nNever )
+                    m_Wheel.schedule( key, expire_tick( nExpire ));
+            });
+            m_Stat.onTimerRound();
+            return nCount;
+        }
+
+        /// Clears the map
+        /**
+            The timer records of the items are not removed, they are dropped by the subsequent \p expire() calls.
+        */
+        void clear()
+        {
+            m_Set.clear();
+        }
+
+        /// Checks if the map is empty
+        /**
+            The expired items that have not been removed yet are counted as well.
+        */
+        bool empty() const
+        {
+            return m_Set.empty();
+        }
+
+        /// Returns item count in the map
+        /**
+            The expired items that have not been removed yet are counted as well.
+        */
+        size_t size() const
+        {
+            return m_Set.size();
+        }
+
+        /// Returns the count of pending timer records
+        size_t timer_count() const
+        {
+            return m_Wheel.size();
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        static time_type now()
+        {
+            return static_cast<time_type>( std::chrono::duration_cast<std::chrono::milliseconds>( clock_type::now().time_since_epoch() ).count());
+        }
+
+        static time_type expire_time( duration_type ttl )
+        {
+            return now() + static_cast<time_type>( ttl.count() > 0 ? ttl.count() : 0 );
+        }
+
+        static tick_type expire_tick( time_type nExpire )
+        {
+            // The timer of an item is due not earlier than the item expires
+            return static_cast<tick_type>(( nExpire + c_nResolution - 1 ) / c_nResolution );
+        }
+
+        bool insert_node( node_type * pNode )
+        {
+            time_type const nExpire = pNode->m_nExpire.load( atomics::memory_order_relaxed );
+
+            // The node inserted may be removed and retired at once, so it is guarded
+            typename gc::Guard guard;
+            guard.assign( pNode );
+
+            while ( !m_Set.insert( *pNode )) {
+                typename set_type::guarded_ptr gp;
+                if ( m_Set.get( gp, pNode->m_Data.first )) {
+                    if ( !gp->expired( now() )) {
+                        cxx_node_allocator().Delete( pNode );
+                        m_Stat.onInsertFailed();
+                        return false;
+                    }
+                    if ( m_Set.unlink( *gp ))
+                        m_Stat.onExpireLazy();
+                }
+
+                // The node is not linked, it can be safely reused
+                pNode->m_pNext.store( typename node_type::marked_ptr(), atomics::memory_order_relaxed );
+            }
+
+            if ( nExpire != c_nNever )
+                m_Wheel.schedule( pNode->m_Data.first, expire_tick( nExpire ));
+            m_Stat.onInsert();
+            return true;
+        }
+
+        template <typename K>
+        bool get_live( typename set_type::guarded_ptr& gp, K const& key )
+        {
+            if ( m_Set.get( gp, key )) {
+                if ( !gp->expired( now() )) {
+                    m_Stat.onFindHit();
+                    return true;
+                }
+                if ( m_Set.unlink( *gp ))
+                    m_Stat.onExpireLazy();
+            }
+            m_Stat.onFindMiss();
+            return false;
+        }
+        //@endcond
+    };
+
+}}  // namespace cds::container
+
+#endif  // #ifndef __CDS_CONTAINER_EXPIRING_MAP_H
@@ -0,0 +1,1015 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_FAT_SKIP_LIST_MAP_RCU_H
+#define __CDS_CONTAINER_FAT_SKIP_LIST_MAP_RCU_H
+
+#include <type_traits>
+#include <cds/container/details/fat_skip_list_base.h>
+#include <cds/urcu/details/check_deadlock.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace container {
+
+    /// Skip-list map with multi-key nodes (template specialization for \ref cds_urcu_desc "RCU")
+    /** @ingroup cds_nonintrusive_map
+        \anchor cds_container_FatSkipListMap_rcu
+
+        Source:
+            - [1990] W.Pugh "Skip Lists: A Probabilistic Alternative to Balanced Trees"
+            - [2007] M.Herlihy, Y.Lev, V.Luchangco, N.Shavit "A Simple Optimistic Skiplist Algorithm"
+            - [2016] V.Leis, F.Scheibner, A.Kemper, T.Neumann "The ART of Practical Synchronization"
+
+        The map is an unrolled skip list: a node contains a sorted array of up to \p Traits::node_capacity
+        keys and values instead of one item, so \ref cds_container_SkipListMap_rcu "SkipListMap" search
+        that misses the cache at almost each step is replaced by the search among a few times fewer nodes
+        and the binary search in the contiguous array of the last node.
+
+        Each node except the head has an immutable <i>fence</i> key; the node contains the keys in the range
+        from its fence (inclusive) to the fence of the next node at level 0 (exclusive). The head contains
+        the keys less than the fence of the first node. The skip-list levels index the fences of the nodes.
+        When a node is full, its upper half is moved to the new node with random height
+        that is linked after it. When a node becomes underfull after a deletion, its keys are moved to the preceding node
+        and the node is removed from the list.
+
+        The synchronization is <b>optimistic lock coupling</b> like \ref cds_container_BPlusTreeMap_rcu "BPlusTreeMap":
+        - a reader does not write to shared memory. It descends the skip list by the immutable fences,
+            then reads the version of the node found, reads the node content and validates that the version
+            has not changed; otherwise the search is repeated;
+        - a writer locks only the node it changes. The split locks the node only; the new node
+            is linked at the upper levels after that by locking its predecessor at each level in turn.
+            The merge locks the node, its predecessor at level 0, and its predecessor at each upper level in turn.
+            The locks are always acquired in descending order of the fences, so the list is deadlock-free.
+
+        The removed nodes are marked obsolete and are reclaimed by RCU after the RCU read-side critical section.
+        Since the reader does not protect each node visited, the map is provided for RCU only.
+
+        The reader copies the key and the value from the node before the validation, so
+        the key and the value are stored by value and they should be trivially copyable and default-constructible,
+        for example, integers, plain structs or pointers. The functors passed to \p find() and \p scan()
+        get the validated copies.
+
+        Template arguments:
+        - \p RCU - one of \ref cds_urcu_gc "RCU type"
+        - \p Key - key type, trivially copyable and default-constructible
+        - \p T - value type, trivially copyable and default-constructible
+        - \p Traits - type traits, see \p fat_skip_list::type_traits for explanation.
+
+        It is possible to declare option-based map with \p fat_skip_list::make_traits metafunction instead of \p Traits template
+        argument. Template argument list \p Options of \p %fat_skip_list::make_traits metafunction are:
+        - \p opt::compare - key compare functor. No default functor is provided.
+            If the option is not specified, \p opt::less is used.
+        - \p opt::less - specifies binary predicate used for key compare. Default is \p std::less<Key>.
+        - \p opt::item_counter - the type of item counting feature. Default is \p atomicity::empty_item_counter that is no item counting.
+        - \p fat_skip_list::random_level_generator - random level generator. Can be \p fat_skip_list::xorshift
+            or \p fat_skip_list::turbo_pascal (the default).
+        - \p opt::back_off - back-off strategy used to wait for a locked node. Default is \p cds::backoff::Default.
+        - \p opt::allocator - the allocator for the nodes. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - \p opt::stat - internal statistics. Available types: \p fat_skip_list::stat, \p fat_skip_list::empty_stat (the default)
+        - \p opt::rcu_check_deadlock - a deadlock checking policy. Default is \p opt::v::rcu_throw_deadlock
+        - \p fat_skip_list::node_capacity - maximum count of keys in a node, default is 16.
+
+        @note Before including <tt><cds/container/fat_skip_list_map_rcu.h></tt> you should include appropriate RCU header file,
+        see \ref cds_urcu_gc "RCU type" for list of existing RCU class and corresponding header files.
+    */
+    template <
+        class RCU,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = fat_skip_list::type_traits
+#else
+        class Traits
+#endif
+    >
+    class FatSkipListMap< cds::urcu::gc<RCU>, Key, T, Traits >
+    {
+    public:
+        typedef cds::urcu::gc<RCU>  gc          ;   ///< RCU Garbage collector
+        typedef Key                 key_type    ;   ///< type of a key stored in the map
+        typedef T                   mapped_type ;   ///< type of value stored in the map
+        typedef Traits              options     ;   ///< Traits template parameter
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator  ;    ///< key compare functor based on opt::compare and opt::less option setter.
+#   else
+        typedef typename opt::details::make_comparator< key_type, options >::type key_comparator;
+#endif
+        typedef typename options::item_counter          item_counter    ;   ///< Item counting policy used
+        typedef typename options::random_level_generator random_level_generator ; ///< random level generator
+        typedef typename options::back_off              back_off        ;   ///< Back-off strategy
+        typedef typename options::stat                  stat            ;   ///< internal statistics type
+        typedef typename options::rcu_check_deadlock    rcu_check_deadlock  ; ///< Deadlock checking policy
+        typedef typename gc::scoped_lock                rcu_lock        ;   ///< RCU scoped lock
+
+        static CDS_CONSTEXPR_CONST size_t c_nCapacity = options::node_capacity; ///< Maximum count of keys in a node
+        static_assert( c_nCapacity >= 4, "Node capacity should be at least 4" );
+
+        static unsigned int const c_nMaxHeight = random_level_generator::c_nUpperBound; ///< Max node height
+
+#if !( CDS_COMPILER == CDS_COMPILER_GCC && CDS_COMPILER_VERSION < 50000 )
+        static_assert( std::is_trivially_copyable<key_type>::value, "Key type should be trivially copyable" );
+        static_assert( std::is_trivially_copyable<mapped_type>::value, "Value type should be trivially copyable" );
+#endif
+
+    protected:
+        //@cond
+        typedef unsigned long long version_type;
+
+        static CDS_CONSTEXPR_CONST version_type c_nObsoleteBit = 1;
+        static CDS_CONSTEXPR_CONST version_type c_nLockBit = 2;
+        static CDS_CONSTEXPR_CONST size_t c_nMinCount = c_nCapacity / 4;   // a node with fewer keys is merged eagerly
+
+        typedef cds::urcu::details::check_deadlock_policy< gc, rcu_check_deadlock>   check_deadlock_policy;
+
+        struct node
+        {
+            atomics::atomic<version_type>   m_nVersion;
+            atomics::atomic<unsigned int>   m_nCount;
+            atomics::atomic<bool>           m_bLinked;      // the node is linked at all levels
+            unsigned int const              m_nHeight;
+            node *                          m_pNextRetired;
+            key_type                        m_Fence;        // the lower bound of the node keys, not used for the head
+            key_type                        m_Keys[c_nCapacity];
+            mapped_type                     m_Values[c_nCapacity];
+            atomics::atomic<node *>         m_arrNext[1];   // the tower is allocated with the node
+
+            explicit node( unsigned int nHeight )
+                : m_nVersion( 0 )
+                , m_nCount( 0 )
+                , m_bLinked( false )
+                , m_nHeight( nHeight )
+                , m_pNextRetired( nullptr )
+            {
+                m_arrNext[0].store( nullptr, atomics::memory_order_relaxed );
+                for ( unsigned int i = 1; i < nHeight; ++i )
+                    new ( m_arrNext + i ) atomics::atomic<node *>( nullptr );
+            }
+
+            size_t count() const
+            {
+                return m_nCount.load( atomics::memory_order_relaxed );
+            }
+
+            void count( size_t n )
+            {
+                m_nCount.store( static_cast<unsigned int>( n ), atomics::memory_order_relaxed );
+            }
+
+            node * next( unsigned int nLevel ) const
+            {
+                assert( nLevel < m_nHeight );
+                return m_arrNext[nLevel].load( atomics::memory_order_acquire );
+            }
+
+            void next( unsigned int nLevel, node * p )
+            {
+                assert( nLevel < m_nHeight );
+                m_arrNext[nLevel].store( p, atomics::memory_order_release );
+            }
+
+            static size_t alloc_size( unsigned int nHeight )
+            {
+                return sizeof(node) + ( nHeight - 1 ) * sizeof( atomics::atomic<node *> );
+            }
+        };
+
+        typedef typename options::allocator::template rebind<char>::other   node_allocator_type; // node with the tower
+
+        // The list of the nodes to retire after RCU unlock
+        struct retired_list
+        {
+            node * m_pHead;
+
+            retired_list()
+                : m_pHead( nullptr )
+            {}
+
+            void push( node * p )
+            {
+                p->m_pNextRetired = m_pHead;
+                m_pHead = p;
+            }
+
+            ~retired_list()
+            {
+                assert( !gc::is_locked() );
+                while ( m_pHead ) {
+                    node * p = m_pHead;
+                    m_pHead = p->m_pNextRetired;
+                    gc::retire_ptr( p, free_node );
+                }
+            }
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        node * const                    m_pHead;
+        atomics::atomic<unsigned int>   m_nHeight;  // the max height of the nodes
+        random_level_generator          m_RandomLevelGen;
+        item_counter                    m_ItemCounter;
+        mutable stat                    m_Stat;
+        //@endcond
+
+    public:
+        /// Default ctor creates empty map
+        FatSkipListMap()
+            : m_pHead( alloc_node( c_nMaxHeight ))
+            , m_nHeight( 1 )
+        {
+            m_pHead->m_bLinked.store( true, atomics::memory_order_relaxed );
+        }
+
+        /// Destroys the map
+        /**
+            The destructor is not thread-safe, it frees all nodes immediately.
+        */
+        ~FatSkipListMap()
+        {
+            node * p = m_pHead;
+            while ( p ) {
+                node * pNext = p->next( 0 );
+                free_node( p );
+                p = pNext;
+            }
+        }
+
+        /// Inserts new item with key \p key and default value
+        /**
+            The function creates an item with key \p key and default value, and then inserts the item into the map.
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            return do_update( key, []( bool, key_type const&, mapped_type& ) {}, false ).first;
+        }
+
+        /// Inserts new item
+        /**
+            The function creates an item with key \p key and value \p val, and then inserts the item into the map.
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            return do_update( key, [&val]( bool, key_type const&, mapped_type& item ) { item = val; }, false ).first;
+        }
+
+        /// Inserts new item and initializes its value by the functor
+        /**
+            The function creates an item with key \p key and default value, calls the functor \p func
+            to initialize the value, and then inserts the item into the map.
+            The functor interface is:
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type& val );
+            };
+            \endcode
+            The functor is called under the node lock, it should be short.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool insert_key( K const& key, Func func )
+        {
+            return do_update( key, [&func]( bool, key_type const& k, mapped_type& item ) { func( k, item ); }, false ).first;
+        }
+
+        /// Ensures that the \p key exists in the map
+        /**
+            The operation performs inserting or changing data.
+
+            If the \p key not found in the map, then the new item created from \p key
+            is inserted into the map (note that in this case the \p key_type should be
+            constructible from type \p K). Otherwise, the functor \p func is called with the item found.
+            The functor interface is:
+            \code
+            struct functor {
+                void operator()( bool bNew, key_type const& key, mapped_type& val );
+            };
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p key - the key of the item
+            - \p val - the value of the item
+
+            The functor is called under the node lock, it should be short.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successful,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already is in the map.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> ensure( K const& key, Func func )
+        {
+            return do_update( key, func, true );
+        }
+
+        /// Delete \p key from the map
+        /**
+            Return \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return do_erase( key, []( key_type const&, mapped_type& ) {} );
+        }
+
+        /// Delete \p key from the map
+        /**
+            The function searches an item with key \p key, calls \p f functor with the item
+            and deletes it from the map. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()( key_type const& key, mapped_type& val );
+            };
+            \endcode
+            The functor is called under the node lock.
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            return do_erase( key, f );
+        }
+
+        /// Find the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor \p f for the item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type const& val );
+            };
+            \endcode
+            The functor gets the copy of the item. Use \p ensure() to change the item.
+
+            The function applies RCU lock internally.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f ) const
+        {
+            return do_find( key, f );
+        }
+
+        /// Find the key \p key
+        /**
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K>
+        bool find( K const& key ) const
+        {
+            auto f = []( key_type const&, mapped_type const& ) {};
+            return do_find( key, f );
+        }
+
+        /// Range scan
+        /**
+            The function calls \p f for each item with the key in the range <tt>[from, to)</tt> in ascending order of the keys.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type const& val );
+            };
+            \endcode
+            The functor gets the copy of the item. The items of a node are copied and validated
+            as a whole, then the functor is called for them; so each item is reported once.
+            The scan is not a snapshot: the items inserted or deleted concurrently may be reported or not.
+
+            The function applies RCU lock internally; the functor is called under RCU lock,
+            so it cannot delete the items from the map.
+
+            Returns the count of items reported.
+        */
+        template <typename Func>
+        size_t scan( key_type const& from, key_type const& to, Func f ) const
+        {
+            key_comparator cmp;
+            m_Stat.onScan();
+            return do_scan( &from, ~size_t(0), [&cmp, &to]( key_type const& key ) { return cmp( key, to ) >= 0; }, f );
+        }
+
+        /// Scans up to \p nCount items starting from \p from
+        /**
+            The function is similar to \ref scan( key_type const&, key_type const&, Func ) "scan()"
+            but it reports up to \p nCount items with the key not less than \p from.
+        */
+        template <typename Func>
+        size_t scan_n( key_type const& from, size_t nCount, Func f ) const
+        {
+            m_Stat.onScan();
+            return do_scan( &from, nCount, []( key_type const& ) { return false; }, f );
+        }
+
+        /// Clears the map
+        /**
+            The function deletes the items in ascending order of the keys by small portions.
+            It is not atomic: the items inserted concurrently may stay in the map.
+        */
+        void clear()
+        {
+            key_type arrKeys[c_nCapacity];
+            size_t nCount;
+            auto f = [&arrKeys, &nCount]( key_type const& key, mapped_type const& ) { arrKeys[nCount++] = key; };
+            for (;;) {
+                nCount = 0;
+                do_scan( static_cast<key_type const *>( nullptr ), c_nCapacity, []( key_type const& ) { return false; }, f );
+                if ( nCount == 0 )
+                    break;
+                for ( size_t i = 0; i < nCount; ++i )
+                    erase( arrKeys[i] );
+            }
+        }
+
+        /// Checks if the map is empty
+        bool empty() const
+        {
+            auto f = []( key_type const&, mapped_type const& ) {};
+            return do_scan( static_cast<key_type const *>( nullptr ), 1, []( key_type const& ) { return false; }, f ) == 0;
+        }
+
+        /// Returns item count in the map
+        /**
+            The value returned depends on item counter type provided by \p Traits template parameter.
+            If it is \p atomicity::empty_item_counter this function always returns 0.
+            Therefore, the function is not suitable for checking the map emptiness, use \p empty()
+            member function for this purpose.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+        /// Checks internal consistency (not atomic, not thread-safe)
+        /**
+            The debugging function to check internal consistency of the list:
+            the keys of each node are ordered and lie in the range defined by the fences,
+            each level is ordered by the fences and contains only the nodes which are high enough,
+            no node is locked.
+        */
+        bool check_consistency() const
+        {
+            key_comparator cmp;
+
+            // Level 0 contains all keys in ascending order
+            for ( node * p = m_pHead; p; p = p->next( 0 )) {
+                if ( p->m_nVersion.load( atomics::memory_order_relaxed ) & ( c_nLockBit | c_nObsoleteBit ))
+                    return false;
+                if ( !p->m_bLinked.load( atomics::memory_order_relaxed ))
+                    return false;
+
+                size_t const nCount = p->count();
+                if ( nCount > c_nCapacity )
+                    return false;
+                for ( size_t i = 0; i < nCount; ++i ) {
+                    if ( i > 0 && cmp( p->m_Keys[i - 1], p->m_Keys[i] ) >= 0 )
+                        return false;
+                    if ( p != m_pHead && cmp( p->m_Keys[i], p->m_Fence ) < 0 )
+                        return false;
+                }
+
+                node * pNext = p->next( 0 );
+                if ( pNext ) {
+                    if ( p != m_pHead && cmp( p->m_Fence, pNext->m_Fence ) >= 0 )
+                        return false;
+                    if ( nCount > 0 && cmp( p->m_Keys[nCount - 1], pNext->m_Fence ) >= 0 )
+                        return false;
+                }
+            }
+
+            // The upper levels are ordered sublists of level 0
+            for ( unsigned int nLevel = 1; nLevel < c_nMaxHeight; ++nLevel ) {
+                node * pPrev = m_pHead;
+                node * pLevel0 = m_pHead->next( 0 );
+                for ( node * p = m_pHead->next( nLevel ); p; p = p->next( nLevel )) {
+                    if ( p->m_nHeight <= nLevel )
+                        return false;
+                    if ( pPrev != m_pHead && cmp( pPrev->m_Fence, p->m_Fence ) >= 0 )
+                        return false;
+                    while ( pLevel0 && pLevel0 != p )
+                        pLevel0 = pLevel0->next( 0 );
+                    if ( !pLevel0 )
+                        return false;
+                    pPrev = p;
+                }
+                if ( nLevel >= m_nHeight.load( atomics::memory_order_relaxed ) && m_pHead->next( nLevel ))
+                    return false;
+            }
+            return true;
+        }
+
+    protected:
+        //@cond
+
+        // Memory management
+
+        static node * alloc_node( unsigned int nHeight )
+        {
+            char * pMem = node_allocator_type().allocate( node::alloc_size( nHeight ));
+            return new ( pMem ) node( nHeight );
+        }
+
+        static void free_node( node * p )
+        {
+            unsigned int const nHeight = p->m_nHeight;
+            p->~node();
+            node_allocator_type().deallocate( reinterpret_cast<char *>( p ), node::alloc_size( nHeight ));
+        }
+
+        unsigned int random_height()
+        {
+            unsigned int nHeight = m_RandomLevelGen() + 1;
+            assert( nHeight <= c_nMaxHeight );
+
+            // The max height of the list grows by one level at a time
+            unsigned int nCur = m_nHeight.load( atomics::memory_order_relaxed );
+            if ( nHeight > nCur ) {
+                nHeight = nCur + 1;
+                m_nHeight.compare_exchange_strong( nCur, nHeight, atomics::memory_order_relaxed, atomics::memory_order_relaxed );
+            }
+            return nHeight;
+        }
+
+        // Version protocol
+
+        static version_type read_lock( node * p, bool& bRestart )
+        {
+            version_type v = p->m_nVersion.load( atomics::memory_order_acquire );
+            if ( v & c_nLockBit ) {
+                back_off bkoff;
+                do {
+                    bkoff();
+                    v = p->m_nVersion.load( atomics::memory_order_acquire );
+                } while ( v & c_nLockBit );
+            }
+            if ( v & c_nObsoleteBit )
+                bRestart = true;
+            return v;
+        }
+
+        static bool validate( node * p, version_type v )
+        {
+            // The content of the node read before the fence is consistent if the version is not changed
+            atomics::atomic_thread_fence( atomics::memory_order_acquire );
+            return p->m_nVersion.load( atomics::memory_order_relaxed ) == v;
+        }
+
+        static bool upgrade_lock( node * p, version_type v )
+        {
+            return p->m_nVersion.compare_exchange_strong( v, v + c_nLockBit, atomics::memory_order_acquire, atomics::memory_order_relaxed );
+        }
+
+        // Locks the node; returns false if the node is obsolete
+        static bool try_write_lock( node * p )
+        {
+            for (;;) {
+                bool bRestart = false;
+                version_type v = read_lock( p, bRestart );
+                if ( bRestart )
+                    return false;
+                if ( upgrade_lock( p, v ))
+                    return true;
+            }
+        }
+
+        static void write_unlock( node * p )
+        {
+            p->m_nVersion.fetch_add( c_nLockBit, atomics::memory_order_release );
+        }
+
+        static void write_unlock_obsolete( node * p )
+        {
+            p->m_nVersion.fetch_add( c_nLockBit | c_nObsoleteBit, atomics::memory_order_release );
+        }
+
+        // Search in a node
+
+        template <typename Q>
+        static size_t lower_bound( key_type const * pKeys, size_t nCount, Q const& key )
+        {
+            // the first position where pKeys[i] >= key
+            key_comparator cmp;
+            size_t nLo = 0;
+            while ( nLo < nCount ) {
+                size_t nMid = ( nLo + nCount ) / 2;
+                if ( cmp( pKeys[nMid], key ) < 0 )
+                    nLo = nMid + 1;
+                else
+                    nCount = nMid;
+            }
+            return nLo;
+        }
+
+        template <typename Q>
+        static size_t upper_bound( key_type const * pKeys, size_t nCount, Q const& key )
+        {
+            // the first position where pKeys[i] > key
+            key_comparator cmp;
+            size_t nLo = 0;
+            while ( nLo < nCount ) {
+                size_t nMid = ( nLo + nCount ) / 2;
+                if ( cmp( pKeys[nMid], key ) <= 0 )
+                    nLo = nMid + 1;
+                else
+                    nCount = nMid;
+            }
+            return nLo;
+        }
+
+        // Search in the list
+
+        // Returns the last node at level nLevel with the fence less than the fence of pNode
+        node * find_pred( node const * pNode, unsigned int nLevel ) const
+        {
+            key_comparator cmp;
+            node * pPred = m_pHead;
+            for ( unsigned int i = m_nHeight.load( atomics::memory_order_relaxed ); i > nLevel; --i ) {
+                node * pNext = pPred->next( i - 1 );
+                while ( pNext && cmp( pNext->m_Fence, pNode->m_Fence ) < 0 ) {
+                    pPred = pNext;
+                    pNext = pPred->next( i - 1 );
+                }
+            }
+            return pPred;
+        }
+
+        // Locates the node which range contains the key (the head if pKey == nullptr) and reads its version.
+        // Returns nullptr if the operation should be restarted
+        template <typename Q>
+        node * locate( Q const * pKey, version_type& v ) const
+        {
+            assert( gc::is_locked() );
+
+            key_comparator cmp;
+            node * pNode = m_pHead;
+            if ( pKey ) {
+                // The fences are immutable, so the descent does not need the validation
+                for ( unsigned int nLevel = m_nHeight.load( atomics::memory_order_relaxed ); nLevel > 0; --nLevel ) {
+                    node * pNext = pNode->next( nLevel - 1 );
+                    while ( pNext && cmp( pNext->m_Fence, *pKey ) <= 0 ) {
+                        pNode = pNext;
+                        pNext = pNode->next( nLevel - 1 );
+                    }
+                }
+            }
+
+            for (;;) {
+                bool bRestart = false;
+                v = read_lock( pNode, bRestart );
+                if ( bRestart )
+                    return nullptr;
+                if ( !pKey )
+                    return pNode;
+
+                // The caller validates the version, so the next node read here is consistent with the node content
+                node * pNext = pNode->next( 0 );
+                if ( !pNext || cmp( pNext->m_Fence, *pKey ) > 0 )
+                    return pNode;
+
+                // The node has been split concurrently
+                pNode = pNext;
+            }
+        }
+
+        template <typename Q, typename Func>
+        bool do_find( Q const& key, Func& f ) const
+        {
+            key_comparator cmp;
+            rcu_lock l;
+            for (;;) {
+                version_type v;
+                node * pNode = locate( &key, v );
+                if ( pNode ) {
+                    size_t nCount = pNode->count();
+                    size_t nPos = lower_bound( pNode->m_Keys, nCount, key );
+                    bool bFound = nPos < nCount && cmp( pNode->m_Keys[nPos], key ) == 0;
+                    key_type k;
+                    mapped_type val;
+                    if ( bFound ) {
+                        k = pNode->m_Keys[nPos];
+                        val = pNode->m_Values[nPos];
+                    }
+                    if ( validate( pNode, v )) {
+                        if ( bFound ) {
+                            f( k, val );
+                            m_Stat.onFindSuccess();
+                        }
+                        else
+                            m_Stat.onFindFailed();
+                        return bFound;
+                    }
+                }
+                m_Stat.onRestart();
+            }
+        }
+
+        template <typename Stop, typename Func>
+        size_t do_scan( key_type const * pFrom, size_t nLimit, Stop stop, Func& f ) const
+        {
+            key_type arrKeys[c_nCapacity];
+            mapped_type arrValues[c_nCapacity];
+
+            size_t nReported = 0;
+            key_type lower;         // the last key reported
+            bool bStarted = false;  // true if lower is valid
+
+            if ( nLimit == 0 )
+                return 0;
+
+            rcu_lock l;
+            for (;;) {
+                version_type v;
+                node * pNode = bStarted ? locate( &lower, v ) : locate( pFrom, v );
+                while ( pNode ) {
+                    size_t nCount = pNode->count();
+                    size_t nPos = bStarted ? upper_bound( pNode->m_Keys, nCount, lower )
+                        : pFrom ? lower_bound( pNode->m_Keys, nCount, *pFrom ) : 0;
+                    size_t nCopied = 0;
+                    bool bDone = false;
+                    for ( ; nPos < nCount; ++nPos ) {
+                        if ( nReported + nCopied == nLimit || stop( pNode->m_Keys[nPos] )) {
+                            bDone = true;
+                            break;
+                        }
+                        arrKeys[nCopied] = pNode->m_Keys[nPos];
+                        arrValues[nCopied] = pNode->m_Values[nPos];
+                        ++nCopied;
+                    }
+                    node * pNext = pNode->next( 0 );
+                    if ( !validate( pNode, v ))
+                        break;
+
+                    for ( size_t i = 0; i < nCopied; ++i )
+                        f( arrKeys[i], arrValues[i] );
+                    if ( nCopied ) {
+                        nReported += nCopied;
+                        lower = arrKeys[nCopied - 1];
+                        bStarted = true;
+                    }
+                    if ( bDone || nReported == nLimit || !pNext )
+                        return nReported;
+
+                    // Lock coupling on level 0
+                    bool bRestart = false;
+                    version_type vNext = read_lock( pNext, bRestart );
+                    if ( bRestart || !validate( pNode, v ))
+                        break;
+                    pNode = pNext;
+                    v = vNext;
+                }
+                m_Stat.onRestart();
+            }
+        }
+
+        // Insert
+
+        template <typename Q, typename Func>
+        static void insert_at( node * pNode, size_t nPos, Q const& key, Func& f )
+        {
+            size_t const nCount = pNode->count();
+            assert( nCount < c_nCapacity );
+            for ( size_t i = nCount; i > nPos; --i ) {
+                pNode->m_Keys[i] = pNode->m_Keys[i - 1];
+                pNode->m_Values[i] = pNode->m_Values[i - 1];
+            }
+            pNode->m_Keys[nPos] = key_type( key );
+            pNode->m_Values[nPos] = mapped_type();
+            f( true, pNode->m_Keys[nPos], pNode->m_Values[nPos] );
+            pNode->count( nCount + 1 );
+        }
+
+        // Splits the full locked node and inserts the key. Returns new node linked at level 0; pNode is unlocked
+        template <typename Q, typename Func>
+        node * split( node * pNode, size_t nPos, Q const& key, Func& f )
+        {
+            assert( pNode->count() == c_nCapacity );
+
+            size_t const nLeft = c_nCapacity - c_nCapacity / 2;
+            node * pNew = alloc_node( random_height() );
+            for ( size_t i = nLeft; i < c_nCapacity; ++i ) {
+                pNew->m_Keys[i - nLeft] = pNode->m_Keys[i];
+                pNew->m_Values[i - nLeft] = pNode->m_Values[i];
+            }
+            pNew->count( c_nCapacity - nLeft );
+            pNew->m_Fence = pNew->m_Keys[0];
+            pNode->count( nLeft );
+
+            if ( nPos <= nLeft )
+                insert_at( pNode, nPos, key, f );
+            else
+                insert_at( pNew, nPos - nLeft, key, f );
+
+            pNew->next( 0, pNode->next( 0 ));
+            pNode->next( 0, pNew );
+            write_unlock( pNode );
+            return pNew;
+        }
+
+        // Links new node at the upper levels
+        void link( node * pNew )
+        {
+            for ( unsigned int nLevel = 1; nLevel < pNew->m_nHeight; ++nLevel ) {
+                for (;;) {
+                    node * pPred = find_pred( pNew, nLevel );
+                    if ( !try_write_lock( pPred )) {
+                        m_Stat.onRestart();
+                        continue;
+                    }
+                    node * pSucc = pPred->next( nLevel );
+                    if ( pSucc && key_comparator()( pSucc->m_Fence, pNew->m_Fence ) < 0 ) {
+                        // A node has been linked after pPred concurrently
+                        write_unlock( pPred );
+                        m_Stat.onRestart();
+                        continue;
+                    }
+                    pNew->next( nLevel, pSucc );
+                    pPred->next( nLevel, pNew );
+                    write_unlock( pPred );
+                    break;
+                }
+            }
+            pNew->m_bLinked.store( true, atomics::memory_order_release );
+        }
+
+        template <typename Q, typename Func>
+        std::pair<bool, bool> do_update( Q const& key, Func f, bool bAllowUpdate )
+        {
+            key_comparator cmp;
+            rcu_lock l;
+            for ( ;; m_Stat.onRestart() ) {
+                version_type v;
+                node * pNode = locate( &key, v );
+                if ( !pNode )
+                    continue;
+
+                size_t nCount = pNode->count();
+                size_t nPos = lower_bound( pNode->m_Keys, nCount, key );
+                bool bFound = nPos < nCount && cmp( pNode->m_Keys[nPos], key ) == 0;
+                if ( bFound && !bAllowUpdate ) {
+                    if ( !validate( pNode, v ))
+                        continue;
+                    m_Stat.onInsertFailed();
+                    return std::make_pair( false, false );
+                }
+
+                // The content read above is valid if the lock is acquired with the version read
+                if ( !upgrade_lock( pNode, v ))
+                    continue;
+
+                if ( bFound ) {
+                    f( false, pNode->m_Keys[nPos], pNode->m_Values[nPos] );
+                    write_unlock( pNode );
+                    m_Stat.onEnsureExist();
+                    return std::make_pair( true, false );
+                }
+
+                if ( nCount < c_nCapacity ) {
+                    insert_at( pNode, nPos, key, f );
+                    write_unlock( pNode );
+                }
+                else {
+                    link( split( pNode, nPos, key, f ));
+                    m_Stat.onNodeSplit();
+                }
+
+                ++m_ItemCounter;
+                if ( bAllowUpdate )
+                    m_Stat.onEnsureNew();
+                else
+                    m_Stat.onInsertSuccess();
+                return std::make_pair( true, true );
+            }
+        }
+
+        // Erase
+
+        // Moves the keys of the underfull locked node to its predecessor and removes the node from the list.
+        // pNode is unlocked
+        void merge( node * pNode, retired_list& retired )
+        {
+            assert( pNode != m_pHead );
+
+            // Lock the predecessor at level 0
+            node * pPred;
+            for (;;) {
+                pPred = find_pred( pNode, 0 );
+                if ( try_write_lock( pPred )) {
+                    if ( pPred->next( 0 ) == pNode )
+                        break;
+                    write_unlock( pPred );
+                }
+                m_Stat.onRestart();
+            }
+
+            size_t const nCount = pNode->count();
+            size_t const nPredCount = pPred->count();
+            if ( nCount > 0 && nPredCount + nCount > c_nCapacity - c_nMinCount ) {
+                write_unlock( pPred );
+                write_unlock( pNode );
+                m_Stat.onMergeRejected();
+                return;
+            }
+
+            // Unlink the node at the upper levels. The predecessors precede pPred or are pPred itself,
+            // so the locks are acquired in descending order of the fences
+            for ( unsigned int nLevel = pNode->m_nHeight - 1; nLevel > 0; --nLevel ) {
+                for (;;) {
+                    node * pLevelPred = find_pred( pNode, nLevel );
+                    bool const bLock = pLevelPred != pPred;
+                    if ( bLock && !try_write_lock( pLevelPred )) {
+                        m_Stat.onRestart();
+                        continue;
+                    }
+                    bool const bLinked = pLevelPred->next( nLevel ) == pNode;
+                    if ( bLinked )
+                        pLevelPred->next( nLevel, pNode->next( nLevel ));
+                    if ( bLock )
+                        write_unlock( pLevelPred );
+                    if ( bLinked )
+                        break;
+                    m_Stat.onRestart();
+                }
+            }
+
+            // Move the keys and unlink the node at level 0
+            for ( size_t i = 0; i < nCount; ++i ) {
+                pPred->m_Keys[nPredCount + i] = pNode->m_Keys[i];
+                pPred->m_Values[nPredCount + i] = pNode->m_Values[i];
+            }
+            pPred->count( nPredCount + nCount );
+            pPred->next( 0, pNode->next( 0 ));
+
+            write_unlock( pPred );
+            write_unlock_obsolete( pNode );
+            retired.push( pNode );
+            m_Stat.onNodeMerge();
+        }
+
+        template <typename Q, typename Func>
+        bool do_erase( Q const& key, Func f )
+        {
+            check_deadlock_policy::check();
+
+            key_comparator cmp;
+            retired_list retired;
+            {
+                rcu_lock l;
+                for ( ;; m_Stat.onRestart() ) {
+                    version_type v;
+                    node * pNode = locate( &key, v );
+                    if ( !pNode )
+                        continue;
+
+                    size_t nCount = pNode->count();
+                    size_t nPos = lower_bound( pNode->m_Keys, nCount, key );
+                    if ( nPos == nCount || cmp( pNode->m_Keys[nPos], key ) != 0 ) {
+                        if ( !validate( pNode, v ))
+                            continue;
+                        m_Stat.onEraseFailed();
+                        return false;
+                    }
+
+                    if ( !upgrade_lock( pNode, v ))
+                        continue;
+
+                    f( pNode->m_Keys[nPos], pNode->m_Values[nPos] );
+                    for ( size_t i = nPos + 1; i < nCount; ++i ) {
+                        pNode->m_Keys[i - 1] = pNode->m_Keys[i];
+                        pNode->m_Values[i - 1] = pNode->m_Values[i];
+                    }
+                    pNode->count( nCount - 1 );
+
+                    // The node which is not linked at all levels yet is not merged
+                    if ( nCount - 1 < c_nMinCount && pNode != m_pHead && pNode->m_bLinked.load( atomics::memory_order_acquire ))
+                        merge( pNode, retired );
+                    else
+                        write_unlock( pNode );
+                    break;
+                }
+            }
+
+            --m_ItemCounter;
+            m_Stat.onEraseSuccess();
+            return true;
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_FAT_SKIP_LIST_MAP_RCU_H
@@ -183,6 +183,41 @@ namespace cds { namespace container {
             //static_assert( (std::is_same<gc, cds::gc::HP>::value || std::is_same<gc, cds::gc::PTB>::value), "GC must be cds::gc::HP or cds:gc::PTB" );
         }
 
+        /// Bulk-load constructor
+        /** \anchor cds_nonintrusive_EllenBinTreeSet_bulk_ctor
+            Builds the balanced tree from the sequence <tt>[first, last)</tt> in O(N) time without any search,
+            the \ref value_type should be constructible from \p *first.
+            The sequence should be sorted in ascending order of the keys and all the keys should be different,
+            it is checked by an assertion in debug mode only.
+            After the construction the object is a usual concurrent set; the tree is not rebalanced by the following updates.
+        */
+        template <typename ForwardIterator>
+        EllenBinTreeSet( ForwardIterator first, ForwardIterator last )
+            : base_class()
+        {
+            base_class::bulk_build( static_cast<size_t>( std::distance( first, last )), [&first]() -> leaf_node * {
+                leaf_node * pNode = cxx_leaf_node_allocator().New( *first );
+                ++first;
+                return pNode;
+            });
+        }
+
+        /// Parallel bulk-load constructor
+        /**
+            The constructor is the same as \ref cds_nonintrusive_EllenBinTreeSet_bulk_ctor "EllenBinTreeSet( first, last )"
+            but the subtrees are built by the tasks of \p ex executor in parallel.
+            \p RandomAccessIterator should be a random access iterator.
+            See \ref cds_intrusive_EllenBinTree_bulk_ctor "intrusive::EllenBinTree" for \p Executor requirements.
+        */
+        template <typename RandomAccessIterator, typename Executor>
+        EllenBinTreeSet( RandomAccessIterator first, RandomAccessIterator last, Executor& ex )
+            : base_class()
+        {
+            base_class::bulk_build( static_cast<size_t>( last - first ), [first]( size_t nIndex ) -> leaf_node * {
+                return cxx_leaf_node_allocator().New( first[nIndex] );
+            }, ex );
+        }
+
         /// Clears the set
         ~EllenBinTreeSet()
         {}
@@ -578,6 +613,103 @@ namespace cds { namespace container {
                 cds::details::predicate_wrapper< leaf_node, Less, typename maker::value_accessor >() );
         }
 
+        /// Finds the item with minimal key greater than \p key
+        /** @anchor cds_nonintrusive_EllenBinTreeSet_find_next
+            The function searches the successor of \p key, i.e. the item with the least key
+            that is strictly greater than \p key, and returns it in \p result parameter.
+            \p key itself may or may not be in the set.
+            The function returns \p false if there is no such item.
+
+            The guarded pointer \p result prevents deallocation of returned item,
+            see cds::gc::guarded_ptr for explanation.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+        */
+        template <typename Q>
+        bool find_next( guarded_ptr& result, Q const& key )
+        {
+            return base_class::find_next_( result.guard(), key );
+        }
+
+        /// Finds the successor of \p key using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeSet_find_next "find_next(guarded_ptr&, Q const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool find_next_with( guarded_ptr& result, Q const& key, Less pred )
+        {
+            return base_class::find_next_with_( result.guard(), key,
+                cds::details::predicate_wrapper< leaf_node, Less, typename maker::value_accessor >() );
+        }
+
+        /// Finds the item with maximal key less than \p key
+        /** @anchor cds_nonintrusive_EllenBinTreeSet_find_prev
+            The function searches the predecessor of \p key, i.e. the item with the greatest key
+            that is strictly less than \p key, and returns it in \p result parameter.
+            \p key itself may or may not be in the set.
+            The function returns \p false if there is no such item.
+
+            The guarded pointer \p result prevents deallocation of returned item,
+            see cds::gc::guarded_ptr for explanation.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+        */
+        template <typename Q>
+        bool find_prev( guarded_ptr& result, Q const& key )
+        {
+            return base_class::find_prev_( result.guard(), key );
+        }
+
+        /// Finds the predecessor of \p key using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeSet_find_prev "find_prev(guarded_ptr&, Q const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool find_prev_with( guarded_ptr& result, Q const& key, Less pred )
+        {
+            return base_class::find_prev_with_( result.guard(), key,
+                cds::details::predicate_wrapper< leaf_node, Less, typename maker::value_accessor >() );
+        }
+
+        /// Calls \p f for each item with key in range <tt>[from, to]</tt>
+        /** @anchor cds_nonintrusive_EllenBinTreeSet_for_each_range
+            The function visits in ascending key order all items whose key \p k satisfies <tt>from <= k <= to</tt>.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor may change non-key fields of \p item only.
+
+            The scan is not a snapshot, see \ref cds_intrusive_EllenBinTree_for_each_range "intrusive EllenBinTree::for_each_range"
+            for the concurrency notes. The function returns the number of items visited.
+        */
+        template <typename Q, typename Func>
+        size_t for_each_range( Q const& from, Q const& to, Func f )
+        {
+            return base_class::for_each_range( from, to, [&f]( leaf_node& node ) { f( node.m_Value ); } );
+        }
+
+        /// Calls \p f for each item in range <tt>[from, to]</tt> using \p pred predicate for key comparing
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeSet_for_each_range "for_each_range(Q const&, Q const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less, typename Func>
+        size_t for_each_range_with( Q const& from, Q const& to, Less pred, Func f )
+        {
+            return base_class::for_each_range_with( from, to,
+                cds::details::predicate_wrapper< leaf_node, Less, typename maker::value_accessor >(),
+                [&f]( leaf_node& node ) { f( node.m_Value ); } );
+        }
+
         /// Clears the set (non-atomic)
         /**
             The function unlink all items from the tree.
@@ -176,6 +176,42 @@ namespace cds { namespace container {
             : base_class()
         {}
 
+        /// Bulk-load constructor
+        /**
+            Builds the map from the sequence <tt>[first, last)</tt> of the pairs in O(N) time without any search.
+            The key of the new item is constructed from <tt>first->first</tt>, the value is constructed from <tt>first->second</tt>.
+            The sequence should be sorted in ascending order of the keys and all the keys should be different.
+            See \ref cds_nonintrusive_SkipListSet_hp_bulk_ctor "SkipListSet( first, last )" for details.
+        */
+        template <typename InputIterator>
+        SkipListMap( InputIterator first, InputIterator last )
+            : base_class()
+        {
+            base_class::bulk_build( [&first, &last]( size_t nIndex ) -> node_type * {
+                if ( first == last )
+                    return nullptr;
+                node_type * pNode = node_allocator().New( base_class::bulk_height( nIndex ), first->first, first->second );
+                ++first;
+                return pNode;
+            }, base_class::dispose_node );
+        }
+
+        /// Parallel bulk-load constructor
+        /**
+            The constructor is the same as \ref SkipListMap( InputIterator, InputIterator )
+            but the parts of the sequence are built by the tasks of \p ex executor in parallel.
+            \p RandomAccessIterator should be a random access iterator.
+            See \ref cds_intrusive_SkipListSet_hp_bulk_ctor "intrusive::SkipListSet" for \p Executor requirements.
+        */
+        template <typename RandomAccessIterator, typename Executor>
+        SkipListMap( RandomAccessIterator first, RandomAccessIterator last, Executor& ex )
+            : base_class()
+        {
+            base_class::bulk_build( static_cast<size_t>( last - first ), [first]( size_t nIndex ) -> node_type * {
+                return node_allocator().New( base_class::bulk_height( nIndex ), first[nIndex].first, first[nIndex].second );
+            }, base_class::dispose_node, ex );
+        }
+
         /// Destructor destroys the set object
         ~SkipListMap()
         {}
@@ -152,6 +152,9 @@ namespace cds { namespace container {
         /// Guarded pointer
         typedef cds::gc::guarded_ptr< gc, node_type, value_type, details::guarded_ptr_cast_set<node_type, value_type> > guarded_ptr;
 
+        /// Search finger, see \ref cds::intrusive::SkipListSet::finger "intrusive::SkipListSet::finger" for explanation
+        typedef typename base_class::finger finger;
+
     protected:
         //@cond
         unsigned int random_level()
@@ -166,6 +169,49 @@ namespace cds { namespace container {
             : base_class()
         {}
 
+        /// Bulk-load constructor
+        /** \anchor cds_nonintrusive_SkipListSet_hp_bulk_ctor
+            Builds the set from the sequence <tt>[first, last)</tt> in O(N) time without any search:
+            the nodes are created and linked level by level in one pass.
+            The \ref value_type should be constructible from \p *first. The sequence should be sorted
+            in ascending order of the keys and all the keys should be different,
+            it is checked by an assertion in debug mode only.
+
+            Instead of random height i-th node (0-based) gets the deterministic height
+            <tt>1 + </tt>(count of trailing zero bits of <tt>i + 1</tt>), so the levels
+            of the skip-list built are balanced ideally. After the construction the object is a usual concurrent set.
+            If the construction of a node throws an exception, the nodes created are freed and the exception
+            is propagated to the caller.
+        */
+        template <typename InputIterator>
+        SkipListSet( InputIterator first, InputIterator last )
+            : base_class()
+        {
+            base_class::bulk_build( [&first, &last]( size_t nIndex ) -> node_type * {
+                if ( first == last )
+                    return nullptr;
+                node_type * pNode = node_allocator().New( base_class::bulk_height( nIndex ), *first );
+                ++first;
+                return pNode;
+            }, base_class::dispose_node );
+        }
+
+        /// Parallel bulk-load constructor
+        /**
+            The constructor is the same as \ref cds_nonintrusive_SkipListSet_hp_bulk_ctor "SkipListSet( first, last )"
+            but the parts of the sequence are built by the tasks of \p ex executor in parallel.
+            \p RandomAccessIterator should be a random access iterator.
+            See \ref cds_intrusive_SkipListSet_hp_bulk_ctor "intrusive::SkipListSet" for \p Executor requirements.
+        */
+        template <typename RandomAccessIterator, typename Executor>
+        SkipListSet( RandomAccessIterator first, RandomAccessIterator last, Executor& ex )
+            : base_class()
+        {
+            base_class::bulk_build( static_cast<size_t>( last - first ), [first]( size_t nIndex ) -> node_type * {
+                return node_allocator().New( base_class::bulk_height( nIndex ), first[nIndex] );
+            }, base_class::dispose_node, ex );
+        }
+
         /// Destructor destroys the set object
         ~SkipListSet()
         {}
@@ -263,6 +309,40 @@ namespace cds { namespace container {
             return false;
         }
 
+        /// Inserts new node using the search finger
+        /**
+            The function is an analog of \p insert(Q const&) but the search of the insert position
+            starts from the finger \p fng if \p val is greater than the finger key.
+            After inserting the finger points to the search path of \p val.
+            See \ref cds::intrusive::SkipListSet::finger "intrusive::SkipListSet::finger" for explanation.
+        */
+        template <typename Q>
+        bool insert( finger& fng, Q const& val )
+        {
+            scoped_node_ptr sp( node_allocator().New( random_level(), val ));
+            if ( base_class::insert( fng, *sp.get() )) {
+                sp.release();
+                return true;
+            }
+            return false;
+        }
+
+        /// Inserts new node using the search finger
+        /**
+            The function is an analog of \p insert(Q const&, Func) but the search of the insert position
+            starts from the finger \p fng if \p val is greater than the finger key.
+        */
+        template <typename Q, typename Func>
+        bool insert( finger& fng, Q const& val, Func f )
+        {
+            scoped_node_ptr sp( node_allocator().New( random_level(), val ));
+            if ( base_class::insert( fng, *sp.get(), [&f]( node_type& val ) { f( val.m_Value ); } )) {
+                sp.release();
+                return true;
+            }
+            return false;
+        }
+
         /// Ensures that the item exists in the set
         /**
             The operation performs inserting or changing data with lock-free manner.
@@ -616,6 +696,41 @@ namespace cds { namespace container {
             return base_class::find_with( val, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >());
         }
 
+        /// Finds the key \p val using the search finger
+        /** \anchor cds_nonintrusive_SkipListSet_find_finger_func
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_find_func "find(Q&, Func)"
+            but the search starts from the finger \p fng if \p val is greater than the finger key.
+            After searching the finger points to the search path of \p val.
+            See \ref cds::intrusive::SkipListSet::finger "intrusive::SkipListSet::finger" for explanation.
+        */
+        template <typename Q, typename Func>
+        bool find( finger& fng, Q& val, Func f )
+        {
+            return base_class::find( fng, val, [&f]( node_type& node, Q& v ) { f( node.m_Value, v ); });
+        }
+
+        /// Finds the key \p val using the search finger
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_find_finger_func "find(finger&, Q&, Func)"
+            for the const key.
+        */
+        template <typename Q, typename Func>
+        bool find( finger& fng, Q const& val, Func f )
+        {
+            return base_class::find( fng, val, [&f]( node_type& node, Q const& v ) { f( node.m_Value, v ); });
+        }
+
+        /// Finds the key \p val using the search finger
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_find_val "find(Q const&)"
+            but the search starts from the finger \p fng if \p val is greater than the finger key.
+        */
+        template <typename Q>
+        bool find( finger& fng, Q const& val )
+        {
+            return base_class::find( fng, val );
+        }
+
         /// Finds \p key and return the item found
         /** \anchor cds_nonintrusive_SkipListSet_hp_get
             The function searches the item with key equal to \p key
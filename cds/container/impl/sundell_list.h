@@ -0,0 +1,257 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_IMPL_SUNDELL_LIST_H
+#define __CDS_CONTAINER_IMPL_SUNDELL_LIST_H
+
+#include <memory>
+#include <cds/container/details/guarded_ptr_cast.h>
+
+namespace cds { namespace container {
+
+    /// Sundell-Tsigas lock-free doubly-linked list
+    /** @ingroup cds_nonintrusive_list
+        \anchor cds_nonintrusive_SundellList_gc
+
+        The list is non-intrusive version of \ref cds_intrusive_SundellList_hp "cds::intrusive::SundellList" class.
+        It is an unordered sequence that supports concurrent insertion and extraction at both ends,
+        so the list can be used as a lock-free deque.
+
+        Source:
+            - [2008] H.Sundell, P.Tsigas "Lock-free deques and doubly linked lists"
+
+        Template arguments:
+        - \p GC - garbage collector used, possible types are \p gc::HP and \p gc::PTB.
+        - \p T - type stored in the list. The value must be copy-constructible.
+        - \p Traits - type traits, default is \p sundell_list::type_traits
+
+        It is possible to declare option-based list with \p cds::container::sundell_list::make_traits metafunction
+        instead of \p Traits template argument. Template argument list \p Options of the metafunction are:
+        - opt::allocator - the allocator used for creating and freeing list's item. Default is \ref CDS_DEFAULT_ALLOCATOR macro.
+        - opt::back_off - back-off strategy used. If the option is not specified, the cds::backoff::Default is used.
+        - opt::item_counter - the type of item counting feature. Default is \ref atomicity::empty_item_counter that is no item counting.
+        - opt::memory_model - C++ memory ordering model. Can be opt::v::relaxed_ordering (relaxed memory model, the default)
+            or opt::v::sequential_consistent (sequentially consisnent memory model).
+
+        \par Usage
+        You should select GC needed and include appropriate .h-file:
+        - for gc::HP: \code #include <cds/container/sundell_list_hp.h> \endcode
+        - for gc::PTB: \code #include <cds/container/sundell_list_ptb.h> \endcode
+
+        Example:
+        \code
+        #include <cds/container/sundell_list_hp.h>
+
+        typedef cds::container::SundellList< cds::gc::HP, int > int_deque;
+
+        int_deque dq;
+        dq.push_back( 1 );
+        dq.push_front( 0 );
+
+        int n;
+        dq.pop_back( n );   // n == 1
+        dq.pop_back( n );   // n == 0
+        \endcode
+    */
+    template <
+        typename GC,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        typename Traits = sundell_list::type_traits
+#else
+        typename Traits
+#endif
+    >
+    class SundellList:
+#ifdef CDS_DOXYGEN_INVOKED
+        protected intrusive::SundellList< GC, T, Traits >
+#else
+        protected details::make_sundell_list< GC, T, Traits >::type
+#endif
+    {
+        //@cond
+        typedef details::make_sundell_list< GC, T, Traits > options;
+        typedef typename options::type  base_class;
+        //@endcond
+
+    public:
+        typedef T                                   value_type      ;   ///< Type of value stored in the list
+        typedef typename base_class::gc             gc              ;   ///< Garbage collector used
+        typedef typename base_class::back_off       back_off        ;   ///< Back-off strategy used
+        typedef typename options::allocator_type    allocator_type  ;   ///< Allocator type used for allocate/deallocate the nodes
+        typedef typename base_class::item_counter   item_counter    ;   ///< Item counting policy used
+        typedef typename base_class::memory_model   memory_model    ;   ///< Memory ordering. See cds::opt::memory_model option
+
+    protected:
+        //@cond
+        typedef typename base_class::value_type     node_type;
+        typedef typename options::cxx_allocator     cxx_allocator;
+        typedef typename options::node_deallocator  node_deallocator;
+        //@endcond
+
+    public:
+        /// Guarded pointer
+        typedef cds::gc::guarded_ptr< gc, node_type, value_type, details::guarded_ptr_cast_set<node_type, value_type> > guarded_ptr;
+
+    protected:
+        //@cond
+        template <typename Q>
+        static node_type * alloc_node( Q const& v )
+        {
+            return cxx_allocator().New( v );
+        }
+
+        template <typename... Args>
+        static node_type * alloc_node( Args&&... args )
+        {
+            return cxx_allocator().MoveNew( std::forward<Args>(args)... );
+        }
+
+        struct node_disposer {
+            void operator()( node_type * pNode )
+            {
+                cxx_allocator().Delete( pNode );
+            }
+        };
+        typedef std::unique_ptr< node_type, node_disposer >     scoped_node_ptr;
+        //@endcond
+
+    public:
+        /// Initializes empty list
+        SundellList()
+        {}
+
+        /// List destructor
+        /**
+            Clears the list
+        */
+        ~SundellList()
+        {}
+
+        /// Inserts new item at the front of the list
+        /**
+            The function creates a node with copy of \p val value
+            and inserts it at the front of the list. The function always returns \p true.
+        */
+        template <typename Q>
+        bool push_front( Q const& val )
+        {
+            scoped_node_ptr pNode( alloc_node( val ));
+            base_class::push_front( *pNode );
+            pNode.release();
+            return true;
+        }
+
+        /// Inserts new item at the back of the list
+        /**
+            The function is similar to \p push_front() but the item is inserted at the back of the list.
+        */
+        template <typename Q>
+        bool push_back( Q const& val )
+        {
+            scoped_node_ptr pNode( alloc_node( val ));
+            base_class::push_back( *pNode );
+            pNode.release();
+            return true;
+        }
+
+        /// Inserts data of type \p value_type constructed with <tt>std::forward<Args>(args)...</tt> at the front of the list
+        template <typename... Args>
+        bool emplace_front( Args&&... args )
+        {
+            scoped_node_ptr pNode( alloc_node( std::forward<Args>(args)... ));
+            base_class::push_front( *pNode );
+            pNode.release();
+            return true;
+        }
+
+        /// Inserts data of type \p value_type constructed with <tt>std::forward<Args>(args)...</tt> at the back of the list
+        template <typename... Args>
+        bool emplace_back( Args&&... args )
+        {
+            scoped_node_ptr pNode( alloc_node( std::forward<Args>(args)... ));
+            base_class::push_back( *pNode );
+            pNode.release();
+            return true;
+        }
+
+        /// Extracts the item from the front of the list
+        /**
+            If the list is empty the function returns \p false, \p dest is unchanged.
+            Otherwise, the value of the first item is copied to \p dest,
+            the item is removed from the list and the function returns \p true.
+        */
+        bool pop_front( value_type& dest )
+        {
+            typename gc::Guard g;
+            node_type * pNode = base_class::do_pop_front( g );
+            if ( pNode ) {
+                dest = pNode->m_Value;
+                return true;
+            }
+            return false;
+        }
+
+        /// Extracts the item from the back of the list
+        /**
+            The function is similar to \p pop_front( value_type& ) but the last item is extracted.
+        */
+        bool pop_back( value_type& dest )
+        {
+            typename gc::Guard g;
+            node_type * pNode = base_class::do_pop_back( g );
+            if ( pNode ) {
+                dest = pNode->m_Value;
+                return true;
+            }
+            return false;
+        }
+
+        /// Extracts the item from the front of the list and returns it as guarded pointer
+        /**
+            If the list is empty the function returns \p false.
+            Otherwise, the first item is removed from the list and returned in \p dest.
+            The item will be freed by the garbage collector when \p dest is released.
+        */
+        bool pop_front( guarded_ptr& dest )
+        {
+            return base_class::do_pop_front( dest.guard() ) != nullptr;
+        }
+
+        /// Extracts the item from the back of the list and returns it as guarded pointer
+        /**
+            The function is similar to \p pop_front( guarded_ptr& ) but the last item is extracted.
+        */
+        bool pop_back( guarded_ptr& dest )
+        {
+            return base_class::do_pop_back( dest.guard() ) != nullptr;
+        }
+
+        /// Checks if the list is empty
+        /**
+            The result is approximate if the list is being changed concurrently.
+        */
+        bool empty() const
+        {
+            return base_class::empty();
+        }
+
+        /// Returns list's item count
+        /**
+            The value returned depends on opt::item_counter option. For atomicity::empty_item_counter,
+            this function always returns 0.
+        */
+        size_t size() const
+        {
+            return base_class::size();
+        }
+
+        /// Clears the list
+        void clear()
+        {
+            base_class::clear();
+        }
+    };
+
+}}  // namespace cds::container
+
+#endif  // #ifndef __CDS_CONTAINER_IMPL_SUNDELL_LIST_H
@@ -23,6 +23,7 @@ namespace cds { namespace container {
             struct default_options {
                 typedef cds::backoff::empty     back_off;
                 typedef CDS_DEFAULT_ALLOCATOR   allocator;
+                typedef cds::opt::none          node_pool;
                 typedef atomicity::empty_item_counter item_counter;
                 typedef intrusive::queue_dummy_stat stat;
                 typedef opt::v::relaxed_ordering    memory_model;
@@ -48,7 +49,8 @@ namespace cds { namespace container {
                 {}
             };
 
-            typedef typename options::allocator::template rebind<node_type>::other allocator_type;
+            typedef typename cds::container::details::select_node_allocator<
+                node_type, typename options::allocator, typename options::node_pool >::type allocator_type;
             typedef cds::details::Allocator< node_type, allocator_type >           cxx_allocator;
 
             struct node_deallocator
@@ -22,6 +22,7 @@ namespace cds { namespace container {
             struct default_options {
                 typedef cds::backoff::empty     back_off;
                 typedef CDS_DEFAULT_ALLOCATOR   allocator;
+                typedef cds::opt::none          node_pool;
                 typedef atomicity::empty_item_counter item_counter;
                 typedef intrusive::optimistic_queue::dummy_stat stat;
                 typedef opt::v::relaxed_ordering    memory_model;
@@ -47,7 +48,8 @@ namespace cds { namespace container {
                 {}
             };
 
-            typedef typename options::allocator::template rebind<node_type>::other allocator_type;
+            typedef typename cds::container::details::select_node_allocator<
+                node_type, typename options::allocator, typename options::node_pool >::type allocator_type;
             typedef cds::details::Allocator< node_type, allocator_type >           cxx_allocator;
 
             struct node_deallocator
@@ -89,6 +91,8 @@ namespace cds { namespace container {
         \p Options are:
         - opt::back_off - back-off strategy used. If the option is not specified, the cds::backoff::empty is used.
         - opt::allocator - allocator (like \p std::allocator) used for nodes allocation. Default is \ref CDS_DEFAULT_ALLOCATOR
+        - opt::node_pool - node pool policy to recycle the nodes freed by the garbage collector,
+            for example, cds::memory::vyukov_queue_node_pool. Default is \p opt::none (no node pool)
         - opt::item_counter - the type of item counting feature. Default is \ref atomicity::empty_item_counter
         - opt::stat - the type to gather internal statistics for debugging and profiling purposes.
             Possible option value are: intrusive::optimistic_queue::stat, intrusive::optimistic_queue::dummy_stat (the default),
@@ -0,0 +1,637 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_SNAPSHOT_H
+#define __CDS_CONTAINER_SNAPSHOT_H
+
+#include <cds/details/defs.h>
+#include <cds/os/file_map.h>
+#include <cds/os/syserror.h>
+#include <cds/details/noncopyable.h>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <string>
+#include <vector>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+
+namespace cds { namespace container {
+
+    /// Binary snapshot of the containers
+    /** @ingroup cds_nonintrusive_helper
+
+        The namespace contains the tools to save the content of a map or a set to a file
+        and to restore the container from the file quickly, for example, to warm up the container after restart.
+
+        \p save() traverses the container by its iterators or by \p for_each() member function
+        if the container has no iterators (like \p CuckooMap) and writes each item to the file.
+        The traversal is performed while other threads modify the container, so the snapshot is not an atomic picture
+        of the container: an item inserted or erased concurrently may be present or missing in the file,
+        other items are saved exactly once. For \p CuckooMap and \p CuckooSet the container is locked
+        entirely during the traversal, so their snapshot is exact but the writers wait for the end of \p save().
+
+        The items are encoded by a <i>codec</i>. The codec interface is:
+        \code
+        struct codec {
+            // Type of the decoded item, should be default-constructible
+            typedef implementation_defined value_type;
+
+            // Writes item v to the snapshot
+            template <typename Q>
+            void save( cds::container::snapshot::writer& w, Q const& v ) const;
+
+            // Reads item v from the snapshot
+            void load( cds::container::snapshot::reader& r, value_type& v ) const;
+        };
+        \endcode
+        The library provides \p pod_codec for trivial types, \p string_codec for \p std::string
+        and \p pair_codec for key-value pairs. \p default_codec selects the codec by the item type of the container.
+
+        The snapshot is read by \p loader that maps the file into memory and provides the forward iterator
+        over decoded items. The iterator range may be passed to bulk-load constructor of the container:
+        \code
+        #include <cds/container/skip_list_map_hp.h>
+        #include <cds/container/snapshot.h>
+
+        typedef cds::container::SkipListMap< cds::gc::HP, int, std::string > map_type;
+        namespace snapshot = cds::container::snapshot;
+
+        map_type m;
+        // ... fill the map
+        snapshot::save( m, "map.snapshot" );
+
+        // on restart
+        snapshot::loader< snapshot::default_codec< map_type::value_type > > ld( "map.snapshot" );
+        map_type m2( ld.begin(), ld.end() );
+        \endcode
+        The sorted bulk-load constructor of \p SkipListMap requires the range to be sorted,
+        so the snapshot of a \p SkipListMap can be loaded in such way. \p SplitListMap bulk-load constructor
+        accepts any snapshot. For other containers use \p load() that inserts the items one by one
+        into the container; the count of the items stored in the snapshot is \p loader::size().
+
+        The file contains the header and the sequence of encoded items. The data are written in the native byte order;
+        the snapshot written on the platform with another byte order is rejected by \p loader.
+        The file is completed by \p save() only after all items are written; incomplete file is rejected too.
+    */
+    namespace snapshot {
+
+        /// Snapshot error
+        class snapshot_error: public cds::Exception
+        {
+        public:
+            //@cond
+            explicit snapshot_error( std::string const& strMsg )
+                : cds::Exception( strMsg )
+            {}
+            //@endcond
+        };
+
+        /// Snapshot file header
+        struct header
+        {
+            char        szMagic[8]  ;   ///< File signature \p c_szMagic
+            uint32_t    nVersion    ;   ///< Format version, \p c_nVersion
+            uint32_t    nByteOrder  ;   ///< Byte order mark \p c_nByteOrderMark in the byte order of the writer
+            uint64_t    nItemCount  ;   ///< Count of the items in the snapshot
+            uint64_t    nDataSize   ;   ///< Size of encoded items in bytes
+
+            static char const *     c_szMagic()     { return "CDSSNAP"; }   ///< File signature
+            static uint32_t const   c_nVersion      = 1             ;   ///< Current format version
+            static uint32_t const   c_nByteOrderMark = 0x01020304   ;   ///< Byte order mark
+        };
+
+        /// Buffered snapshot writer
+        /**
+            The object is used by the codecs to write encoded items.
+            On construction the writer creates the file \p pszFileName and reserves the space for \p header.
+            The header is written by \p commit() when all items are written, so the file is invalid until \p commit().
+            All errors are reported by \p snapshot_error exception.
+        */
+        class writer: public cds::details::noncopyable
+        {
+            //@cond
+            std::FILE *         m_pFile;
+            std::string         m_strFileName;
+            std::vector<char>   m_Buffer;
+            size_t              m_nBufUsed;
+            uint64_t            m_nDataSize;
+
+            static size_t const c_nBufferSize = 64 * 1024;
+
+            void fail( char const * pszWhat )
+            {
+                std::string strMsg = std::string( "snapshot: " ) + pszWhat + " '" + m_strFileName + "': " + std::strerror( errno );
+                if ( m_pFile ) {
+                    std::fclose( m_pFile );
+                    m_pFile = nullptr;
+                }
+                throw snapshot_error( strMsg );
+            }
+
+            void flush()
+            {
+                if ( m_nBufUsed ) {
+                    if ( std::fwrite( &m_Buffer[0], 1, m_nBufUsed, m_pFile ) != m_nBufUsed )
+                        fail( "cannot write" );
+                    m_nBufUsed = 0;
+                }
+            }
+            //@endcond
+
+        public:
+            /// Creates the snapshot file \p pszFileName
+            explicit writer( char const * pszFileName )
+                : m_pFile( std::fopen( pszFileName, "wb" ))
+                , m_strFileName( pszFileName )
+                , m_Buffer( c_nBufferSize )
+                , m_nBufUsed( 0 )
+                , m_nDataSize( 0 )
+            {
+                if ( !m_pFile )
+                    fail( "cannot create" );
+
+                // Zero header is not valid, it will be rewritten by commit()
+                header h;
+                std::memset( &h, 0, sizeof(h) );
+                write( &h, sizeof(h) );
+                m_nDataSize = 0;
+            }
+
+            /// Closes the file. If \p commit() has not been called the file is left invalid
+            ~writer()
+            {
+                if ( m_pFile )
+                    std::fclose( m_pFile );
+            }
+
+            /// Writes \p nSize bytes from \p pData
+            void write( void const * pData, size_t nSize )
+            {
+                char const * p = reinterpret_cast<char const *>( pData );
+                m_nDataSize += nSize;
+                while ( nSize ) {
+                    if ( m_nBufUsed == c_nBufferSize )
+                        flush();
+                    size_t const n = std::min( nSize, c_nBufferSize - m_nBufUsed );
+                    std::memcpy( &m_Buffer[m_nBufUsed], p, n );
+                    m_nBufUsed += n;
+                    p += n;
+                    nSize -= n;
+                }
+            }
+
+            /// Writes the header and closes the file
+            /**
+                \p nItemCount is the count of the items written.
+            */
+            void commit( size_t nItemCount )
+            {
+                assert( m_pFile );
+                flush();
+
+                header h;
+                std::memset( &h, 0, sizeof(h) );
+                std::strcpy( h.szMagic, header::c_szMagic() );
+                h.nVersion = header::c_nVersion;
+                h.nByteOrder = header::c_nByteOrderMark;
+                h.nItemCount = nItemCount;
+                h.nDataSize = m_nDataSize;
+
+                if ( std::fseek( m_pFile, 0, SEEK_SET ) != 0 )
+                    fail( "cannot write" );
+                if ( std::fwrite( &h, sizeof(h), 1, m_pFile ) != 1 )
+                    fail( "cannot write" );
+                int nRet = std::fclose( m_pFile );
+                m_pFile = nullptr;
+                if ( nRet != 0 )
+                    fail( "cannot write" );
+            }
+        };
+
+        /// Snapshot reader
+        /**
+            The object is used by the codecs to read encoded items from the memory-mapped snapshot.
+            The reader does not own the memory.
+            If the data are over \p snapshot_error exception is thrown.
+        */
+        class reader
+        {
+            //@cond
+            char const * m_pCur;
+            char const * m_pEnd;
+            //@endcond
+
+        public:
+            /// Constructs the reader of \p nSize bytes starting from \p pData
+            reader( void const * pData, size_t nSize )
+                : m_pCur( reinterpret_cast<char const *>( pData ))
+                , m_pEnd( reinterpret_cast<char const *>( pData ) + nSize )
+            {}
+
+            /// Returns the pointer to next \p nSize bytes and skips them
+            /**
+                The pointer may be unaligned.
+            */
+            char const * get( size_t nSize )
+            {
+                if ( static_cast<size_t>( m_pEnd - m_pCur ) < nSize )
+                    throw snapshot_error( "snapshot: unexpected end of data" );
+                char const * p = m_pCur;
+                m_pCur += nSize;
+                return p;
+            }
+
+            /// Copies next \p nSize bytes to \p pDest
+            void read( void * pDest, size_t nSize )
+            {
+                std::memcpy( pDest, get( nSize ), nSize );
+            }
+
+            /// Checks if all data have been read
+            bool eof() const
+            {
+                return m_pCur == m_pEnd;
+            }
+        };
+
+        /// Codec for trivial types
+        /**
+            The item is written as is, byte by byte.
+        */
+        template <typename T>
+        struct pod_codec
+        {
+            static_assert( std::is_pod<T>::value, "pod_codec requires POD type" );
+
+            typedef T value_type;   ///< Item type
+
+            /// Writes \p v
+            void save( writer& w, T const& v ) const
+            {
+                w.write( &v, sizeof(v) );
+            }
+
+            /// Reads \p v
+            void load( reader& r, T& v ) const
+            {
+                r.read( &v, sizeof(v) );
+            }
+        };
+
+        /// Codec for \p std::string
+        /**
+            The string is written as 64bit length followed by the characters.
+        */
+        struct string_codec
+        {
+            typedef std::string value_type;   ///< Item type
+
+            /// Writes \p s
+            void save( writer& w, std::string const& s ) const
+            {
+                uint64_t nLen = s.size();
+                w.write( &nLen, sizeof(nLen) );
+                w.write( s.data(), s.size() );
+            }
+
+            /// Reads \p s
+            void load( reader& r, std::string& s ) const
+            {
+                uint64_t nLen;
+                r.read( &nLen, sizeof(nLen) );
+                s.assign( r.get( static_cast<size_t>( nLen )), static_cast<size_t>( nLen ));
+            }
+        };
+
+        /// Codec for key-value pair
+        /**
+            The key is encoded by \p KeyCodec, the value is encoded by \p ValueCodec.
+            The decoded item type is <tt>std::pair< KeyCodec::value_type, ValueCodec::value_type ></tt>.
+        */
+        template <typename KeyCodec, typename ValueCodec>
+        struct pair_codec
+        {
+            typedef KeyCodec    key_codec   ;   ///< Key codec
+            typedef ValueCodec  value_codec ;   ///< Value codec
+
+            /// Item type
+            typedef std::pair< typename key_codec::value_type, typename value_codec::value_type > value_type;
+
+            key_codec   m_KeyCodec      ;   ///< Key codec
+            value_codec m_ValueCodec    ;   ///< Value codec
+
+            /// Default ctor
+            pair_codec()
+            {}
+
+            /// Constructs the codec with the codecs of the key and of the value
+            pair_codec( key_codec const& kc, value_codec const& vc )
+                : m_KeyCodec( kc )
+                , m_ValueCodec( vc )
+            {}
+
+            /// Writes \p v
+            template <typename Pair>
+            void save( writer& w, Pair const& v ) const
+            {
+                m_KeyCodec.save( w, v.first );
+                m_ValueCodec.save( w, v.second );
+            }
+
+            /// Reads \p v
+            void load( reader& r, value_type& v ) const
+            {
+                m_KeyCodec.load( r, v.first );
+                m_ValueCodec.load( r, v.second );
+            }
+        };
+
+        /// Selects the codec for type \p T
+        /**
+            The default codec is:
+            - \p string_codec for \p std::string
+            - \p pair_codec of the default codecs of the key and of the value for <tt>std::pair<K, V></tt>,
+              the constness of \p K is removed, so <tt>default_codec< Map::value_type ></tt> is the codec for the map items
+            - \p pod_codec for other types
+        */
+        template <typename T>
+        struct default_codec: public pod_codec<T>
+        {};
+
+        //@cond
+        template <>
+        struct default_codec< std::string >: public string_codec
+        {};
+
+        template <typename K, typename V>
+        struct default_codec< std::pair<K, V> >
+            : public pair_codec< default_codec< typename std::remove_const<K>::type >, default_codec<V> >
+        {};
+        //@endcond
+
+        //@cond
+        namespace details {
+            template <typename Container>
+            struct has_iterator {
+                template <typename C> static char test( typename C::iterator * );
+                template <typename C> static long test( ... );
+                static bool const value = sizeof( test<Container>( nullptr )) == sizeof(char);
+            };
+
+            template <typename Container>
+            struct has_mapped_type {
+                template <typename C> static char test( typename C::mapped_type * );
+                template <typename C> static long test( ... );
+                static bool const value = sizeof( test<Container>( nullptr )) == sizeof(char);
+            };
+
+            template <typename Container, typename Func>
+            static inline void traverse( Container& c, Func f, std::true_type )
+            {
+                for ( typename Container::iterator it = c.begin(), itEnd = c.end(); it != itEnd; ++it )
+                    f( *it );
+            }
+
+            template <typename Container, typename Func>
+            static inline void traverse( Container& c, Func f, std::false_type )
+            {
+                c.for_each( f );
+            }
+
+            template <typename Container, typename Value>
+            static inline bool insert( Container& c, Value const& v, std::true_type )
+            {
+                return c.insert( v.first, v.second );
+            }
+
+            template <typename Container, typename Value>
+            static inline bool insert( Container& c, Value const& v, std::false_type )
+            {
+                return c.insert( v );
+            }
+        } // namespace details
+        //@endcond
+
+        /// Saves the container \p c to the file \p pszFileName
+        /**
+            The container is traversed by its iterators, or by \p for_each() member function
+            if the container has no iterators. Each item is written by \p codec.
+            Other threads can modify the container while it is being saved, see \ref cds::container::snapshot
+            "snapshot" namespace description for the consistency of such snapshot.
+            For RCU-based containers the caller should meet the iterator requirements of the container.
+
+            Returns the count of saved items. If the file cannot be written, \p snapshot_error is thrown.
+        */
+        template <typename Container, typename Codec = default_codec< typename Container::value_type > >
+        size_t save( Container& c, char const * pszFileName, Codec const& codec = Codec() )
+        {
+            writer w( pszFileName );
+            size_t nCount = 0;
+            details::traverse( c, [&w, &codec, &nCount]( typename Container::value_type const& v ) {
+                    codec.save( w, v );
+                    ++nCount;
+                },
+                std::integral_constant< bool, details::has_iterator<Container>::value >()
+            );
+            w.commit( nCount );
+            return nCount;
+        }
+
+        /// Snapshot loader
+        /**
+            The loader maps the snapshot file written by \p save() into memory
+            and provides forward iterator over the items decoded by \p Codec.
+            The decoded item type <tt>Codec::value_type</tt> should be default-constructible.
+
+            Each iterator decodes the items independently, so the range can be traversed several times.
+            The iterators are valid while the loader is alive.
+        */
+        template <typename Codec>
+        class loader
+        {
+        public:
+            typedef Codec   codec   ;   ///< Codec
+            typedef typename codec::value_type  value_type  ;   ///< Decoded item type
+
+        protected:
+            //@cond
+            cds::OS::file_map   m_File;
+            codec               m_Codec;
+            char const *        m_pData;
+            size_t              m_nDataSize;
+            size_t              m_nItemCount;
+            //@endcond
+
+        public:
+            /// Forward iterator over the decoded items
+            class iterator
+            {
+            public:
+                typedef std::forward_iterator_tag   iterator_category   ;   ///< Iterator category
+                typedef typename loader::value_type value_type          ;   ///< Value type
+                typedef std::ptrdiff_t              difference_type     ;   ///< Difference type
+                typedef value_type const *          pointer             ;   ///< Pointer to item
+                typedef value_type const &          reference           ;   ///< Reference to item
+
+            private:
+                //@cond
+                friend class loader;
+
+                codec const *   m_pCodec;
+                reader          m_Reader;
+                size_t          m_nRest;    // count of the items not passed yet including current one
+                value_type      m_Value;
+
+                iterator( codec const& c, char const * pData, size_t nDataSize, size_t nCount )
+                    : m_pCodec( &c )
+                    , m_Reader( pData, nDataSize )
+                    , m_nRest( nCount )
+                {
+                    decode();
+                }
+
+                void decode()
+                {
+                    if ( m_nRest )
+                        m_pCodec->load( m_Reader, m_Value );
+                }
+                //@endcond
+
+            public:
+                /// Constructs end iterator
+                iterator()
+                    : m_pCodec( nullptr )
+                    , m_Reader( nullptr, 0 )
+                    , m_nRest( 0 )
+                {}
+
+                /// Returns current item
+                reference operator*() const
+                {
+                    assert( m_nRest );
+                    return m_Value;
+                }
+
+                /// Returns pointer to current item
+                pointer operator->() const
+                {
+                    assert( m_nRest );
+                    return &m_Value;
+                }
+
+                /// Pre-increment
+                iterator& operator++()
+                {
+                    assert( m_nRest );
+                    --m_nRest;
+                    decode();
+                    return *this;
+                }
+
+                /// Post-increment
+                iterator operator++(int)
+                {
+                    iterator it( *this );
+                    ++*this;
+                    return it;
+                }
+
+                /// Iterator comparison, the iterators of the same loader are comparable only
+                bool operator==( iterator const& it ) const
+                {
+                    return m_nRest == it.m_nRest;
+                }
+
+                /// Iterator comparison
+                bool operator!=( iterator const& it ) const
+                {
+                    return !( *this == it );
+                }
+            };
+
+        public:
+            /// Maps the snapshot file \p pszFileName
+            /**
+                The header of the file is checked. If the file cannot be mapped or it is not valid snapshot,
+                \p snapshot_error is thrown.
+            */
+            explicit loader( char const * pszFileName, codec const& c = codec() )
+                : m_Codec( c )
+            {
+                if ( !m_File.open( pszFileName ))
+                    throw snapshot_error( std::string( "snapshot: cannot open '" ) + pszFileName + "': "
+                        + cds::OS::getSystemErrorText( cds::OS::getErrorCode() ));
+
+                header h;
+                if ( m_File.size() < sizeof(h) )
+                    throw snapshot_error( std::string( "snapshot: '" ) + pszFileName + "' is not a snapshot" );
+                std::memcpy( &h, m_File.data(), sizeof(h) );
+                if ( std::memcmp( h.szMagic, header::c_szMagic(), sizeof(h.szMagic) ) != 0 )
+                    throw snapshot_error( std::string( "snapshot: '" ) + pszFileName + "' is not a snapshot or it is incomplete" );
+                if ( h.nVersion != header::c_nVersion )
+                    throw snapshot_error( std::string( "snapshot: '" ) + pszFileName + "' has unsupported version" );
+                if ( h.nByteOrder != header::c_nByteOrderMark )
+                    throw snapshot_error( std::string( "snapshot: '" ) + pszFileName + "' has foreign byte order" );
+                if ( h.nDataSize != m_File.size() - sizeof(h) )
+                    throw snapshot_error( std::string( "snapshot: '" ) + pszFileName + "' has wrong size" );
+
+                m_pData = reinterpret_cast<char const *>( m_File.data() ) + sizeof(h);
+                m_nDataSize = static_cast<size_t>( h.nDataSize );
+                m_nItemCount = static_cast<size_t>( h.nItemCount );
+            }
+
+            /// Returns the count of the items in the snapshot
+            size_t size() const
+            {
+                return m_nItemCount;
+            }
+
+            /// Checks if the snapshot is empty
+            bool empty() const
+            {
+                return size() == 0;
+            }
+
+            /// Returns an iterator to the first item
+            /**
+                The first item is decoded, so \p snapshot_error is thrown if it cannot be decoded.
+            */
+            iterator begin() const
+            {
+                return iterator( m_Codec, m_pData, m_nDataSize, m_nItemCount );
+            }
+
+            /// Returns an iterator to the end of the snapshot
+            iterator end() const
+            {
+                return iterator();
+            }
+        };
+
+        /// Loads the snapshot \p pszFileName into the container \p c
+        /**
+            The function inserts each item of the snapshot into \p c by <tt>c.insert( key, value )</tt> for the maps
+            (the containers having \p mapped_type) or by <tt>c.insert( item )</tt> for the sets.
+            The container may be used by other threads.
+            Returns the count of inserted items; the items that are already in \p c are not counted.
+
+            If the file is not valid snapshot, \p snapshot_error is thrown.
+        */
+        template <typename Container, typename Codec = default_codec< typename Container::value_type > >
+        size_t load( Container& c, char const * pszFileName, Codec const& codec = Codec() )
+        {
+            loader<Codec> ld( pszFileName, codec );
+            size_t nCount = 0;
+            for ( typename loader<Codec>::iterator it = ld.begin(), itEnd = ld.end(); it != itEnd; ++it ) {
+                if ( details::insert( c, *it, std::integral_constant< bool, details::has_mapped_type<Container>::value >() ))
+                    ++nCount;
+            }
+            return nCount;
+        }
+
+    } // namespace snapshot
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_SNAPSHOT_H
@@ -221,6 +221,31 @@ namespace cds { namespace container {
             : base_class( nItemCount, nLoadFactor )
         {}
 
+        /// Bulk-load constructor
+        /**
+            Builds the map from the sequence <tt>[first, last)</tt> of the pairs, <tt>std::pair<Key const, Value></tt>
+            should be constructible from \p *first. The bucket table is sized for <tt>std::distance( first, last )</tt> items
+            and pre-split before inserting the items.
+            See \ref cds_nonintrusive_SplitListSet_hp_bulk_ctor "SplitListSet( first, last, nLoadFactor )" for details.
+        */
+        template <typename ForwardIterator
+            , typename = typename std::enable_if< !std::is_integral<ForwardIterator>::value >::type >
+        SplitListMap( ForwardIterator first, ForwardIterator last, size_t nLoadFactor = 1 )
+            : base_class( first, last, nLoadFactor )
+        {}
+
+        /// Parallel bulk-load constructor
+        /**
+            The constructor is the same as \ref SplitListMap( ForwardIterator, ForwardIterator, size_t )
+            but the buckets are pre-split and the items are inserted by the tasks of \p ex executor in parallel.
+            See \ref cds_intrusive_SplitListSet_hp_bulk_ctor "intrusive::SplitListSet" for \p Executor requirements.
+        */
+        template <typename RandomAccessIterator, typename Executor
+            , typename = typename std::enable_if< std::is_class<Executor>::value >::type >
+        SplitListMap( RandomAccessIterator first, RandomAccessIterator last, Executor& ex, size_t nLoadFactor = 1 )
+            : base_class( first, last, ex, nLoadFactor )
+        {}
+
     public:
         /// Inserts new node with key and default value
         /**
@@ -573,6 +598,20 @@ namespace cds { namespace container {
             return base_class::get_with_( ptr.guard(), key, cds::details::predicate_wrapper<value_type, Less, key_accessor>() );
         }
 
+        /// Deletes the item pointed by \p ptr from the map
+        /**
+            \p ptr should be obtained by \ref cds_nonintrusive_SplitListMap_hp_get "get()".
+            Unlike \p erase(), the function deletes exactly the item pointed by \p ptr:
+            if the item has been erased from the map (and, possibly, a new item with the same key
+            has been inserted) since \p ptr was obtained, the function returns \p false and the map is not changed.
+
+            The item is freed by GC when \p ptr is released.
+        */
+        bool unlink( guarded_ptr& ptr )
+        {
+            return base_class::unlink_( ptr.guard() );
+        }
+
         /// Clears the map (non-atomic)
         /**
             The function unlink all items from the map.
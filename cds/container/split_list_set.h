@@ -320,6 +320,42 @@ namespace cds { namespace container {
             : base_class( nItemCount, nLoadFactor )
         {}
 
+        /// Bulk-load constructor
+        /** \anchor cds_nonintrusive_SplitListSet_hp_bulk_ctor
+            Builds the set from the sequence <tt>[first, last)</tt>, the \ref value_type should be constructible from \p *first.
+            The bucket table is sized for <tt>std::distance( first, last )</tt> items with \p nLoadFactor load factor
+            and all buckets are pre-split before inserting the items, so no bucket is split during the build.
+            The sequence may be unsorted. An item whose key is already in the set is not inserted.
+            See \ref cds_intrusive_SplitListSet_hp_bulk_ctor "intrusive::SplitListSet" for details.
+        */
+        template <typename ForwardIterator
+            , typename = typename std::enable_if< !std::is_integral<ForwardIterator>::value >::type >
+        SplitListSet( ForwardIterator first, ForwardIterator last, size_t nLoadFactor = 1 )
+            : base_class( static_cast<size_t>( std::distance( first, last )), nLoadFactor )
+        {
+            base_class::presplit( static_cast<size_t>( std::distance( first, last )));
+            for ( ; first != last; ++first )
+                insert_node( alloc_node( *first ));
+        }
+
+        /// Parallel bulk-load constructor
+        /**
+            The constructor is the same as \ref cds_nonintrusive_SplitListSet_hp_bulk_ctor "SplitListSet( first, last, nLoadFactor )"
+            but the buckets are pre-split and the items are inserted by the tasks of \p ex executor in parallel.
+            \p RandomAccessIterator should be a random access iterator.
+            See \ref cds_intrusive_SplitListSet_hp_bulk_ctor "intrusive::SplitListSet" for \p Executor requirements.
+        */
+        template <typename RandomAccessIterator, typename Executor
+            , typename = typename std::enable_if< std::is_class<Executor>::value >::type >
+        SplitListSet( RandomAccessIterator first, RandomAccessIterator last, Executor& ex, size_t nLoadFactor = 1 )
+            : base_class( static_cast<size_t>( last - first ), nLoadFactor )
+        {
+            base_class::presplit( static_cast<size_t>( last - first ), ex );
+            base_class::bulk_for( ex, 0, static_cast<size_t>( last - first ), [this, first]( size_t i ) {
+                insert_node( alloc_node( first[i] ));
+            });
+        }
+
     public:
         /// Forward iterator
         typedef iterator_type<false>  iterator;
@@ -741,6 +777,21 @@ namespace cds { namespace container {
             return get_with_( ptr.guard(), key, pred );
         }
 
+        /// Deletes the item pointed by \p ptr from the set
+        /**
+            \p ptr should be obtained by \ref cds_nonintrusive_SplitListSet_hp_get "get()".
+            Unlike \p erase(), the function deletes exactly the item pointed by \p ptr:
+            if the item has been erased from the set (and, possibly, a new item with the same key
+            has been inserted) since \p ptr was obtained, the function returns \p false and the set is not changed.
+            So the item may be examined via \p ptr and then deleted if it is still the same item.
+
+            The item is freed by GC when \p ptr is released.
+        */
+        bool unlink( guarded_ptr& ptr )
+        {
+            return unlink_( ptr.guard() );
+        }
+
         /// Clears the set (non-atomic)
         /**
             The function unlink all items from the set.
@@ -751,6 +802,36 @@ namespace cds { namespace container {
             base_class::clear();
         }
 
+        /// Clears the set by several threads (non-atomic)
+        /**
+            The function is an analog of \ref clear() for large sets,
+            see \ref cds::intrusive::SplitListSet::parallel_clear() "intrusive::SplitListSet::parallel_clear()".
+            If \p nThreads is 0, the processor count is used.
+            Each worker thread is attached to the GC for the time of clearing.
+        */
+        void parallel_clear( size_t nThreads = 0 )
+        {
+            base_class::parallel_clear( nThreads );
+        }
+
+        /// Calls \p f for each item of the set by several threads
+        /**
+            See \ref cds::intrusive::SplitListSet::parallel_for_each() "intrusive::SplitListSet::parallel_for_each()".
+            The functor \p Func interface is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            \p f is called concurrently from several threads, so it should be thread-safe.
+            The functor may change non-key fields of \p item only.
+        */
+        template <typename Func>
+        void parallel_for_each( Func f, size_t nThreads = 0 )
+        {
+            base_class::parallel_for_each( [&f]( node_type& node ) { f( node.m_Value ); }, nThreads );
+        }
+
         /// Checks if the set is empty
         /**
             Emptiness is checked by item counting: if item count is zero then assume that the set is empty.
@@ -784,6 +865,12 @@ namespace cds { namespace container {
             return base_class::get_with_( guard, key, typename maker::template predicate_wrapper<Less>::type() );
         }
 
+        bool unlink_( typename gc::Guard& guard )
+        {
+            node_type * pNode = guard.template get<node_type>();
+            return pNode && base_class::unlink( *pNode );
+        }
+
         //@endcond
 
     };
@@ -910,6 +910,39 @@ namespace cds { namespace container {
             return base_class::clear();
         }
 
+        /// Clears the set by several threads
+        /**
+            The calling thread locks the entire lock array, then the bucket table is split into \p nThreads
+            ranges of buckets that are cleaned up in parallel, see \p cds::algo::parallel_for_range().
+            If \p nThreads is 0, the processor count is used.
+        */
+        void parallel_clear( size_t nThreads = 0 )
+        {
+            base_class::parallel_clear( nThreads );
+        }
+
+        /// Calls \p f for each item of the set by several threads
+        /**
+            The calling thread locks the entire lock array, then the bucket table is split into \p nThreads
+            ranges of buckets that are traversed in parallel, see \p cds::algo::parallel_for_range().
+            If \p nThreads is 0, the processor count is used.
+
+            The functor \p Func interface is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            \p f is called concurrently from several threads, so it should be thread-safe.
+            The functor may change non-key fields of \p item only and must not call the member functions of the set
+            since the set is locked.
+        */
+        template <typename Func>
+        void parallel_for_each( Func f, size_t nThreads = 0 )
+        {
+            base_class::parallel_for_each( f, nThreads );
+        }
+
         /// Checks if the set is empty
         /**
             Emptiness is checked by item counting: if item count is zero then the set is empty.
@@ -0,0 +1,11 @@
+//$$CDS-header$$
+
+#ifndef __CDS_CONTAINER_SUNDELL_LIST_HP_H
+#define __CDS_CONTAINER_SUNDELL_LIST_HP_H
+
+#include <cds/container/details/sundell_list_base.h>
+#include <cds/intrusive/sundell_list_hp.h>
+#include <cds/container/details/make_sundell_list.h>
+#include <cds/container/impl/sundell_list.h>
+
+#endif  // #ifndef __CDS_CONTAINER_SUNDELL_LIST_HP_H
@@ -244,6 +244,12 @@ namespace cds {
                 return dec();
             }
 
+            /// Adds \p n to the counter. Returns new value of the counter
+            counter_type operator +=( counter_type n )
+            {
+                return m_Counter.fetch_add( n, atomics::memory_order_relaxed ) + n;
+            }
+
             /// Resets count to 0
             void reset(atomics::memory_order order = atomics::memory_order_relaxed)
             {
@@ -298,6 +304,12 @@ namespace cds {
                 return 0;
             }
 
+            /// Dummy addition. Always returns 0
+            size_t operator +=( size_t /*n*/ )
+            {
+                return 0;
+            }
+
             /// Dummy pre-decrement. Always returns 0
             size_t operator --()
             {
@@ -28,6 +28,9 @@ namespace cds { namespace gc {
         /// Native guarded pointer type
         typedef gc::hzp::hazard_pointer guarded_pointer;
 
+        /// Retired pointer type
+        typedef cds::gc::details::retired_ptr retired_ptr;
+
         /// Atomic reference
         /**
             @headerfile cds/gc/hp.h
@@ -287,6 +290,7 @@ namespace cds { namespace gc {
             T * assign( size_t nIndex, T * p )
             {
                 base_class::set(nIndex, p);
+                hzp::GarbageCollector::publication_fence();
                 return p;
             }
 
@@ -361,6 +365,9 @@ namespace cds { namespace gc {
             hzp::scan_type nScanType = hzp::inplace   ///< Scan type (see \ref hzp::scan_type enum)
         )
         {
+#       ifdef CDS_HP_ASYMMETRIC_FENCE
+            hzp::GarbageCollector::enableAsymmetricFence();
+#       endif
             hzp::GarbageCollector::Construct(
                 nHazardPtrCount,
                 nMaxThreadCount,
@@ -472,6 +479,19 @@ namespace cds { namespace gc {
         template <class Disposer, typename T>
         static void retire( T * p ) ;   // inline in hp_impl.h
 
+        /// Retires the pointer chain [\p itFirst, \p itLast)
+        /**
+            The value type of \p ForwardIterator is \ref retired_ptr.
+            The function is faster than \p retire() call for each pointer: the thread's retired array
+            is looked up once and it is scanned only when it becomes full. So, the batch that fits
+            into the free space of the retired array does not cause any scan, and the greater batch
+            causes one scan per \ref retired_array_capacity() pointers.
+
+            The function is useful when many nodes are removed at once, for example, by \p clear() of a container.
+        */
+        template <typename ForwardIterator>
+        static void batch_retire( ForwardIterator itFirst, ForwardIterator itLast ) ;   // inline in hp_impl.h
+
         /// Get current scan strategy
         /**@anchor hrc_gc_HP_getScanType
             See hzp::GarbageCollector::Scan for scan algo description
@@ -500,6 +520,29 @@ namespace cds { namespace gc {
             return hzp::GarbageCollector::isUsed();
         }
 
+        /// Starts background reclamation thread
+        /**
+            See \ref hzp_gc_startReclaimer "hzp::GarbageCollector::startReclaimer" for explanation.
+        */
+        static void start_reclaimer( size_t nMaxPendingBatches = 64 )
+        {
+            hzp::GarbageCollector::instance().startReclaimer( nMaxPendingBatches );
+        }
+
+        /// Stops background reclamation thread
+        static void stop_reclaimer()
+        {
+            hzp::GarbageCollector::instance().stopReclaimer();
+        }
+
+        /// Fills GC telemetry snapshot \p s
+        /**
+            See \ref cds_gc_telemetry "telemetry" for explanation.
+        */
+        static cds::gc::telemetry::snapshot& get_telemetry( cds::gc::telemetry::snapshot& s )
+        {
+            return hzp::GarbageCollector::instance().getTelemetry( s );
+        }
 
         /// Forced GC cycle call for current thread
         /**
@@ -45,6 +45,12 @@ namespace cds { namespace gc {
         cds::threading::getGC<HP>().retirePtr( p, cds::details::static_functor<Disposer, T>::call );
     }
 
+    template <typename ForwardIterator>
+    inline void HP::batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
+    {
+        cds::threading::getGC<HP>().batchRetirePtr( itFirst, itLast );
+    }
+
     inline void HP::scan()
     {
         cds::threading::getGC<HP>().scan();
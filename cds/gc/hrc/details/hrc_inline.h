@@ -13,6 +13,7 @@ namespace cds { namespace gc { namespace hrc {
     namespace details {
         inline retired_vector::retired_vector( const GarbageCollector& gc )
         : m_nFreeList(0)
+        , m_nSize(0)
         , m_arr( gc.getMaxRetiredPtrCount() )
         {
             for ( size_t i = 0; i < m_arr.capacity(); ++i )
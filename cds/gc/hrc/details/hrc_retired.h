@@ -90,6 +90,7 @@ namespace cds { namespace gc { namespace hrc {
             static const size_t m_nEndFreeList = size_t(0) -  1 ;    ///< End of free list
             //@endcond
             size_t          m_nFreeList ; ///< Index of first free item in m_arr
+            size_t          m_nSize     ; ///< Count of retired nodes in m_arr
             vector_type     m_arr       ; ///< Array of retired pointers (implicit \ref CDS_DEFAULT_ALLOCATOR dependence)
 
         public:
@@ -110,6 +111,18 @@ namespace cds { namespace gc { namespace hrc {
                 return m_arr.capacity();
             }
 
+            /// Returns count of retired nodes in array
+            size_t size() const
+            {
+                return m_nSize;
+            }
+
+            /// Checks if the array is empty
+            bool empty() const
+            {
+                return m_nSize == 0;
+            }
+
             /// Returns count of retired node in array. This function is intended for debug purposes only
             size_t retiredNodeCount() const
             {
@@ -132,6 +145,7 @@ namespace cds { namespace gc { namespace hrc {
                 m_nFreeList = m_arr[n].m_nNextFree;
                 CDS_DEBUG_ONLY( m_arr[n].m_nNextFree = m_nEndFreeList ; )
                 m_arr[n].set( p, pFunc );
+                ++m_nSize;
             }
 
             /// Pops the item by index \p n from the array
@@ -141,6 +155,8 @@ namespace cds { namespace gc { namespace hrc {
                 m_arr[n].m_pNode.store( nullptr, atomics::memory_order_release );
                 m_arr[n].m_nNextFree = m_nFreeList;
                 m_nFreeList = n;
+                assert( m_nSize > 0 );
+                --m_nSize;
             }
 
             /// Checks if array is full
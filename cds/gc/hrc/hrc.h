@@ -11,6 +11,7 @@
 #include <cds/refcounter.h>
 #include <cds/lock/spinlock.h>
 #include <cds/gc/exception.h>
+#include <cds/gc/telemetry.h>
 
 #include <cds/gc/hrc/details/hrc_fwd.h>
 #include <cds/gc/hrc/details/hrc_retired.h>
@@ -186,6 +187,115 @@ namespace cds { namespace gc {
             */
             template <size_t Count> using HPArray = gc::hzp::details::HPArrayT<ContainerNode *, Count >;
 
+            /// Buffer of deferred decrements of reference counters
+            /**
+                The buffer is used in deferred reference counting mode, see \ref hrc_gc_enableDeferredRC "enableDeferredRC".
+                The owner thread stores the node whose reference counter should be decremented to a free slot
+                instead of atomic decrement. An increment of the reference counter of the node that has
+                a pending decrement cancels the decrement, so no atomic operation is performed at all.
+
+                The buffer is single writer - multiple reader: only the owner thread fills the slots,
+                any thread may apply pending decrements (\p flush) by exchanging the slot with \p nullptr,
+                so the decrement is applied exactly once. Thus, a pending decrement
+                overestimates the reference counter, that is, it may only delay the reclamation of the node
+                and never lets the node be reclaimed too early.
+            */
+            class deferred_rc_buffer
+            {
+            public:
+                static const size_t c_nCapacity = 32    ;   ///< Max count of pending decrements
+
+            private:
+                atomics::atomic<ContainerNode *>    m_arr[c_nCapacity]  ;   ///< pending decrements
+                size_t                              m_nHint     ;   ///< owner only: index of the slot to start the search of free slot
+                size_t                              m_nPushed   ;   ///< owner only: count of pushes since last flush by the owner
+
+                atomics::atomic<size_t>             m_nDeferred ;   ///< statistics: count of deferred decrements
+                atomics::atomic<size_t>             m_nCanceled ;   ///< statistics: count of decrements canceled by increments
+
+            public:
+                //@cond
+                deferred_rc_buffer()
+                    : m_nHint( 0 )
+                    , m_nPushed( 0 )
+                    , m_nDeferred( 0 )
+                    , m_nCanceled( 0 )
+                {
+                    for ( size_t i = 0; i < c_nCapacity; ++i )
+                        m_arr[i].store( nullptr, atomics::memory_order_relaxed );
+                }
+                //@endcond
+
+                /// Defers the decrement of reference counter of \p p (owner only). Returns \p false if the buffer is full
+                bool push( ContainerNode * p )
+                {
+                    assert( p != nullptr );
+                    for ( size_t i = 0; i < c_nCapacity; ++i ) {
+                        size_t n = ( m_nHint + i ) % c_nCapacity;
+                        if ( m_arr[n].load( atomics::memory_order_relaxed ) == nullptr ) {
+                            m_arr[n].store( p, atomics::memory_order_release );
+                            m_nHint = n + 1;
+                            ++m_nPushed;
+                            m_nDeferred.store( m_nDeferred.load( atomics::memory_order_relaxed ) + 1, atomics::memory_order_relaxed );
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                /// Cancels a pending decrement of reference counter of \p p (owner only)
+                /**
+                    Returns \p true if the decrement is canceled. Returns \p false if there is no pending decrement
+                    for \p p or it has been just applied by other thread; in this case the caller should increment the counter.
+                */
+                bool cancel( ContainerNode * p )
+                {
+                    if ( m_nPushed == 0 )
+                        return false;
+                    for ( size_t i = 0; i < c_nCapacity; ++i ) {
+                        if ( m_arr[i].load( atomics::memory_order_relaxed ) == p ) {
+                            if ( m_arr[i].exchange( nullptr, atomics::memory_order_acquire ) == p ) {
+                                m_nCanceled.store( m_nCanceled.load( atomics::memory_order_relaxed ) + 1, atomics::memory_order_relaxed );
+                                return true;
+                            }
+                            return false;
+                        }
+                    }
+                    return false;
+                }
+
+                /// Applies all pending decrements (any thread)
+                void flush()
+                {
+                    for ( size_t i = 0; i < c_nCapacity; ++i ) {
+                        if ( m_arr[i].load( atomics::memory_order_relaxed ) != nullptr ) {
+                            ContainerNode * p = m_arr[i].exchange( nullptr, atomics::memory_order_acquire );
+                            if ( p )
+                                p->decRefCount();
+                        }
+                    }
+                }
+
+                /// Applies all pending decrements (owner only)
+                void flush_local()
+                {
+                    flush();
+                    m_nPushed = 0;
+                }
+
+                /// Returns count of deferred decrements
+                size_t deferred_count() const
+                {
+                    return m_nDeferred.load( atomics::memory_order_relaxed );
+                }
+
+                /// Returns count of decrements canceled by increments
+                size_t canceled_count() const
+                {
+                    return m_nCanceled.load( atomics::memory_order_relaxed );
+                }
+            };
+
             /// HP record of the thread
             /**
                 This structure is single writer - multiple reader type. The writer is the thread owned the record
@@ -195,6 +305,8 @@ namespace cds { namespace gc {
 
                 hzp::details::HPAllocator<hazard_ptr>   m_hzp           ;   ///< array of hazard pointers. Implicit \ref CDS_DEFAULT_ALLOCATOR dependence
                 details::retired_vector                 m_arrRetired    ;   ///< array of retired pointers
+                details::deferred_rc_buffer             m_DeferredRC    ;   ///< deferred decrements of reference counters
+                cds::gc::telemetry::thread_counters     m_Telemetry     ;   ///< telemetry counters of the owner thread
 
                 //@cond
                 thread_descriptor( const GarbageCollector& HzpMgr ) ;    // inline
@@ -249,6 +361,8 @@ namespace cds { namespace gc {
                 event_counter::value_type   evcDeletedNode        ; ///< Node deletion event counter
                 event_counter::value_type   evcScanGuarded      ; ///< Count of retired nodes that could not be deleted on Scan phase
                 event_counter::value_type   evcScanClaimGuarded ; ///< Count of retired node that could not be deleted on Scan phase because of m_nClaim != 0
+                size_t                      nDeferredRCDec      ; ///< Count of deferred decrements of reference counters (deferred reference counting mode)
+                size_t                      nDeferredRCCanceled ; ///< Count of deferred decrements canceled by increments (deferred reference counting mode)
 
 #ifdef CDS_DEBUG
                 event_counter::value_type   evcNodeConstruct    ; ///< Count of constructed ContainerNode
@@ -312,6 +426,7 @@ namespace cds { namespace gc {
             atomics::atomic<thread_list_node *> m_pListHead  ;  ///< Head of thread list
 
             static GarbageCollector *    m_pGC    ;    ///< HRC garbage collector instance
+            static atomics::atomic<bool> m_bDeferredRC ;   ///< \p true - deferred reference counting mode
 
             statistics              m_Stat                  ;    ///< Internal statistics
             bool                    m_bStatEnabled          ;    ///< @a true - accumulate internal statistics
@@ -389,6 +504,9 @@ namespace cds { namespace gc {
             /// Get internal statistics
             internal_state& getInternalState( internal_state& stat) const;
 
+            /// Fills GC telemetry snapshot \p s, see \ref cds_gc_telemetry "telemetry"
+            cds::gc::telemetry::snapshot& getTelemetry( cds::gc::telemetry::snapshot& s ) const;
+
             /// Check if statistics enabled
             bool              isStatisticsEnabled() const
             {
@@ -403,6 +521,41 @@ namespace cds { namespace gc {
                 return bCurEnabled;
             }
 
+            /// Enables or disables deferred reference counting mode
+            /** @anchor hrc_gc_enableDeferredRC
+                In usual mode each update of a reference-counted link (\p cds::gc::HRC::atomic_ref,
+                \p cds::gc::HRC::atomic_marked_ptr) increments the reference counter of new node
+                and decrements the counter of old node by atomic operations. The reference counter of
+                a hot node (for example, the head of a list) is a point of contention.
+
+                In deferred mode the decrements are buffered in the thread's \ref details::deferred_rc_buffer "buffer"
+                and an increment cancels the pending decrement of the same node; for example, a failed CAS
+                retried in a loop does not touch the reference counter of the new node at all.
+                The pending decrements are applied in batches when the buffer is full, at the beginning of \ref Scan,
+                by \ref CleanUpAll for all threads (so an idle thread cannot hold a node forever),
+                and when the thread is detached.
+
+                Since a pending decrement can only overestimate the reference counter, the reclamation remains safe.
+                Only decrements are deferred: a deferred increment would underestimate the counter,
+                so the node could be reclaimed while a link still refers to it.
+                The size of retired array of each thread is increased by the buffer capacity per thread
+                to keep the bound of the count of not reclaimed nodes.
+
+                The mode may be switched at any time: the decrements pending when the mode is switched off
+                are applied as usual, and an increment in usual mode never touches the buffer.
+                The function returns previous mode.
+            */
+            static bool enableDeferredRC( bool bEnable )
+            {
+                return m_bDeferredRC.exchange( bEnable, atomics::memory_order_acq_rel );
+            }
+
+            /// Checks if deferred reference counting mode is enabled
+            static bool isDeferredRC()
+            {
+                return m_bDeferredRC.load( atomics::memory_order_acquire );
+            }
+
             /// Checks that required hazard pointer count \p nRequiredCount is less or equal then max hazard pointer count
             /**
                 If \p nRequiredCount > getHazardPointerCount() then the exception HZPTooMany is thrown
@@ -496,8 +649,13 @@ namespace cds { namespace gc {
             void fini()
             {
                 if ( m_pDesc ) {
-                    cleanUpLocal();
-                    m_gc.Scan( this );
+                    // cleanUpLocal and Scan pass whole retired array; they are useless if nothing is retired
+                    if ( !m_pDesc->m_arrRetired.empty() ) {
+                        cleanUpLocal();
+                        m_gc.Scan( this );
+                    }
+                    // Scan may defer the decrements of terminated nodes' links
+                    m_pDesc->m_DeferredRC.flush_local();
                     details::thread_descriptor * pRec = m_pDesc;
                     m_pDesc = nullptr;
                     if  ( pRec )
@@ -555,6 +713,7 @@ namespace cds { namespace gc {
                 pNode->m_bTrace.store( false, atomics::memory_order_release );
 
                 m_pDesc->m_arrRetired.push( pNode, pFunc );
+                m_pDesc->m_Telemetry.onRetire();
 
                 if ( m_pDesc->m_arrRetired.isFull() )
                     m_gc.try_retire( this );
@@ -567,6 +726,25 @@ namespace cds { namespace gc {
             }
             //@endcond
 
+            /// Increments reference counter of \p pNode or cancels its pending decrement (deferred reference counting mode)
+            void incRef( ContainerNode * pNode )
+            {
+                if ( !m_pDesc || !m_pDesc->m_DeferredRC.cancel( pNode ))
+                    pNode->incRefCount();
+            }
+
+            /// Defers the decrement of reference counter of \p pNode (deferred reference counting mode)
+            void decRef( ContainerNode * pNode )
+            {
+                if ( !m_pDesc )
+                    pNode->decRefCount();
+                else if ( !m_pDesc->m_DeferredRC.push( pNode )) {
+                    // The buffer is full - apply all pending decrements in batch
+                    m_pDesc->m_DeferredRC.flush_local();
+                    m_pDesc->m_DeferredRC.push( pNode );
+                }
+            }
+
         protected:
             /// The procedure will try to remove redundant claimed references from link in deleted nodes that has been deleted by this thread
             void cleanUpLocal()
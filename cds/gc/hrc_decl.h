@@ -133,6 +133,17 @@ namespace cds { namespace gc {
         /// Native hazard pointer type
         typedef container_node * guarded_pointer;
 
+    private:
+        //@cond
+        // Reference counter updates of atomic_ref and atomic_marked_ptr.
+        // In deferred reference counting mode the decrements are buffered by the current thread,
+        // see hrc::GarbageCollector::enableDeferredRC
+        static void inc_ref( container_node * p )    ;   // inline in hrc_impl.h
+        static void dec_ref( container_node * p )    ;   // inline in hrc_impl.h
+        //@endcond
+
+    public:
+
         /// Atomic reference
         /**
             @headerfile cds/gc/hrc.h
@@ -246,19 +257,19 @@ namespace cds { namespace gc {
             static void before_store( T * pNew ) CDS_NOEXCEPT
             {
                 if ( pNew )
-                    ++pNew->m_RC;
+                    inc_ref( pNew );
             }
             static void after_store( T * pOld, T * pNew ) CDS_NOEXCEPT
             {
                 if ( pNew )
                     pNew->m_bTrace.store( false, atomics::memory_order_release );
                 if ( pOld )
-                    --pOld->m_RC;
+                    dec_ref( pOld );
             }
             static void before_cas( T * p ) CDS_NOEXCEPT
             {
                 if ( p ) {
-                    ++p->m_RC;
+                    inc_ref( p );
                     p->m_bTrace.store( false, atomics::memory_order_release );
                 }
             }
@@ -266,11 +277,11 @@ namespace cds { namespace gc {
             {
                 if ( bSuccess ) {
                     if ( pOld )
-                        --pOld->m_RC;
+                        dec_ref( pOld );
                 }
                 else {
                     if ( pNew )
-                        --pNew->m_RC;
+                        dec_ref( pNew );
                 }
             }
             //@endcond
@@ -383,19 +394,19 @@ namespace cds { namespace gc {
             static void before_store( typename marked_ptr::pointer_type p ) CDS_NOEXCEPT
             {
                 if ( p )
-                    ++p->m_RC;
+                    inc_ref( p );
             }
             static void after_store( typename marked_ptr::pointer_type pOld, typename marked_ptr::pointer_type pNew ) CDS_NOEXCEPT
             {
                 if ( pNew )
                     pNew->m_bTrace.store( false, atomics::memory_order_release );
                 if ( pOld )
-                    --pOld->m_RC;
+                    dec_ref( pOld );
             }
             static void before_cas( typename marked_ptr::pointer_type p ) CDS_NOEXCEPT
             {
                 if ( p ) {
-                    ++p->m_RC;
+                    inc_ref( p );
                     p->m_bTrace.store( false, atomics::memory_order_release );
                 }
             }
@@ -403,11 +414,11 @@ namespace cds { namespace gc {
             {
                 if ( bSuccess ) {
                     if ( pOld )
-                        --pOld->m_RC;
+                        dec_ref( pOld );
                 }
                 else {
                     if ( pNew )
-                        --pNew->m_RC;
+                        dec_ref( pNew );
                 }
             }
             //@endcond
@@ -792,6 +803,25 @@ namespace cds { namespace gc {
             return true;
         }
 
+        /// Enables or disables deferred reference counting mode
+        /**
+            See \ref hrc_gc_enableDeferredRC "hrc::GarbageCollector::enableDeferredRC" for explanation.
+            Returns previous mode.
+        */
+        static bool enable_deferred_rc( bool bEnable = true )
+        {
+            return hrc::GarbageCollector::enableDeferredRC( bEnable );
+        }
+
+        /// Fills GC telemetry snapshot \p s
+        /**
+            See \ref cds_gc_telemetry "telemetry" for explanation.
+        */
+        static cds::gc::telemetry::snapshot& get_telemetry( cds::gc::telemetry::snapshot& s )
+        {
+            return hrc::GarbageCollector::instance().getTelemetry( s );
+        }
+
         /// Retire pointer \p p with function \p pFunc
         /**
             The function places pointer \p p to array of pointers ready for removing.
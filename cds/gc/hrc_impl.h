@@ -50,6 +50,22 @@ namespace cds { namespace gc {
         cds::threading::getGC<HRC>().scan();
     }
 
+    inline void HRC::inc_ref( container_node * p )
+    {
+        if ( hrc::GarbageCollector::isDeferredRC() && cds::threading::Manager::isThreadAttached() )
+            cds::threading::getGC<HRC>().incRef( p );
+        else
+            p->incRefCount();
+    }
+
+    inline void HRC::dec_ref( container_node * p )
+    {
+        if ( hrc::GarbageCollector::isDeferredRC() && cds::threading::Manager::isThreadAttached() )
+            cds::threading::getGC<HRC>().decRef( p );
+        else
+            p->decRefCount();
+    }
+
 
 }} // namespace cds::gc
 //@endcond
@@ -6,6 +6,7 @@
 #include <cds/cxx11_atomic.h>
 #include <cds/os/thread.h>
 #include <cds/gc/exception.h>
+#include <cds/gc/telemetry.h>
 
 #include <cds/gc/hzp/details/hp_fwd.h>
 #include <cds/gc/hzp/details/hp_alloc.h>
@@ -119,6 +120,7 @@ namespace cds {
             struct HPRec {
                 HPAllocator<hazard_pointer>    m_hzp        ; ///< array of hazard pointers. Implicit \ref CDS_DEFAULT_ALLOCATOR dependency
                 retired_vector            m_arrRetired ; ///< Retired pointer array
+                cds::gc::telemetry::thread_counters m_Telemetry ; ///< Telemetry counters of the owner thread
 
                 /// Ctor
                 HPRec( const cds::gc::hzp::GarbageCollector& HzpMgr ) ;    // inline
@@ -151,6 +153,16 @@ namespace cds {
             \li [2003] Maged M.Michael "Hazard Pointers: Safe memory reclamation for lock-free objects"
             \li [2004] Andrei Alexandrescy, Maged Michael "Lock-free Data Structures with Hazard Pointers"
 
+        \par Asymmetric fences
+            A hazard pointer must be visible to the scanning thread before the protecting thread
+            re-reads the guarded pointer, that requires a store-load fence after each hazard pointer publication.
+            If the macro \p CDS_HP_ASYMMETRIC_FENCE is defined (both for the library and for your code),
+            the fence is moved from the readers to the reclaimer: the publication is followed by compiler barrier only,
+            and \ref Scan issues Linux <tt>membarrier(MEMBARRIER_CMD_PRIVATE_EXPEDITED)</tt> system call
+            that serializes all threads of the process. \p cds::gc::HP constructor registers the process
+            for expedited membarrier. If the system call is unavailable (Linux kernel before 4.14, other OSes),
+            the readers do not pay for the mode: the hazard pointer is published by release store as without the macro,
+            and only \ref Scan issues a full memory fence before reading the hazard pointers.
         */
         class CDS_EXPORT_API GarbageCollector
         {
@@ -180,6 +192,11 @@ namespace cds {
 
                 event_counter::value_type   evcDeletedNode  ;   ///< Count of deleting of retired objects
                 event_counter::value_type   evcDeferredNode ;   ///< Count of objects that cannot be deleted in Scan phase because of a hazard_pointer guards it
+
+                event_counter::value_type   evcReclaimerBatch   ;   ///< Count of retired arrays handed off to the reclamation thread
+                event_counter::value_type   evcReclaimerBackpressure;   ///< Count of inline scans because the reclamation thread lags
+                size_t                      nReclaimerPassCount ;   ///< Count of reclamation passes of the reclamation thread
+                size_t                      nReclaimerScanTime  ;   ///< Total duration of reclamation passes, microseconds
             };
 
             /// No GarbageCollector object is created
@@ -202,8 +219,13 @@ namespace cds {
 
                 event_counter  m_DeletedNode            ;    ///< Count of retired objects deleting
                 event_counter  m_DeferredNode            ;    ///< Count of objects that cannot be deleted in Scan phase because of a hazard_pointer guards it
+
+                event_counter  m_ReclaimerBatch         ;    ///< Count of retired arrays handed off to the reclamation thread
+                event_counter  m_ReclaimerBackpressure  ;    ///< Count of inline scans because the reclamation thread lags
             };
 
+            class reclaimer;
+
             /// Internal list of cds::gc::hzp::details::HPRec
             struct hplist_node: public details::HPRec
             {
@@ -230,6 +252,7 @@ namespace cds {
             atomics::atomic<hplist_node *>   m_pListHead  ;  ///< Head of GC list
 
             static GarbageCollector *    m_pHZPManager  ;   ///< GC instance pointer
+            static atomics::atomic<bool> m_bAsymmetricFence ;   ///< \p true if membarrier is used for hazard pointer publication
 
             Statistics              m_Stat              ;   ///< Internal statistics
             bool                    m_bStatEnabled      ;   ///< true - statistics enabled
@@ -238,6 +261,9 @@ namespace cds {
             const size_t            m_nMaxThreadCount       ;   ///< max count of thread
             const size_t            m_nMaxRetiredPtrCount   ;   ///< max count of retired ptr per thread
             scan_type               m_nScanType             ;   ///< scan type (see \ref scan_type enum)
+            reclaimer *             m_pReclaimer            ;   ///< background reclamation thread
+            size_t                  m_nReclaimerPassCount   ;   ///< reclamation passes of stopped reclamation threads
+            size_t                  m_nReclaimerScanTime    ;   ///< scan time of stopped reclamation threads, microseconds
 
 
         private:
@@ -269,6 +295,9 @@ namespace cds {
 
             //@cond
             void detachAllThread();
+
+            // Makes the hazard pointers published by other threads visible for scanning
+            static void scan_fence();
             //@endcond
 
         public:
@@ -321,6 +350,37 @@ namespace cds {
                 return m_pHZPManager != nullptr;
             }
 
+            /// Tries to enable asymmetric fences for hazard pointer publication
+            /**
+                The function registers the process for Linux expedited \p membarrier.
+                Returns \p true if the registration is succeeded.
+                The function should be called before any hazard pointer is used,
+                \p cds::gc::HP constructor calls it if \p CDS_HP_ASYMMETRIC_FENCE macro is defined.
+                Once enabled, the mode cannot be switched off: the readers rely on the system-wide barrier of the scan,
+                so if \p membarrier fails after the registration the scan aborts the process.
+            */
+            static bool CDS_STDCALL enableAsymmetricFence();
+
+            /// Checks if asymmetric fences are used for hazard pointer publication
+            static bool isAsymmetricFenceEnabled()
+            {
+                return m_bAsymmetricFence.load( atomics::memory_order_acquire );
+            }
+
+            /// Orders hazard pointer publication before subsequent loads of the current thread
+            /**
+                If \p CDS_HP_ASYMMETRIC_FENCE macro is not defined, the function does nothing.
+                Otherwise, it is compiler barrier: the store-load ordering is provided by \p membarrier of the scan.
+                If \p membarrier is unavailable, the reader side stays the same as without the macro
+                and the scan issues a full fence instead.
+            */
+            static void publication_fence()
+            {
+#           ifdef CDS_HP_ASYMMETRIC_FENCE
+                CDS_COMPILER_RW_BARRIER;
+#           endif
+            }
+
             /// Returns max Hazard Pointer count defined in construction time
             size_t            getHazardPointerCount() const        { return m_nHazardPointerCount; }
 
@@ -335,6 +395,9 @@ namespace cds {
             /// Get internal statistics
             InternalState& getInternalState(InternalState& stat) const;
 
+            /// Fills GC telemetry snapshot \p s, see \ref cds_gc_telemetry "telemetry"
+            cds::gc::telemetry::snapshot& getTelemetry( cds::gc::telemetry::snapshot& s ) const;
+
             /// Checks if internal statistics enabled
             bool              isStatisticsEnabled() const { return m_bStatEnabled; }
 
@@ -373,6 +436,37 @@ namespace cds {
                 m_nScanType = nScanType;
             }
 
+            /// Starts background reclamation thread
+            /** @anchor hzp_gc_startReclaimer
+                By default, the thread that overflows its array of retired pointers performs \ref Scan and \ref HelpScan itself,
+                so a random unlucky operation pays for the whole scan. When the reclamation thread is started,
+                the thread hands off its full array of retired pointers (a batch) to the reclamation thread
+                and continues immediately. The reclamation thread has its own hazard pointer record,
+                it scans the batches handed off and then calls \ref HelpScan.
+
+                Backpressure: if the reclamation thread lags and \p nMaxPendingBatches batches are waiting for it,
+                the thread that overflows its retired array scans it inline.
+
+                The reclamation thread is stopped by \ref stopReclaimer or by \ref Destruct.
+                The functions \p startReclaimer and \p stopReclaimer must not be called concurrently with
+                the threads that use Hazard Pointer GC.
+            */
+            void startReclaimer(
+                size_t nMaxPendingBatches = 64  ///< max count of batches waiting for reclamation
+            );
+
+            /// Stops background reclamation thread
+            /**
+                The batches pending are reclaimed before the thread is terminated.
+            */
+            void stopReclaimer();
+
+            /// Checks if background reclamation thread is running
+            bool isReclaimerRunning() const
+            {
+                return m_pReclaimer != nullptr;
+            }
+
         public:    // Internals for threads
 
             /// Allocates Hazard Pointer GC record. For internal use only
@@ -394,6 +488,9 @@ namespace cds {
             */
             void Scan( details::HPRec * pRec )
             {
+                cds::gc::telemetry::stopwatch sw;
+                size_t const nRetired = pRec->m_arrRetired.size();
+
                 switch ( m_nScanType ) {
                     case inplace:
                         inplace_scan( pRec );
@@ -404,6 +501,27 @@ namespace cds {
                         classic_scan( pRec );
                         break;
                 }
+
+                pRec->m_Telemetry.onScan( sw.elapsed(), nRetired - pRec->m_arrRetired.size() );
+            }
+
+            /// Scans the retired array of \p pRec together with the batch [\p pBatch, \p pBatch + \p nBatchSize)
+            /**
+                The batch is checked against the same sorted snapshot of hazard pointers
+                as the retired array, so the whole batch costs one pass over the HP list.
+                The pointers of the batch that are still guarded are moved into the retired array of \p pRec.
+
+                The function is called internally by ThreadGC::batchRetirePtr when the batch does not fit
+                into the free space of the retired array.
+            */
+            void BatchScan( details::HPRec * pRec, details::retired_ptr * pBatch, size_t nBatchSize )
+            {
+                cds::gc::telemetry::stopwatch sw;
+                size_t const nRetired = pRec->m_arrRetired.size() + nBatchSize;
+
+                classic_scan( pRec, pBatch, nBatchSize );
+
+                pRec->m_Telemetry.onScan( sw.elapsed(), nRetired - pRec->m_arrRetired.size() );
             }
 
             /// Helper scan routine
@@ -417,7 +535,21 @@ namespace cds {
             */
             void HelpScan( details::HPRec * pThis );
 
+            /// Hands off full retired array of \p pRec to the reclamation thread. For internal use only
+            /**
+                Returns \p false if the reclamation thread is not running or it lags;
+                in that case the caller should scan \p pRec itself.
+            */
+            bool handOff( details::HPRec * pRec )
+            {
+                return m_pReclaimer && handOffBatch( pRec );
+            }
+
         protected:
+            //@cond
+            bool handOffBatch( details::HPRec * pRec );
+            //@endcond
+
             /// Classic scan algorithm
             /** @anchor hzp_gc_classic_scan
                 Classical scan algorithm as described in Michael's paper.
@@ -441,8 +573,11 @@ namespace cds {
 
                 This function is called internally by ThreadGC object when upper bound of thread's list of reclaimed pointers
                 is reached.
+
+                If \p pBatch is not \p nullptr, the \p nBatchSize pointers of \p pBatch are checked in the third stage
+                after the retired array of \p pRec (see \ref BatchScan).
             */
-            void classic_scan( details::HPRec * pRec );
+            void classic_scan( details::HPRec * pRec, details::retired_ptr * pBatch = nullptr, size_t nBatchSize = 0 );
 
             /// In-place scan algorithm
             /** @anchor hzp_gc_inplace_scan
@@ -535,10 +670,44 @@ namespace cds {
             void retirePtr( const details::retired_ptr& p )
             {
                 m_pHzpRec->m_arrRetired.push( p );
+                m_pHzpRec->m_Telemetry.onRetire();
 
                 if ( m_pHzpRec->m_arrRetired.isFull() ) {
-                    // Max of retired pointer count is reached. Do scan
-                    scan();
+                    // Max of retired pointer count is reached. Do scan or hand off the retired array to the reclamation thread
+                    if ( !m_HzpManager.handOff( m_pHzpRec ))
+                        scan();
+                }
+            }
+
+            /// Places retired pointers [\p itFirst, \p itLast) into thread's array of retired pointer for deferred reclamation
+            /**
+                The value type of \p ForwardIterator is \p details::retired_ptr.
+                The batch that fits into the free space of the array does not trigger \p Scan at all.
+                Otherwise the rest of the batch is checked together with the full array
+                against one sorted snapshot of hazard pointers (see GarbageCollector::BatchScan).
+            */
+            template <typename ForwardIterator>
+            void batchRetirePtr( ForwardIterator itFirst, ForwardIterator itLast )
+            {
+                details::retired_vector& arrRetired = m_pHzpRec->m_arrRetired;
+
+                size_t nCount = 0;
+                for ( ; itFirst != itLast && !arrRetired.isFull(); ++itFirst, ++nCount )
+                    arrRetired.push( *itFirst );
+
+                if ( itFirst != itLast ) {
+                    std::vector< details::retired_ptr > arrBatch( itFirst, itLast );
+                    m_pHzpRec->m_Telemetry.onRetire( nCount + arrBatch.size() );
+
+                    m_HzpManager.BatchScan( m_pHzpRec, &arrBatch[0], arrBatch.size() );
+                    m_HzpManager.HelpScan( m_pHzpRec );
+                }
+                else {
+                    m_pHzpRec->m_Telemetry.onRetire( nCount );
+                    if ( arrRetired.isFull() ) {
+                        if ( !m_HzpManager.handOff( m_pHzpRec ))
+                            scan();
+                    }
                 }
             }
 
@@ -579,6 +748,7 @@ namespace cds {
                 , m_gc( gc )
             {
                 m_hp = p;
+                GarbageCollector::publication_fence();
             }
 
             /// Frees HP guard. The pointer guarded may be deleted after this.
@@ -597,7 +767,9 @@ namespace cds {
             template <typename T>
             T * operator =( T * p )
             {
-                return m_hp = p;
+                m_hp = p;
+                GarbageCollector::publication_fence();
+                return p;
             }
 
             //@cond
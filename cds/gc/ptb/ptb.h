@@ -5,11 +5,13 @@
 
 #include <cds/cxx11_atomic.h>
 #include <cds/gc/details/retired_ptr.h>
+#include <cds/gc/telemetry.h>
 #include <cds/details/aligned_allocator.h>
 #include <cds/details/allocator.h>
 #include <cds/details/noncopyable.h>
 
 #include <cds/lock/spinlock.h>
+#include <cds/lock/scoped_lock.h>
 
 #if CDS_COMPILER == CDS_COMPILER_MSVC
 #   pragma warning(push)
@@ -38,11 +40,14 @@ namespace cds { namespace gc {
         See cds::gc::PTB class for explanation.
 
         \par Implementation issues
-            The global list of free guards (cds::gc::ptb::details::guard_allocator) is protected by spin-lock (i.e. serialized).
-            It seems that solution should not introduce significant performance bottleneck, because each thread has own set
-            of guards allocated from global list of free guards and access to global list is occurred only when
-            all thread's guard is busy. In this case the thread allocates next block of guards from global list.
-            Guards allocated for the thread is push back to the global list only when the thread terminates.
+            The global list of free guards (cds::gc::ptb::details::guard_allocator) is lock-free.
+            Each thread has own cache of guards allocated from global list of free guards and access to global list
+            is occurred only when all thread's guards are busy. In this case the thread allocates next block
+            of guards from global list. Guards allocated for the thread is push back to the global list only when the thread terminates.
+
+            The retired pointers that \ref ptb_gc_liberate "liberate" found free are split into chunks.
+            The thread that performs \p liberate frees the first chunk and publishes the others,
+            so the threads that call \p liberate or \ref ptb_gc_retirePtr "retirePtr" concurrently help to free them.
     */
     namespace ptb {
 
@@ -113,6 +118,13 @@ namespace cds { namespace gc {
             };
 
             /// Guard allocator
+            /**
+                The list of free guards is lock-free. Pushing to the free-list is usual CAS loop.
+                Popping an item by CAS is ABA-prone, so the guards are popped by grabbing whole free-list
+                by atomic \p exchange: the thread takes the guards it needs and pushes the rest back.
+                A thread that finds the free-list empty meanwhile allocates new guard from the heap;
+                that is harmless since the guards are reused later.
+            */
             template <class Alloc = CDS_DEFAULT_ALLOCATOR>
             class guard_allocator
             {
@@ -120,13 +132,6 @@ namespace cds { namespace gc {
 
                 atomics::atomic<guard_data *>    m_GuardList ;       ///< Head of allocated guard list (linked by guard_data::pGlobalNext field)
                 atomics::atomic<guard_data *>    m_FreeGuardList ;   ///< Head of free guard list (linked by guard_data::pNextFree field)
-                SpinLock                m_freeListLock  ;   ///< Access to m_FreeGuardList
-
-                /*
-                    Unfortunately, access to the list of free guard is lock-based.
-                    Lock-free manipulations with guard free-list are ABA-prone.
-                    TODO: working with m_FreeGuardList in lock-free manner.
-                */
 
             private:
                 /// Allocates new guard from the heap. The function uses aligned allocator
@@ -149,6 +154,50 @@ namespace cds { namespace gc {
                     return pGuard;
                 }
 
+                /// Pushes the list [pHead, pTail] linked by \p pNextFree field to the free-list
+                void pushFree( guard_data * pHead, guard_data * pTail )
+                {
+                    guard_data * pFree = m_FreeGuardList.load( atomics::memory_order_relaxed );
+                    do {
+                        pTail->pNextFree.store( pFree, atomics::memory_order_relaxed );
+                        // pFree is changed by compare_exchange_weak
+                    } while ( !m_FreeGuardList.compare_exchange_weak( pFree, pHead, atomics::memory_order_release, atomics::memory_order_relaxed ));
+                }
+
+                /// Pops up to \p nCount guards from the free-list
+                /**
+                    Returns the list linked by \p pNextFree field or \p nullptr if the free-list is empty
+                */
+                guard_data * popFree( size_t nCount )
+                {
+                    if ( m_FreeGuardList.load( atomics::memory_order_relaxed ) == nullptr )
+                        return nullptr;
+
+                    guard_data * pHead = m_FreeGuardList.exchange( nullptr, atomics::memory_order_acquire );
+                    if ( !pHead )
+                        return nullptr;
+
+                    guard_data * pLast = pHead;
+                    guard_data * pNext;
+                    while ( --nCount && (pNext = pLast->pNextFree.load( atomics::memory_order_relaxed )) != nullptr )
+                        pLast = pNext;
+
+                    guard_data * pRest = pLast->pNextFree.load( atomics::memory_order_relaxed );
+                    pLast->pNextFree.store( nullptr, atomics::memory_order_relaxed );
+
+                    if ( pRest ) {
+                        // Push the rest back. Usually, the free-list is still empty
+                        guard_data * pExpected = nullptr;
+                        if ( !m_FreeGuardList.compare_exchange_strong( pExpected, pRest, atomics::memory_order_release, atomics::memory_order_relaxed )) {
+                            guard_data * pTail = pRest;
+                            while ( (pNext = pTail->pNextFree.load( atomics::memory_order_relaxed )) != nullptr )
+                                pTail = pNext;
+                            pushFree( pRest, pTail );
+                        }
+                    }
+                    return pHead;
+                }
+
             public:
                 // Default ctor
                 guard_allocator()
@@ -170,14 +219,7 @@ namespace cds { namespace gc {
                 guard_data * alloc()
                 {
                     // Try to pop a guard from free-list
-                    details::guard_data * pGuard;
-
-                    {
-                        cds::lock::scoped_lock<SpinLock> al( m_freeListLock );
-                        pGuard = m_FreeGuardList.load(atomics::memory_order_relaxed);
-                        if ( pGuard )
-                            m_FreeGuardList.store( pGuard->pNextFree.load(atomics::memory_order_relaxed), atomics::memory_order_relaxed );
-                    }
+                    details::guard_data * pGuard = popFree( 1 );
                     if ( !pGuard )
                         return allocNew();
 
@@ -192,10 +234,7 @@ namespace cds { namespace gc {
                 void free( guard_data * pGuard )
                 {
                     pGuard->pPost.store( nullptr, atomics::memory_order_relaxed );
-
-                    cds::lock::scoped_lock<SpinLock> al( m_freeListLock );
-                    pGuard->pNextFree.store( m_FreeGuardList.load(atomics::memory_order_relaxed), atomics::memory_order_relaxed );
-                    m_FreeGuardList.store( pGuard, atomics::memory_order_relaxed );
+                    pushFree( pGuard, pGuard );
                 }
 
                 /// Allocates list of guard
@@ -208,16 +247,31 @@ namespace cds { namespace gc {
                 {
                     assert( nCount != 0 );
 
-                    guard_data * pHead;
+                    // Take as many free guards as possible by one pop
+                    guard_data * pHead = popFree( nCount );
                     guard_data * pLast;
 
-                    pHead =
-                        pLast = alloc();
-
                     // The guard list allocated is private for the thread,
                     // so, we can use relaxed memory order
-                    while ( --nCount ) {
-                        guard_data * p = alloc();
+                    if ( pHead ) {
+                        pLast = pHead;
+                        for (;;) {
+                            pLast->init();
+                            --nCount;
+                            guard_data * p = pLast->pNextFree.load( atomics::memory_order_relaxed );
+                            if ( !p )
+                                break;
+                            pLast = pLast->pThreadNext = p;
+                        }
+                    }
+                    else {
+                        pHead =
+                            pLast = allocNew();
+                        --nCount;
+                    }
+
+                    while ( nCount-- ) {
+                        guard_data * p = allocNew();
                         pLast->pNextFree.store( pLast->pThreadNext = p, atomics::memory_order_relaxed );
                         pLast = p;
                     }
@@ -244,14 +298,13 @@ namespace cds { namespace gc {
                         pLast->pNextFree.store( p = pLast->pThreadNext, atomics::memory_order_relaxed );
                         pLast = p;
                     }
+                    pLast->pPost.store( nullptr, atomics::memory_order_relaxed );
 
-                    cds::lock::scoped_lock<SpinLock> al( m_freeListLock );
-                    pLast->pNextFree.store( m_FreeGuardList.load(atomics::memory_order_relaxed), atomics::memory_order_relaxed );
-                    m_FreeGuardList.store( pList, atomics::memory_order_relaxed );
+                    pushFree( pList, pLast );
                 }
 
                 /// Returns the list's head of guards allocated
-                guard_data * begin()
+                guard_data * begin() const
                 {
                     return m_GuardList.load(atomics::memory_order_acquire);
                 }
@@ -293,6 +346,18 @@ namespace cds { namespace gc {
                     return m_nItemCount.fetch_add( 1, atomics::memory_order_relaxed ) + 1;
                 }
 
+                /// Pushes the list [\p head, \p tail] of \p nCount nodes linked by \p m_pNext into the buffer. Returns current buffer size
+                size_t push( retired_ptr_node& head, retired_ptr_node& tail, size_t nCount )
+                {
+                    retired_ptr_node * pHead = m_pHead.load(atomics::memory_order_acquire);
+                    do {
+                        tail.m_pNext = pHead;
+                        // pHead is changed by compare_exchange_weak
+                    } while ( !m_pHead.compare_exchange_weak( pHead, &head, atomics::memory_order_release, atomics::memory_order_relaxed ));
+
+                    return m_nItemCount.fetch_add( nCount, atomics::memory_order_relaxed ) + nCount;
+                }
+
                 /// Result of \ref ptb_gc_privatve "privatize" function.
                 /**
                     The \p privatize function returns retired node list as \p first and the size of that list as \p second.
@@ -561,6 +626,26 @@ namespace cds { namespace gc {
                 }
             };
 
+            /// Telemetry record of a thread
+            /**
+                The record is owned by a \p ThreadGC object, only the owner thread updates the counters.
+                The records are linked into the list of GC and never deleted until GC destruction;
+                the record of the terminated thread is reused by a new thread.
+            */
+            struct thread_telemetry
+            {
+                cds::gc::telemetry::thread_counters m_Counters  ;   ///< Telemetry counters of the owner thread
+                thread_telemetry *                  m_pNext     ;   ///< Next record in the list of GC
+                atomics::atomic<bool>               m_bFree     ;   ///< The record is not owned by a thread
+
+                //@cond
+                thread_telemetry()
+                    : m_pNext( nullptr )
+                    , m_bFree( false )
+                {}
+                //@endcond
+            };
+
         } // namespace details
 
         /// Guard
@@ -691,12 +776,20 @@ namespace cds { namespace gc {
             {
                 atomics::atomic<size_t>  m_nGuardCount       ;   ///< Total guard count
                 atomics::atomic<size_t>  m_nFreeGuardCount   ;   ///< Count of free guard
+                atomics::atomic<size_t>  m_nReclaimerBackpressure;  ///< Count of inline liberate calls because the reclamation thread lags
+                atomics::atomic<size_t>  m_nLiberateChunkCount;     ///< Count of chunks published by liberate for cooperative freeing
+                atomics::atomic<size_t>  m_nHelpedChunkCount;       ///< Count of published chunks freed by retirePtr callers
 
                 internal_stat()
                     : m_nGuardCount(0)
                     , m_nFreeGuardCount(0)
+                    , m_nReclaimerBackpressure(0)
+                    , m_nLiberateChunkCount(0)
+                    , m_nHelpedChunkCount(0)
                 {}
             };
+
+            class reclaimer;
             //@endcond
 
         public:
@@ -708,17 +801,30 @@ namespace cds { namespace gc {
             {
                 size_t m_nGuardCount       ;   ///< Total guard count
                 size_t m_nFreeGuardCount   ;   ///< Count of free guard
+                size_t m_nReclaimerBackpressure;    ///< Count of inline liberate calls because the reclamation thread lags
+                size_t m_nReclaimerPassCount;   ///< Count of liberate calls performed by the reclamation thread
+                size_t m_nReclaimerScanTime ;   ///< Total duration of liberate calls of the reclamation thread, microseconds
+                size_t m_nLiberateChunkCount;   ///< Count of chunks of retired pointers published by liberate for cooperative freeing
+                size_t m_nHelpedChunkCount  ;   ///< Count of published chunks freed by retirePtr callers
 
                 //@cond
                 InternalState()
                     : m_nGuardCount(0)
                     , m_nFreeGuardCount(0)
+                    , m_nReclaimerBackpressure(0)
+                    , m_nReclaimerPassCount(0)
+                    , m_nReclaimerScanTime(0)
+                    , m_nLiberateChunkCount(0)
+                    , m_nHelpedChunkCount(0)
                 {}
 
                 InternalState& operator =( internal_stat const& s )
                 {
                     m_nGuardCount = s.m_nGuardCount.load(atomics::memory_order_relaxed);
                     m_nFreeGuardCount = s.m_nFreeGuardCount.load(atomics::memory_order_relaxed);
+                    m_nReclaimerBackpressure = s.m_nReclaimerBackpressure.load(atomics::memory_order_relaxed);
+                    m_nLiberateChunkCount = s.m_nLiberateChunkCount.load(atomics::memory_order_relaxed);
+                    m_nHelpedChunkCount = s.m_nHelpedChunkCount.load(atomics::memory_order_relaxed);
 
                     return *this;
                 }
@@ -738,6 +844,19 @@ namespace cds { namespace gc {
 
             internal_stat   m_stat  ;   ///< Internal statistics
             bool            m_bStatEnabled  ;   ///< Internal Statistics enabled
+            atomics::atomic<details::thread_telemetry *> m_pTelemetryList ;   ///< List of thread telemetry records
+            details::thread_telemetry   m_UnattachedTelemetry   ;   ///< Telemetry record of the threads not attached to libcds
+            cds::SpinLock               m_UnattachedLock        ;   ///< Serializes retiring by the threads not attached to libcds
+
+            reclaimer *     m_pReclaimer    ;   ///< Background reclamation thread
+            size_t          m_nMaxPending   ;   ///< Backpressure bound of the reclamation thread, in liberate thresholds
+            size_t          m_nReclaimerPassCount;  ///< Liberate calls of stopped reclamation threads
+            size_t          m_nReclaimerScanTime;   ///< Liberate duration of stopped reclamation threads, microseconds
+
+            static const size_t c_nLiberateChunkSize = 256  ;   ///< Max count of retired pointers in a chunk freed by one thread
+            static const size_t c_nLiberateSlotCount = 32   ;   ///< Max count of chunks published for cooperative freeing
+            atomics::atomic<details::retired_ptr_node *> m_arrLiberateChunk[c_nLiberateSlotCount] ;   ///< Chunks published by liberate (lists linked by m_pNextFree)
+            atomics::atomic<size_t>                      m_nPendingChunks  ;   ///< Count of chunks published (approximate)
 
         public:
             /// Initializes PTB memory manager singleton
@@ -815,20 +934,141 @@ namespace cds { namespace gc {
                 m_GuardPool.freeList( pList );
             }
 
+            /// Allocates telemetry record for a thread
+            details::thread_telemetry * allocTelemetry();
+
+            /// Frees the telemetry record \p pRec of terminated thread for reusing in future
+            void freeTelemetry( details::thread_telemetry * pRec )
+            {
+                pRec->m_bFree.store( true, atomics::memory_order_release );
+            }
+
             /// Places retired pointer \p and its deleter \p pFunc into thread's array of retired pointer for deferred reclamation
             /**@anchor ptb_gc_retirePtr
+                \p tm is the telemetry counters of current thread.
             */
             template <typename T>
-            void retirePtr( T * p, void (* pFunc)(T *) )
+            void retirePtr( T * p, void (* pFunc)(T *), cds::gc::telemetry::thread_counters& tm )
             {
-                retirePtr( retired_ptr( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc ) ) );
+                retirePtr( retired_ptr( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc ) ), tm );
             }
 
             /// Places retired pointer \p into thread's array of retired pointer for deferred reclamation
-            void retirePtr( retired_ptr const& p )
+            void retirePtr( retired_ptr const& p, cds::gc::telemetry::thread_counters& tm )
             {
-                if ( m_RetiredBuffer.push( m_RetiredAllocator.alloc(p)) >= m_nLiberateThreshold.load(atomics::memory_order_relaxed) )
-                    liberate();
+                tm.onRetire();
+                onRetire( m_RetiredBuffer.push( m_RetiredAllocator.alloc(p)), tm );
+            }
+
+            /// Places retired pointers [\p itFirst, \p itLast) into the buffer of retired pointer for deferred reclamation
+            /**
+                The value type of \p ForwardIterator is \p retired_ptr.
+                The pointers are linked into a list that is pushed into the buffer by one CAS,
+                and the liberate threshold is checked once for whole batch,
+                so the batch causes at most one \ref ptb_gc_liberate "liberate" call.
+            */
+            template <typename ForwardIterator>
+            void batchRetirePtr( ForwardIterator itFirst, ForwardIterator itLast, cds::gc::telemetry::thread_counters& tm )
+            {
+                if ( itFirst == itLast )
+                    return;
+
+                details::retired_ptr_node& tail = m_RetiredAllocator.alloc( *itFirst );
+                details::retired_ptr_node * pHead = &tail;
+                size_t nItems = 1;
+                for ( ++itFirst; itFirst != itLast; ++itFirst ) {
+                    details::retired_ptr_node& node = m_RetiredAllocator.alloc( *itFirst );
+                    node.m_pNext = pHead;
+                    pHead = &node;
+                    ++nItems;
+                }
+
+                tm.onRetire( nItems );
+                onRetire( m_RetiredBuffer.push( *pHead, tail, nItems ), tm );
+            }
+
+            /// Places retired pointer \p p of a thread that is not attached to libcds into the buffer of retired pointers
+            /**
+                Such thread has no ThreadGC and no telemetry record, so the retiring is counted in the common record of the GC.
+                The counters of the record are owner-only, thus the calls of unattached threads are serialized by a spin-lock
+                that is held during the \ref ptb_gc_liberate "liberate" cycle too.
+                Attached threads retire pointers by ThreadGC without locking.
+            */
+            template <typename T>
+            void retirePtr( T * p, void (* pFunc)(T *) )
+            {
+                cds::lock::scoped_lock<cds::SpinLock> al( m_UnattachedLock );
+                retirePtr( p, pFunc, m_UnattachedTelemetry.m_Counters );
+            }
+
+            /// Places retired pointers [\p itFirst, \p itLast) of a thread that is not attached to libcds into the buffer of retired pointers
+            /**
+                See \ref retirePtr( T *, void (*)(T *)) for the locking.
+            */
+            template <typename ForwardIterator>
+            void batchRetirePtr( ForwardIterator itFirst, ForwardIterator itLast )
+            {
+                cds::lock::scoped_lock<cds::SpinLock> al( m_UnattachedLock );
+                batchRetirePtr( itFirst, itLast, m_UnattachedTelemetry.m_Counters );
+            }
+
+            /// Calls \ref ptb_gc_liberate "liberate" on behalf of a thread that is not attached to libcds
+            void scan()
+            {
+                cds::lock::scoped_lock<cds::SpinLock> al( m_UnattachedLock );
+                liberate( m_UnattachedTelemetry.m_Counters );
+            }
+
+        private:
+            //@cond
+            void onRetire( size_t nCount, cds::gc::telemetry::thread_counters& tm )
+            {
+                if ( nCount >= m_nLiberateThreshold.load(atomics::memory_order_relaxed) ) {
+                    if ( !m_pReclaimer || !wakeupReclaimer( nCount ))
+                        liberate( tm );
+                }
+                else if ( m_nPendingChunks.load( atomics::memory_order_relaxed ) != 0 ) {
+                    // Help concurrent liberate to free retired pointers
+                    size_t nFreed = helpLiberate();
+                    if ( nFreed ) {
+                        m_stat.m_nHelpedChunkCount.fetch_add( 1, atomics::memory_order_relaxed );
+                        tm.onReclaim( nFreed );
+                        tm.onHelpScan();
+                    }
+                }
+            }
+            //@endcond
+
+        public:
+
+            /// Starts background reclamation thread
+            /** @anchor ptb_gc_startReclaimer
+                By default, the thread whose \ref ptb_gc_retirePtr "retirePtr" call crosses the liberate threshold
+                performs \ref ptb_gc_liberate "liberate" itself, so a random unlucky operation pays for the whole liberate cycle.
+                When the reclamation thread is started, the thread just wakes the reclamation thread up
+                and continues immediately; the reclamation thread calls \p liberate.
+
+                Backpressure: if the reclamation thread lags and the count of retired pointers reaches
+                <tt>nMaxPending * nLiberateThreshold</tt>, the retiring thread calls \p liberate inline.
+
+                The reclamation thread is stopped by \ref stopReclaimer or by \ref Destruct.
+                The functions \p startReclaimer and \p stopReclaimer must not be called concurrently with
+                the threads that use PTB GC.
+            */
+            void startReclaimer(
+                size_t nMaxPending = 64 ///< backpressure bound in liberate thresholds
+            );
+
+            /// Stops background reclamation thread
+            /**
+                The reclamation thread performs the last liberate cycle before it is terminated.
+            */
+            void stopReclaimer();
+
+            /// Checks if background reclamation thread is running
+            bool isReclaimerRunning() const
+            {
+                return m_pReclaimer != nullptr;
             }
 
         protected:
@@ -836,8 +1076,10 @@ namespace cds { namespace gc {
             /** @anchor ptb_gc_liberate
                 The main function of Pass The Buck algorithm. It tries to free retired pointers if they are not
                 trapped by any guard.
+
+                The liberate pass is counted in telemetry counters \p tm of current thread.
             */
-            void liberate();
+            void liberate( cds::gc::telemetry::thread_counters& tm );
 
             //@}
 
@@ -846,14 +1088,25 @@ namespace cds { namespace gc {
 #if 0
             void liberate( details::liberate_set& set );
 #endif
+            bool wakeupReclaimer( size_t nRetiredCount );
+
+            // The functions return the count of retired pointers freed by current thread
+            size_t freeRetired( details::retired_ptr_node * pList );
+            size_t freeChunk( details::retired_ptr_node * pChunk );
+            bool publishChunk( details::retired_ptr_node * pChunk );
+            size_t helpLiberate();
             //@endcond
 
         public:
             /// Get internal statistics
-            InternalState& getInternalState(InternalState& stat) const
-            {
-                return stat = m_stat;
-            }
+            InternalState& getInternalState(InternalState& stat) const;
+
+            /// Fills GC telemetry snapshot \p s, see \ref cds_gc_telemetry "telemetry"
+            /**
+                The counters of the thread telemetry records are aggregated.
+                The backlog is the current size of retired pointer buffer.
+            */
+            cds::gc::telemetry::snapshot& getTelemetry( cds::gc::telemetry::snapshot& s ) const;
 
             /// Checks if internal statistics enabled
             bool              isStatisticsEnabled() const
@@ -887,18 +1140,22 @@ namespace cds { namespace gc {
             \li Thread guard list: the list of thread-local guards (linked by \p pThreadNext field)
             \li Free guard list: the list of thread-local free guards (linked by \p pNextFree field)
             Free guard list is a subset of thread guard list.
+            When the free guard list is empty, the thread moves next \p nInitialThreadGuardCount guards
+            from the global free-list to its lists at once.
         */
         class ThreadGC: public cds::details::noncopyable
         {
             GarbageCollector&   m_gc    ;   ///< reference to GC singleton
             details::guard_data *    m_pList ;   ///< Local list of guards owned by the thread
             details::guard_data *    m_pFree ;   ///< The list of free guard from m_pList
+            details::thread_telemetry * m_pTelemetry ;  ///< Telemetry record owned by the thread
 
         public:
             ThreadGC()
                 : m_gc( GarbageCollector::instance() )
                 , m_pList( nullptr )
                 , m_pFree( nullptr )
+                , m_pTelemetry( nullptr )
             {}
 
             /// Dtor calls fini()
@@ -914,6 +1171,8 @@ namespace cds { namespace gc {
                     m_pList =
                         m_pFree = m_gc.allocGuardList( m_gc.m_nInitialThreadGuardCount );
                 }
+                if ( !m_pTelemetry )
+                    m_pTelemetry = m_gc.allocTelemetry();
             }
 
             /// Finalization. Repeat call is available
@@ -924,6 +1183,10 @@ namespace cds { namespace gc {
                     m_pList =
                         m_pFree = nullptr;
                 }
+                if ( m_pTelemetry ) {
+                    m_gc.freeTelemetry( m_pTelemetry );
+                    m_pTelemetry = nullptr;
+                }
             }
 
         public:
@@ -931,15 +1194,10 @@ namespace cds { namespace gc {
             void allocGuard( Guard& g )
             {
                 assert( m_pList != nullptr );
-                if ( m_pFree ) {
-                    g.m_pGuard = m_pFree;
-                    m_pFree = m_pFree->pNextFree.load(atomics::memory_order_relaxed);
-                }
-                else {
-                    g.m_pGuard = m_gc.allocGuard();
-                    g.m_pGuard->pThreadNext = m_pList;
-                    m_pList = g.m_pGuard;
-                }
+                if ( !m_pFree )
+                    refill();
+                g.m_pGuard = m_pFree;
+                m_pFree = m_pFree->pNextFree.load(atomics::memory_order_relaxed);
             }
 
             /// Frees guard \p g
@@ -958,18 +1216,13 @@ namespace cds { namespace gc {
                 assert( m_pList != nullptr );
                 size_t nCount = 0;
 
-                while ( m_pFree && nCount < Count ) {
+                while ( nCount < Count ) {
+                    if ( !m_pFree )
+                        refill();
                     arr[nCount].set_guard( m_pFree );
                     m_pFree = m_pFree->pNextFree.load(atomics::memory_order_relaxed);
                     ++nCount;
                 }
-
-                while ( nCount < Count ) {
-                    details::guard& g = arr[nCount++];
-                    g.set_guard( m_gc.allocGuard() );
-                    g.get_guard()->pThreadNext = m_pList;
-                    m_pList = g.get_guard();
-                }
             }
 
             /// Frees guard array \p arr
@@ -994,16 +1247,42 @@ namespace cds { namespace gc {
             template <typename T>
             void retirePtr( T * p, void (* pFunc)(T *) )
             {
-                m_gc.retirePtr( p, pFunc );
+                assert( m_pTelemetry );
+                m_gc.retirePtr( p, pFunc, m_pTelemetry->m_Counters );
+            }
+
+            /// Places retired pointers [\p itFirst, \p itLast) into the buffer of retired pointer for deferred reclamation
+            template <typename ForwardIterator>
+            void batchRetirePtr( ForwardIterator itFirst, ForwardIterator itLast )
+            {
+                assert( m_pTelemetry );
+                m_gc.batchRetirePtr( itFirst, itLast, m_pTelemetry->m_Counters );
             }
 
             //@cond
             void scan()
             {
-                m_gc.liberate();
+                assert( m_pTelemetry );
+                m_gc.liberate( m_pTelemetry->m_Counters );
             }
             //@endcond
 
+        private:
+            //@cond
+            // Moves next block of guards from the global free-list to the thread's cache
+            void refill()
+            {
+                assert( m_pFree == nullptr );
+
+                details::guard_data * pList = m_gc.allocGuardList( m_gc.m_nInitialThreadGuardCount );
+                details::guard_data * pLast = pList;
+                while ( pLast->pThreadNext )
+                    pLast = pLast->pThreadNext;
+                pLast->pThreadNext = m_pList;
+                m_pList =
+                    m_pFree = pList;
+            }
+            //@endcond
         };
 
         //////////////////////////////////////////////////////////
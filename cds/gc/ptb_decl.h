@@ -30,6 +30,9 @@ namespace cds { namespace gc {
         /// Native guarded pointer type
         typedef void * guarded_pointer;
 
+        /// Retired pointer type
+        typedef cds::gc::details::retired_ptr retired_ptr;
+
         /// Atomic reference
         /**
             @headerfile cds/gc/ptb.h
@@ -385,12 +388,13 @@ namespace cds { namespace gc {
             The function places pointer \p p to array of pointers ready for removing.
             (so called retired pointer array). The pointer can be safely removed when no guarded pointer points to it.
             Deleting the pointer is the function \p pFunc call.
+
+            The function may be called by a thread that is not attached to libcds, for example, by a thread
+            that releases the last reference to an object. Such thread retires \p p into the common retired buffer
+            of PTB GC under a spin-lock; an attached thread does it without locking.
         */
         template <typename T>
-        static void retire( T * p, void (* pFunc)(T *) )
-        {
-            ptb::GarbageCollector::instance().retirePtr( p, pFunc );
-        }
+        static void retire( T * p, void (* pFunc)(T *) )    ;   // inline in ptb_impl.h
 
         /// Retire pointer \p p with functor of type \p Disposer
         /**
@@ -398,12 +402,22 @@ namespace cds { namespace gc {
             (so called retired pointer array). The pointer can be safely removed when no guarded pointer points to it.
 
             See gc::HP::retire for \p Disposer requirements.
+            The thread may be not attached to libcds, see \ref retire( T *, void (*)(T *) ).
         */
         template <class Disposer, typename T>
-        static void retire( T * p )
-        {
-            retire( p, cds::details::static_functor<Disposer, T>::call );
-        }
+        static void retire( T * p )     ;   // inline in ptb_impl.h
+
+        /// Retires the pointer chain [\p itFirst, \p itLast)
+        /**
+            The value type of \p ForwardIterator is \ref retired_ptr.
+            The chain is pushed into the retired buffer by one atomic operation
+            and the liberate threshold is checked once, so the batch causes at most one liberate cycle.
+
+            The function is useful when many nodes are removed at once, for example, by \p clear() of a container.
+            The thread may be not attached to libcds, see \ref retire( T *, void (*)(T *) ).
+        */
+        template <typename ForwardIterator>
+        static void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )     ;   // inline in ptb_impl.h
 
         /// Checks if Pass-the-Buck GC is constructed and may be used
         static bool isUsed()
@@ -411,6 +425,30 @@ namespace cds { namespace gc {
             return ptb::GarbageCollector::isUsed();
         }
 
+        /// Starts background reclamation thread
+        /**
+            See \ref ptb_gc_startReclaimer "ptb::GarbageCollector::startReclaimer" for explanation.
+        */
+        static void start_reclaimer( size_t nMaxPending = 64 )
+        {
+            ptb::GarbageCollector::instance().startReclaimer( nMaxPending );
+        }
+
+        /// Stops background reclamation thread
+        static void stop_reclaimer()
+        {
+            ptb::GarbageCollector::instance().stopReclaimer();
+        }
+
+        /// Fills GC telemetry snapshot \p s
+        /**
+            See \ref cds_gc_telemetry "telemetry" for explanation.
+        */
+        static cds::gc::telemetry::snapshot& get_telemetry( cds::gc::telemetry::snapshot& s )
+        {
+            return ptb::GarbageCollector::instance().getTelemetry( s );
+        }
+
         /// Forced GC cycle call for current thread
         /**
             Usually, this function should not be called directly.
@@ -4,6 +4,7 @@
 #define __CDS_GC_PTB_IMPL_H
 
 #include <cds/threading/model.h>
+#include <cds/details/static_functor.h>
 
 //@cond
 namespace cds { namespace gc {
@@ -32,9 +33,36 @@ namespace cds { namespace gc {
         : GuardArray::base_class( cds::threading::getGC<PTB>() )
     {}
 
+    template <typename T>
+    inline void PTB::retire( T * p, void (* pFunc)(T *) )
+    {
+        if ( cds::threading::Manager::isThreadAttached() )
+            cds::threading::getGC<PTB>().retirePtr( p, pFunc );
+        else
+            ptb::GarbageCollector::instance().retirePtr( p, pFunc );
+    }
+
+    template <class Disposer, typename T>
+    inline void PTB::retire( T * p )
+    {
+        retire( p, cds::details::static_functor<Disposer, T>::call );
+    }
+
+    template <typename ForwardIterator>
+    inline void PTB::batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
+    {
+        if ( cds::threading::Manager::isThreadAttached() )
+            cds::threading::getGC<PTB>().batchRetirePtr( itFirst, itLast );
+        else
+            ptb::GarbageCollector::instance().batchRetirePtr( itFirst, itLast );
+    }
+
     inline void PTB::scan()
     {
-        cds::threading::getGC<PTB>().scan();
+        if ( cds::threading::Manager::isThreadAttached() )
+            cds::threading::getGC<PTB>().scan();
+        else
+            ptb::GarbageCollector::instance().scan();
     }
 
 }} // namespace cds::gc
@@ -0,0 +1,340 @@
+//$$CDS-header$$
+
+#ifndef __CDS_GC_TELEMETRY_H
+#define __CDS_GC_TELEMETRY_H
+
+#include <chrono>
+#include <cds/cxx11_atomic.h>
+#include <cds/algo/int_algo.h>
+
+namespace cds { namespace gc {
+
+    /// Unified telemetry of garbage collectors
+    /** @anchor cds_gc_telemetry
+        Each garbage collector (\p cds::gc::HP, \p cds::gc::PTB, \p cds::gc::HRC and \p cds::urcu::gc)
+        provides static function <tt>get_telemetry( cds::gc::telemetry::snapshot& s )</tt>
+        that fills the same \ref snapshot structure: retired object backlog, count and duration
+        of reclamation passes, grace period latency for RCU, guards in use.
+
+        The counters are always collected. They are cheap enough to be left on in production:
+        - the per-event counters (for example, retired objects) are owned by the thread record of the GC
+          and updated by the owner thread with plain (non-atomic) increments,
+          the reader aggregates the counters of all thread records on demand;
+        - the counters of reclamation passes are updated once per pass, the pass duration is measured
+          by \p std::chrono::steady_clock and recorded in a log2 histogram.
+
+        Some values are not applicable for some GC, they are zero:
+        \p nGracePeriodCount and \p gracePeriodTime for HP, PTB and HRC;
+        \p nHelpScanCount, \p nGuardsInUse and \p scanTime for RCU.
+
+        Example:
+        \code
+        #include <cds/gc/hp.h>
+
+        cds::gc::telemetry::snapshot s;
+        cds::gc::HP::get_telemetry( s );
+        std::cout << "Retired objects not reclaimed yet: " << s.nBacklog
+                  << ", scan 99th percentile, ns < " << s.scanTime.percentile( 99 ) << std::endl;
+        \endcode
+    */
+    namespace telemetry {
+
+        /// Counter modified by one thread at a time
+        /**
+            The counter is incremented by plain load and store without atomic read-modify-write operation.
+            So, the counter must be modified by one thread at a time (for example, by the owner of GC's thread record
+            or under a lock), but it may be read by any thread.
+        */
+        class owner_counter
+        {
+            //@cond
+            atomics::atomic<size_t> m_nValue;
+            //@endcond
+        public:
+            //@cond
+            owner_counter()
+                : m_nValue( 0 )
+            {}
+            //@endcond
+
+            /// Adds \p n to the counter
+            void add( size_t n = 1 )
+            {
+                m_nValue.store( m_nValue.load( atomics::memory_order_relaxed ) + n, atomics::memory_order_relaxed );
+            }
+
+            /// Returns current value
+            size_t get() const
+            {
+                return m_nValue.load( atomics::memory_order_relaxed );
+            }
+        };
+
+        /// Counter modified by several threads concurrently
+        class shared_counter
+        {
+            //@cond
+            atomics::atomic<size_t> m_nValue;
+            //@endcond
+        public:
+            //@cond
+            shared_counter()
+                : m_nValue( 0 )
+            {}
+            //@endcond
+
+            /// Adds \p n to the counter
+            void add( size_t n = 1 )
+            {
+                m_nValue.fetch_add( n, atomics::memory_order_relaxed );
+            }
+
+            /// Returns current value
+            size_t get() const
+            {
+                return m_nValue.load( atomics::memory_order_relaxed );
+            }
+        };
+
+        /// Latency histogram data
+        /**
+            The bucket \p i contains the count of events of duration <tt>[2**i, 2**(i+1))</tt> nanoseconds,
+            the bucket 0 contains the events shorter than 2 ns, the last bucket contains
+            all events longer than <tt>2**(c_nBucketCount-1)</tt> ns (about 2 seconds).
+        */
+        struct histogram_data
+        {
+            static size_t const c_nBucketCount = 32 ;   ///< Bucket count
+
+            size_t  arrBucket[c_nBucketCount]   ;   ///< Event count per bucket
+
+            //@cond
+            histogram_data()
+            {
+                clear();
+            }
+            //@endcond
+
+            /// Clears all buckets
+            void clear()
+            {
+                for ( size_t i = 0; i < c_nBucketCount; ++i )
+                    arrBucket[i] = 0;
+            }
+
+            /// Returns total count of events
+            size_t count() const
+            {
+                size_t n = 0;
+                for ( size_t i = 0; i < c_nBucketCount; ++i )
+                    n += arrBucket[i];
+                return n;
+            }
+
+            /// Returns upper bound of duration of bucket \p nBucket, nanoseconds
+            static uint64_t upper_bound( size_t nBucket )
+            {
+                return uint64_t(2) << nBucket;
+            }
+
+            /// Returns upper bound of the bucket that contains \p nPercent percentile, nanoseconds
+            /**
+                For example, <tt>percentile( 99 )</tt> returns the duration which 99% of the events do not exceed
+                (with precision of the bucket). If the histogram is empty, the function returns 0.
+            */
+            uint64_t percentile( double nPercent ) const
+            {
+                size_t const nTotal = count();
+                if ( nTotal == 0 )
+                    return 0;
+
+                size_t const nBound = static_cast<size_t>( nTotal * nPercent / 100 );
+                size_t nCount = 0;
+                for ( size_t i = 0; i < c_nBucketCount; ++i ) {
+                    nCount += arrBucket[i];
+                    if ( nCount >= nBound && nCount > 0 )
+                        return upper_bound( i );
+                }
+                return upper_bound( c_nBucketCount - 1 );
+            }
+
+            /// Adds \p h to the histogram
+            histogram_data& operator +=( histogram_data const& h )
+            {
+                for ( size_t i = 0; i < c_nBucketCount; ++i )
+                    arrBucket[i] += h.arrBucket[i];
+                return *this;
+            }
+        };
+
+        /// Latency histogram
+        /**
+            \p Counter is \p owner_counter or \p shared_counter
+        */
+        template <typename Counter>
+        class histogram
+        {
+            //@cond
+            Counter     m_arrBucket[ histogram_data::c_nBucketCount ];
+            //@endcond
+
+        public:
+            /// Records an event of duration \p nDuration nanoseconds
+            void record( uint64_t nDuration )
+            {
+                m_arrBucket[ bucket( nDuration ) ].add();
+            }
+
+            /// Adds the histogram to \p h
+            void collect( histogram_data& h ) const
+            {
+                for ( size_t i = 0; i < histogram_data::c_nBucketCount; ++i )
+                    h.arrBucket[i] += m_arrBucket[i].get();
+            }
+
+            /// Returns the bucket for \p nDuration nanoseconds
+            static size_t bucket( uint64_t nDuration )
+            {
+                if ( nDuration >> ( histogram_data::c_nBucketCount - 1 ))
+                    return histogram_data::c_nBucketCount - 1;
+                return cds::beans::log2floor( static_cast<size_t>( nDuration ));
+            }
+        };
+
+        /// GC telemetry snapshot
+        /**
+            The snapshot is filled by <tt>get_telemetry()</tt> function of a GC, see \ref cds_gc_telemetry "telemetry".
+            The values are aggregated from the counters updated concurrently,
+            so the snapshot is consistent only approximately.
+        */
+        struct snapshot
+        {
+            size_t  nThreadCount        ;   ///< Count of threads attached to the GC
+            size_t  nRetired            ;   ///< Total count of retired objects
+            size_t  nReclaimed          ;   ///< Total count of reclaimed (freed) objects
+            size_t  nBacklog            ;   ///< Count of retired objects that are not reclaimed yet
+            size_t  nScanCount          ;   ///< Count of reclamation passes (HP and HRC \p Scan, PTB \p liberate, RCU \p synchronize)
+            size_t  nHelpScanCount      ;   ///< Count of help passes (HP and HRC \p HelpScan, PTB chunks freed by retiring threads)
+            size_t  nGracePeriodCount   ;   ///< RCU: count of grace periods waited
+            size_t  nGuardsInUse        ;   ///< Count of guards (hazard pointers) protecting a pointer at the moment
+            histogram_data  scanTime        ;   ///< Duration histogram of reclamation passes
+            histogram_data  gracePeriodTime ;   ///< RCU: duration histogram of grace period waiting
+
+            //@cond
+            snapshot()
+            {
+                clear();
+            }
+            //@endcond
+
+            /// Clears the snapshot
+            void clear()
+            {
+                nThreadCount =
+                    nRetired =
+                    nReclaimed =
+                    nBacklog =
+                    nScanCount =
+                    nHelpScanCount =
+                    nGracePeriodCount =
+                    nGuardsInUse = 0;
+                scanTime.clear();
+                gracePeriodTime.clear();
+            }
+        };
+
+        /// Reclamation counters
+        /**
+            \p Counter is \p owner_counter (\p thread_counters, for the counters of thread record)
+            or \p shared_counter (\p shared_counters, for the counters of the GC singleton).
+        */
+        template <typename Counter>
+        class counters
+        {
+            //@cond
+            Counter             m_nRetired          ;
+            Counter             m_nReclaimed        ;
+            Counter             m_nScanCount        ;
+            Counter             m_nHelpScanCount    ;
+            Counter             m_nGracePeriodCount ;
+            histogram<Counter>  m_ScanTime          ;
+            histogram<Counter>  m_GracePeriodTime   ;
+            //@endcond
+
+        public:
+            /// \p n objects are retired
+            void onRetire( size_t n = 1 )
+            {
+                m_nRetired.add( n );
+            }
+
+            /// \p n objects are reclaimed out of reclamation pass
+            void onReclaim( size_t n )
+            {
+                m_nReclaimed.add( n );
+            }
+
+            /// The reclamation pass of \p nDuration nanoseconds has reclaimed \p nReclaimed objects
+            void onScan( uint64_t nDuration, size_t nReclaimed )
+            {
+                m_nScanCount.add();
+                m_nReclaimed.add( nReclaimed );
+                m_ScanTime.record( nDuration );
+            }
+
+            /// Help pass is done
+            void onHelpScan()
+            {
+                m_nHelpScanCount.add();
+            }
+
+            /// Grace period of \p nDuration nanoseconds is waited
+            void onGracePeriod( uint64_t nDuration )
+            {
+                m_nGracePeriodCount.add();
+                m_GracePeriodTime.record( nDuration );
+            }
+
+            /// Adds the counters to \p s
+            void collect( snapshot& s ) const
+            {
+                s.nRetired          += m_nRetired.get();
+                s.nReclaimed        += m_nReclaimed.get();
+                s.nScanCount        += m_nScanCount.get();
+                s.nHelpScanCount    += m_nHelpScanCount.get();
+                s.nGracePeriodCount += m_nGracePeriodCount.get();
+                m_ScanTime.collect( s.scanTime );
+                m_GracePeriodTime.collect( s.gracePeriodTime );
+            }
+        };
+
+        /// Counters of GC thread record
+        typedef counters< owner_counter >   thread_counters;
+
+        /// Counters of GC singleton
+        typedef counters< shared_counter >  shared_counters;
+
+        /// Stopwatch to measure the duration of reclamation pass
+        class stopwatch
+        {
+            //@cond
+            typedef std::chrono::steady_clock   clock_type;
+            clock_type::time_point  m_tStart;
+            //@endcond
+        public:
+            /// Starts the stopwatch
+            stopwatch()
+                : m_tStart( clock_type::now() )
+            {}
+
+            /// Returns the time elapsed since the stopwatch has been started, nanoseconds
+            uint64_t elapsed() const
+            {
+                return static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( clock_type::now() - m_tStart ).count() );
+            }
+        };
+
+    } // namespace telemetry
+}} // namespace cds::gc
+
+#endif // #ifndef __CDS_GC_TELEMETRY_H
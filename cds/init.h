@@ -79,6 +79,7 @@ namespace cds {
     {
         if ( cds::details::fini_last_call() ) {
             cds::threading::Manager::fini();
+            cds::threading::thread_data_pool::instance().clear();
 
             cds::OS::topology::fini();
         }
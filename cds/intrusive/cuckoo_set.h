@@ -1629,6 +1629,8 @@ namespace cds { namespace intrusive {
             The hash functors are passed as <tt> std::tuple< H1, H2, ... Hn > </tt>. The number of hash functors specifies
             the number \p k - the count of hash tables in cuckoo hashing. If the compiler supports variadic templates
             then k is unlimited, otherwise up to 10 different hash functors are supported.
+            Instead of the tuple, \p cds::opt::v::derived_hash_list may be used: it computes one 128-bit hash
+            and derives \p k hash values from it.
         - opt::mutex_policy - concurrent access policy.
             Available policies: cuckoo::striping, cuckoo::refinable.
             Default is cuckoo::striping.
@@ -2766,6 +2768,34 @@ namespace cds { namespace intrusive {
             m_ItemCounter.reset();
         }
 
+        /// Calls \p f for each item of the set
+        /**
+            The functor \p Func interface is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The function locks entire set, so the set is not changed while the items are being traversed
+            and any concurrent modifying operation waits for \p for_each completion.
+            The functor should not change the key of the item and must not call any member function of the set.
+        */
+        template <typename Func>
+        void for_each( Func f )
+        {
+            // locks entire array
+            scoped_full_lock sl( m_MutexPolicy );
+
+            for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                bucket_entry * pEntry = m_BucketTable[i];
+                bucket_entry * pEnd = pEntry + m_nBucketMask + 1;
+                for ( ; pEntry != pEnd ; ++pEntry ) {
+                    for ( bucket_iterator it = pEntry->begin(), itEnd = pEntry->end(); it != itEnd; ++it )
+                        f( *node_traits::to_value_ptr( *it ));
+                }
+            }
+        }
+
         /// Checks if the set is empty
         /**
             Emptiness is checked by item counting: if item count is zero then the set is empty.
@@ -376,6 +376,8 @@ namespace cds { namespace intrusive {
             event_counter   m_nExtractMaxRetries    ; ///< Count of retries of \p extract_max call
             event_counter   m_nEraseWhileFind       ; ///< Count of erased item while searching
             event_counter   m_nExtractWhileFind     ; ///< Count of extracted item while searching (RCU only)
+            event_counter   m_nFingerHit            ; ///< Count of searches started from the finger
+            event_counter   m_nFingerMiss           ; ///< Count of searches with the finger that have been restarted from the head
 
             //@cond
             void onAddNode( unsigned int nHeight )
@@ -420,6 +422,8 @@ namespace cds { namespace intrusive {
             void onExtractMaxSuccess()      { ++m_nExtractMaxSuccess; }
             void onExtractMaxFailed()       { ++m_nExtractMaxFailed;  }
             void onExtractMaxRetry()        { ++m_nExtractMaxRetries; }
+            void onFingerHit()              { ++m_nFingerHit;         }
+            void onFingerMiss()             { ++m_nFingerMiss;        }
 
             //@endcond
         };
@@ -460,6 +464,8 @@ namespace cds { namespace intrusive {
             void onExtractMaxSuccess()      const {}
             void onExtractMaxFailed()       const {}
             void onExtractMaxRetry()        const {}
+            void onFingerHit()              const {}
+            void onFingerMiss()             const {}
 
             //@endcond
         };
@@ -212,9 +212,9 @@ namespace cds { namespace intrusive {
                 size_t nLoadFactor        ///< Load factor
                 )
                 : m_nLoadFactor( nLoadFactor > 0 ? nLoadFactor : (size_t) 1 ),
-                m_nCapacity( cds::beans::ceil2( nItemCount / m_nLoadFactor ) )
+                m_nCapacity( nItemCount / m_nLoadFactor > 2 ? cds::beans::ceil2( nItemCount / m_nLoadFactor ) : 2 )
             {
-                // m_nCapacity must be power of 2
+                // m_nCapacity must be power of 2 and not less than the initial bucket count 2
                 assert( cds::beans::is_power2( m_nCapacity ) );
                 allocate_table();
             }
@@ -0,0 +1,243 @@
+//$$CDS-header$$
+
+#ifndef __CDS_INTRUSIVE_DETAILS_SUNDELL_LIST_BASE_H
+#define __CDS_INTRUSIVE_DETAILS_SUNDELL_LIST_BASE_H
+
+#include <cds/intrusive/details/base.h>
+#include <cds/opt/options.h>
+#include <cds/cxx11_atomic.h>
+#include <cds/details/marked_ptr.h>
+#include <cds/algo/backoff_strategy.h>
+
+namespace cds { namespace intrusive {
+
+    /// SundellList doubly-linked list related definitions
+    /** @ingroup cds_intrusive_helper
+    */
+    namespace sundell_list {
+
+        /// Doubly-linked list node
+        /**
+            Template parameters:
+            - GC - garbage collector
+            - Tag - a tag used to distinguish between different implementation
+        */
+        template <class GC, typename Tag = opt::none>
+        struct node
+        {
+            typedef GC              gc  ;   ///< Garbage collector
+            typedef Tag             tag ;   ///< tag
+
+            typedef cds::details::marked_ptr<node, 1>   marked_ptr         ;   ///< marked pointer
+            typedef typename gc::template atomic_marked_ptr< marked_ptr>     atomic_marked_ptr   ;   ///< atomic marked pointer specific for GC
+            typedef typename gc::template atomic_ref<node>                   atomic_node_ptr     ;   ///< atomic pointer specific for GC
+
+            atomic_marked_ptr   m_pNext ;   ///< pointer to the next node in the container; the mark means the node is deleted
+            atomic_node_ptr     m_pPrev ;   ///< hint pointer to the previous node in the container
+
+            CDS_CONSTEXPR node() CDS_NOEXCEPT
+                : m_pNext( nullptr )
+                , m_pPrev( nullptr )
+            {}
+        };
+
+        //@cond
+        template <typename GC, typename Node, typename MemoryModel>
+        struct node_cleaner {
+            void operator()( Node * p )
+            {
+                typedef typename Node::marked_ptr marked_ptr;
+                p->m_pNext.store( marked_ptr(), MemoryModel::memory_order_release );
+                p->m_pPrev.store( nullptr, MemoryModel::memory_order_release );
+            }
+        };
+        //@endcond
+
+        //@cond
+        struct undefined_gc;
+        struct default_hook {
+            typedef undefined_gc    gc;
+            typedef opt::none       tag;
+        };
+        //@endcond
+
+        //@cond
+        template < typename HookType, typename... Options>
+        struct hook
+        {
+            typedef typename opt::make_options< default_hook, Options...>::type  options;
+            typedef typename options::gc    gc;
+            typedef typename options::tag   tag;
+            typedef node<gc, tag>   node_type;
+            typedef HookType        hook_type;
+        };
+        //@endcond
+
+        /// Base hook
+        /**
+            \p Options are:
+            - opt::gc - garbage collector used.
+            - opt::tag - tag
+        */
+        template < typename... Options >
+        struct base_hook: public hook< opt::base_hook_tag, Options... >
+        {};
+
+        /// Member hook
+        /**
+            \p MemberOffset defines offset in bytes of \ref node member into your structure.
+            Use \p offsetof macro to define \p MemberOffset
+
+            \p Options are:
+            - opt::gc - garbage collector used.
+            - opt::tag - tag
+        */
+        template < size_t MemberOffset, typename... Options >
+        struct member_hook: public hook< opt::member_hook_tag, Options... >
+        {
+            //@cond
+            static const size_t c_nMemberOffset = MemberOffset;
+            //@endcond
+        };
+
+        /// Traits hook
+        /**
+            \p NodeTraits defines type traits for node.
+            See \ref node_traits for \p NodeTraits interface description
+
+            \p Options are:
+            - opt::gc - garbage collector used.
+            - opt::tag - tag
+        */
+        template <typename NodeTraits, typename... Options >
+        struct traits_hook: public hook< opt::traits_hook_tag, Options... >
+        {
+            //@cond
+            typedef NodeTraits node_traits;
+            //@endcond
+        };
+
+        /// Check link
+        template <typename Node>
+        struct link_checker
+        {
+            //@cond
+            typedef Node node_type;
+            //@endcond
+
+            /// Checks if the link fields of node \p pNode are \p nullptr
+            /**
+                An asserting is generated if \p pNode link fields are not \p nullptr
+            */
+            static void is_empty( const node_type * pNode )
+            {
+                assert( pNode->m_pNext.load( atomics::memory_order_relaxed ) == nullptr );
+                assert( pNode->m_pPrev.load( atomics::memory_order_relaxed ) == nullptr );
+            }
+        };
+
+        //@cond
+        template <class GC, typename Node, opt::link_check_type LinkType >
+        struct link_checker_selector;
+
+        template <typename GC, typename Node>
+        struct link_checker_selector< GC, Node, opt::never_check_link >
+        {
+            typedef intrusive::opt::v::empty_link_checker<Node>  type;
+        };
+
+        template <typename GC, typename Node>
+        struct link_checker_selector< GC, Node, opt::debug_check_link >
+        {
+#       ifdef _DEBUG
+            typedef link_checker<Node>  type;
+#       else
+            typedef intrusive::opt::v::empty_link_checker<Node>  type;
+#       endif
+        };
+
+        template <typename GC, typename Node>
+        struct link_checker_selector< GC, Node, opt::always_check_link >
+        {
+            typedef link_checker<Node>  type;
+        };
+        //@endcond
+
+        /// Metafunction for selecting appropriate link checking policy
+        template < typename Node, opt::link_check_type LinkType >
+        struct get_link_checker
+        {
+            //@cond
+            typedef typename link_checker_selector< typename Node::gc, Node, LinkType>::type type;
+            //@endcond
+        };
+
+        /// Type traits for SundellList class
+        struct type_traits
+        {
+            /// Hook used
+            /**
+                Possible values are: sundell_list::base_hook, sundell_list::member_hook, sundell_list::traits_hook.
+            */
+            typedef base_hook<>       hook;
+
+            /// back-off strategy used
+            /**
+                If the option is not specified, the cds::backoff::Default is used.
+            */
+            typedef cds::backoff::Default           back_off;
+
+            /// Disposer
+            /**
+                the functor used for dispose removed items. Default is opt::v::empty_disposer.
+            */
+            typedef opt::v::empty_disposer          disposer;
+
+            /// Item counter
+            /**
+                The type for item counting feature.
+                Default is no item counter (\ref atomicity::empty_item_counter)
+            */
+            typedef atomicity::empty_item_counter     item_counter;
+
+            /// Link fields checking feature
+            /**
+                Default is \ref opt::debug_check_link
+            */
+            static const opt::link_check_type link_checker = opt::debug_check_link;
+
+            /// C++ memory ordering model
+            /**
+                List of available memory ordering see opt::memory_model
+            */
+            typedef opt::v::relaxed_ordering        memory_model;
+        };
+
+        /// Metafunction converting option list to traits
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options list see \ref SundellList.
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+    } // namespace sundell_list
+
+    //@cond
+    // Forward declaration
+    template < class GC, typename T, class Traits = sundell_list::type_traits >
+    class SundellList;
+    //@endcond
+
+}}   // namespace cds::intrusive
+
+#endif // #ifndef __CDS_INTRUSIVE_DETAILS_SUNDELL_LIST_BASE_H
@@ -1239,6 +1239,133 @@ namespace cds { namespace intrusive {
             return get_( key, compare_functor());
         }
 
+        /// Finds the item with minimal key greater than \p key
+        /** \anchor cds_intrusive_EllenBinTree_rcu_find_next
+            The function searches the successor of \p key, i.e. the item with the least key
+            that is strictly greater than \p key, and returns the pointer to the item found.
+            \p key itself may or may not be in the tree.
+            If there is no such item the function returns \p nullptr.
+
+            The item returned was in the tree at the moment the leaf was reached.
+
+            RCU should be locked before call the function.
+            Returned pointer is valid while RCU is locked.
+        */
+        template <typename Q>
+        value_type * find_next( Q const& key ) const
+        {
+            return find_next_( key, node_compare() );
+        }
+
+        /// Finds the successor of \p key using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_find_next "find_next(Q const&)"
+            but \p pred is used for comparing the keys.
+
+            \p Less functor has the semantics like \p std::less but should take arguments of type \ref value_type and \p Q
+            in any order.
+            \p pred must imply the same element order as the comparator used for building the tree.
+        */
+        template <typename Q, typename Less>
+        value_type * find_next_with( Q const& key, Less pred ) const
+        {
+            typedef ellen_bintree::details::compare<
+                key_type,
+                value_type,
+                opt::details::make_comparator_from_less<Less>,
+                node_traits
+            > compare_functor;
+
+            return find_next_( key, compare_functor());
+        }
+
+        /// Finds the item with maximal key less than \p key
+        /** \anchor cds_intrusive_EllenBinTree_rcu_find_prev
+            The function searches the predecessor of \p key, i.e. the item with the greatest key
+            that is strictly less than \p key, and returns the pointer to the item found.
+            \p key itself may or may not be in the tree.
+            If there is no such item the function returns \p nullptr.
+
+            RCU should be locked before call the function.
+            Returned pointer is valid while RCU is locked.
+        */
+        template <typename Q>
+        value_type * find_prev( Q const& key ) const
+        {
+            return find_prev_( key, node_compare() );
+        }
+
+        /// Finds the predecessor of \p key using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_find_prev "find_prev(Q const&)"
+            but \p pred is used for comparing the keys.
+
+            \p Less functor has the semantics like \p std::less but should take arguments of type \ref value_type and \p Q
+            in any order.
+            \p pred must imply the same element order as the comparator used for building the tree.
+        */
+        template <typename Q, typename Less>
+        value_type * find_prev_with( Q const& key, Less pred ) const
+        {
+            typedef ellen_bintree::details::compare<
+                key_type,
+                value_type,
+                opt::details::make_comparator_from_less<Less>,
+                node_traits
+            > compare_functor;
+
+            return find_prev_( key, compare_functor());
+        }
+
+        /// Calls \p f for each item with key in range <tt>[from, to]</tt>
+        /** \anchor cds_intrusive_EllenBinTree_rcu_for_each_range
+            The function visits in ascending key order all items whose key \p k satisfies <tt>from <= k <= to</tt>.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor may change non-key fields of \p item only;
+            it should not call any modifying member function of the tree.
+
+            The scan starts from the lower bound of \p from and repeatedly moves to the successor
+            of the item just visited, so its cost is <tt>O(M log N)</tt> where \p M is the number of items visited.
+            The scan is not a snapshot: an item inserted into or removed from the range concurrently
+            may or may not be visited. The keys passed to \p f are strictly increasing.
+
+            The function applies RCU lock internally for the whole scan, so the reclamation
+            is delayed until the scan is done. Keep the range reasonably short.
+
+            The function returns the number of items visited.
+        */
+        template <typename Q, typename Func>
+        size_t for_each_range( Q const& from, Q const& to, Func f ) const
+        {
+            return for_each_range_( from, to, node_compare(), f );
+        }
+
+        /// Calls \p f for each item in range <tt>[from, to]</tt> using \p pred predicate for key comparing
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_for_each_range "for_each_range(Q const&, Q const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less and should meet \ref cds_intrusive_EllenBinTree_rcu_less
+            "Predicate requirements".
+            \p pred must imply the same element order as the comparator used for building the tree.
+        */
+        template <typename Q, typename Less, typename Func>
+        size_t for_each_range_with( Q const& from, Q const& to, Less pred, Func f ) const
+        {
+            typedef ellen_bintree::details::compare<
+                key_type,
+                value_type,
+                opt::details::make_comparator_from_less<Less>,
+                node_traits
+            > compare_functor;
+
+            return for_each_range_( from, to, compare_functor(), f );
+        }
+
         /// Checks if the tree is empty
         bool empty() const
         {
@@ -1633,6 +1760,142 @@ namespace cds { namespace intrusive {
             return true;
         }
 
+        template <typename KeyValue, typename Compare>
+        leaf_node * search_next( KeyValue const& key, Compare cmp, bool bInclusive ) const
+        {
+            // Finds the leftmost leaf with key > key (or >= key if bInclusive is true).
+            // The fork is the deepest node where the search path turns left;
+            // if the leaf found by the search is not suitable, the answer is the leftmost leaf
+            // of the fork's right subtree
+            assert( gc::is_locked() );
+
+            internal_node * pParent;
+            internal_node * pFork;
+            tree_node *     pLeaf;
+            update_ptr      updParent;
+            update_ptr      updFork;
+            int nCmp;
+
+        retry:
+            pFork = nullptr;
+            pLeaf = const_cast<internal_node *>( &m_Root );
+            while ( pLeaf->is_internal() ) {
+                pParent = static_cast<internal_node *>( pLeaf );
+                updParent = pParent->m_pUpdate.load( memory_model::memory_order_acquire );
+
+                switch ( updParent.bits() ) {
+                    case update_desc::DFlag:
+                    case update_desc::Mark:
+                        m_Stat.onSearchRetry();
+                        goto retry;
+                }
+
+                nCmp = cmp( key, *pParent );
+                if ( nCmp < 0 ) {
+                    pFork = pParent;
+                    updFork = updParent;
+                }
+                pLeaf = nCmp < 0 ? pParent->m_pLeft.load( memory_model::memory_order_acquire )
+                                 : pParent->m_pRight.load( memory_model::memory_order_acquire );
+            }
+
+            nCmp = cmp( key, *static_cast<leaf_node *>( pLeaf ));
+            if ( nCmp > 0 || ( nCmp == 0 && !bInclusive )) {
+                if ( !pFork )
+                    return nullptr;
+
+                // Get leftmost leaf of the fork's right subtree
+                pLeaf = pFork->m_pRight.load( memory_model::memory_order_acquire );
+                if ( pFork->m_pUpdate.load( memory_model::memory_order_acquire ) != updFork ) {
+                    m_Stat.onSearchRetry();
+                    goto retry;
+                }
+                while ( pLeaf->is_internal() ) {
+                    pParent = static_cast<internal_node *>( pLeaf );
+                    updParent = pParent->m_pUpdate.load( memory_model::memory_order_acquire );
+                    switch ( updParent.bits() ) {
+                        case update_desc::DFlag:
+                        case update_desc::Mark:
+                            m_Stat.onSearchRetry();
+                            goto retry;
+                    }
+                    pLeaf = pParent->m_pLeft.load( memory_model::memory_order_acquire );
+                }
+            }
+
+            if ( pLeaf->infinite_key())
+                return nullptr;
+            return static_cast<leaf_node *>( pLeaf );
+        }
+
+        template <typename KeyValue, typename Compare>
+        leaf_node * search_prev( KeyValue const& key, Compare cmp ) const
+        {
+            // Finds the rightmost leaf with key < key.
+            // The fork is the deepest node where the search path turns right;
+            // if the leaf found by the search is not suitable, the answer is the rightmost leaf
+            // of the fork's left subtree
+            assert( gc::is_locked() );
+
+            internal_node * pParent;
+            internal_node * pFork;
+            tree_node *     pLeaf;
+            update_ptr      updParent;
+            update_ptr      updFork;
+            int nCmp;
+
+        retry:
+            pFork = nullptr;
+            pLeaf = const_cast<internal_node *>( &m_Root );
+            while ( pLeaf->is_internal() ) {
+                pParent = static_cast<internal_node *>( pLeaf );
+                updParent = pParent->m_pUpdate.load( memory_model::memory_order_acquire );
+
+                switch ( updParent.bits() ) {
+                    case update_desc::DFlag:
+                    case update_desc::Mark:
+                        m_Stat.onSearchRetry();
+                        goto retry;
+                }
+
+                nCmp = cmp( key, *pParent );
+                if ( nCmp >= 0 ) {
+                    pFork = pParent;
+                    updFork = updParent;
+                }
+                pLeaf = nCmp < 0 ? pParent->m_pLeft.load( memory_model::memory_order_acquire )
+                                 : pParent->m_pRight.load( memory_model::memory_order_acquire );
+            }
+
+            if ( pLeaf->infinite_key() || cmp( key, *static_cast<leaf_node *>( pLeaf )) <= 0 ) {
+                if ( !pFork )
+                    return nullptr;
+
+                // Get rightmost leaf of the fork's left subtree
+                pLeaf = pFork->m_pLeft.load( memory_model::memory_order_acquire );
+                if ( pFork->m_pUpdate.load( memory_model::memory_order_acquire ) != updFork ) {
+                    m_Stat.onSearchRetry();
+                    goto retry;
+                }
+                while ( pLeaf->is_internal() ) {
+                    pParent = static_cast<internal_node *>( pLeaf );
+                    updParent = pParent->m_pUpdate.load( memory_model::memory_order_acquire );
+                    switch ( updParent.bits() ) {
+                        case update_desc::DFlag:
+                        case update_desc::Mark:
+                            m_Stat.onSearchRetry();
+                            goto retry;
+                    }
+                    pLeaf = pParent->infinite_key() ? pParent->m_pLeft.load( memory_model::memory_order_acquire )
+                                                    : pParent->m_pRight.load( memory_model::memory_order_acquire );
+                }
+            }
+
+            if ( pLeaf->infinite_key())
+                return nullptr;
+            return static_cast<leaf_node *>( pLeaf );
+        }
+
         template <typename Q, typename Compare, typename Equal, typename Func>
         bool erase_( Q const& val, Compare cmp, Equal eq, Func f )
         {
@@ -1950,6 +2213,48 @@ namespace cds { namespace intrusive {
         }
 
 
+        template <typename Q, typename Compare>
+        value_type * find_next_( Q const& key, Compare cmp ) const
+        {
+            leaf_node * pLeaf = search_next( key, cmp, false );
+            if ( pLeaf ) {
+                m_Stat.onFindSuccess();
+                return node_traits::to_value_ptr( pLeaf );
+            }
+
+            m_Stat.onFindFailed();
+            return nullptr;
+        }
+
+        template <typename Q, typename Compare>
+        value_type * find_prev_( Q const& key, Compare cmp ) const
+        {
+            leaf_node * pLeaf = search_prev( key, cmp );
+            if ( pLeaf ) {
+                m_Stat.onFindSuccess();
+                return node_traits::to_value_ptr( pLeaf );
+            }
+
+            m_Stat.onFindFailed();
+            return nullptr;
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        size_t for_each_range_( Q const& from, Q const& to, Compare cmp, Func f ) const
+        {
+            size_t nCount = 0;
+
+            rcu_lock l;
+            leaf_node * pLeaf = search_next( from, cmp, true );
+            while ( pLeaf && cmp( *pLeaf, to ) <= 0 ) {
+                value_type * pVal = node_traits::to_value_ptr( pLeaf );
+                f( *pVal );
+                ++nCount;
+                pLeaf = search_next( *pVal, cmp, false );
+            }
+            return nCount;
+        }
+
         bool try_insert( value_type& val, internal_node * pNewInternal, search_result& res, retired_list& updRetire )
         {
             assert( gc::is_locked() );
@@ -5,6 +5,9 @@
 
 #include <memory>
 #include <functional>   // ref
+#include <vector>
+#include <iterator>     // distance
+#include <exception>    // exception_ptr
 #include <cds/intrusive/details/ellen_bintree_base.h>
 #include <cds/opt/compare.h>
 #include <cds/details/binary_functor_wrapper.h>
@@ -237,6 +240,32 @@ namespace cds { namespace intrusive {
                 guards.clear( Guard_helpLeaf );
             }
         };
+
+        // Result of successor/predecessor search
+        struct bound_search_result {
+            enum guard_index {
+                Guard_Fork,
+                Guard_updFork,
+                Guard_Parent,
+                Guard_Leaf,
+                Guard_updParent,
+
+                // helping
+                Guard_helpLeaf,
+
+                // end of guard indices
+                guard_count
+            };
+
+            typedef typename gc::template GuardArray< guard_count > guard_array;
+            guard_array guards;
+
+            leaf_node *         pLeaf;
+
+            bound_search_result()
+                : pLeaf( nullptr )
+            {}
+        };
         //@endcond
 
     protected:
@@ -318,6 +347,185 @@ namespace cds { namespace intrusive {
             m_Root.m_pLeft.store( &m_LeafInf1, memory_model::memory_order_relaxed );
             m_Root.m_pRight.store( &m_LeafInf2, memory_model::memory_order_release );
         }
+
+        // Bulk build support
+        // The max count of the leaves of the subtree built by one task of the parallel bulk build
+        static size_t const c_nBulkChunkSize = 4096;
+
+        // A subtree of the parallel bulk build
+        struct bulk_slot {
+            size_t                          nFirst;
+            size_t                          nLast;
+            atomics::atomic<tree_node *> *  pLink;
+            std::exception_ptr              pError;
+        };
+
+        // Frees the subtree that is not linked into the tree (the subtree of the bulk build)
+        void bulk_dispose( tree_node * pNode ) const
+        {
+            if ( !pNode )
+                return;
+            if ( pNode->is_leaf() ) {
+                free_leaf_node( node_traits::to_value_ptr( static_cast<leaf_node *>( pNode )));
+                return;
+            }
+
+            internal_node * pInternal = static_cast<internal_node *>( pNode );
+            bulk_dispose( pInternal->m_pLeft.load( memory_model::memory_order_relaxed ));
+            bulk_dispose( pInternal->m_pRight.load( memory_model::memory_order_relaxed ));
+            m_Stat.onInternalNodeDeleted();
+            free_internal_node( pInternal );
+        }
+
+        // Builds the balanced subtree of nCount leaves. nextItem() returns the next item of the sorted sequence.
+        // pMin is the leftmost leaf of the subtree; its key is the key of the parent internal node.
+        // If an exception is thrown the part of the subtree built is freed
+        template <typename NextItem>
+        tree_node * bulk_build_subtree( size_t nCount, NextItem& nextItem, leaf_node *& pMin )
+        {
+            assert( nCount > 0 );
+            if ( nCount == 1 ) {
+                pMin = node_traits::to_node_ptr( nextItem() );
+                return pMin;
+            }
+
+            tree_node * pLeft = bulk_build_subtree( nCount / 2, nextItem, pMin );
+            unique_internal_node_ptr pInternal;
+            leaf_node * pRightMin = nullptr;
+            tree_node * pRight = nullptr;
+            try {
+                pInternal.reset( alloc_internal_node() );
+                pRight = bulk_build_subtree( nCount - nCount / 2, nextItem, pRightMin );
+            }
+            catch ( ... ) {
+                if ( pInternal.get() )
+                    m_Stat.onInternalNodeDeleted();
+                bulk_dispose( pLeft );
+                throw;
+            }
+
+            // Leaf-oriented tree: the key of the internal node is the minimal key of its right subtree
+            assert( node_compare()( *pLeft, static_cast<tree_node const&>( *pRightMin )) < 0 );
+            key_extractor()( pInternal->m_Key, *node_traits::to_value_ptr( pRightMin ));
+            pInternal->m_pLeft.store( pLeft, memory_model::memory_order_relaxed );
+            pInternal->m_pRight.store( pRight, memory_model::memory_order_relaxed );
+            return pInternal.release();
+        }
+
+        // Builds the top levels of the balanced subtree of the leaves [nFirst, nLast) for the parallel bulk build.
+        // The subtrees of no more than c_nBulkChunkSize leaves are not built, they are collected into arrSlots.
+        // The internal nodes of the top levels are collected into arrTop; its keys are set when all subtrees are built
+        void bulk_build_top( size_t nFirst, size_t nLast, atomics::atomic<tree_node *>& link,
+            std::vector< bulk_slot >& arrSlots, std::vector< internal_node * >& arrTop )
+        {
+            if ( nLast - nFirst <= c_nBulkChunkSize ) {
+                bulk_slot slot;
+                slot.nFirst = nFirst;
+                slot.nLast = nLast;
+                slot.pLink = &link;
+                arrSlots.push_back( slot );
+                return;
+            }
+
+            internal_node * pInternal = alloc_internal_node();
+            link.store( pInternal, memory_model::memory_order_relaxed );
+            arrTop.push_back( pInternal );
+
+            size_t const nMid = nFirst + ( nLast - nFirst ) / 2;
+            bulk_build_top( nFirst, nMid, pInternal->m_pLeft, arrSlots, arrTop );
+            bulk_build_top( nMid, nLast, pInternal->m_pRight, arrSlots, arrTop );
+        }
+
+        // Links the subtree built to the empty tree
+        void bulk_link( tree_node * pSubtree, size_t nCount )
+        {
+            assert( m_Root.m_pLeft.load( memory_model::memory_order_relaxed ) == &m_LeafInf1 );
+            if ( !pSubtree )
+                return;
+
+            // All regular keys are in the left subtree of the internal node with key Infinite1, see try_insert()
+            internal_node * pInf1 = alloc_internal_node();
+            pInf1->infinite_key( 1 );
+            pInf1->m_pLeft.store( pSubtree, memory_model::memory_order_relaxed );
+            pInf1->m_pRight.store( &m_LeafInf1, memory_model::memory_order_relaxed );
+            m_Root.m_pLeft.store( pInf1, memory_model::memory_order_release );
+
+            m_ItemCounter += nCount;
+        }
+
+        // Builds the empty tree from nCount items of the sorted sequence; see bulk_build_subtree() for nextItem
+        template <typename NextItem>
+        void bulk_build( size_t nCount, NextItem nextItem )
+        {
+            if ( nCount == 0 )
+                return;
+
+            leaf_node * pMin;
+            tree_node * pSubtree = bulk_build_subtree( nCount, nextItem, pMin );
+            try {
+                bulk_link( pSubtree, nCount );
+            }
+            catch ( ... ) {
+                bulk_dispose( pSubtree );
+                throw;
+            }
+        }
+
+        // Builds the empty tree from nCount items of the sorted sequence in parallel.
+        // itemAt(i) returns i-th item, it may be called concurrently for different indices
+        template <typename ItemAt, typename Executor>
+        void bulk_build( size_t nCount, ItemAt const& itemAt, Executor& ex )
+        {
+            if ( nCount == 0 )
+                return;
+
+            atomics::atomic<tree_node *> root( nullptr );
+            std::vector< bulk_slot > arrSlots;
+            std::vector< internal_node * > arrTop;
+            try {
+                bulk_build_top( 0, nCount, root, arrSlots, arrTop );
+            }
+            catch ( ... ) {
+                bulk_dispose( root.load( memory_model::memory_order_relaxed ));
+                throw;
+            }
+
+            bulk_slot * pSlots = arrSlots.data();
+            ex.parallel_for( size_t(0), arrSlots.size(), [this, pSlots, &itemAt]( size_t nSlot ) {
+                bulk_slot& slot = pSlots[nSlot];
+                size_t nItem = slot.nFirst;
+                auto nextItem = [&itemAt, &nItem]() { return itemAt( nItem++ ); };
+                try {
+                    leaf_node * pMin;
+                    slot.pLink->store( bulk_build_subtree( slot.nLast - slot.nFirst, nextItem, pMin ), memory_model::memory_order_relaxed );
+                }
+                catch ( ... ) {
+                    slot.pError = std::current_exception();
+                }
+            }, 1 );
+
+            tree_node * pSubtree = root.load( memory_model::memory_order_relaxed );
+            try {
+                for ( size_t i = 0; i < arrSlots.size(); ++i ) {
+                    if ( pSlots[i].pError )
+                        std::rethrow_exception( pSlots[i].pError );
+                }
+
+                // The key of the top internal node is the key of the leftmost leaf of its right subtree
+                for ( typename std::vector< internal_node * >::const_iterator it = arrTop.begin(); it != arrTop.end(); ++it ) {
+                    tree_node * pNode = (*it)->m_pRight.load( memory_model::memory_order_relaxed );
+                    while ( pNode->is_internal() )
+                        pNode = static_cast<internal_node *>( pNode )->m_pLeft.load( memory_model::memory_order_relaxed );
+                    key_extractor()( (*it)->m_Key, *node_traits::to_value_ptr( static_cast<leaf_node *>( pNode )));
+                }
+
+                bulk_link( pSubtree, nCount );
+            }
+            catch ( ... ) {
+                bulk_dispose( pSubtree );
+                throw;
+            }
+        }
         //@endcond
 
     public:
@@ -328,6 +536,51 @@ namespace cds { namespace intrusive {
             make_empty_tree();
         }
 
+        /// Bulk-load constructor
+        /** \anchor cds_intrusive_EllenBinTree_bulk_ctor
+            Builds the balanced tree from the items of the sequence <tt>[first, last)</tt> in O(N) time without any search:
+            the tree is built bottom-up in one pass over the sequence. The type of \p *first should be \p value_type&.
+            The items should be sorted in ascending order of the keys and all the keys should be different,
+            it is checked by an assertion in debug mode only.
+
+            If an exception is thrown (by the internal node allocator) the items passed are disposed.
+            After the construction the object is a usual concurrent tree; the tree is not rebalanced by the following updates.
+        */
+        template <typename ForwardIterator>
+        EllenBinTree( ForwardIterator first, ForwardIterator last )
+        {
+            static_assert( (!std::is_same< key_extractor, opt::none >::value), "The key extractor option must be specified" );
+            make_empty_tree();
+
+            bulk_build( static_cast<size_t>( std::distance( first, last )), [&first]() -> value_type * {
+                value_type * pVal = &*first;
+                ++first;
+                return pVal;
+            });
+        }
+
+        /// Parallel bulk-load constructor
+        /**
+            The constructor is the same as \ref cds_intrusive_EllenBinTree_bulk_ctor "EllenBinTree( first, last )"
+            but the subtrees are built by the tasks of \p ex executor in parallel.
+            \p RandomAccessIterator should be a random access iterator.
+
+            \p Executor should support <tt>parallel_for( size_t nFirst, size_t nLast, Func f, size_t nGrainSize )</tt>
+            that calls <tt>f( i )</tt> for each <tt>i</tt> from <tt>[nFirst, nLast)</tt> and waits for all calls to be completed,
+            for example, \p cds::algo::work_stealing::executor. The calling thread must be attached
+            to libcds infrastructure if the executor requires it.
+        */
+        template <typename RandomAccessIterator, typename Executor>
+        EllenBinTree( RandomAccessIterator first, RandomAccessIterator last, Executor& ex )
+        {
+            static_assert( (!std::is_same< key_extractor, opt::none >::value), "The key extractor option must be specified" );
+            make_empty_tree();
+
+            bulk_build( static_cast<size_t>( last - first ), [first]( size_t nIndex ) -> value_type * {
+                return &first[nIndex];
+            }, ex );
+        }
+
         /// Clears the tree
         ~EllenBinTree()
         {
@@ -804,6 +1057,123 @@ namespace cds { namespace intrusive {
             return get_with_( dest.guard(), key, pred );
         }
 
+        /// Finds the item with minimal key greater than \p key
+        /** @anchor cds_intrusive_EllenBinTree_find_next
+            The function searches the successor of \p key, i.e. the item with the least key
+            that is strictly greater than \p key, and returns it in \p dest parameter.
+            \p key itself may or may not be in the tree.
+            If there is no such item the function returns \p false.
+
+            The search is lock-free. The item returned was in the tree at the moment the leaf
+            was reached; the path to the leaf is validated against concurrent updates the same way
+            as \ref cds_intrusive_EllenBinTree_find_val "find" does it.
+
+            The guarded pointer \p dest prevents disposer invocation for returned item,
+            see cds::gc::guarded_ptr for explanation.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+        */
+        template <typename Q>
+        bool find_next( guarded_ptr& dest, Q const& key ) const
+        {
+            return find_next_( dest.guard(), key );
+        }
+
+        /// Finds the successor of \p key using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_find_next "find_next(guarded_ptr&, Q const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less and should meet \ref cds_intrusive_EllenBinTree_less
+            "Predicate requirements".
+            \p pred must imply the same element order as the comparator used for building the tree.
+        */
+        template <typename Q, typename Less>
+        bool find_next_with( guarded_ptr& dest, Q const& key, Less pred ) const
+        {
+            return find_next_with_( dest.guard(), key, pred );
+        }
+
+        /// Finds the item with maximal key less than \p key
+        /** @anchor cds_intrusive_EllenBinTree_find_prev
+            The function searches the predecessor of \p key, i.e. the item with the greatest key
+            that is strictly less than \p key, and returns it in \p dest parameter.
+            \p key itself may or may not be in the tree.
+            If there is no such item the function returns \p false.
+
+            The same concurrency notes as for \ref cds_intrusive_EllenBinTree_find_next "find_next" apply.
+
+            The guarded pointer \p dest prevents disposer invocation for returned item,
+            see cds::gc::guarded_ptr for explanation.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+        */
+        template <typename Q>
+        bool find_prev( guarded_ptr& dest, Q const& key ) const
+        {
+            return find_prev_( dest.guard(), key );
+        }
+
+        /// Finds the predecessor of \p key using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_find_prev "find_prev(guarded_ptr&, Q const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less and should meet \ref cds_intrusive_EllenBinTree_less
+            "Predicate requirements".
+            \p pred must imply the same element order as the comparator used for building the tree.
+        */
+        template <typename Q, typename Less>
+        bool find_prev_with( guarded_ptr& dest, Q const& key, Less pred ) const
+        {
+            return find_prev_with_( dest.guard(), key, pred );
+        }
+
+        /// Calls \p f for each item with key in range <tt>[from, to]</tt>
+        /** @anchor cds_intrusive_EllenBinTree_for_each_range
+            The function visits in ascending key order all items whose key \p k satisfies <tt>from <= k <= to</tt>.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor is called while \p item is guarded, so \p item cannot be disposed during
+            the functor is executing. The functor may change non-key fields of \p item only;
+            it should not call any modifying member function of the tree.
+
+            The scan does not copy the tree: it starts from the lower bound of \p from and repeatedly
+            moves to the successor of the item just visited (see \ref cds_intrusive_EllenBinTree_find_next "find_next"),
+            so its cost is <tt>O(M log N)</tt> where \p M is the number of items visited.
+            The scan is not a snapshot: an item inserted into or removed from the range concurrently
+            may or may not be visited. However, the keys passed to \p f are strictly increasing
+            and each visited item was in the tree at the moment it was reached.
+
+            The function returns the number of items visited.
+        */
+        template <typename Q, typename Func>
+        size_t for_each_range( Q const& from, Q const& to, Func f ) const
+        {
+            return for_each_range_( from, to, node_compare(), f );
+        }
+
+        /// Calls \p f for each item in range <tt>[from, to]</tt> using \p pred predicate for key comparing
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_for_each_range "for_each_range(Q const&, Q const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less and should meet \ref cds_intrusive_EllenBinTree_less
+            "Predicate requirements".
+            \p pred must imply the same element order as the comparator used for building the tree.
+        */
+        template <typename Q, typename Less, typename Func>
+        size_t for_each_range_with( Q const& from, Q const& to, Less pred, Func f ) const
+        {
+            typedef ellen_bintree::details::compare<
+                key_type,
+                value_type,
+                opt::details::make_comparator_from_less<Less>,
+                node_traits
+            > compare_functor;
+
+            return for_each_range_( from, to, compare_functor(), f );
+        }
+
         /// Checks if the tree is empty
         bool empty() const
         {
@@ -921,14 +1291,15 @@ namespace cds { namespace intrusive {
             return false;
         }
 
-        tree_node * protect_child_node( search_result& res, internal_node * pParent, bool bRight, update_ptr updParent ) const
+        template <typename SearchResult>
+        tree_node * protect_child_node( SearchResult& res, internal_node * pParent, bool bRight, update_ptr updParent ) const
         {
             tree_node * p;
             tree_node * pn = bRight ? pParent->m_pRight.load( memory_model::memory_order_relaxed ) : pParent->m_pLeft.load( memory_model::memory_order_relaxed );
             do {
                 p = pn;
-                res.guards.assign( search_result::Guard_Leaf, static_cast<internal_node *>( p ));
-                res.guards.assign( search_result::Guard_helpLeaf, node_traits::to_value_ptr( static_cast<leaf_node *>( p ) ));
+                res.guards.assign( SearchResult::Guard_Leaf, static_cast<internal_node *>( p ));
+                res.guards.assign( SearchResult::Guard_helpLeaf, node_traits::to_value_ptr( static_cast<leaf_node *>( p ) ));
                 pn = bRight ? pParent->m_pRight.load( memory_model::memory_order_acquire ) : pParent->m_pLeft.load( memory_model::memory_order_acquire );
             } while ( p != pn );
 
@@ -940,18 +1311,19 @@ namespace cds { namespace intrusive {
             }
 
             if ( p && p->is_leaf() )
-                res.guards.copy( search_result::Guard_Leaf, search_result::Guard_helpLeaf );
-            res.guards.clear( search_result::Guard_helpLeaf );
+                res.guards.copy( SearchResult::Guard_Leaf, SearchResult::Guard_helpLeaf );
+            res.guards.clear( SearchResult::Guard_helpLeaf );
             return p;
         }
 
-        update_ptr search_protect_update( search_result& res, atomics::atomic<update_ptr> const& src ) const
+        template <typename SearchResult>
+        update_ptr search_protect_update( SearchResult& res, atomics::atomic<update_ptr> const& src ) const
         {
             update_ptr ret;
             update_ptr upd( src.load( memory_model::memory_order_relaxed ) );
             do {
                 ret = upd;
-                res.guards.assign( search_result::Guard_updParent, upd );
+                res.guards.assign( SearchResult::Guard_updParent, upd );
             } while ( ret != (upd = src.load( memory_model::memory_order_acquire )) );
             return ret;
         }
@@ -1123,6 +1495,177 @@ namespace cds { namespace intrusive {
             return true;
         }
 
+        template <typename KeyValue, typename Compare>
+        bool search_next( bound_search_result& res, KeyValue const& key, Compare cmp, bool bInclusive ) const
+        {
+            // Finds the leftmost leaf with key > key (or >= key if bInclusive is true).
+            // The fork is the deepest node where the search path turns left;
+            // if the leaf found by the search is not suitable, the answer is the leftmost leaf
+            // of the fork's right subtree
+            internal_node * pParent;
+            internal_node * pFork;
+            update_ptr      updParent;
+            update_ptr      updFork;
+            tree_node *     pLeaf;
+            int nCmp;
+
+        retry:
+            pFork = nullptr;
+            updParent = nullptr;
+            pLeaf = const_cast<internal_node *>( &m_Root );
+            while ( pLeaf->is_internal() ) {
+                res.guards.copy( bound_search_result::Guard_Parent, bound_search_result::Guard_Leaf );
+                pParent = static_cast<internal_node *>( pLeaf );
+
+                updParent = search_protect_update( res, pParent->m_pUpdate );
+
+                switch ( updParent.bits() ) {
+                    case update_desc::DFlag:
+                    case update_desc::Mark:
+                        m_Stat.onSearchRetry();
+                        goto retry;
+                }
+
+                nCmp = cmp( key, *pParent );
+                if ( nCmp < 0 ) {
+                    res.guards.copy( bound_search_result::Guard_Fork, bound_search_result::Guard_Parent );
+                    res.guards.copy( bound_search_result::Guard_updFork, bound_search_result::Guard_updParent );
+                    pFork = pParent;
+                    updFork = updParent;
+                }
+
+                pLeaf = protect_child_node( res, pParent, nCmp >= 0, updParent );
+                if ( !pLeaf ) {
+                    m_Stat.onSearchRetry();
+                    goto retry;
+                }
+            }
+
+            nCmp = cmp( key, *static_cast<leaf_node *>( pLeaf ));
+            if ( nCmp > 0 || ( nCmp == 0 && !bInclusive )) {
+                if ( !pFork )
+                    return false;
+
+                // Get leftmost leaf of the fork's right subtree
+                res.guards.copy( bound_search_result::Guard_Parent, bound_search_result::Guard_Fork );
+                res.guards.copy( bound_search_result::Guard_updParent, bound_search_result::Guard_updFork );
+                pParent = pFork;
+                updParent = updFork;
+                bool bRight = true;
+                for (;;) {
+                    pLeaf = protect_child_node( res, pParent, bRight, updParent );
+                    if ( !pLeaf ) {
+                        m_Stat.onSearchRetry();
+                        goto retry;
+                    }
+                    if ( pLeaf->is_leaf() )
+                        break;
+
+                    res.guards.copy( bound_search_result::Guard_Parent, bound_search_result::Guard_Leaf );
+                    pParent = static_cast<internal_node *>( pLeaf );
+                    updParent = search_protect_update( res, pParent->m_pUpdate );
+                    switch ( updParent.bits() ) {
+                        case update_desc::DFlag:
+                        case update_desc::Mark:
+                            m_Stat.onSearchRetry();
+                            goto retry;
+                    }
+                    bRight = false;
+                }
+            }
+
+            if ( pLeaf->infinite_key())
+                return false;
+
+            res.pLeaf = static_cast<leaf_node *>( pLeaf );
+            return true;
+        }
+
+        template <typename KeyValue, typename Compare>
+        bool search_prev( bound_search_result& res, KeyValue const& key, Compare cmp ) const
+        {
+            // Finds the rightmost leaf with key < key.
+            // The fork is the deepest node where the search path turns right;
+            // if the leaf found by the search is not suitable, the answer is the rightmost leaf
+            // of the fork's left subtree
+            internal_node * pParent;
+            internal_node * pFork;
+            update_ptr      updParent;
+            update_ptr      updFork;
+            tree_node *     pLeaf;
+            int nCmp;
+
+        retry:
+            pFork = nullptr;
+            updParent = nullptr;
+            pLeaf = const_cast<internal_node *>( &m_Root );
+            while ( pLeaf->is_internal() ) {
+                res.guards.copy( bound_search_result::Guard_Parent, bound_search_result::Guard_Leaf );
+                pParent = static_cast<internal_node *>( pLeaf );
+
+                updParent = search_protect_update( res, pParent->m_pUpdate );
+
+                switch ( updParent.bits() ) {
+                    case update_desc::DFlag:
+                    case update_desc::Mark:
+                        m_Stat.onSearchRetry();
+                        goto retry;
+                }
+
+                nCmp = cmp( key, *pParent );
+                if ( nCmp >= 0 ) {
+                    res.guards.copy( bound_search_result::Guard_Fork, bound_search_result::Guard_Parent );
+                    res.guards.copy( bound_search_result::Guard_updFork, bound_search_result::Guard_updParent );
+                    pFork = pParent;
+                    updFork = updParent;
+                }
+
+                pLeaf = protect_child_node( res, pParent, nCmp >= 0, updParent );
+                if ( !pLeaf ) {
+                    m_Stat.onSearchRetry();
+                    goto retry;
+                }
+            }
+
+            if ( pLeaf->infinite_key() || cmp( key, *static_cast<leaf_node *>( pLeaf )) <= 0 ) {
+                if ( !pFork )
+                    return false;
+
+                // Get rightmost leaf of the fork's left subtree
+                res.guards.copy( bound_search_result::Guard_Parent, bound_search_result::Guard_Fork );
+                res.guards.copy( bound_search_result::Guard_updParent, bound_search_result::Guard_updFork );
+                pParent = pFork;
+                updParent = updFork;
+                bool bRight = false;
+                for (;;) {
+                    pLeaf = protect_child_node( res, pParent, bRight, updParent );
+                    if ( !pLeaf ) {
+                        m_Stat.onSearchRetry();
+                        goto retry;
+                    }
+                    if ( pLeaf->is_leaf() )
+                        break;
+
+                    res.guards.copy( bound_search_result::Guard_Parent, bound_search_result::Guard_Leaf );
+                    pParent = static_cast<internal_node *>( pLeaf );
+                    updParent = search_protect_update( res, pParent->m_pUpdate );
+                    switch ( updParent.bits() ) {
+                        case update_desc::DFlag:
+                        case update_desc::Mark:
+                            m_Stat.onSearchRetry();
+                            goto retry;
+                    }
+                    bRight = !pParent->infinite_key();
+                }
+            }
+
+            if ( pLeaf->infinite_key())
+                return false;
+
+            res.pLeaf = static_cast<leaf_node *>( pLeaf );
+            return true;
+        }
+
         void help( update_ptr pUpdate )
         {
             // pUpdate must be guarded!
@@ -1527,6 +2070,83 @@ namespace cds { namespace intrusive {
             return false;
         }
 
+        template <typename Q, typename Compare>
+        bool find_bound_( typename gc::Guard& guard, Q const& key, Compare cmp, bool bNext ) const
+        {
+            bound_search_result res;
+            if ( bNext ? search_next( res, key, cmp, false ) : search_prev( res, key, cmp )) {
+                assert( res.pLeaf );
+                guard.assign( node_traits::to_value_ptr( res.pLeaf ));
+                m_Stat.onFindSuccess();
+                return true;
+            }
+
+            m_Stat.onFindFailed();
+            return false;
+        }
+
+        template <typename Q>
+        bool find_next_( typename gc::Guard& guard, Q const& key ) const
+        {
+            return find_bound_( guard, key, node_compare(), true );
+        }
+
+        template <typename Q, typename Less>
+        bool find_next_with_( typename gc::Guard& guard, Q const& key, Less pred ) const
+        {
+            typedef ellen_bintree::details::compare<
+                key_type,
+                value_type,
+                opt::details::make_comparator_from_less<Less>,
+                node_traits
+            > compare_functor;
+
+            return find_bound_( guard, key, compare_functor(), true );
+        }
+
+        template <typename Q>
+        bool find_prev_( typename gc::Guard& guard, Q const& key ) const
+        {
+            return find_bound_( guard, key, node_compare(), false );
+        }
+
+        template <typename Q, typename Less>
+        bool find_prev_with_( typename gc::Guard& guard, Q const& key, Less pred ) const
+        {
+            typedef ellen_bintree::details::compare<
+                key_type,
+                value_type,
+                opt::details::make_comparator_from_less<Less>,
+                node_traits
+            > compare_functor;
+
+            return find_bound_( guard, key, compare_functor(), false );
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        size_t for_each_range_( Q const& from, Q const& to, Compare cmp, Func f ) const
+        {
+            size_t nCount = 0;
+            typename gc::Guard guard;
+            bound_search_result res;
+
+            bool bFound = search_next( res, from, cmp, true );
+            while ( bFound ) {
+                assert( res.pLeaf );
+                if ( cmp( *res.pLeaf, to ) > 0 )
+                    break;
+
+                // The item is the key for the next search so it must stay guarded
+                value_type * pVal = node_traits::to_value_ptr( res.pLeaf );
+                guard.assign( pVal );
+                f( *pVal );
+                ++nCount;
+
+                bFound = search_next( res, *pVal, cmp, false );
+            }
+            return nCount;
+        }
+
         template <typename Q>
         bool get_( typename gc::Guard& guard, Q const& val ) const
         {
@@ -942,6 +942,12 @@ namespace cds { namespace intrusive {
             return insert_at( pHead, *node_traits::to_value_ptr( pNode ) );
         }
 
+        // split-list support: returns the iterator pointing to pHead node
+        iterator iterator_at( node_type * pHead )
+        {
+            return iterator( pHead );
+        }
+
         bool insert_at( node_type * pHead, value_type& val )
         {
             link_checker::is_empty( node_traits::to_node_ptr( val ) );
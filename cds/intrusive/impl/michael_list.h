@@ -914,6 +914,12 @@ namespace cds { namespace intrusive {
             return insert_at( refHead, *node_traits::to_value_ptr( pNode ) );
         }
 
+        // split-list support: returns the iterator pointing to the node refHead refers to
+        iterator iterator_at( atomic_node_ptr const& refHead )
+        {
+            return iterator( refHead );
+        }
+
         bool insert_at( atomic_node_ptr& refHead, value_type& val )
         {
             node_type * pNode = node_traits::to_node_ptr( val );
@@ -6,6 +6,9 @@
 #include <type_traits>
 #include <memory>
 #include <functional>   // ref
+#include <vector>
+#include <limits>
+#include <exception>    // exception_ptr
 #include <cds/intrusive/details/skip_list_base.h>
 #include <cds/opt/compare.h>
 #include <cds/details/binary_functor_wrapper.h>
@@ -387,6 +390,14 @@ namespace cds { namespace intrusive {
 
         //@cond
         static unsigned int const c_nMinHeight = 5;
+
+        // The count of the nodes linked by one task of the parallel bulk build
+        static size_t const c_nBulkChunkSize = 4096;
+
+        // The level of the search path remembered by the finger
+        static unsigned int const c_nFingerLevel = 2;
+        // Max count of the steps to the right on the top level of the finger
+        static unsigned int const c_nFingerSteps = 2;
         //@endcond
 
     protected:
@@ -416,9 +427,73 @@ namespace cds { namespace intrusive {
             typename gc::template GuardArray< c_nMaxHeight * 2 > guards  ;   ///< Guards array for pPrev/pSucc
 
             node_type *   pCur  ;   // guarded by guards; needed only for *ensure* function
+            unsigned int  nLevel;   // the level where the search has been stopped
+        };
+
+        enum finger_search_result {
+            finger_found,
+            finger_not_found,
+            finger_abort
         };
         //@endcond
 
+    public:
+        /// Search finger
+        /**
+            The finger remembers a node of the search path of the last operation to start the next search
+            from that node instead of the head of the skip-list. It speeds up the workloads where
+            each thread accesses the keys in ascending order or the keys located close to each other:
+            the search starts from the finger if the key is greater than the finger key
+            and the finger node is not deleted, otherwise the search starts from the head as usual.
+
+            The finger node is protected by the GC's guard owned by the finger object, so each finger
+            requires one additional hazard pointer. The finger is a thread-local object,
+            it cannot be shared between threads. The finger may be used with one skip-list object only,
+            and it must be destroyed before the skip-list.
+
+            Usage:
+            \code
+            typedef cds::intrusive::SkipListSet< cds::gc::HP, foo, my_traits > skip_list;
+            skip_list theList;
+            // ...
+            skip_list::finger f;
+            for ( int key = nFirst; key < nLast; ++key )
+                theList.find( f, key );
+            \endcode
+        */
+        class finger
+        {
+            //@cond
+            friend class SkipListSet;
+
+            typename gc::Guard  m_Guard;
+            SkipListSet const * m_pSet;
+            node_type *         m_pNode;
+            unsigned int        m_nLevel;
+            //@endcond
+
+        public:
+            /// Creates an empty finger
+            finger()
+                : m_pSet( nullptr )
+                , m_pNode( nullptr )
+                , m_nLevel( 0 )
+            {}
+
+            /// Clears the finger, the next search will start from the head of the skip-list
+            void reset()
+            {
+                m_pNode = nullptr;
+                m_Guard.clear();
+            }
+
+            /// Checks if the finger is empty
+            bool empty() const
+            {
+                return m_pNode == nullptr;
+            }
+        };
+
     protected:
         skip_list::details::head_node< node_type >      m_Head  ;   ///< head tower (max height)
 
@@ -508,8 +583,10 @@ namespace cds { namespace intrusive {
                             pPred = pCur.ptr();
                             pos.guards.copy( nLevel * 2, nLevel * 2 + 1 ) ;   // pPrev guard := cur guard
                         }
-                        else if ( nCmp == 0 && bStopIfFound )
+                        else if ( nCmp == 0 && bStopIfFound ) {
+                            pos.nLevel = static_cast<unsigned int>( nLevel );
                             goto found;
+                        }
                         else
                             break;
                     }
@@ -520,6 +597,7 @@ namespace cds { namespace intrusive {
                 pos.pSucc[ nLevel ] = pCur.ptr();
             }
 
+            pos.nLevel = 0;
             if ( nCmp != 0 )
                 return false;
 
@@ -528,6 +606,131 @@ namespace cds { namespace intrusive {
             return pCur.ptr() && nCmp == 0;
         }
 
+        template <typename Q, typename Compare >
+        finger_search_result find_position_from( finger& fng, Q const& val, position& pos, Compare cmp, bool bStopIfFound, unsigned int nHeight )
+        {
+            // The search starts from the finger node on the finger level and fills pos for the levels [0 .. fng.m_nLevel].
+            // The caller needs the insert position on the levels [0 .. nHeight - 1]
+            if ( fng.m_pSet != this ) {
+                gc::check_available_guards( c_nHazardPtrCount + 1 );
+                fng.reset();
+                fng.m_pSet = this;
+            }
+
+            node_type * pPred = fng.m_pNode;
+            if ( pPred == nullptr || fng.m_nLevel + 1 < nHeight || cmp( *node_traits::to_value_ptr( pPred ), val ) >= 0 )
+                return finger_abort;
+
+            marked_node_ptr pSucc;
+            marked_node_ptr pCur;
+            int const nTop = static_cast<int>( fng.m_nLevel );
+            unsigned int nStep = 0;
+            int nCmp = 1;
+
+            for ( int nLevel = nTop; nLevel >= 0; --nLevel ) {
+                pos.guards.assign( nLevel * 2, node_traits::to_value_ptr( pPred ));
+                while ( true ) {
+                    pCur = pos.guards.protect( nLevel * 2 + 1, pPred->next( nLevel ), gc_protect );
+                    if ( pCur.bits() ) {
+                        // pPred is logically deleted, the search should be restarted from the head
+                        return finger_abort;
+                    }
+
+                    if ( pCur.ptr() == nullptr )
+                        break;
+
+                    pSucc = pCur->next( nLevel ).load( memory_model::memory_order_relaxed );
+                    if ( pPred->next( nLevel ).load( memory_model::memory_order_relaxed ).all() != pCur.ptr() || pSucc.bits() ) {
+                        // Concurrent modification; the search from the head helps to unlink deleted pCur
+                        return finger_abort;
+                    }
+
+                    nCmp = cmp( *node_traits::to_value_ptr( pCur.ptr()), val );
+                    if ( nCmp < 0 ) {
+                        if ( nLevel == nTop && ++nStep > c_nFingerSteps ) {
+                            // val is too far from the finger
+                            return finger_abort;
+                        }
+                        pPred = pCur.ptr();
+                        pos.guards.copy( nLevel * 2, nLevel * 2 + 1 ) ;   // pPrev guard := cur guard
+                    }
+                    else if ( nCmp == 0 && bStopIfFound ) {
+                        pos.nLevel = static_cast<unsigned int>( nLevel );
+                        pos.pCur = pCur.ptr();
+                        return finger_found;
+                    }
+                    else
+                        break;
+                }
+
+                // Next level
+                pos.pPrev[ nLevel ] = pPred;
+                pos.pSucc[ nLevel ] = pCur.ptr();
+            }
+
+            pos.nLevel = 0;
+            pos.pCur = pCur.ptr();
+            return pCur.ptr() && nCmp == 0 ? finger_found : finger_not_found;
+        }
+
+        void update_finger( finger& fng, position const& pos, unsigned int nTop, bool bFound, node_type * pNew = nullptr )
+        {
+            // pos contains the search path on the levels [pos.nLevel .. nTop] (pos.pCur on pos.nLevel if bFound).
+            // pNew is the node inserted, it is linked on all its levels or it is deleted
+            // Any node of the path is guarded by pos.guards
+            unsigned int nLevel = nTop < c_nFingerLevel ? nTop : c_nFingerLevel;
+            node_type * pNode;
+            if ( bFound && nLevel <= pos.nLevel ) {
+                nLevel = pos.nLevel;
+                pNode = pos.pCur;
+            }
+            else if ( pNew && nLevel < pNew->height() )
+                pNode = pNew;
+            else
+                pNode = pos.pPrev[ nLevel ];
+
+            set_finger( fng, pNode, nLevel );
+        }
+
+        void set_finger( finger& fng, node_type * pNode, unsigned int nLevel )
+        {
+            // pNode should be guarded by the caller
+            if ( pNode == m_Head.head() )
+                fng.reset();
+            else {
+                fng.m_Guard.assign( node_traits::to_value_ptr( pNode ));
+                fng.m_pNode = pNode;
+                fng.m_nLevel = nLevel;
+            }
+        }
+
+        template <typename Q, typename Compare>
+        bool find_position_with_finger( finger& fng, Q const& val, position& pos, Compare cmp, unsigned int nHeight, unsigned int& nTop )
+        {
+            bool bFound;
+            nTop = c_nMaxHeight - 1;
+            switch ( find_position_from( fng, val, pos, cmp, true, nHeight )) {
+            case finger_found:
+                m_Stat.onFingerHit();
+                nTop = fng.m_nLevel;
+                bFound = true;
+                break;
+            case finger_not_found:
+                m_Stat.onFingerHit();
+                nTop = fng.m_nLevel;
+                bFound = false;
+                break;
+            default:
+                if ( fng.m_pNode )
+                    m_Stat.onFingerMiss();
+                bFound = find_position( val, pos, cmp, true );
+                break;
+            }
+
+            update_finger( fng, pos, nTop, bFound );
+            return bFound;
+        }
+
         bool find_min_position( position& pos )
         {
             node_type * pPred;
@@ -835,6 +1038,117 @@ namespace cds { namespace intrusive {
             return false;
         }
 
+        template <typename Q, typename Compare, typename Func>
+        finger_search_result find_fastpath_with_finger( finger& fng, Q& val, Compare cmp, Func f )
+        {
+            // Like find_fastpath() but the search starts from the finger if it is possible
+            typename gc::template GuardArray<3>  guards; // 0 - pPred, 1 - pCur, 2 - new finger node
+            node_type * pPred;
+            node_type * pFinger;
+            marked_node_ptr pCur;
+            int nTop;
+
+            if ( fng.m_pSet != this ) {
+                gc::check_available_guards( c_nHazardPtrCount + 1 );
+                fng.reset();
+                fng.m_pSet = this;
+            }
+
+            bool const bFinger = fng.m_pNode && cmp( *node_traits::to_value_ptr( fng.m_pNode ), val ) < 0;
+            if ( bFinger ) {
+                pPred = fng.m_pNode;
+                guards.assign( 0, node_traits::to_value_ptr( pPred ));
+                nTop = static_cast<int>( fng.m_nLevel );
+            }
+            else {
+                if ( fng.m_pNode )
+                    m_Stat.onFingerMiss();
+                pPred = m_Head.head();
+                nTop = static_cast<int>( m_nHeight.load( memory_model::memory_order_relaxed ) - 1 );
+            }
+
+            int const nFingerLevel = nTop < static_cast<int>( c_nFingerLevel ) ? nTop : static_cast<int>( c_nFingerLevel );
+            unsigned int nStep = 0;
+            pFinger = pPred;
+            for ( int nLevel = nTop; nLevel >= 0; --nLevel ) {
+                while ( true ) {
+                    pCur = guards.protect( 1, pPred->next( nLevel ), gc_protect );
+                    if ( pCur.bits() ) {
+                        // pPred is logically deleted, try slow-path
+                        if ( bFinger )
+                            m_Stat.onFingerMiss();
+                        return finger_abort;
+                    }
+
+                    if ( pCur.ptr() == nullptr )
+                        break;
+
+                    int nCmp = cmp( *node_traits::to_value_ptr( pCur.ptr() ), val );
+                    if ( nCmp < 0 ) {
+                        if ( bFinger && nLevel == nTop && ++nStep > c_nFingerSteps ) {
+                            // val is too far from the finger
+                            m_Stat.onFingerMiss();
+                            return finger_abort;
+                        }
+                        guards.copy( 0, 1 );
+                        pPred = pCur.ptr();
+                    }
+                    else if ( nCmp == 0 ) {
+                        // found
+                        f( *node_traits::to_value_ptr( pCur.ptr() ), val );
+                        if ( nLevel >= nFingerLevel )
+                            set_finger( fng, pCur.ptr(), static_cast<unsigned int>( nLevel ));
+                        else
+                            set_finger( fng, pFinger, static_cast<unsigned int>( nFingerLevel ));
+                        if ( bFinger )
+                            m_Stat.onFingerHit();
+                        return finger_found;
+                    }
+                    else // pCur > val - go down
+                        break;
+                }
+
+                if ( nLevel == nFingerLevel ) {
+                    pFinger = pPred;
+                    guards.copy( 2, 0 );
+                }
+            }
+
+            set_finger( fng, pFinger, static_cast<unsigned int>( nFingerLevel ));
+            if ( bFinger )
+                m_Stat.onFingerHit();
+            return finger_not_found;
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool find_with_finger_( finger& fng, Q& val, Compare cmp, Func f )
+        {
+            switch ( find_fastpath_with_finger( fng, val, cmp, f )) {
+            case finger_found:
+                m_Stat.onFindFastSuccess();
+                return true;
+            case finger_not_found:
+                m_Stat.onFindFastFailed();
+                return false;
+            default:
+                break;
+            }
+
+            position pos;
+            if ( find_position( val, pos, cmp, true )) {
+                assert( cmp( *node_traits::to_value_ptr( pos.pCur ), val ) == 0 );
+
+                update_finger( fng, pos, c_nMaxHeight - 1, true );
+                f( *node_traits::to_value_ptr( pos.pCur ), val );
+                m_Stat.onFindSlowSuccess();
+                return true;
+            }
+
+            update_finger( fng, pos, c_nMaxHeight - 1, false );
+            m_Stat.onFindSlowFailed();
+            return false;
+        }
+
         template <typename Q, typename Compare>
         bool get_with_( typename gc::Guard& guard, Q const& val, Compare cmp )
         {
@@ -955,6 +1269,166 @@ namespace cds { namespace intrusive {
             if ( nCur < nHeight )
                 m_nHeight.compare_exchange_strong( nCur, nHeight, memory_model::memory_order_release, atomics::memory_order_relaxed );
         }
+
+        // Bulk build support
+        // The first and the last node of each level of a contiguous part of the sorted sequence
+        struct bulk_chunk {
+            node_type *         pFirst[ c_nMaxHeight ];
+            node_type *         pLast[ c_nMaxHeight ];
+            size_t              nCount;
+            std::exception_ptr  pError;
+        };
+
+        // Deterministic height of i-th node of the sorted sequence: 1 + count of trailing zero bits of (i + 1).
+        // So the levels of the skip-list built form a perfect skip-list
+        static unsigned int bulk_height( size_t nIndex )
+        {
+            unsigned int nHeight = 1;
+            for ( size_t n = nIndex + 1; ( n & 1 ) == 0 && nHeight < c_nMaxHeight; n >>= 1 )
+                ++nHeight;
+            return nHeight;
+        }
+
+        // Builds the tower of the intrusive item if it has no tower yet
+        static node_type * make_bulk_tower( value_type& val, size_t nIndex )
+        {
+            node_type * pNode = node_traits::to_node_ptr( val );
+            if ( pNode->height() > 1 && pNode->get_tower() != nullptr )
+                return pNode;
+            return node_builder::make_tower( pNode, bulk_height( nIndex ));
+        }
+
+        // Links the nodes nodeAt(nFirst) ... nodeAt(nLast - 1) into the chunk.
+        // nodeAt(i) returns i-th node of the sorted sequence with its tower, or nullptr if the sequence is over.
+        // The chunk is consistent if nodeAt throws an exception
+        template <typename NodeAt>
+        void bulk_link_chunk( bulk_chunk& chunk, size_t nFirst, size_t nLast, NodeAt& nodeAt )
+        {
+            for ( unsigned int nLevel = 0; nLevel < c_nMaxHeight; ++nLevel )
+                chunk.pFirst[nLevel] = chunk.pLast[nLevel] = nullptr;
+            chunk.nCount = 0;
+
+            for ( size_t i = nFirst; i < nLast; ++i ) {
+                node_type * pNode = nodeAt( i );
+                if ( !pNode )
+                    break;
+
+                assert( chunk.pLast[0] == nullptr
+                    || key_comparator()( *node_traits::to_value_ptr( chunk.pLast[0] ), *node_traits::to_value_ptr( pNode )) < 0 );
+
+                unsigned int const nHeight = pNode->height();
+                assert( nHeight <= c_nMaxHeight );
+                for ( unsigned int nLevel = 0; nLevel < nHeight; ++nLevel ) {
+                    if ( chunk.pLast[nLevel] )
+                        chunk.pLast[nLevel]->next( nLevel ).store( marked_node_ptr( pNode ), memory_model::memory_order_relaxed );
+                    else
+                        chunk.pFirst[nLevel] = pNode;
+                    chunk.pLast[nLevel] = pNode;
+                }
+                ++chunk.nCount;
+                m_Stat.onAddNode( nHeight );
+            }
+        }
+
+        // Frees the nodes of the chunk by calling disposeNode( value_type * ) for each node.
+        // It is used when the bulk build fails: the nodes are not linked to the skip-list yet
+        template <typename DisposeNode>
+        void bulk_dispose_chunk( bulk_chunk& chunk, DisposeNode disposeNode )
+        {
+            node_type * pNode = chunk.pFirst[0];
+            while ( pNode ) {
+                node_type * pNext = pNode == chunk.pLast[0] ? nullptr : pNode->next( 0 ).load( memory_model::memory_order_relaxed ).ptr();
+                m_Stat.onRemoveNode( pNode->height() );
+                disposeNode( node_traits::to_value_ptr( pNode ));
+                pNode = pNext;
+            }
+            for ( unsigned int nLevel = 0; nLevel < c_nMaxHeight; ++nLevel )
+                chunk.pFirst[nLevel] = chunk.pLast[nLevel] = nullptr;
+            chunk.nCount = 0;
+        }
+
+        // Releases the tower built by make_bulk_tower, the item itself is not disposed
+        static void dispose_bulk_tower( value_type * pVal )
+        {
+            typename node_builder::node_disposer()( node_traits::to_node_ptr( pVal ));
+        }
+
+        // Links the chunks to the head of the empty skip-list
+        void bulk_stitch( bulk_chunk const * pChunks, size_t nChunkCount )
+        {
+            assert( m_Head.head()->next( 0 ).load( memory_model::memory_order_relaxed ).ptr() == nullptr );
+
+            unsigned int nHeight = 1;
+            for ( unsigned int nLevel = 0; nLevel < c_nMaxHeight; ++nLevel ) {
+                node_type * pPred = m_Head.head();
+                for ( size_t i = 0; i < nChunkCount; ++i ) {
+                    if ( pChunks[i].pFirst[nLevel] ) {
+                        assert( pPred == m_Head.head()
+                            || key_comparator()( *node_traits::to_value_ptr( pPred ), *node_traits::to_value_ptr( pChunks[i].pFirst[nLevel] )) < 0 );
+                        pPred->next( nLevel ).store( marked_node_ptr( pChunks[i].pFirst[nLevel] ), memory_model::memory_order_relaxed );
+                        pPred = pChunks[i].pLast[nLevel];
+                    }
+                }
+                pPred->next( nLevel ).store( marked_node_ptr(), memory_model::memory_order_relaxed );
+                if ( pPred != m_Head.head() )
+                    nHeight = nLevel + 1;
+            }
+
+            for ( size_t i = 0; i < nChunkCount; ++i )
+                m_ItemCounter += pChunks[i].nCount;
+            increase_height( nHeight );
+
+            atomics::atomic_thread_fence( memory_model::memory_order_release );
+        }
+
+        // Builds the empty skip-list from the sorted sequence of the nodes, see bulk_link_chunk for nodeAt.
+        // If nodeAt throws, the nodes built are freed by disposeNode and the skip-list stays empty:
+        // the destructor is not called when the constructor throws
+        template <typename NodeAt, typename DisposeNode>
+        void bulk_build( NodeAt nodeAt, DisposeNode disposeNode )
+        {
+            bulk_chunk chunk;
+            try {
+                bulk_link_chunk( chunk, 0, std::numeric_limits<size_t>::max(), nodeAt );
+            }
+            catch ( ... ) {
+                bulk_dispose_chunk( chunk, disposeNode );
+                throw;
+            }
+            bulk_stitch( &chunk, 1 );
+        }
+
+        // Builds the empty skip-list from the sorted sequence of nCount nodes in parallel.
+        // nodeAt may be called concurrently for different indices.
+        // If nodeAt throws, all nodes built are freed by disposeNode and the first exception is rethrown
+        template <typename NodeAt, typename DisposeNode, typename Executor>
+        void bulk_build( size_t nCount, NodeAt const& nodeAt, DisposeNode disposeNode, Executor& ex )
+        {
+            std::vector< bulk_chunk > arrChunks( ( nCount + c_nBulkChunkSize - 1 ) / c_nBulkChunkSize );
+            bulk_chunk * pChunks = arrChunks.data();
+
+            ex.parallel_for( size_t(0), arrChunks.size(), [this, pChunks, nCount, &nodeAt]( size_t nChunk ) {
+                NodeAt f( nodeAt );
+                size_t const nFirst = nChunk * c_nBulkChunkSize;
+                try {
+                    bulk_link_chunk( pChunks[nChunk], nFirst, std::min( nFirst + c_nBulkChunkSize, nCount ), f );
+                }
+                catch ( ... ) {
+                    pChunks[nChunk].pError = std::current_exception();
+                }
+            }, 1 );
+
+            for ( size_t i = 0; i < arrChunks.size(); ++i ) {
+                if ( pChunks[i].pError ) {
+                    std::exception_ptr pError = pChunks[i].pError;
+                    for ( size_t k = 0; k < arrChunks.size(); ++k )
+                        bulk_dispose_chunk( pChunks[k], disposeNode );
+                    std::rethrow_exception( pError );
+                }
+            }
+
+            bulk_stitch( pChunks, arrChunks.size() );
+        }
         //@endcond
 
     public:
@@ -975,6 +1449,64 @@ namespace cds { namespace intrusive {
             atomics::atomic_thread_fence( memory_model::memory_order_release );
         }
 
+        /// Bulk-load constructor
+        /** \anchor cds_intrusive_SkipListSet_hp_bulk_ctor
+            Builds the skip-list from the items of the sequence <tt>[first, last)</tt> in O(N) time
+            without any search: the items are linked level by level in one pass.
+            The type of \p *first should be \p value_type&. The items should be sorted in ascending order
+            of the keys and all the keys should be different, it is checked by an assertion in debug mode only.
+
+            Instead of random height an item without tower gets the deterministic height:
+            i-th item (0-based) has the height <tt>1 + </tt>(count of trailing zero bits of <tt>i + 1</tt>)
+            limited by \p c_nMaxHeight, so the levels of the skip-list built are balanced ideally.
+            After the construction the object is a usual concurrent skip-list.
+
+            If an exception is thrown while the sequence is traversed, the towers built are freed,
+            the items are not disposed and the exception is propagated to the caller.
+        */
+        template <typename InputIterator>
+        SkipListSet( InputIterator first, InputIterator last )
+            : m_Head( c_nMaxHeight )
+            , m_nHeight( c_nMinHeight )
+        {
+            static_assert( (std::is_same< gc, typename node_type::gc >::value), "GC and node_type::gc must be the same type" );
+
+            gc::check_available_guards( c_nHazardPtrCount );
+
+            bulk_build( [&first, &last]( size_t nIndex ) -> node_type * {
+                if ( first == last )
+                    return nullptr;
+                node_type * pNode = make_bulk_tower( *first, nIndex );
+                ++first;
+                return pNode;
+            }, dispose_bulk_tower );
+        }
+
+        /// Parallel bulk-load constructor
+        /**
+            The constructor is the same as \ref cds_intrusive_SkipListSet_hp_bulk_ctor "SkipListSet( first, last )"
+            but the parts of the sequence are linked by the tasks of \p ex executor in parallel.
+            \p RandomAccessIterator should be a random access iterator.
+
+            \p Executor should support <tt>parallel_for( size_t nFirst, size_t nLast, Func f, size_t nGrainSize )</tt>
+            that calls <tt>f( i )</tt> for each <tt>i</tt> from <tt>[nFirst, nLast)</tt> and waits for all calls to be completed,
+            for example, \p cds::algo::work_stealing::executor. The calling thread must be attached
+            to libcds infrastructure if the executor requires it.
+        */
+        template <typename RandomAccessIterator, typename Executor>
+        SkipListSet( RandomAccessIterator first, RandomAccessIterator last, Executor& ex )
+            : m_Head( c_nMaxHeight )
+            , m_nHeight( c_nMinHeight )
+        {
+            static_assert( (std::is_same< gc, typename node_type::gc >::value), "GC and node_type::gc must be the same type" );
+
+            gc::check_available_guards( c_nHazardPtrCount );
+
+            bulk_build( static_cast<size_t>( last - first ), [first]( size_t nIndex ) -> node_type * {
+                return make_bulk_tower( first[nIndex], nIndex );
+            }, dispose_bulk_tower, ex );
+        }
+
         /// Clears and destructs the skip-list
         ~SkipListSet()
         {
@@ -1101,6 +1633,69 @@ namespace cds { namespace intrusive {
             }
         }
 
+        /// Inserts new node using the search finger
+        /**
+            The function is an analog of \ref insert(value_type&) but the search of the insert position
+            starts from the finger \p fng if it is possible. After inserting the finger points
+            to the search path of \p val. See \ref finger class for explanation.
+        */
+        bool insert( finger& fng, value_type& val )
+        {
+            return insert( fng, val, []( value_type& ) {} );
+        }
+
+        /// Inserts new node using the search finger
+        /**
+            The function is an analog of \ref insert(value_type&, Func) but the search of the insert position
+            starts from the finger \p fng if it is possible. After inserting the finger points
+            to the search path of \p val. See \ref finger class for explanation.
+        */
+        template <typename Func>
+        bool insert( finger& fng, value_type& val, Func f )
+        {
+            typename gc::Guard gNew;
+            gNew.assign( &val );
+
+            node_type * pNode = node_traits::to_node_ptr( val );
+            scoped_node_ptr scp( pNode );
+            unsigned int nHeight = pNode->height();
+            bool bTowerMade = false;
+
+            // The finger search needs the height of new node, so the tower is built before searching
+            if ( nHeight == 1 || pNode->get_tower() == nullptr ) {
+                build_node( pNode );
+                nHeight = pNode->height();
+                bTowerMade = true;
+            }
+
+            position pos;
+            unsigned int nTop;
+            while ( true )
+            {
+                if ( find_position_with_finger( fng, val, pos, key_comparator(), nHeight, nTop )) {
+                    // scoped_node_ptr deletes the node tower if we create it
+                    if ( !bTowerMade )
+                        scp.release();
+
+                    m_Stat.onInsertFailed();
+                    return false;
+                }
+
+                if ( !insert_at_position( val, pNode, pos, f )) {
+                    m_Stat.onInsertRetry();
+                    continue;
+                }
+
+                update_finger( fng, pos, nTop, false, pNode );
+                increase_height( nHeight );
+                ++m_ItemCounter;
+                m_Stat.onAddNode( nHeight );
+                m_Stat.onInsertSuccess();
+                scp.release();
+                return true;
+            }
+        }
+
         /// Ensures that the \p val exists in the set
         /**
             The operation performs inserting or changing data with lock-free manner.
@@ -1522,6 +2117,43 @@ namespace cds { namespace intrusive {
             return find_with_( val, cds::opt::details::make_comparator_from_less<Less>(), [](value_type& , Q const& ) {} );
         }
 
+        /// Finds the key \p val using the search finger
+        /** \anchor cds_intrusive_SkipListSet_hp_find_finger_func
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_find_func "find(Q&, Func)"
+            but the search starts from the finger \p fng if \p val is greater than the finger key.
+            After searching the finger points to the search path of \p val.
+            See \ref finger class for explanation.
+        */
+        template <typename Q, typename Func>
+        bool find( finger& fng, Q& val, Func f )
+        {
+            return find_with_finger_( fng, val, key_comparator(), f );
+        }
+
+        /// Finds the key \p val using the search finger
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_find_finger_func "find(finger&, Q&, Func)"
+            for the const key.
+        */
+        template <typename Q, typename Func>
+        bool find( finger& fng, Q const& val, Func f )
+        {
+            return find_with_finger_( fng, val, key_comparator(), f );
+        }
+
+        /// Finds the key \p val using the search finger
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_find_val "find(Q const&)"
+            but the search starts from the finger \p fng if \p val is greater than the finger key.
+            After searching the finger points to the search path of \p val.
+            See \ref finger class for explanation.
+        */
+        template <typename Q>
+        bool find( finger& fng, Q const& val )
+        {
+            return find_with_finger_( fng, val, key_comparator(), [](value_type& , Q const& ) {} );
+        }
+
         /// Finds the key \p val and return the item found
         /** \anchor cds_intrusive_SkipListSet_hp_get
             The function searches the item with key equal to \p val
@@ -0,0 +1,606 @@
+//$$CDS-header$$
+
+#ifndef __CDS_INTRUSIVE_IMPL_SUNDELL_LIST_H
+#define __CDS_INTRUSIVE_IMPL_SUNDELL_LIST_H
+
+#include <cds/intrusive/details/sundell_list_base.h>
+#include <cds/gc/guarded_ptr.h>
+
+namespace cds { namespace intrusive {
+
+    /// Sundell-Tsigas lock-free doubly-linked list
+    /** @ingroup cds_intrusive_list
+        \anchor cds_intrusive_SundellList_hp
+
+        The list is an unordered doubly-linked sequence of items that supports concurrent
+        \p push_front(), \p push_back(), \p pop_front(), \p pop_back() and \p unlink() of an arbitrary item.
+        So, the list can be used as a lock-free deque or as a building block for LRU-like structures
+        that need O(1) removal from the middle.
+
+        Source:
+            - [2008] H.Sundell, P.Tsigas "Lock-free deques and doubly linked lists"
+
+        The \p next links form Harris-Michael single-linked list: the deletion marks the \p next pointer
+        of the node (logical deletion), then the node is unlinked from its predecessor (physical deletion).
+        Like in the original algorithm, the \p prev links are only the hints that are corrected lazily.
+
+        The original algorithm follows \p prev links of deleted nodes that requires reference-counting
+        memory reclamation. This implementation is adapted to \p gc::HP and \p gc::PTB:
+        - a \p prev link is followed only if the node that owns the link is not deleted;
+        - a thread that writes \p prev link validates the written predecessor after writing,
+            and the thread that unlinks a node fixes the \p prev link of its successor before retiring the node.
+            So, the \p prev link of a live node never points to a reclaimed node;
+        - if the hint is not valid, the predecessor is searched by \p next links starting from the hint
+            or, if the hint is deleted, from the head of the list.
+
+        Thus, \p push_back() and \p pop_back() are O(1) in the absence of contention at the tail;
+        under high contention the search from the head may be performed.
+
+        Template arguments:
+        - \p GC - Garbage collector used, possible types are \p gc::HP and \p gc::PTB.
+        - \p T - type to be stored in the list. The type must be based on \p sundell_list::node (for \p sundell_list::base_hook)
+            or it must have a member of type \p sundell_list::node (for \p sundell_list::member_hook).
+        - \p Traits - type traits. See \p sundell_list::type_traits for explanation.
+
+        It is possible to declare option-based list with \p cds::intrusive::sundell_list::make_traits metafunction
+        instead of \p Traits template argument. Template argument list \p Options of the metafunction are:
+        - opt::hook - hook used. Possible values are: sundell_list::base_hook, sundell_list::member_hook, sundell_list::traits_hook.
+            If the option is not specified, <tt>sundell_list::base_hook<></tt> and gc::HP is used.
+        - opt::back_off - back-off strategy used. If the option is not specified, the cds::backoff::Default is used.
+        - opt::disposer - the functor used for dispose removed items. Default is opt::v::empty_disposer. Due the nature
+            of GC schema the disposer may be called asynchronously.
+        - opt::link_checker - the type of node's link fields checking. Default is \ref opt::debug_check_link
+        - opt::item_counter - the type of item counting feature. Default is \ref atomicity::empty_item_counter that is no item counting.
+        - opt::memory_model - C++ memory ordering model. Can be opt::v::relaxed_ordering (relaxed memory model, the default)
+            or opt::v::sequential_consistent (sequentially consisnent memory model).
+
+        You should select GC needed and include appropriate .h-file:
+        - for gc::HP: \code #include <cds/intrusive/sundell_list_hp.h> \endcode
+        - for gc::PTB: \code #include <cds/intrusive/sundell_list_ptb.h> \endcode
+
+        Each operation uses up to six guards of \p GC per thread.
+
+        Example:
+        \code
+        #include <cds/intrusive/sundell_list_hp.h>
+
+        struct page: public cds::intrusive::sundell_list::node< cds::gc::HP >
+        {
+            int nPageNo;
+        };
+
+        struct page_disposer {
+            void operator()( page * p ) { delete p; }
+        };
+
+        typedef cds::intrusive::SundellList< cds::gc::HP, page,
+            cds::intrusive::sundell_list::make_traits<
+                cds::intrusive::opt::hook< cds::intrusive::sundell_list::base_hook< cds::opt::gc< cds::gc::HP > > >
+                ,cds::intrusive::opt::disposer< page_disposer >
+            >::type
+        > page_list;
+
+        page_list pl;
+        pl.push_front( *new page );
+
+        page_list::guarded_ptr gp;
+        if ( pl.pop_back( gp )) {
+            // gp->nPageNo is safe to read while gp is alive
+        }
+        \endcode
+    */
+    template <
+        class GC
+        ,typename T
+#ifdef CDS_DOXYGEN_INVOKED
+        ,class Traits = sundell_list::type_traits
+#else
+        ,class Traits
+#endif
+    >
+    class SundellList
+    {
+    public:
+        typedef T       value_type      ;   ///< type of value stored in the list
+        typedef Traits  options         ;   ///< Traits template parameter
+
+        typedef typename options::hook      hook        ;   ///< hook type
+        typedef typename hook::node_type    node_type   ;   ///< node type
+
+        typedef typename options::disposer  disposer    ;   ///< disposer used
+        typedef typename get_node_traits< value_type, node_type, hook>::type node_traits ;    ///< node traits
+        typedef typename sundell_list::get_link_checker< node_type, options::link_checker >::type link_checker   ;   ///< link checker
+
+        typedef GC  gc          ;   ///< Garbage collector
+        typedef typename options::back_off  back_off    ;   ///< back-off strategy
+        typedef typename options::item_counter item_counter ;   ///< Item counting policy used
+        typedef typename options::memory_model  memory_model;   ///< Memory ordering. See cds::opt::memory_model option
+
+        typedef cds::gc::guarded_ptr< gc, value_type > guarded_ptr; ///< Guarded pointer
+
+    protected:
+        //@cond
+        typedef typename node_type::atomic_marked_ptr   atomic_node_ptr ;   ///< Atomic node pointer
+        typedef typename node_type::marked_ptr          marked_node_ptr ;   ///< Node marked pointer
+
+        typedef typename gc::template GuardArray<4> search_guards;
+        enum {
+            guard_prev_item,        // predecessor found by search
+            guard_current_item,     // current node of search
+            guard_next_item,        // successor of the node being unlinked by search
+            guard_succ_item         // successor of the node being inserted or deleted
+        };
+
+        // Count of attempts to wait for the hint fixing before the search from the head
+        enum { c_nHintWaitCount = 16 };
+
+        struct clean_disposer {
+            void operator()( value_type * p )
+            {
+                sundell_list::node_cleaner<gc, node_type, memory_model>()( node_traits::to_node_ptr( p ) );
+                disposer()( p );
+            }
+        };
+        //@endcond
+
+    protected:
+        node_type       m_Head          ;   ///< Head sentinel
+        node_type       m_Tail          ;   ///< Tail sentinel
+        item_counter    m_ItemCounter   ;   ///< Item counter
+
+    public:
+        /// Initializes empty list
+        SundellList()
+        {
+            m_Head.m_pNext.store( marked_node_ptr( &m_Tail ), memory_model::memory_order_relaxed );
+            m_Tail.m_pPrev.store( &m_Head, memory_model::memory_order_release );
+        }
+
+        /// Destroys the list object
+        /**
+            The destructor calls \p clear(), the items are disposed by the garbage collector.
+        */
+        ~SundellList()
+        {
+            clear();
+        }
+
+        /// Inserts \p val at the front of the list
+        /**
+            The function always returns \p true.
+        */
+        bool push_front( value_type& val )
+        {
+            node_type * pNode = node_traits::to_node_ptr( val );
+            link_checker::is_empty( pNode );
+
+            search_guards g;
+            typename gc::Guard gNode;
+            gNode.assign( &val );
+            back_off bkoff;
+
+            marked_node_ptr pNext;
+            while ( true ) {
+                pNext = protect_next( g, guard_succ_item, m_Head.m_pNext );
+                pNode->m_pPrev.store( &m_Head, memory_model::memory_order_relaxed );
+                pNode->m_pNext.store( marked_node_ptr( pNext.ptr() ), memory_model::memory_order_relaxed );
+                if ( m_Head.m_pNext.compare_exchange_strong( pNext, marked_node_ptr( pNode ), memory_model::memory_order_seq_cst, atomics::memory_order_relaxed ))
+                    break;
+                bkoff();
+            }
+            ++m_ItemCounter;
+
+            link_prev( pNext.ptr(), &m_Head, pNode, g );
+            return true;
+        }
+
+        /// Inserts \p val at the back of the list
+        /**
+            The function always returns \p true.
+        */
+        bool push_back( value_type& val )
+        {
+            node_type * pNode = node_traits::to_node_ptr( val );
+            link_checker::is_empty( pNode );
+
+            search_guards g;
+            typename gc::Guard gNode;
+            typename gc::Guard gHint;
+            gNode.assign( &val );
+            back_off bkoff;
+
+            unsigned int nWait = 0;
+            node_type * pPrev;
+            while ( true ) {
+                pPrev = protect_prev( gHint, &m_Tail );
+                assert( pPrev != nullptr );
+
+                marked_node_ptr pNext = pPrev->m_pNext.load( memory_model::memory_order_seq_cst );
+                if ( pNext.ptr() != &m_Tail || pNext.bits() ) {
+                    if ( !hint_is_stale( pNext, nWait ))
+                        bkoff();
+                    else
+                        correct_prev( &m_Tail, pPrev, g );
+                    continue;
+                }
+
+                pNode->m_pPrev.store( pPrev, memory_model::memory_order_relaxed );
+                pNode->m_pNext.store( pNext, memory_model::memory_order_relaxed );
+                if ( pPrev->m_pNext.compare_exchange_strong( pNext, marked_node_ptr( pNode ), memory_model::memory_order_seq_cst, atomics::memory_order_relaxed ))
+                    break;
+                bkoff();
+            }
+            ++m_ItemCounter;
+
+            link_prev( &m_Tail, pPrev, pNode, g );
+            return true;
+        }
+
+        /// Extracts the item from the front of the list
+        /**
+            If the list is empty the function returns \p false.
+            Otherwise, the function unlinks the first item and returns \p true;
+            the item is returned in \p dest guarded pointer. The item will be disposed
+            by the garbage collector when \p dest is released.
+        */
+        bool pop_front( guarded_ptr& dest )
+        {
+            return do_pop_front( dest.guard() ) != nullptr;
+        }
+
+        /// Extracts the item from the back of the list
+        /**
+            The function is similar to \p pop_front() but the last item is extracted.
+        */
+        bool pop_back( guarded_ptr& dest )
+        {
+            return do_pop_back( dest.guard() ) != nullptr;
+        }
+
+        /// Unlinks the item \p val from the list
+        /**
+            The function unlinks \p val from any position of the list and returns \p true.
+            If \p val is not in the list (it has been removed by another thread), the function returns \p false.
+            The item is disposed by the garbage collector.
+
+            The memory of \p val must be valid during the call: the item must be protected by the caller,
+            for example, by \p guarded_ptr, or the disposer must not free the item.
+            The item removed and disposed concurrently is recognized by cleared link fields.
+        */
+        bool unlink( value_type& val )
+        {
+            node_type * pNode = node_traits::to_node_ptr( val );
+
+            search_guards g;
+            typename gc::Guard gNode;
+            typename gc::Guard gHint;
+            back_off bkoff;
+
+            // If the node is linked after the guard is set, it cannot be disposed until the guard is released
+            gNode.assign( &val );
+
+            while ( true ) {
+                marked_node_ptr pNext = pNode->m_pNext.load( memory_model::memory_order_seq_cst );
+                if ( pNext.bits() || !pNext.ptr() )
+                    return false;
+
+                node_type * pPrev = protect_prev( gHint, pNode );
+                if ( !pPrev )
+                    return false;
+
+                if ( pNode->m_pNext.compare_exchange_strong( pNext, marked_node_ptr( pNext.ptr(), 1 ), memory_model::memory_order_seq_cst, atomics::memory_order_relaxed )) {
+                    --m_ItemCounter;
+                    unlink_marked( pPrev, pNode, g, gHint );
+                    return true;
+                }
+                bkoff();
+            }
+        }
+
+        /// Checks if the list is empty
+        /**
+            The result is approximate if the list is being changed concurrently.
+        */
+        bool empty() const
+        {
+            return m_Head.m_pNext.load( memory_model::memory_order_relaxed ).ptr() == &m_Tail;
+        }
+
+        /// Returns list's item count
+        /**
+            The value returned depends on opt::item_counter option. For atomicity::empty_item_counter,
+            this function always returns 0.
+
+            <b>Warning</b>: even if you use real item counter and it returns 0, this fact is not mean that the list
+            is empty. To check list emptyness use \ref empty() method.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter.value();
+        }
+
+        /// Clears the list
+        /**
+            The function pops all items from the front of the list.
+            The items are disposed by the garbage collector.
+        */
+        void clear()
+        {
+            typename gc::Guard g;
+            while ( do_pop_front( g ))
+                g.clear();
+        }
+
+    protected:
+        //@cond
+        bool is_sentinel( node_type const * p ) const
+        {
+            return p == &m_Head || p == &m_Tail;
+        }
+
+        value_type * guarded_value( node_type * p ) const
+        {
+            return p && !is_sentinel( p ) ? node_traits::to_value_ptr( *p ) : nullptr;
+        }
+
+        void retire_node( node_type * pNode )
+        {
+            assert( pNode != nullptr );
+            gc::template retire<clean_disposer>( node_traits::to_value_ptr( *pNode ) );
+        }
+
+        marked_node_ptr protect_next( search_guards& g, size_t nIndex, atomic_node_ptr& src ) const
+        {
+            marked_node_ptr p;
+            do {
+                p = src.load( memory_model::memory_order_acquire );
+                g.assign( nIndex, guarded_value( p.ptr() ));
+            } while ( p != src.load( memory_model::memory_order_acquire ));
+            return p;
+        }
+
+        marked_node_ptr protect_next( typename gc::Guard& g, atomic_node_ptr& src ) const
+        {
+            marked_node_ptr p;
+            do {
+                p = src.load( memory_model::memory_order_acquire );
+                g.assign( guarded_value( p.ptr() ));
+            } while ( p != src.load( memory_model::memory_order_acquire ));
+            return p;
+        }
+
+        // Protects the prev hint of pNode
+        // Returns nullptr if pNode is deleted since the hint of deleted node may refer to reclaimed node
+        node_type * protect_prev( typename gc::Guard& g, node_type * pNode ) const
+        {
+            while ( true ) {
+                node_type * pPrev = pNode->m_pPrev.load( memory_model::memory_order_acquire );
+                g.assign( guarded_value( pPrev ));
+                if ( pNode->m_pPrev.load( memory_model::memory_order_seq_cst ) == pPrev ) {
+                    if ( pNode->m_pNext.load( memory_model::memory_order_seq_cst ).bits() )
+                        return nullptr;
+                    return pPrev;
+                }
+            }
+        }
+
+        // pNext is the value of m_pNext of the hint that is not equal to the expected successor.
+        // If the hint is deleted, its deleter is going to fix the hint soon, so we wait for a while
+        bool hint_is_stale( marked_node_ptr pNext, unsigned int& nWait ) const
+        {
+            if ( pNext.bits() && ++nWait < c_nHintWaitCount )
+                return false;
+            nWait = 0;
+            return true;
+        }
+
+        // Searches the predecessor of pTarget by next links starting from pStart.
+        // pStart must be protected by the caller or be the head.
+        // Returns the predecessor protected by guard_prev_item slot,
+        // or nullptr if pTarget is not found, that is, pTarget has been unlinked.
+        node_type * search_prev( node_type * pTarget, node_type * pStart, search_guards& g )
+        {
+            back_off bkoff;
+
+        try_again:
+            node_type * pPred = pStart;
+            g.assign( guard_prev_item, guarded_value( pPred ));
+            while ( true ) {
+                marked_node_ptr pCur = protect_next( g, guard_current_item, pPred->m_pNext );
+                if ( pCur.bits() ) {
+                    // pPred has been deleted, the search starts from the head
+                    pStart = &m_Head;
+                    bkoff();
+                    goto try_again;
+                }
+
+                if ( pCur.ptr() == pTarget )
+                    return pPred;
+                if ( pCur.ptr() == &m_Tail )
+                    return nullptr;
+
+                if ( pCur->m_pNext.load( memory_model::memory_order_acquire ).bits() ) {
+                    // pCur is deleted, help to unlink it
+                    if ( !help_unlink( pPred, pCur.ptr(), g ))
+                        bkoff();
+                    continue;
+                }
+
+                g.copy( guard_prev_item, guard_current_item );
+                pPred = pCur.ptr();
+            }
+        }
+
+        // Unlinks deleted node pCur from its predecessor pPred during the search
+        bool help_unlink( node_type * pPred, node_type * pCur, search_guards& g )
+        {
+            // The next link of deleted node is frozen.
+            // pNext cannot be unlinked while pCur is linked, so pNext is safe if pPred->m_pNext == pCur
+            node_type * pNext = pCur->m_pNext.load( memory_model::memory_order_acquire ).ptr();
+            g.assign( guard_next_item, guarded_value( pNext ));
+
+            marked_node_ptr cur( pCur );
+            if ( pPred->m_pNext.compare_exchange_strong( cur, marked_node_ptr( pNext ), memory_model::memory_order_seq_cst, atomics::memory_order_relaxed )) {
+                // The search may not be nested, so the hint of pNext is reset to the head if pPred is not valid hint
+                node_type * p = pCur;
+                if ( pNext->m_pPrev.compare_exchange_strong( p, pPred, memory_model::memory_order_seq_cst, atomics::memory_order_relaxed )
+                    && pPred->m_pNext.load( memory_model::memory_order_seq_cst ) != marked_node_ptr( pNext ))
+                {
+                    p = pPred;
+                    pNext->m_pPrev.compare_exchange_strong( p, &m_Head, memory_model::memory_order_seq_cst, atomics::memory_order_relaxed );
+                }
+                retire_node( pCur );
+                return true;
+            }
+            return false;
+        }
+
+        // Sets the prev hint of pNode to its actual predecessor.
+        // pNode and pHint must be protected by the caller outside of the search guards.
+        void correct_prev( node_type * pNode, node_type * pHint, search_guards& g )
+        {
+            while ( true ) {
+                node_type * pStart = pHint->m_pNext.load( memory_model::memory_order_seq_cst ).bits() ? &m_Head : pHint;
+                node_type * pPred = search_prev( pNode, pStart, g );
+                if ( !pPred )
+                    return;
+
+                node_type * p = pNode->m_pPrev.load( memory_model::memory_order_acquire );
+                if ( p != pPred && !pNode->m_pPrev.compare_exchange_strong( p, pPred, memory_model::memory_order_seq_cst, atomics::memory_order_relaxed ))
+                    continue;
+
+                // Validate after writing: the predecessor must be adjacent to pNode,
+                // otherwise the hint can outlive the predecessor
+                if ( pPred->m_pNext.load( memory_model::memory_order_seq_cst ) == marked_node_ptr( pNode )
+                    || pNode->m_pNext.load( memory_model::memory_order_seq_cst ).bits() )
+                {
+                    return;
+                }
+
+                // pPred may be unlinked and retired; the next search releases its guard,
+                // so the hint is reset to the head before: protect_prev() must not validate a guard against freed node
+                p = pPred;
+                pNode->m_pPrev.compare_exchange_strong( p, &m_Head, memory_model::memory_order_seq_cst, atomics::memory_order_relaxed );
+            }
+        }
+
+        // Fixes the prev hint of pSucc after pNode has been linked between pPred and pSucc
+        // pSucc must be protected by guard_succ_item or be the tail, pNode must be protected by the caller
+        void link_prev( node_type * pSucc, node_type * pPred, node_type * pNode, search_guards& g )
+        {
+            node_type * p = pPred;
+            if ( pSucc->m_pPrev.compare_exchange_strong( p, pNode, memory_model::memory_order_seq_cst, atomics::memory_order_relaxed )
+                && pNode->m_pNext.load( memory_model::memory_order_seq_cst ) != marked_node_ptr( pSucc ))
+            {
+                correct_prev( pSucc, pNode, g );
+            }
+        }
+
+        // Physically deletes marked node pNode; pPred is a hint for the predecessor protected by gHint
+        void unlink_marked( node_type * pPred, node_type * pNode, search_guards& g, typename gc::Guard& gHint )
+        {
+            back_off bkoff;
+            while ( true ) {
+                marked_node_ptr cur( pNode );
+                if ( pPred->m_pNext.load( memory_model::memory_order_seq_cst ) == cur ) {
+                    // pNext stays linked until pNode is unlinked, so CAS success validates the guard of pNext
+                    node_type * pNext = pNode->m_pNext.load( memory_model::memory_order_acquire ).ptr();
+                    g.assign( guard_succ_item, guarded_value( pNext ));
+                    if ( pPred->m_pNext.compare_exchange_strong( cur, marked_node_ptr( pNext ), memory_model::memory_order_seq_cst, atomics::memory_order_relaxed )) {
+                        // The hint of pNext must not refer to pNode after pNode is retired
+                        node_type * p = pNode;
+                        if ( pNext->m_pPrev.compare_exchange_strong( p, pPred, memory_model::memory_order_seq_cst, atomics::memory_order_relaxed )
+                            && pPred->m_pNext.load( memory_model::memory_order_seq_cst ) != marked_node_ptr( pNext ))
+                        {
+                            correct_prev( pNext, pPred, g );
+                        }
+                        retire_node( pNode );
+                        return;
+                    }
+                    bkoff();
+                    continue;
+                }
+
+                // pPred is not the predecessor of pNode
+                node_type * pStart = pPred->m_pNext.load( memory_model::memory_order_seq_cst ).bits() ? &m_Head : pPred;
+                pPred = search_prev( pNode, pStart, g );
+                if ( !pPred ) {
+                    // pNode has been unlinked by another thread
+                    return;
+                }
+                gHint.assign( g.template get<value_type>( guard_prev_item ));
+            }
+        }
+
+        value_type * do_pop_front( typename gc::Guard& gNode )
+        {
+            search_guards g;
+            typename gc::Guard gHint;
+            back_off bkoff;
+
+            while ( true ) {
+                marked_node_ptr pFirst = protect_next( gNode, m_Head.m_pNext );
+                if ( pFirst.ptr() == &m_Tail )
+                    return nullptr;
+
+                marked_node_ptr pNext = pFirst->m_pNext.load( memory_model::memory_order_seq_cst );
+                if ( pNext.bits() ) {
+                    // The first node is deleted but not unlinked yet
+                    help_unlink( &m_Head, pFirst.ptr(), g );
+                    continue;
+                }
+
+                if ( pFirst->m_pNext.compare_exchange_strong( pNext, marked_node_ptr( pNext.ptr(), 1 ), memory_model::memory_order_seq_cst, atomics::memory_order_relaxed )) {
+                    --m_ItemCounter;
+                    unlink_marked( &m_Head, pFirst.ptr(), g, gHint );
+                    return node_traits::to_value_ptr( *pFirst.ptr() );
+                }
+                bkoff();
+            }
+        }
+
+        value_type * do_pop_back( typename gc::Guard& gNode )
+        {
+            search_guards g;
+            typename gc::Guard gHint;
+            back_off bkoff;
+
+            unsigned int nWait = 0;
+            while ( true ) {
+                node_type * pLast = protect_prev( gNode, &m_Tail );
+                assert( pLast != nullptr );
+
+                if ( pLast == &m_Head ) {
+                    if ( m_Head.m_pNext.load( memory_model::memory_order_seq_cst ).ptr() == &m_Tail )
+                        return nullptr;
+                    correct_prev( &m_Tail, &m_Head, g );
+                    continue;
+                }
+
+                marked_node_ptr pNext = pLast->m_pNext.load( memory_model::memory_order_seq_cst );
+                if ( pNext.ptr() != &m_Tail || pNext.bits() ) {
+                    if ( !hint_is_stale( pNext, nWait ))
+                        bkoff();
+                    else
+                        correct_prev( &m_Tail, pLast, g );
+                    continue;
+                }
+
+                node_type * pPrev = protect_prev( gHint, pLast );
+                if ( !pPrev )
+                    continue;
+
+                if ( pLast->m_pNext.compare_exchange_strong( pNext, marked_node_ptr( &m_Tail, 1 ), memory_model::memory_order_seq_cst, atomics::memory_order_relaxed )) {
+                    --m_ItemCounter;
+                    unlink_marked( pPrev, pLast, g, gHint );
+                    return node_traits::to_value_ptr( *pLast );
+                }
+                bkoff();
+            }
+        }
+        //@endcond
+    };
+
+}}  // namespace cds::intrusive
+
+#endif // #ifndef __CDS_INTRUSIVE_IMPL_SUNDELL_LIST_H
@@ -5,6 +5,7 @@
 
 #include <cds/intrusive/details/michael_set_base.h>
 #include <cds/details/allocator.h>
+#include <cds/algo/parallel_for.h>
 
 namespace cds { namespace intrusive {
 
@@ -777,6 +778,50 @@ namespace cds { namespace intrusive {
             m_ItemCounter.reset();
         }
 
+        /// Clears the set by several threads (non-atomic)
+        /**
+            The function is an analog of \ref clear() but the bucket table is split into \p nThreads
+            ranges of buckets that are cleaned up in parallel, see \p cds::algo::parallel_for_range().
+            If \p nThreads is 0, the processor count is used.
+            Each worker thread is attached to the GC for the time of clearing, so the \p disposer
+            is called by (or deferred in) the worker threads.
+        */
+        void parallel_clear( size_t nThreads = 0 )
+        {
+            cds::algo::parallel_for_range( 0, bucket_count(), nThreads, [this]( size_t nFirst, size_t nLast ) {
+                for ( size_t i = nFirst; i < nLast; ++i )
+                    m_Buckets[i].clear();
+            });
+            m_ItemCounter.reset();
+        }
+
+        /// Calls \p f for each item of the set by several threads
+        /**
+            The bucket table is split into \p nThreads ranges of buckets that are traversed in parallel,
+            see \p cds::algo::parallel_for_range(). If \p nThreads is 0, the processor count is used.
+            Each worker thread is attached to the GC for the time of traversing.
+
+            The functor \p Func interface is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            \p f is called concurrently from several threads, so it should be thread-safe.
+            The function is not atomic: an item inserted or erased by other thread while \p parallel_for_each
+            is working may be visited or not.
+        */
+        template <typename Func>
+        void parallel_for_each( Func f, size_t nThreads = 0 )
+        {
+            cds::algo::parallel_for_range( 0, bucket_count(), nThreads, [this, &f]( size_t nFirst, size_t nLast ) {
+                for ( size_t i = nFirst; i < nLast; ++i ) {
+                    for ( typename bucket_type::iterator it = m_Buckets[i].begin(), itEnd = m_Buckets[i].end(); it != itEnd; ++it )
+                        f( *it );
+                }
+            });
+        }
+
 
         /// Checks if the set is empty
         /**
@@ -6,6 +6,7 @@
 #include <mutex>
 #include <cds/intrusive/details/base.h>
 #include <cds/details/marked_ptr.h>
+#include <cds/details/static_functor.h>
 #include <cds/algo/int_algo.h>
 #include <cds/lock/spinlock.h>
 #include <cds/opt/permutation.h>
@@ -571,16 +572,29 @@ namespace cds { namespace intrusive {
         /**
             The function repeatedly calls \p dequeue() until it returns \p nullptr.
             \p Disposer is called for each removed item.
+            The removed items are retired by batches of \p c_nRetireBatchSize items via \p gc::batch_retire().
         */
         template <class Disposer>
         void clear_with( Disposer )
         {
+            typedef typename gc::retired_ptr retired_ptr;
+            static size_t const c_nRetireBatchSize = 64;
+
+            retired_ptr arrRetired[c_nRetireBatchSize];
+            size_t nRetired = 0;
+
             typename gc::Guard itemGuard;
             while ( do_dequeue( itemGuard ) ) {
                 assert( itemGuard.template get<value_type>() );
-                gc::template retire<Disposer>( itemGuard.template get<value_type>() );
+                arrRetired[nRetired++] = retired_ptr( itemGuard.template get<value_type>(), cds::details::static_functor<Disposer, value_type>::call );
                 itemGuard.clear();
+
+                if ( nRetired == c_nRetireBatchSize ) {
+                    gc::batch_retire( arrRetired, arrRetired + nRetired );
+                    nRetired = 0;
+                }
             }
+            gc::batch_retire( arrRetired, arrRetired + nRetired );
         }
 
         /// Returns queue's item count
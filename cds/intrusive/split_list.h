@@ -3,7 +3,10 @@
 #ifndef __CDS_INTRUSIVE_SPLIT_LIST_H
 #define __CDS_INTRUSIVE_SPLIT_LIST_H
 
+#include <iterator>     // distance
+#include <exception>    // exception_ptr
 #include <cds/intrusive/details/split_list_base.h>
+#include <cds/algo/parallel_for.h>
 
 namespace cds { namespace intrusive {
 
@@ -340,6 +343,13 @@ namespace cds { namespace intrusive {
                 bucket_head_type h(pHead);
                 return base_class::insert_aux_node( h, pNode );
             }
+
+            typename base_class::iterator iterator_at( dummy_node_type * pHead )
+            {
+                assert( pHead != nullptr );
+                bucket_head_type h(pHead);
+                return base_class::iterator_at( h );
+            }
         };
         //@endcond
 
@@ -456,6 +466,104 @@ namespace cds { namespace intrusive {
             }
         }
 
+        // Bulk build support
+        // Returns log2 of the bucket count that inc_item_count() reaches for nItemCount items
+        size_t presplit_log2( size_t nItemCount ) const
+        {
+            size_t nLog2 = m_nBucketCountLog2.load( atomics::memory_order_relaxed );
+            while ( ( nItemCount >> nLog2 ) > m_Buckets.load_factor() && ( size_t(2) << nLog2 ) <= m_Buckets.capacity() )
+                ++nLog2;
+            return nLog2;
+        }
+
+        // Sets the bucket count for nItemCount items and initializes the buckets,
+        // so the following inserts of nItemCount items do not split any bucket.
+        // The buckets are initialized in ascending order, so the parent of each bucket is ready
+        // and the dummy node of the bucket is inserted right after the dummy node of the parent
+        void presplit( size_t nItemCount )
+        {
+            size_t const nLog2 = presplit_log2( nItemCount );
+            m_nBucketCountLog2.store( nLog2, atomics::memory_order_relaxed );
+
+            size_t const nBucketCount = size_t(1) << nLog2;
+            for ( size_t nBucket = 1; nBucket < nBucketCount; ++nBucket ) {
+                if ( m_Buckets.bucket( nBucket ) == nullptr )
+                    init_bucket( nBucket );
+            }
+        }
+
+        // Parallel version of presplit(). The parent of any bucket from [2**k, 2**(k+1)) is in [0, 2**k),
+        // so the buckets of such range are initialized in parallel
+        template <typename Executor>
+        void presplit( size_t nItemCount, Executor& ex )
+        {
+            size_t const nLog2 = presplit_log2( nItemCount );
+            m_nBucketCountLog2.store( nLog2, atomics::memory_order_relaxed );
+
+            size_t const nBucketCount = size_t(1) << nLog2;
+            for ( size_t nFirst = 1; nFirst < nBucketCount; nFirst *= 2 ) {
+                bulk_for( ex, nFirst, nFirst * 2, [this]( size_t nBucket ) {
+                    if ( m_Buckets.bucket( nBucket ) == nullptr )
+                        init_bucket( nBucket );
+                });
+            }
+        }
+
+        // Calls f(i) for each i from [nFirst, nLast) by the tasks of the executor.
+        // The executor tasks must not throw, so the first exception thrown by f is rethrown after all tasks are done
+        template <typename Executor, typename Func>
+        static void bulk_for( Executor& ex, size_t nFirst, size_t nLast, Func f )
+        {
+            atomics::atomic<bool> bFailed( false );
+            std::exception_ptr pError;
+            ex.parallel_for( nFirst, nLast, [&f, &bFailed, &pError]( size_t i ) {
+                try {
+                    f( i );
+                }
+                catch ( ... ) {
+                    if ( !bFailed.exchange( true, atomics::memory_order_relaxed ))
+                        pError = std::current_exception();
+                }
+            });
+            if ( pError )
+                std::rethrow_exception( pError );
+        }
+
+        // Calls f( item ) for each item of the set by nThreads threads.
+        // The list is ordered by bit-reversed hash, so for nSegmentCount = 2**k the items with the same
+        // nHash & (nSegmentCount - 1) == nBucket form a contiguous segment of the list that starts
+        // from the dummy node of the bucket nBucket < nSegmentCount.
+        // The segments of the current buckets are split into ranges walked by the threads.
+        // The iterator is moved to the next node before f is called, so f may unlink the item
+        template <typename Func>
+        void parallel_walk( size_t nThreads, Func f )
+        {
+            typedef typename ordered_list::iterator list_iterator;
+
+            size_t const nSegmentCount = size_t(1) << m_nBucketCountLog2.load( atomics::memory_order_relaxed );
+            cds::algo::parallel_for_range( 0, nSegmentCount, nThreads, [this, nSegmentCount, &f]( size_t nFirst, size_t nLast ) {
+                list_iterator itEnd = m_List.end();
+                for ( size_t nBucket = nFirst; nBucket < nLast; ++nBucket ) {
+                    dummy_node_type * pHead = m_Buckets.bucket( nBucket );
+                    if ( pHead == nullptr )
+                        pHead = init_bucket( nBucket );
+
+                    list_iterator it = m_List.iterator_at( pHead );
+                    while ( it != itEnd ) {
+                        node_type * pNode = node_traits::to_node_ptr( *it );
+                        if ( ( split_list::reverse_bits( pNode->m_nHash ) & ( nSegmentCount - 1 )) != nBucket )
+                            break;
+
+                        list_iterator itNext( it );
+                        ++itNext;
+                        if ( !pNode->is_dummy() )
+                            f( *it );
+                        it = itNext;
+                    }
+                }
+            });
+        }
+
         template <typename Q, typename Compare, typename Func>
         bool find_( Q& val, Compare cmp, Func f )
         {
@@ -585,6 +693,51 @@ namespace cds { namespace intrusive {
             init();
         }
 
+        /// Bulk-load constructor
+        /** \anchor cds_intrusive_SplitListSet_hp_bulk_ctor
+            Builds the split-list from the items of the sequence <tt>[first, last)</tt>; \p *first should be \p value_type&.
+            The bucket table is sized for <tt>std::distance( first, last )</tt> items with \p nLoadFactor load factor
+            and all buckets are pre-split (its dummy nodes are created) before inserting the items,
+            so each insertion searches in the bucket of \p nLoadFactor items on average and no bucket is split during the build.
+            The items may be unsorted. An item whose key is already in the set is not inserted.
+            After the construction the object is a usual concurrent set.
+        */
+        template <typename ForwardIterator
+            , typename = typename std::enable_if< !std::is_integral<ForwardIterator>::value >::type >
+        SplitListSet( ForwardIterator first, ForwardIterator last, size_t nLoadFactor = 1 )
+            : m_Buckets( static_cast<size_t>( std::distance( first, last )), nLoadFactor )
+            , m_nBucketCountLog2(1)
+        {
+            init();
+            presplit( static_cast<size_t>( std::distance( first, last )));
+            for ( ; first != last; ++first )
+                insert( *first );
+        }
+
+        /// Parallel bulk-load constructor
+        /**
+            The constructor is the same as \ref cds_intrusive_SplitListSet_hp_bulk_ctor "SplitListSet( first, last, nLoadFactor )"
+            but the buckets are pre-split and the items are inserted by the tasks of \p ex executor in parallel.
+            \p RandomAccessIterator should be a random access iterator.
+
+            \p Executor should support <tt>parallel_for( size_t nFirst, size_t nLast, Func f )</tt>
+            that calls <tt>f( i )</tt> for each <tt>i</tt> from <tt>[nFirst, nLast)</tt> and waits for all calls to be completed,
+            for example, \p cds::algo::work_stealing::executor. The executor threads and the calling thread
+            must be attached to libcds infrastructure.
+        */
+        template <typename RandomAccessIterator, typename Executor
+            , typename = typename std::enable_if< std::is_class<Executor>::value >::type >
+        SplitListSet( RandomAccessIterator first, RandomAccessIterator last, Executor& ex, size_t nLoadFactor = 1 )
+            : m_Buckets( static_cast<size_t>( last - first ), nLoadFactor )
+            , m_nBucketCountLog2(1)
+        {
+            init();
+            presplit( static_cast<size_t>( last - first ), ex );
+            bulk_for( ex, 0, static_cast<size_t>( last - first ), [this, first]( size_t i ) {
+                insert( first[i] );
+            });
+        }
+
     public:
         /// Inserts new node
         /**
@@ -1027,6 +1180,47 @@ namespace cds { namespace intrusive {
             }
         }
 
+        /// Clears the set by several threads (non-atomic)
+        /**
+            The function is an analog of \ref clear() for large sets.
+            The split-list is divided into segments by the buckets, the segments are split into \p nThreads
+            ranges that are cleaned up in parallel, see \p cds::algo::parallel_for_range().
+            If \p nThreads is 0, the processor count is used.
+            Each worker thread is attached to the GC for the time of clearing, so the \p disposer
+            is called by (or deferred in) the worker threads.
+
+            The function is not atomic: an item inserted by other thread while \p parallel_clear is working
+            may stay in the set.
+        */
+        void parallel_clear( size_t nThreads = 0 )
+        {
+            parallel_walk( nThreads, [this]( value_type& item ) { unlink( item ); } );
+        }
+
+        /// Calls \p f for each item of the set by several threads
+        /**
+            The split-list is divided into segments by the buckets, the segments are split into \p nThreads
+            ranges that are traversed in parallel, see \p cds::algo::parallel_for_range().
+            If \p nThreads is 0, the processor count is used.
+            Each worker thread is attached to the GC for the time of traversing.
+
+            The functor \p Func interface is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            \p f is called concurrently from several threads, so it should be thread-safe.
+            The functor may change non-key fields of \p item only.
+            The function is not atomic: an item inserted or erased by other thread while \p parallel_for_each
+            is working may be visited or not.
+        */
+        template <typename Func>
+        void parallel_for_each( Func f, size_t nThreads = 0 )
+        {
+            parallel_walk( nThreads, [&f]( value_type& item ) { f( item ); } );
+        }
+
     protected:
         //@cond
         template <bool IsConst>
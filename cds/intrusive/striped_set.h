@@ -6,6 +6,7 @@
 #include <cds/intrusive/details/base.h>
 #include <cds/intrusive/striped_set/adapter.h>
 #include <cds/intrusive/striped_set/striping_policy.h>
+#include <cds/algo/parallel_for.h>
 
 namespace cds { namespace intrusive {
     /// StripedSet related definitions
@@ -807,6 +808,55 @@ namespace cds { namespace intrusive {
             m_ItemCounter.reset();
         }
 
+        /// Clears the set by several threads
+        /**
+            The function is an analog of \ref clear() for large sets.
+            The calling thread locks the entire lock array, then the bucket table is split into \p nThreads
+            ranges of buckets that are cleaned up in parallel by the worker threads, see \p cds::algo::parallel_for_range().
+            If \p nThreads is 0, the processor count is used.
+        */
+        void parallel_clear( size_t nThreads = 0 )
+        {
+            // locks entire array, the workers access the buckets under the lock of the calling thread
+            scoped_full_lock sl( m_MutexPolicy );
+
+            cds::algo::parallel_for_range( 0, bucket_count(), nThreads, [this]( size_t nFirst, size_t nLast ) {
+                for ( size_t i = nFirst; i < nLast; ++i )
+                    m_Buckets[i].clear();
+            });
+            m_ItemCounter.reset();
+        }
+
+        /// Calls \p f for each item of the set by several threads
+        /**
+            The calling thread locks the entire lock array, then the bucket table is split into \p nThreads
+            ranges of buckets that are traversed in parallel by the worker threads, see \p cds::algo::parallel_for_range().
+            If \p nThreads is 0, the processor count is used.
+
+            The functor \p Func interface is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            \p f is called concurrently from several threads, so it should be thread-safe.
+            The functor may change non-key fields of \p item only and must not call the member functions of the set
+            since the set is locked.
+        */
+        template <typename Func>
+        void parallel_for_each( Func f, size_t nThreads = 0 )
+        {
+            // locks entire array, the workers access the buckets under the lock of the calling thread
+            scoped_full_lock sl( m_MutexPolicy );
+
+            cds::algo::parallel_for_range( 0, bucket_count(), nThreads, [this, &f]( size_t nFirst, size_t nLast ) {
+                for ( size_t i = nFirst; i < nLast; ++i ) {
+                    for ( typename bucket_type::iterator it = m_Buckets[i].begin(), itEnd = m_Buckets[i].end(); it != itEnd; ++it )
+                        f( *it );
+                }
+            });
+        }
+
         /// Checks if the set is empty
         /**
             Emptiness is checked by item counting: if item count is zero then the set is empty.
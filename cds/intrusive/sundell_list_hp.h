@@ -0,0 +1,9 @@
+//$$CDS-header$$
+
+#ifndef __CDS_INTRUSIVE_SUNDELL_LIST_HP_H
+#define __CDS_INTRUSIVE_SUNDELL_LIST_HP_H
+
+#include <cds/intrusive/impl/sundell_list.h>
+#include <cds/gc/hp.h>
+
+#endif // #ifndef __CDS_INTRUSIVE_SUNDELL_LIST_HP_H
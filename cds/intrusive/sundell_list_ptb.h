@@ -0,0 +1,9 @@
+//$$CDS-header$$
+
+#ifndef __CDS_INTRUSIVE_SUNDELL_LIST_PTB_H
+#define __CDS_INTRUSIVE_SUNDELL_LIST_PTB_H
+
+#include <cds/intrusive/impl/sundell_list.h>
+#include <cds/gc/ptb.h>
+
+#endif // #ifndef __CDS_INTRUSIVE_SUNDELL_LIST_PTB_H
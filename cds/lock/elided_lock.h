@@ -0,0 +1,263 @@
+//$$CDS-header$$
+
+#ifndef __CDS_LOCK_ELIDED_LOCK_H
+#define __CDS_LOCK_ELIDED_LOCK_H
+
+#include <cds/compiler/htm.h>
+#include <cds/cxx11_atomic.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/user_setup/cache_line.h>
+
+//@cond
+#ifdef CDS_CXX11_THREAD_LOCAL_SUPPORT
+#   define CDS_ELIDED_LOCK_TLS    thread_local
+#else
+#   define CDS_ELIDED_LOCK_TLS    __declspec( thread )
+#endif
+//@endcond
+
+namespace cds { namespace lock {
+
+    //@cond
+    namespace details {
+        // Locks elided by the current thread
+        // The list is changed inside the transaction only, so it is rolled back on abort
+        template <typename Tag = void>
+        struct elided_lock_list
+        {
+            static unsigned int const c_nCapacity = 16;
+
+            static CDS_ELIDED_LOCK_TLS void const * s_arrLock[c_nCapacity];
+            static CDS_ELIDED_LOCK_TLS unsigned int s_nCount;
+
+            static bool push( void const * pLock )
+            {
+                if ( s_nCount >= c_nCapacity )
+                    return false;
+                s_arrLock[ s_nCount++ ] = pLock;
+                return true;
+            }
+
+            static bool pop( void const * pLock )
+            {
+                for ( unsigned int i = s_nCount; i > 0; --i ) {
+                    if ( s_arrLock[i - 1] == pLock ) {
+                        s_arrLock[i - 1] = s_arrLock[ --s_nCount ];
+                        return true;
+                    }
+                }
+                return false;
+            }
+        };
+
+        template <typename Tag>
+        CDS_ELIDED_LOCK_TLS void const * elided_lock_list<Tag>::s_arrLock[elided_lock_list<Tag>::c_nCapacity];
+
+        template <typename Tag>
+        CDS_ELIDED_LOCK_TLS unsigned int elided_lock_list<Tag>::s_nCount = 0;
+    } // namespace details
+    //@endcond
+
+    /// \ref ElidedLock internal statistics
+    /**
+        The counters are padded by cache line from both sides. Otherwise, updating a counter
+        after a commit would abort the transactions of other threads that have read the lock word.
+    */
+    template <typename Counter = cds::atomicity::event_counter >
+    struct elided_lock_stat
+    {
+        typedef Counter counter_type;   ///< Event counter type
+
+        //@cond
+        char            pad1_[cds::c_nCacheLineSize];
+        //@endcond
+        counter_type    m_nElided       ;   ///< Count of critical sections executed transactionally without acquiring the lock
+        counter_type    m_nLockBusy     ;   ///< Count of aborts because the lock was busy
+        counter_type    m_nConflict     ;   ///< Count of aborts because of memory conflicts
+        counter_type    m_nCapacity     ;   ///< Count of aborts because of transaction buffer overflow
+        counter_type    m_nOtherAbort   ;   ///< Count of other aborts
+        counter_type    m_nFallback     ;   ///< Count of real lock acquisitions (elision failed or RTM is not supported)
+        //@cond
+        char            pad2_[cds::c_nCacheLineSize];
+        //@endcond
+
+        /// Returns total count of aborts
+        size_t abort_count() const
+        {
+            return m_nLockBusy.get() + m_nConflict.get() + m_nCapacity.get() + m_nOtherAbort.get();
+        }
+
+        //@cond
+        void onElided()     { ++m_nElided; }
+        void onFallback()   { ++m_nFallback; }
+        void onAbort( unsigned int nStatus, bool bLockBusy )
+        {
+            if ( bLockBusy )
+                ++m_nLockBusy;
+            else if ( nStatus & cds::htm::c_nAbortConflict )
+                ++m_nConflict;
+            else if ( nStatus & cds::htm::c_nAbortCapacity )
+                ++m_nCapacity;
+            else
+                ++m_nOtherAbort;
+        }
+        //@endcond
+    };
+
+    /// \ref ElidedLock dummy internal statistics
+    struct elided_lock_empty_stat
+    {
+        //@cond
+        void onElided()     {}
+        void onFallback()   {}
+        void onAbort( unsigned int /*nStatus*/, bool /*bLockBusy*/ ) {}
+        //@endcond
+    };
+
+    /// Lock with hardware lock elision
+    /**
+        The lock is a wrapper over \p Lock that tries to execute the critical section
+        as a hardware transaction (Intel RTM) without acquiring \p Lock at all.
+        The transaction reads the lock word, so it is aborted if any thread acquires \p Lock really.
+        Non-conflicting critical sections are executed in parallel.
+        After \p RetryCount aborts (or immediately if the processor reports that the retry is useless)
+        \p Lock is acquired as usual.
+
+        RTM support is detected at run-time by \p cpuid (see \p cds::htm::is_supported()).
+        If RTM is not supported, \p %ElidedLock is just \p Lock with a small overhead of the check.
+
+        The lock may be used as a lock type of \p cds::lock::array, of \p striping and \p refinable
+        policies of the striped set (\p refinable policy requires a recursive lock like \p cds::lock::ReentrantSpin),
+        and as \p opt::lock_type of \p cds::algo::flat_combining::kernel.
+
+        Template parameters:
+        - \p Lock - the lock to elide. It should provide \p lock(), \p unlock(), \p try_lock()
+            and <tt>bool is_locked() const</tt> functions, for example, \p cds::lock::Spin or \p cds::lock::ReentrantSpin.
+            For a recursive lock, \p is_locked() must return \p false for the owner thread.
+        - \p RetryCount - how many times the elision is tried before acquiring the lock
+        - \p Stat - internal statistics: \p elided_lock_stat or \p elided_lock_empty_stat (the default)
+
+        \p try_lock() acquires \p Lock really without elision: a caller of \p try_lock()
+        usually needs the real ownership (for example, flat combining elects the combiner by \p try_lock()).
+
+        Transactions are flat-nested: if the thread that has elided a lock acquires another \p %ElidedLock,
+        the nested critical section is elided too. Each thread remembers the locks it has elided,
+        so \p unlock() commits the transaction only for an elided acquisition and releases \p Lock
+        otherwise. Up to 16 locks may be elided by a thread at once, the next nested lock is acquired really.
+
+        Example:
+        \code
+        #include <cds/lock/elided_lock.h>
+        #include <cds/container/striped_set.h>
+
+        typedef cds::lock::ElidedLock< cds::lock::Spin, 3, cds::lock::elided_lock_stat<> > elided_spin;
+
+        typedef cds::container::StripedSet< std::list<int>,
+            cds::opt::mutex_policy< cds::container::striped_set::striping< elided_spin > >,
+            ...
+        > set_type;
+        \endcode
+    */
+    template <class Lock, unsigned int RetryCount = 3, class Stat = elided_lock_empty_stat >
+    class ElidedLock
+    {
+    public:
+        typedef Lock    lock_type   ;   ///< Elided lock type
+        typedef Stat    stat_type   ;   ///< Internal statistics type
+
+        static unsigned int const c_nRetryCount = RetryCount ;   ///< Elision attempt count
+
+    protected:
+        //@cond
+        static unsigned char const c_nLockBusyCode = 0xFF;
+        static unsigned char const c_nNestingCode = 0xFE;
+
+        typedef details::elided_lock_list<> elided_list;
+
+        lock_type   m_Lock;
+        stat_type   m_Stat;
+        //@endcond
+
+    public:
+        /// Constructs the lock in free state
+        ElidedLock()
+        {}
+
+        /// Dummy copy constructor, initializes the lock to free state
+        ElidedLock( ElidedLock const& )
+            : m_Lock()
+        {}
+
+        /// Locks the lock or elides it
+        void lock()
+        {
+            if ( cds::htm::is_supported() ) {
+                for ( unsigned int nTry = 0; nTry < c_nRetryCount; ++nTry ) {
+                    unsigned int nStatus = cds::htm::xbegin();
+                    if ( nStatus == cds::htm::c_nStarted ) {
+                        // Reading the lock word adds it to the read-set of the transaction
+                        if ( !m_Lock.is_locked() ) {
+                            if ( elided_list::push( this ))
+                                return;
+                            cds::htm::xabort< c_nNestingCode >();
+                        }
+                        cds::htm::xabort< c_nLockBusyCode >();
+                    }
+
+                    // The transaction is aborted
+                    bool bExplicit = (nStatus & cds::htm::c_nAbortExplicit) != 0;
+                    bool bLockBusy = bExplicit && cds::htm::abort_code( nStatus ) == c_nLockBusyCode;
+                    m_Stat.onAbort( nStatus, bLockBusy );
+                    if ( bExplicit && cds::htm::abort_code( nStatus ) == c_nNestingCode )
+                        break;
+                    if ( bLockBusy ) {
+                        // Wait until the lock is free and try again
+                        cds::backoff::hint bkoff;
+                        while ( m_Lock.is_locked() )
+                            bkoff();
+                    }
+                    else if ( !(nStatus & cds::htm::c_nAbortRetry) )
+                        break;
+                }
+            }
+
+            m_Stat.onFallback();
+            m_Lock.lock();
+        }
+
+        /// Unlocks the lock or commits the elided critical section
+        void unlock()
+        {
+            // The lock is elided only if lock() has registered the acquisition in the current transaction.
+            // The state of the lock word cannot be used: for example, ReentrantSpin is free for its owner
+            if ( cds::htm::is_supported() && cds::htm::xtest() && elided_list::pop( this )) {
+                cds::htm::xend();
+                if ( !cds::htm::xtest() )
+                    m_Stat.onElided();
+            }
+            else
+                m_Lock.unlock();
+        }
+
+        /// Tries to acquire the lock really, without elision
+        bool try_lock()
+        {
+            return m_Lock.try_lock();
+        }
+
+        /// Checks if the lock is acquired really
+        bool is_locked() const
+        {
+            return m_Lock.is_locked();
+        }
+
+        /// Returns internal statistics
+        stat_type const& statistics() const
+        {
+            return m_Stat;
+        }
+    };
+
+}} // namespace cds::lock
+
+#endif // #ifndef __CDS_LOCK_ELIDED_LOCK_H
@@ -24,6 +24,7 @@
 #include <cds/os/topology.h>
 #include <cds/os/alloc_aligned.h>
 #include <cds/lock/spinlock.h>
+#include <cds/algo/backoff_strategy.h>
 #include <cds/details/type_padding.h>
 #include <cds/details/marked_ptr.h>
 #include <cds/container/vyukov_mpmc_cycle_queue.h>
@@ -31,6 +32,7 @@
 #include <cds/details/lib.h>
 
 #include <stdlib.h>
+#include <type_traits>
 #include <boost/intrusive/list.hpp>
 
 namespace cds {
@@ -280,6 +282,69 @@ namespace michael {
         }
     };
 
+    /// Per-thread magazine of free blocks
+    /**
+        This class is an implementation of opt::thread_cache option.
+
+        Each thread keeps a private list ("magazine") of free blocks for each size-class
+        whose block size is not greater than \p MaxBlockSize. \p Heap::free pushes the block into the magazine
+        of current thread, \p Heap::alloc pops a block from it; both operations are performed
+        without any atomic operation. When the magazine size exceeds \p Capacity, \p FlushBatch
+        blocks are returned to the shared heap at once. The whole cache of the thread
+        is returned to the shared heap when the thread is detached from \p libcds
+        by \p cds::threading::Manager::detachThread.
+
+        The thread that is not attached to \p libcds bypasses the cache.
+
+        Template parameters:
+            - \p Capacity - max count of cached blocks per size-class
+            - \p MaxBlockSize - max block size (including the internal block header) that can be cached
+            - \p FlushBatch - count of blocks returned to the shared heap when the magazine is overflowed
+    */
+    template <size_t Capacity = 32, size_t MaxBlockSize = 256, size_t FlushBatch = Capacity / 2>
+    struct thread_magazine
+    {
+        static const size_t c_nCapacity = Capacity          ;   ///< Max count of cached blocks per size-class
+        static const size_t c_nMaxBlockSize = MaxBlockSize  ;   ///< Max size of cached block
+        static const size_t c_nFlushBatch = FlushBatch      ;   ///< Count of blocks flushed at once
+
+        //@cond
+        static_assert( FlushBatch > 0 && FlushBatch <= Capacity, "FlushBatch must be in range [1, Capacity]" );
+        //@endcond
+    };
+
+    //@cond
+    namespace details {
+        template <typename ThreadCache>
+        struct thread_cache_traits
+        {
+            static const bool   c_bEnabled = true;
+            static const size_t c_nCapacity = ThreadCache::c_nCapacity;
+            static const size_t c_nMaxBlockSize = ThreadCache::c_nMaxBlockSize;
+            static const size_t c_nFlushBatch = ThreadCache::c_nFlushBatch;
+        };
+
+        template <>
+        struct thread_cache_traits<cds::opt::none>
+        {
+            static const bool   c_bEnabled = false;
+            static const size_t c_nCapacity = 0;
+            static const size_t c_nMaxBlockSize = 0;
+            static const size_t c_nFlushBatch = 0;
+        };
+
+        // The page heap gathers statistics if it declares \p stat_type and \p statistics() (like \ref mmap_page_heap)
+        template <typename PageHeap>
+        struct page_heap_stat
+        {
+            template <typename T> static char test( typename T::stat_type const * );
+            template <typename T> static long test( ... );
+
+            static const bool c_bEnabled = sizeof( test<PageHeap>( nullptr )) == sizeof(char);
+        };
+    }   // namespace details
+    //@endcond
+
     //@cond
     namespace details {
         struct free_list_tag;
@@ -593,7 +658,9 @@ namespace michael {
         - \ref opt::aligned_heap - option setter for a heap used for internal aligned memory management.
             Default is \ref aligned_malloc_heap
         - \ref opt::page_heap - option setter for a heap used for page (superblock) allocation of 64K/1M size.
-            Default is \ref page_cached_allocator
+            Default is \ref page_cached_allocator. If the page heap gathers statistics of OS memory
+            (it has \p stat_type typedef and \p statistics() member function like \ref mmap_page_heap),
+            its counters are added to the OS-allocated counters of \ref summary_stat by \p summaryStat().
         - \ref opt::sizeclass_selector - option setter for a class used to select appropriate size-class
             for incoming allocation request.
             Default is \ref default_sizeclass_selector
@@ -611,6 +678,10 @@ namespace michael {
             Default is \ref os_allocated_empty
         - \ref opt::check_bounds - a bound checker.
             Default is no bound checker (cds::opt::none)
+        - \ref opt::thread_cache - per-thread cache of free blocks, for example, \ref thread_magazine.
+            Default is no per-thread cache (cds::opt::none). The heap with per-thread cache may be destroyed
+            while the threads that have used it are attached to \p libcds: the cache record of such thread
+            is freed when the thread is detached. Of course, the thread must not use the heap after its destruction.
 
         \par Usage:
         The heap is the basic building block for your allocator or <tt> operator new</tt> implementation.
@@ -707,6 +778,7 @@ namespace michael {
             typedef procheap_empty_stat         procheap_stat;
             typedef os_allocated_empty          os_allocated_stat;
             typedef cds::opt::none              check_bounds;
+            typedef cds::opt::none              thread_cache;
         };
         //@endcond
 
@@ -727,6 +799,7 @@ namespace michael {
         typedef typename options::procheap_stat         procheap_stat       ;   ///< effective processor heap statistics
         typedef typename options::os_allocated_stat     os_allocated_stat   ;   ///< effective OS-allocated memory statistics
         typedef details::bound_checker_selector< typename options::check_bounds >    bound_checker   ;  ///< effective bound checker
+        typedef details::thread_cache_traits< typename options::thread_cache >      thread_cache_traits ;  ///< effective per-thread cache traits
 
         // forward declarations
         //@cond
@@ -1158,6 +1231,32 @@ namespace michael {
         };
 
 
+        //@cond
+        /// Per-thread cache record
+        struct thread_cache_record: public cds::threading::thread_detach_hook
+        {
+            /// Magazine of cached free blocks of one size-class
+            struct magazine {
+                block_header *  pHead   ;   ///< head of the list of cached blocks
+                size_t          nCount  ;   ///< count of blocks in the magazine
+            };
+
+            /// Record state
+            enum state {
+                owned,      ///< the record is linked into the detach hooks of a thread
+                free,       ///< the record is not owned by any thread
+                detaching,  ///< the owner thread is flushing the record
+                orphan      ///< the heap is destroyed, the owner thread frees the record when it is detached
+            };
+
+            Heap *                  pHeap       ;   ///< owner heap, \p nullptr for orphan record
+            thread_cache_record *   pNextRecord ;   ///< next record in the heap's list of records
+            atomics::atomic<int>    nState      ;   ///< record state
+            magazine *              arrMagazine ;   ///< magazines, one for each size-class
+        };
+        typedef typename thread_cache_record::magazine  magazine;
+        //@endcond
+
     protected:
         sys_topology        m_Topology           ;  ///< System topology
         system_heap         m_LargeHeap          ;  ///< Heap for large block
@@ -1169,6 +1268,8 @@ namespace michael {
 
         os_allocated_stat   m_OSAllocStat        ;  ///< OS-allocated memory statistics
 
+        atomics::atomic<thread_cache_record *> m_pThreadCacheList ;   ///< list of per-thread cache records
+
     protected:
         //@cond
 
@@ -1610,6 +1711,14 @@ namespace michael {
             assert( nSizeClassIndex < m_SizeClassSelector.size() );
 
             block_header * pBlock;
+            if ( thread_cache_traits::c_bEnabled && m_SizeClassSelector.at( nSizeClassIndex )->nBlockSize <= thread_cache_traits::c_nMaxBlockSize ) {
+                thread_cache_record * pCache = get_thread_cache();
+                if ( pCache && (pBlock = pop_cached( pCache->arrMagazine[ nSizeClassIndex ] )) != nullptr ) {
+                    pBlock->desc()->pProcHeap->stat.incAllocatedBytes( pBlock->desc()->nBlockSize );
+                    return pBlock;
+                }
+            }
+
             processor_heap * pProcHeap;
             while ( true ) {
                 pProcHeap = find_heap( nSizeClassIndex );
@@ -1630,6 +1739,201 @@ namespace michael {
             return pBlock;
         }
 
+        /// Returns block \p pBlock of superblock \p pDesc to the shared heap
+        void free_block( superblock_desc * pDesc, block_header * pBlock )
+        {
+            pDesc->pProcHeap->stat.incDeallocatedBytes( pDesc->nBlockSize );
+            pDesc->pProcHeap->stat.incFreeCount();
+            release_block( pDesc, pBlock );
+        }
+
+        /// Links \p pBlock into the free list of superblock \p pDesc, the statistics is not changed
+        void release_block( superblock_desc * pDesc, block_header * pBlock )
+        {
+            anchor_tag oldAnchor;
+            anchor_tag newAnchor;
+            processor_heap_base * pProcHeap = pDesc->pProcHeap;
+
+            oldAnchor = pDesc->anchor.load(atomics::memory_order_acquire);
+            do {
+                newAnchor = oldAnchor;
+                reinterpret_cast<free_block_header *>( pBlock )->nNextFree = oldAnchor.avail;
+                newAnchor.avail = (reinterpret_cast<byte *>( pBlock ) - pDesc->pSB) / pDesc->nBlockSize;
+                newAnchor.tag += 1;
+
+                assert( oldAnchor.state != SBSTATE_EMPTY );
+
+                if ( oldAnchor.state == SBSTATE_FULL )
+                    newAnchor.state = SBSTATE_PARTIAL;
+
+                if ( oldAnchor.count == pDesc->nCapacity - 1 ) {
+                    //pProcHeap = pDesc->pProcHeap;
+                    //CDS_COMPILER_RW_BARRIER         ;   // instruction fence is needed?..
+                    newAnchor.state = SBSTATE_EMPTY;
+                }
+                else
+                    newAnchor.count += 1;
+            } while ( !pDesc->anchor.compare_exchange_strong( oldAnchor, newAnchor, atomics::memory_order_release, atomics::memory_order_relaxed ) );
+
+            if ( newAnchor.state == SBSTATE_EMPTY ) {
+                if ( pProcHeap->unlink_partial( pDesc ))
+                    free_superblock( pDesc );
+            }
+            else if (oldAnchor.state == SBSTATE_FULL ) {
+                assert( pProcHeap != nullptr );
+                pProcHeap->stat.decDescFull();
+                pProcHeap->add_partial( pDesc );
+            }
+        }
+
+        /// Detach handler of per-thread cache record
+        static void on_thread_detach( cds::threading::thread_detach_hook * pHook )
+        {
+            thread_cache_record * pRec = static_cast<thread_cache_record *>( pHook );
+            int nState = thread_cache_record::owned;
+            if ( pRec->nState.compare_exchange_strong( nState, thread_cache_record::detaching, atomics::memory_order_acquire, atomics::memory_order_relaxed )) {
+                pRec->pHeap->flush_thread_cache( pRec );
+                pRec->nState.store( thread_cache_record::free, atomics::memory_order_release );
+            }
+            else {
+                // The heap has been destroyed
+                assert( nState == thread_cache_record::orphan );
+                aligned_malloc_heap::free( pRec );
+            }
+        }
+
+        /// Returns the cache record of current thread or \p nullptr if the thread is not attached to \p libcds
+        thread_cache_record * get_thread_cache()
+        {
+            if ( !cds::threading::Manager::isThreadAttached() )
+                return nullptr;
+
+            cds::threading::ThreadData * pThreadData = cds::threading::Manager::thread_data();
+            for ( cds::threading::thread_detach_hook * pHook = pThreadData->m_pDetachHooks; pHook; pHook = pHook->m_pNextHook ) {
+                if ( pHook->m_pfnDetach == on_thread_detach && static_cast<thread_cache_record *>( pHook )->pHeap == this )
+                    return static_cast<thread_cache_record *>( pHook );
+            }
+
+            // The first call from current thread
+            thread_cache_record * pRec = acquire_thread_cache();
+            pThreadData->add_detach_hook( pRec );
+            return pRec;
+        }
+
+        /// Acquires free cache record or allocates new one
+        thread_cache_record * acquire_thread_cache()
+        {
+            for ( thread_cache_record * pRec = m_pThreadCacheList.load( atomics::memory_order_acquire ); pRec; pRec = pRec->pNextRecord ) {
+                int nState = thread_cache_record::free;
+                if ( pRec->nState.load( atomics::memory_order_relaxed ) == thread_cache_record::free
+                    && pRec->nState.compare_exchange_strong( nState, thread_cache_record::owned, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                {
+                    return pRec;
+                }
+            }
+
+            const size_t nClassCount = m_SizeClassSelector.size();
+            // The record may outlive the heap (see ~Heap), so it is allocated from the system heap
+            thread_cache_record * pRec = new( aligned_malloc_heap::alloc( sizeof(thread_cache_record) + sizeof(magazine) * nClassCount, c_nAlignment ))
+                thread_cache_record;
+            pRec->m_pfnDetach = on_thread_detach;
+            pRec->pHeap = this;
+            pRec->nState.store( thread_cache_record::owned, atomics::memory_order_relaxed );
+            pRec->arrMagazine = reinterpret_cast<magazine *>( pRec + 1 );
+            for ( size_t i = 0; i < nClassCount; ++i ) {
+                pRec->arrMagazine[i].pHead = nullptr;
+                pRec->arrMagazine[i].nCount = 0;
+            }
+
+            thread_cache_record * pHead = m_pThreadCacheList.load( atomics::memory_order_relaxed );
+            do {
+                pRec->pNextRecord = pHead;
+            } while ( !m_pThreadCacheList.compare_exchange_weak( pHead, pRec, atomics::memory_order_release, atomics::memory_order_relaxed ));
+            return pRec;
+        }
+
+        /// Pops a block from the magazine
+        static block_header * pop_cached( magazine& mag )
+        {
+            block_header * pBlock = mag.pHead;
+            if ( pBlock ) {
+                // The link to next cached block is placed just after the block header
+                mag.pHead = *reinterpret_cast<block_header **>( pBlock + 1 );
+                --mag.nCount;
+            }
+            return pBlock;
+        }
+
+        /// Pushes \p pBlock into the magazine of current thread, returns \p false if current thread has no cache
+        bool push_cached( superblock_desc * pDesc, block_header * pBlock )
+        {
+            thread_cache_record * pCache = get_thread_cache();
+            if ( !pCache )
+                return false;
+
+            // The index of the processor heap in the processor descriptor is the size-class index
+            processor_heap_base * pProcHeap = pDesc->pProcHeap;
+            magazine& mag = pCache->arrMagazine[ static_cast<processor_heap *>( pProcHeap ) - pProcHeap->pProcDesc->arrProcHeap ];
+
+            pProcHeap->stat.incDeallocatedBytes( pDesc->nBlockSize );
+            pProcHeap->stat.incFreeCount();
+
+            *reinterpret_cast<block_header **>( pBlock + 1 ) = mag.pHead;
+            mag.pHead = pBlock;
+            if ( ++mag.nCount > thread_cache_traits::c_nCapacity )
+                flush_magazine( mag, thread_cache_traits::c_nFlushBatch );
+            return true;
+        }
+
+        /// Returns \p nCount blocks from the magazine to the shared heap
+        void flush_magazine( magazine& mag, size_t nCount )
+        {
+            block_header * pBlock;
+            while ( nCount-- > 0 && (pBlock = pop_cached( mag )) != nullptr )
+                release_block( pBlock->desc(), pBlock );
+        }
+
+        /// Returns all blocks cached in \p pRec to the shared heap
+        void flush_thread_cache( thread_cache_record * pRec )
+        {
+            const size_t nClassCount = m_SizeClassSelector.size();
+            for ( size_t i = 0; i < nClassCount; ++i )
+                flush_magazine( pRec->arrMagazine[i], pRec->arrMagazine[i].nCount );
+        }
+
+        /// Frees the cache records, the records owned by other threads are left to them
+        void free_thread_cache_list()
+        {
+            thread_cache_record * pRec = m_pThreadCacheList.load( atomics::memory_order_acquire );
+            while ( pRec ) {
+                thread_cache_record * pNext = pRec->pNextRecord;
+                cds::backoff::yield bkoff;
+                while ( true ) {
+                    int nState = pRec->nState.load( atomics::memory_order_acquire );
+                    if ( nState == thread_cache_record::free ) {
+                        aligned_malloc_heap::free( pRec );
+                        break;
+                    }
+                    if ( nState == thread_cache_record::owned ) {
+                        // The record of current thread is unlinked from its detach hooks
+                        if ( cds::threading::Manager::isThreadAttached() && cds::threading::Manager::thread_data()->remove_detach_hook( pRec )) {
+                            aligned_malloc_heap::free( pRec );
+                            break;
+                        }
+
+                        // Other thread will free the record on detach
+                        if ( pRec->nState.compare_exchange_strong( nState, thread_cache_record::orphan, atomics::memory_order_acq_rel, atomics::memory_order_relaxed )) {
+                            pRec->pHeap = nullptr;
+                            break;
+                        }
+                    }
+                    // The owner thread is being detached, wait until the record is flushed
+                    bkoff();
+                }
+                pRec = pNext;
+            }
+        }
+
         //@endcond
     public:
         /// Heap constructor
@@ -1642,6 +1946,7 @@ namespace michael {
             m_arrProcDesc = new( m_AlignedHeap.alloc(sizeof(processor_desc *) * m_nProcessorCount, c_nAlignment ))
                 atomics::atomic<processor_desc *>[ m_nProcessorCount ];
             memset( m_arrProcDesc, 0, sizeof(processor_desc *) * m_nProcessorCount )    ;   // ?? memset for atomic<>
+            m_pThreadCacheList.store( nullptr, atomics::memory_order_relaxed );
         }
 
         /// Heap destructor
@@ -1650,6 +1955,9 @@ namespace michael {
         */
         ~Heap()
         {
+            // Blocks cached by threads are freed with their superblocks
+            free_thread_cache_list();
+
             for ( unsigned int i = 0; i < m_nProcessorCount; ++i ) {
                 processor_desc * pDesc = m_arrProcDesc[i].load(atomics::memory_order_relaxed);
                 if ( pDesc )
@@ -1709,45 +2017,13 @@ namespace michael {
                 pDesc->nBlockSize
             );
 
-
-            anchor_tag oldAnchor;
-            anchor_tag newAnchor;
-            processor_heap_base * pProcHeap = pDesc->pProcHeap;
-
-            pProcHeap->stat.incDeallocatedBytes( pDesc->nBlockSize );
-
-            oldAnchor = pDesc->anchor.load(atomics::memory_order_acquire);
-            do {
-                newAnchor = oldAnchor;
-                reinterpret_cast<free_block_header *>( pBlock )->nNextFree = oldAnchor.avail;
-                newAnchor.avail = (reinterpret_cast<byte *>( pBlock ) - pDesc->pSB) / pDesc->nBlockSize;
-                newAnchor.tag += 1;
-
-                assert( oldAnchor.state != SBSTATE_EMPTY );
-
-                if ( oldAnchor.state == SBSTATE_FULL )
-                    newAnchor.state = SBSTATE_PARTIAL;
-
-                if ( oldAnchor.count == pDesc->nCapacity - 1 ) {
-                    //pProcHeap = pDesc->pProcHeap;
-                    //CDS_COMPILER_RW_BARRIER         ;   // instruction fence is needed?..
-                    newAnchor.state = SBSTATE_EMPTY;
-                }
-                else
-                    newAnchor.count += 1;
-            } while ( !pDesc->anchor.compare_exchange_strong( oldAnchor, newAnchor, atomics::memory_order_release, atomics::memory_order_relaxed ) );
-
-            pProcHeap->stat.incFreeCount();
-
-            if ( newAnchor.state == SBSTATE_EMPTY ) {
-                if ( pProcHeap->unlink_partial( pDesc ))
-                    free_superblock( pDesc );
-            }
-            else if (oldAnchor.state == SBSTATE_FULL ) {
-                assert( pProcHeap != nullptr );
-                pProcHeap->stat.decDescFull();
-                pProcHeap->add_partial( pDesc );
+            if ( thread_cache_traits::c_bEnabled && pDesc->nBlockSize <= thread_cache_traits::c_nMaxBlockSize
+                && push_cached( pDesc, pBlock ))
+            {
+                return;
             }
+
+            free_block( pDesc, pBlock );
         }
 
         /// Reallocate memory block
@@ -1867,6 +2143,21 @@ namespace michael {
             free( pMemory );
         }
 
+    public:
+        /// Returns all blocks cached by current thread to the shared heap
+        /**
+            The function is useful only if the heap has opt::thread_cache option.
+            The cache of the thread is flushed automatically when the thread is detached from \p libcds.
+        */
+        void flush_thread_cache()
+        {
+            if ( thread_cache_traits::c_bEnabled ) {
+                thread_cache_record * pCache = get_thread_cache();
+                if ( pCache )
+                    flush_thread_cache( pCache );
+            }
+        }
+
     public:
 
         /// Get instant summary statistics
@@ -1882,11 +2173,25 @@ namespace michael {
                             st.add_procheap_stat( pProcHeap->stat );
                         }
                     }
+                    add_page_heap_stat( st, pProcDesc, std::integral_constant< bool, details::page_heap_stat<page_heap>::c_bEnabled >() );
                 }
             }
 
             st.add_heap_stat( m_OSAllocStat );
         }
+
+    protected:
+        //@cond
+        void add_page_heap_stat( summary_stat& st, processor_desc const * pProcDesc, std::true_type ) const
+        {
+            size_t const nPageHeapCount = m_SizeClassSelector.pageTypeCount();
+            for ( size_t i = 0; i < nPageHeapCount; ++i )
+                st.add_heap_stat( pProcDesc->pageHeaps[i].statistics() );
+        }
+
+        void add_page_heap_stat( summary_stat& /*st*/, processor_desc const * /*pProcDesc*/, std::false_type ) const
+        {}
+        //@endcond
     };
 
 }}} // namespace cds::memory::michael
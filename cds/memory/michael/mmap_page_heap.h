@@ -0,0 +1,256 @@
+//$$CDS-header$$
+
+#ifndef __CDS_MEMORY_MICHAEL_MMAP_PAGE_HEAP_H
+#define __CDS_MEMORY_MICHAEL_MMAP_PAGE_HEAP_H
+
+/*
+    Page heap for Michael's allocator based on mmap arenas.
+    Only POSIX systems are supported.
+*/
+
+#include <cds/details/defs.h>
+
+#if CDS_OS_INTERFACE != CDS_OSI_UNIX
+#   error "mmap_page_heap is supported for POSIX systems only"
+#endif
+
+#include <sys/mman.h>
+#include <stdlib.h>
+#include <cds/lock/spinlock.h>
+#include <cds/memory/michael/osalloc_stat.h>
+
+namespace cds { namespace memory { namespace michael {
+
+    /// Huge page policy of \ref mmap_page_heap
+    enum mmap_huge_page {
+        mmap_huge_page_none,        ///< regular pages only
+        mmap_huge_page_transparent, ///< arenas are advised by \p madvise(MADV_HUGEPAGE) (transparent huge pages, Linux only)
+        mmap_huge_page_explicit     ///< arenas are mapped with \p MAP_HUGETLB; if no huge page is available, regular pages are used (Linux only)
+    };
+
+    /// Page heap based on \p mmap arenas
+    /**
+        This class is one of available implementation of opt::page_heap option.
+
+        The heap maps large arenas of \p ArenaSize bytes directly by \p mmap (anonymous private mapping)
+        and carves the pages (superblocks) from them, so libc heap is not involved at all.
+        Freed pages are kept in the free-list of its arena. When all pages of an arena become free,
+        the arena is considered idle and its physical memory is returned to OS by \p madvise(MADV_DONTNEED);
+        the address range of the arena is kept and reused by next allocations.
+        Arenas are unmapped when the heap is destroyed.
+
+        Since Michael's heap keeps one page heap object per processor and per page size,
+        an arena is mapped on demand only, on the first page allocation.
+
+        Template parameters:
+            - \p ArenaSize - arena size in bytes, must be a multiple of 2M (huge page size)
+            - \p HugePage - huge page policy, see \ref mmap_huge_page
+            - \p Stat - statistics of OS memory mapped by the heap, \ref os_allocated_atomic or \ref os_allocated_empty (the default).
+                Mapping an arena and reusing an idle arena increment allocated bytes,
+                releasing an idle arena and unmapping a used arena increment deallocated bytes.
+
+        Example:
+        \code
+        #include <cds/memory/michael/allocator.h>
+        #include <cds/memory/michael/mmap_page_heap.h>
+
+        namespace ma = cds::memory::michael;
+        ma::Heap<
+            ma::opt::page_heap< ma::mmap_page_heap< 64 * 1024 * 1024, ma::mmap_huge_page_transparent > >
+        > myHeap;
+        \endcode
+    */
+    template <size_t ArenaSize = 32 * 1024 * 1024, int HugePage = mmap_huge_page_none, class Stat = os_allocated_empty >
+    class mmap_page_heap
+    {
+    public:
+        typedef Stat    stat_type   ;   ///< Statistics type
+
+        static const size_t c_nArenaSize = ArenaSize   ;   ///< Arena size in bytes
+        static const size_t c_nHugePageSize = 2 * 1024 * 1024  ;   ///< Huge page size (arena alignment)
+
+        //@cond
+        static_assert( ArenaSize % c_nHugePageSize == 0, "ArenaSize must be a multiple of 2M" );
+        //@endcond
+
+    protected:
+        //@cond
+        struct arena
+        {
+            arena *     pNext       ;   ///< next arena
+            char *      pStart      ;   ///< start of arena memory
+            size_t      nCarved     ;   ///< count of pages carved from the arena
+            size_t      nUsed       ;   ///< count of pages in use
+            void *      pFreeList   ;   ///< list of free pages, the link is stored in the page itself
+            bool        bReleased   ;   ///< physical memory of the arena is returned to OS
+        };
+
+        typedef cds::lock::Spin     lock_type;
+        typedef cds::lock::scoped_lock<lock_type> scoped_lock;
+
+        size_t const    m_nPageSize     ;   ///< page size
+        size_t const    m_nArenaPages   ;   ///< page count in an arena
+        arena *         m_pArenas       ;   ///< list of arenas
+        lock_type       m_Lock          ;   ///< arena list lock
+        stat_type       m_Stat          ;   ///< statistics
+        //@endcond
+
+    public:
+        /// Initializes heap
+        mmap_page_heap(
+            size_t nPageSize    ///< page size in bytes
+        )
+            : m_nPageSize( nPageSize )
+            , m_nArenaPages( ArenaSize / nPageSize )
+            , m_pArenas( nullptr )
+        {
+            assert( m_nArenaPages > 0 );
+        }
+
+        //@cond
+        ~mmap_page_heap()
+        {
+            arena * p = m_pArenas;
+            while ( p ) {
+                arena * pNext = p->pNext;
+                if ( !p->bReleased )
+                    m_Stat.incBytesDeallocated( ArenaSize );
+                ::munmap( p->pStart, ArenaSize );
+                ::free( p );
+                p = pNext;
+            }
+        }
+        //@endcond
+
+        /// Allocate new page
+        /**
+            Returns \p nullptr if OS cannot map new arena.
+        */
+        void * alloc()
+        {
+            scoped_lock al( m_Lock );
+
+            // Prefer arenas in use to let idle arenas stay released
+            arena * pIdle = nullptr;
+            for ( arena * p = m_pArenas; p; p = p->pNext ) {
+                if ( p->bReleased ) {
+                    if ( !pIdle )
+                        pIdle = p;
+                }
+                else if ( p->pFreeList || p->nCarved < m_nArenaPages )
+                    return carve( p );
+            }
+
+            if ( pIdle ) {
+                pIdle->bReleased = false;
+                m_Stat.incBytesAllocated( ArenaSize );
+                return carve( pIdle );
+            }
+
+            arena * pArena = map_arena();
+            if ( !pArena )
+                return nullptr;
+            pArena->pNext = m_pArenas;
+            m_pArenas = pArena;
+            return carve( pArena );
+        }
+
+        /// Free page \p pPage
+        void free( void * pPage )
+        {
+            scoped_lock al( m_Lock );
+
+            arena * pArena = m_pArenas;
+            while ( pArena && !( pArena->pStart <= pPage && pPage < pArena->pStart + ArenaSize ))
+                pArena = pArena->pNext;
+            assert( pArena != nullptr );
+            assert( pArena->nUsed > 0 );
+
+            if ( --pArena->nUsed == 0 ) {
+                // The arena is idle - return its memory to OS
+                ::madvise( pArena->pStart, ArenaSize, MADV_DONTNEED );
+                pArena->pFreeList = nullptr;
+                pArena->nCarved = 0;
+                pArena->bReleased = true;
+                m_Stat.incBytesDeallocated( ArenaSize );
+            }
+            else {
+                *reinterpret_cast<void **>( pPage ) = pArena->pFreeList;
+                pArena->pFreeList = pPage;
+            }
+        }
+
+        /// Returns statistics of the heap
+        stat_type const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        void * carve( arena * pArena )
+        {
+            void * pPage = pArena->pFreeList;
+            if ( pPage )
+                pArena->pFreeList = *reinterpret_cast<void **>( pPage );
+            else {
+                assert( pArena->nCarved < m_nArenaPages );
+                pPage = pArena->pStart + m_nPageSize * pArena->nCarved++;
+            }
+            ++pArena->nUsed;
+            return pPage;
+        }
+
+        arena * map_arena()
+        {
+            char * pStart = nullptr;
+
+#       ifdef MAP_HUGETLB
+            if ( HugePage == mmap_huge_page_explicit ) {
+                void * p = ::mmap( nullptr, ArenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+                if ( p != MAP_FAILED )
+                    pStart = reinterpret_cast<char *>( p );
+            }
+#       endif
+
+            if ( !pStart ) {
+                // Map more than needed and trim the arena to huge page boundary
+                const size_t nMapSize = ArenaSize + c_nHugePageSize;
+                void * p = ::mmap( nullptr, nMapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+                if ( p == MAP_FAILED )
+                    return nullptr;
+
+                char * pMap = reinterpret_cast<char *>( p );
+                pStart = reinterpret_cast<char *>(( reinterpret_cast<uptr_atomic_t>( pMap ) + c_nHugePageSize - 1 ) & ~( uptr_atomic_t( c_nHugePageSize ) - 1 ));
+                if ( pStart != pMap )
+                    ::munmap( pMap, pStart - pMap );
+                if ( pStart + ArenaSize != pMap + nMapSize )
+                    ::munmap( pStart + ArenaSize, ( pMap + nMapSize ) - ( pStart + ArenaSize ));
+
+#           ifdef MADV_HUGEPAGE
+                if ( HugePage != mmap_huge_page_none )
+                    ::madvise( pStart, ArenaSize, MADV_HUGEPAGE );
+#           endif
+            }
+
+            arena * pArena = reinterpret_cast<arena *>( ::malloc( sizeof(arena) ));
+            if ( !pArena ) {
+                ::munmap( pStart, ArenaSize );
+                return nullptr;
+            }
+            pArena->pNext = nullptr;
+            pArena->pStart = pStart;
+            pArena->nCarved = 0;
+            pArena->nUsed = 0;
+            pArena->pFreeList = nullptr;
+            pArena->bReleased = false;
+
+            m_Stat.incBytesAllocated( ArenaSize );
+            return pArena;
+        }
+        //@endcond
+    };
+
+}}} // namespace cds::memory::michael
+
+#endif // #ifndef __CDS_MEMORY_MICHAEL_MMAP_PAGE_HEAP_H
@@ -192,6 +192,26 @@ namespace cds { namespace memory { namespace michael {
             //@endcond
         };
 
+        /// Option setter for per-thread cache of free blocks
+        /**
+            The option specifies a per-thread front-end of the heap. Small blocks freed by a thread
+            are kept in the thread's private cache ("magazine") and are reused by next allocations
+            of the same size-class without any atomic operation on the shared heap.
+
+            Available \p Type implementations:
+                - \p cds::opt::none - no per-thread cache (default)
+                - \ref thread_magazine - per-thread magazine of bounded size
+        */
+        template <typename Type>
+        struct thread_cache {
+            //@cond
+            template <class BASE> struct pack: public BASE
+            {
+                typedef Type thread_cache;
+            };
+            //@endcond
+        };
+
         /// Option setter for bounds checking
         /**
             This option defines a strategy to check upper memory boundary of allocated blocks.
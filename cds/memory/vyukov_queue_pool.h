@@ -5,6 +5,7 @@
 
 #include <cds/details/allocator.h>
 #include <cds/intrusive/vyukov_mpmc_cycle_queue.h>
+#include <cds/memory/pool_allocator.h>
 
 namespace cds { namespace memory {
 
@@ -475,6 +476,66 @@ namespace cds { namespace memory {
     };
 
 
+    /// Node pool policy based on \ref lazy_vyukov_queue_pool
+    /** @ingroup cds_memory_pool
+        The class is an implementation of cds::opt::node_pool option.
+
+        For each node type \p Node the policy maintains a static object of type
+        <tt>lazy_vyukov_queue_pool< Node, cds::opt::buffer< cds::opt::v::dynamic_buffer< Node > > ></tt>
+        with capacity \p Capacity. The pool is shared between all containers with the same node type.
+        The node freed by the container is pushed into the pool (if the pool is not full)
+        and is popped by next node allocation. Thus, the steady-state work of a queue
+        does not call the allocator at all.
+
+        Template parameters:
+        - \p Capacity - capacity of the free-list, must be a power of two.
+        - \p Allocator - the allocator used when the free-list is empty or full. Default is \ref CDS_DEFAULT_ALLOCATOR
+
+        The pool is a static object destroyed at program exit,
+        so garbage collectors must be terminated before the program exits.
+
+        Example:
+        \code
+        #include <cds/container/msqueue.h>
+        #include <cds/memory/vyukov_queue_pool.h>
+
+        typedef cds::container::MSQueue< cds::gc::HP, Foo,
+            cds::opt::node_pool< cds::memory::vyukov_queue_node_pool<> >
+        > queue_type;
+        \endcode
+    */
+    template <size_t Capacity = 1024 * 64, class Allocator = CDS_DEFAULT_ALLOCATOR >
+    struct vyukov_queue_node_pool
+    {
+        //@cond
+        static_assert( (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two" );
+        //@endcond
+
+        /// Rebinds the policy to \p Node type
+        template <typename Node>
+        struct rebind {
+            /// Pool type
+            typedef lazy_vyukov_queue_pool< Node,
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< Node > >
+                ,cds::opt::allocator< Allocator >
+            > pool_type;
+
+            /// Pool accessor
+            struct accessor {
+                typedef Node value_type ;   ///< Value type
+
+                /// Returns the pool of \p Node
+                pool_type& operator()() const
+                {
+                    static pool_type s_Pool( Capacity );
+                    return s_Pool;
+                }
+            };
+
+            typedef pool_allocator< Node, accessor > other  ;   ///< Rebinding result
+        };
+    };
+
 }}  // namespace cds::memory
 
 
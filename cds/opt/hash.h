@@ -5,7 +5,14 @@
 
 #include <tuple>
 #include<functional>
+#include <string>
+#include <cstring>  // memcpy, strlen
 #include <cds/opt/options.h>
+#include <cds/compiler/crc32c.h>
+#include <cds/compiler/simd_hash.h>
+#if CDS_COMPILER == CDS_COMPILER_MSVC
+#   include <intrin.h>  // _umul128
+#endif
 
 namespace cds { namespace opt {
 
@@ -160,6 +167,498 @@ namespace cds { namespace opt {
     } // namespace details
     //@endcond
 
+    namespace v {
+        /// 128-bit hash value, the result of \p mix128_hash
+        struct hash128_value
+        {
+            uint64_t    lo  ;   ///< Low 64 bits
+            uint64_t    hi  ;   ///< High 64 bits
+        };
+    } // namespace v
+
+    //@cond
+    namespace details {
+        // Fast non-cryptographic hashing of byte sequences.
+        // mix64 is the wyhash algorithm (public domain): the input is mixed by 64x64 -> 128 bit multiplication
+        // folding the high and low halves of the product. striped is for long keys: eight independent
+        // 64-bit lanes accumulate 32x32 -> 64 bit products like xxh3 does; the lanes have no data dependency,
+        // so they are processed by AVX2 vpmuludq if the processor supports it (see cds/compiler/simd_hash.h).
+
+        static uint64_t const c_hashP0 = 0xa0761d6478bd642fULL;
+        static uint64_t const c_hashP1 = 0xe7037ed1a0b428dbULL;
+        static uint64_t const c_hashP2 = 0x8ebc6af09c88c6e3ULL;
+        static uint64_t const c_hashP3 = 0x589965cc75374cc3ULL;
+
+        // Long keys are hashed by striped algorithm, shorter ones - by mix64
+        static size_t const c_nStripedHashThreshold = 512;
+
+        static inline void hash_mum128( uint64_t& a, uint64_t& b )
+        {
+#       if defined(__SIZEOF_INT128__)
+            unsigned __int128 r = a;
+            r *= b;
+            a = static_cast<uint64_t>( r );
+            b = static_cast<uint64_t>( r >> 64 );
+#       elif CDS_COMPILER == CDS_COMPILER_MSVC && CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64
+            a = _umul128( a, b, &b );
+#       else
+            uint64_t const ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>( a ), lb = static_cast<uint32_t>( b );
+            uint64_t const rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+            uint64_t const t = rl + ( rm0 << 32 );
+            uint64_t const lo = t + ( rm1 << 32 );
+            uint64_t const c = ( t < rl ? 1 : 0 ) + ( lo < t ? 1 : 0 );
+            b = rh + ( rm0 >> 32 ) + ( rm1 >> 32 ) + c;
+            a = lo;
+#       endif
+        }
+
+        static inline uint64_t hash_mum( uint64_t a, uint64_t b )
+        {
+            hash_mum128( a, b );
+            return a ^ b;
+        }
+
+        static inline uint64_t hash_read64( unsigned char const * p )
+        {
+            uint64_t v;
+            memcpy( &v, p, sizeof(v) );
+            return v;
+        }
+
+        static inline uint64_t hash_read32( unsigned char const * p )
+        {
+            uint32_t v;
+            memcpy( &v, p, sizeof(v) );
+            return v;
+        }
+
+        static inline size_t hash_fold( uint64_t h )
+        {
+            return sizeof(size_t) >= sizeof(uint64_t) ? static_cast<size_t>( h ) : static_cast<size_t>( h ^ ( h >> 32 ));
+        }
+
+        // wyhash seed premixing, it is done once in the constructor of the hash functor
+        static inline uint64_t mix_prepare_seed( uint64_t seed )
+        {
+            return seed ^ hash_mum( seed ^ c_hashP0, c_hashP1 );
+        }
+
+        // wyhash body: reduces the key to two 64-bit words a and b; seed should be prepared by mix_prepare_seed()
+        static inline void mix_body( unsigned char const * p, size_t nSize, uint64_t seed, uint64_t& a, uint64_t& b )
+        {
+            if ( nSize <= 16 ) {
+                if ( nSize >= 4 ) {
+                    size_t const nMid = ( nSize >> 3 ) << 2;
+                    a = ( hash_read32( p ) << 32 ) | hash_read32( p + nMid );
+                    b = ( hash_read32( p + nSize - 4 ) << 32 ) | hash_read32( p + nSize - 4 - nMid );
+                }
+                else if ( nSize > 0 ) {
+                    a = ( uint64_t( p[0] ) << 16 ) | ( uint64_t( p[nSize >> 1] ) << 8 ) | p[nSize - 1];
+                    b = 0;
+                }
+                else
+                    a = b = 0;
+            }
+            else {
+                size_t i = nSize;
+                if ( i > 48 ) {
+                    uint64_t s1 = seed;
+                    uint64_t s2 = seed;
+                    do {
+                        seed = hash_mum( hash_read64( p ) ^ c_hashP1, hash_read64( p + 8 ) ^ seed );
+                        s1 = hash_mum( hash_read64( p + 16 ) ^ c_hashP2, hash_read64( p + 24 ) ^ s1 );
+                        s2 = hash_mum( hash_read64( p + 32 ) ^ c_hashP3, hash_read64( p + 40 ) ^ s2 );
+                        p += 48;
+                        i -= 48;
+                    } while ( i > 48 );
+                    seed ^= s1 ^ s2;
+                }
+                while ( i > 16 ) {
+                    seed = hash_mum( hash_read64( p ) ^ c_hashP1, hash_read64( p + 8 ) ^ seed );
+                    i -= 16;
+                    p += 16;
+                }
+                a = hash_read64( p + i - 16 );
+                b = hash_read64( p + i - 8 );
+            }
+            a ^= c_hashP1;
+            b ^= seed;
+            hash_mum128( a, b );
+        }
+
+        struct mix64_algorithm
+        {
+            typedef size_t result_type;
+
+            static uint64_t prepare_seed( uint64_t nSeed )
+            {
+                return mix_prepare_seed( nSeed );
+            }
+
+            static uint64_t hash64( void const * pData, size_t nSize, uint64_t nSeed )
+            {
+                uint64_t a, b;
+                mix_body( reinterpret_cast<unsigned char const *>( pData ), nSize, nSeed, a, b );
+                return hash_mum( a ^ c_hashP0 ^ nSize, b ^ c_hashP1 );
+            }
+
+            static result_type hash( void const * pData, size_t nSize, uint64_t nSeed )
+            {
+                return hash_fold( hash64( pData, nSize, nSeed ));
+            }
+        };
+
+        struct mix128_algorithm
+        {
+            typedef v::hash128_value result_type;
+
+            static uint64_t prepare_seed( uint64_t nSeed )
+            {
+                return mix_prepare_seed( nSeed );
+            }
+
+            static result_type hash( void const * pData, size_t nSize, uint64_t nSeed )
+            {
+                uint64_t a, b;
+                mix_body( reinterpret_cast<unsigned char const *>( pData ), nSize, nSeed, a, b );
+                result_type h;
+                h.lo = hash_mum( a ^ c_hashP0 ^ nSize, b ^ c_hashP1 );
+                h.hi = hash_mum( a ^ c_hashP2 ^ nSize, b ^ c_hashP3 );
+                return h;
+            }
+        };
+
+        struct striped_algorithm
+        {
+            typedef size_t result_type;
+
+            static uint64_t prepare_seed( uint64_t nSeed )
+            {
+                return mix64_algorithm::prepare_seed( nSeed );
+            }
+
+            // Accumulates the stripes of the key, the same as cds::simd_hash::accumulate_avx2()
+            static void accumulate( uint64_t * acc, unsigned char const * p, size_t nSize, uint64_t nSeed, uint64_t const * pSecret, size_t nBlockStripes )
+            {
+                uint64_t key[4];
+                for ( unsigned int j = 0; j < 4; ++j ) {
+                    acc[j] = key[j] = nSeed ^ pSecret[j];
+                    acc[j + 4] = nSeed + pSecret[j];
+                }
+
+                unsigned char const * const pLast = p + nSize - 64;
+                size_t nStripes = ( nSize - 1 ) / 64;
+                size_t nBlock = 0;
+                while ( true ) {
+                    for ( unsigned int j = 0; j < 8; ++j ) {
+                        uint64_t const v = hash_read64( p + j * 8 );
+                        uint64_t const k = v ^ key[j & 3];
+                        acc[j ^ 1] += v;
+                        acc[j] += ( k & 0xFFFFFFFF ) * ( k >> 32 );
+                    }
+                    for ( unsigned int j = 0; j < 4; ++j )
+                        key[j] += pSecret[3];
+
+                    if ( nStripes == 0 )
+                        break;
+                    if ( --nStripes == 0 )
+                        p = pLast;
+                    else {
+                        p += 64;
+                        if ( ++nBlock == nBlockStripes ) {
+                            nBlock = 0;
+                            for ( unsigned int j = 0; j < 8; ++j ) {
+                                acc[j] ^= acc[j] >> 47;
+                                acc[j] *= 0x9E3779B1;
+                            }
+                        }
+                    }
+                }
+            }
+
+            static uint64_t hash64( void const * pData, size_t nSize, uint64_t nSeed )
+            {
+                if ( nSize < c_nStripedHashThreshold )
+                    return mix64_algorithm::hash64( pData, nSize, nSeed );
+
+                // The accumulators are scrambled after each block of 16 stripes (1K)
+                static size_t const c_nBlockStripes = 16;
+                static uint64_t const c_Secret[4] = { c_hashP0, c_hashP1, c_hashP2, c_hashP3 };
+
+                uint64_t acc[8];
+                unsigned char const * p = reinterpret_cast<unsigned char const *>( pData );
+                if ( cds::simd_hash::is_avx2_supported() )
+                    cds::simd_hash::accumulate_avx2( acc, p, nSize, nSeed, c_Secret, c_nBlockStripes );
+                else
+                    accumulate( acc, p, nSize, nSeed, c_Secret, c_nBlockStripes );
+
+                uint64_t h = nSize * c_hashP1 ^ nSeed;
+                h += hash_mum( acc[0] ^ c_hashP0, acc[1] ^ c_hashP1 );
+                h += hash_mum( acc[2] ^ c_hashP2, acc[3] ^ c_hashP3 );
+                h += hash_mum( acc[4] ^ c_hashP1, acc[5] ^ c_hashP2 );
+                h += hash_mum( acc[6] ^ c_hashP3, acc[7] ^ c_hashP0 );
+                h ^= h >> 37;
+                h *= 0x165667919E3779F9ULL;
+                return h ^ ( h >> 32 );
+            }
+
+            static result_type hash( void const * pData, size_t nSize, uint64_t nSeed )
+            {
+                return hash_fold( hash64( pData, nSize, nSeed ));
+            }
+        };
+
+        // mix64 for short keys; for long ones - striped if AVX2 is supported, otherwise mix64
+        struct fast_algorithm
+        {
+            typedef size_t result_type;
+
+            static uint64_t prepare_seed( uint64_t nSeed )
+            {
+                return mix64_algorithm::prepare_seed( nSeed );
+            }
+
+            static result_type hash( void const * pData, size_t nSize, uint64_t nSeed )
+            {
+                if ( nSize >= c_nStripedHashThreshold && cds::simd_hash::is_avx2_supported() )
+                    return striped_algorithm::hash( pData, nSize, nSeed );
+                return mix64_algorithm::hash( pData, nSize, nSeed );
+            }
+        };
+
+        struct crc32c_algorithm
+        {
+            typedef size_t result_type;
+
+            static uint64_t prepare_seed( uint64_t nSeed )
+            {
+                return nSeed;
+            }
+
+            static result_type hash( void const * pData, size_t nSize, uint64_t nSeed )
+            {
+                uint32_t const nCrc = cds::crc32c::update( ~static_cast<uint32_t>( nSeed ), pData, nSize );
+                // CRC is linear and 32-bit only, the final multiplication spreads it to all bits of the result
+                return hash_fold( hash_mum( nCrc ^ nSeed ^ c_hashP0, nSize ^ c_hashP1 ));
+            }
+        };
+
+        // Adapts byte-sequence Algorithm to the hash functor interface
+        template <class Algorithm>
+        class byte_hash
+        {
+        protected:
+            uint64_t    m_nSeed;
+
+        public:
+            typedef typename Algorithm::result_type result_type;
+
+            byte_hash( uint64_t nSeed )
+                : m_nSeed( Algorithm::prepare_seed( nSeed ))
+            {}
+
+            template <typename Char, typename Traits, typename Alloc>
+            result_type operator()( std::basic_string<Char, Traits, Alloc> const& s ) const
+            {
+                return Algorithm::hash( s.data(), s.size() * sizeof(Char), m_nSeed );
+            }
+
+            result_type operator()( char const * s ) const
+            {
+                return Algorithm::hash( s, strlen( s ), m_nSeed );
+            }
+
+            template <typename Q>
+            typename std::enable_if< std::is_arithmetic<Q>::value || std::is_enum<Q>::value, result_type >::type
+            operator()( Q const& v ) const
+            {
+                return Algorithm::hash( &v, sizeof(v), m_nSeed );
+            }
+
+            result_type operator()( void const * pData, size_t nSize ) const
+            {
+                return Algorithm::hash( pData, nSize, m_nSeed );
+            }
+        };
+    } // namespace details
+    //@endcond
+
+    namespace v {
+
+        /// Fast 64-bit multiply-mix hash functor
+        /** @anchor cds_opt_fast_hash
+            The functor implements wyhash algorithm: eight key bytes are mixed by one 64x64 -> 128 bit multiplication.
+            It is the best choice for short and middle-size keys.
+
+            The fast hash functors \p mix64_hash, \p striped_hash, \p crc32c_hash, \p fast_hash and \p mix128_hash
+            have the same interface:
+            - the constructor accepts 64-bit seed, default is 0. The functors with different seeds produce independent hash values;
+            - <tt>operator()( std::basic_string<Char, Traits, Alloc> const& )</tt> hashes the characters of the string;
+            - <tt>operator()( char const * )</tt> hashes C-string, so the hash of \p std::string and its \p c_str() are equal;
+            - <tt>operator()( Q const& )</tt> for arithmetic or enum \p Q hashes the object representation of the value;
+            - <tt>operator()( void const * pData, size_t nSize )</tt> hashes \p nSize bytes of \p pData.
+
+            The hash values depend on the byte order of the platform, so they should not be stored persistently.
+
+            Usage:
+            \code
+            #include <cds/opt/hash.h>
+            typedef cds::container::SplitListMap< cds::gc::HP, std::string, int,
+                cds::container::split_list::make_traits<
+                    cds::container::split_list::ordered_list< cds::container::michael_list_tag >
+                    ,cds::opt::hash< cds::opt::v::fast_hash >
+                >::type
+            > string_map;
+            \endcode
+        */
+        class mix64_hash: public opt::details::byte_hash< opt::details::mix64_algorithm >
+        {
+            //@cond
+            typedef opt::details::byte_hash< opt::details::mix64_algorithm > base_class;
+            //@endcond
+        public:
+            /// Constructs the functor with the \p nSeed
+            mix64_hash( uint64_t nSeed = 0 )
+                : base_class( nSeed )
+            {}
+        };
+
+        /// Striped hash functor for long keys
+        /**
+            The keys shorter than 512 bytes are hashed by \p mix64_hash.
+            For longer keys eight independent 64-bit accumulators process 64-byte stripes by 32x32 -> 64 bit
+            multiplication. If the processor supports AVX2 (checked once at run-time by \p cpuid, see \p cds::simd_hash)
+            the stripes are processed by AVX2 \p vpmuludq, it is about 1.5 times faster than \p mix64_hash for long keys.
+            Otherwise the portable implementation producing the same hash values is used,
+            it is several times slower than \p mix64_hash; use \p fast_hash if the target processor is unknown.
+            See \ref cds_opt_fast_hash "mix64_hash" for the interface.
+        */
+        class striped_hash: public opt::details::byte_hash< opt::details::striped_algorithm >
+        {
+            //@cond
+            typedef opt::details::byte_hash< opt::details::striped_algorithm > base_class;
+            //@endcond
+        public:
+            /// Constructs the functor with the \p nSeed
+            striped_hash( uint64_t nSeed = 0 )
+                : base_class( nSeed )
+            {}
+        };
+
+        /// CRC32C hash functor
+        /**
+            The functor calculates CRC32C of the key by SSE4.2 \p crc32 instruction if the processor supports it
+            (checked once at run-time by \p cpuid, see \p cds::crc32c), otherwise by table-driven software implementation.
+            The 32-bit CRC is spread to all bits of the result by one multiplication.
+            See \ref cds_opt_fast_hash "mix64_hash" for the interface.
+        */
+        class crc32c_hash: public opt::details::byte_hash< opt::details::crc32c_algorithm >
+        {
+            //@cond
+            typedef opt::details::byte_hash< opt::details::crc32c_algorithm > base_class;
+            //@endcond
+        public:
+            /// Constructs the functor with the \p nSeed
+            crc32c_hash( uint64_t nSeed = 0 )
+                : base_class( nSeed )
+            {}
+        };
+
+        /// Fast hash functor: \p mix64_hash for short keys, \p striped_hash for long ones
+        /**
+            It is the recommended general-purpose fast hash functor.
+            The keys of 512 bytes and longer are hashed by \p striped_hash if the processor supports AVX2,
+            otherwise all keys are hashed by \p mix64_hash. So the hash values may be different on different processors,
+            but they are the same within the process.
+            See \ref cds_opt_fast_hash "mix64_hash" for the interface.
+        */
+        class fast_hash: public opt::details::byte_hash< opt::details::fast_algorithm >
+        {
+            //@cond
+            typedef opt::details::byte_hash< opt::details::fast_algorithm > base_class;
+            //@endcond
+        public:
+            /// Constructs the functor with the \p nSeed
+            fast_hash( uint64_t nSeed = 0 )
+                : base_class( nSeed )
+            {}
+        };
+
+        /// 128-bit multiply-mix hash functor
+        /**
+            The functor is an analog of \p mix64_hash that returns \p hash128_value.
+            It is intended for \p derived_hash_list.
+            See \ref cds_opt_fast_hash "mix64_hash" for the interface.
+        */
+        class mix128_hash: public opt::details::byte_hash< opt::details::mix128_algorithm >
+        {
+            //@cond
+            typedef opt::details::byte_hash< opt::details::mix128_algorithm > base_class;
+            //@endcond
+        public:
+            /// Constructs the functor with the \p nSeed
+            mix128_hash( uint64_t nSeed = 0 )
+                : base_class( nSeed )
+            {}
+        };
+
+        /// Hash functor list deriving \p Count hash values from one 128-bit hash
+        /**
+            The class is a replacement of <tt>std::tuple< H1, H2, ... Hn ></tt> in \p opt::hash option for cuckoo hashing
+            (\p cds::intrusive::CuckooSet, \p cds::container::CuckooSet, \p cds::container::CuckooMap).
+            Instead of \p Count hash functor calls per key, the 128-bit hash \p Hash128 (for example, \p mix128_hash)
+            is computed once, and the hash values are derived from its halves by double hashing:
+            <tt>h[i] = lo + i * (hi | 1)</tt>. For different \p i the values are different,
+            as cuckoo hashing requires, and for a good 128-bit hash they behave as independent hash functions.
+
+            \p Hash128 functor should return \p hash128_value for the key.
+            The hash tuple passed to the constructor of the cuckoo container is <tt>std::tuple< Hash128 ></tt>.
+
+            Usage:
+            \code
+            #include <cds/container/cuckoo_set.h>
+            typedef cds::container::CuckooSet< std::string,
+                cds::container::cuckoo::make_traits<
+                    cds::opt::hash< cds::opt::v::derived_hash_list< cds::opt::v::mix128_hash, 2 > >
+                    ,cds::opt::equal_to< std::equal_to< std::string > >
+                >::type
+            > string_set;
+            \endcode
+        */
+        template <typename Hash128, size_t Count = 2>
+        struct derived_hash_list
+        {
+            static_assert( Count >= 2, "At least two hash values must be derived" );
+
+            static size_t const size = Count;       ///< The number of derived hash values
+            typedef std::tuple< Hash128 > hash_tuple_type; ///< Hash tuple type
+
+            hash_tuple_type hash_tuple; ///< 128-bit hash functor
+
+            //@cond
+            derived_hash_list()
+            {}
+
+            derived_hash_list( hash_tuple_type const& t)
+                : hash_tuple( t )
+            {}
+            derived_hash_list( hash_tuple_type&& t)
+                : hash_tuple( std::forward<hash_tuple_type>(t) )
+            {}
+
+            template <typename T>
+            void operator()( size_t * dest, T const& v ) const
+            {
+                hash128_value const h = std::get<0>( hash_tuple )( v );
+                uint64_t const nStep = h.hi | 1;
+                uint64_t x = h.lo;
+                for ( size_t i = 0; i < Count; ++i, x += nStep )
+                    dest[i] = opt::details::hash_fold( x );
+            }
+            //@endcond
+        };
+    } // namespace v
+
 }} // namespace cds::opt
 
 #endif // #ifndef __CDS_OPT_HASH_H
@@ -257,6 +257,31 @@ namespace opt {
         //@endcond
     };
 
+    /// [type-option] Option setter for node pool
+    /**
+        The node pool recycles the nodes of a container. The node disposed by the container
+        (for a GC-based container - after the GC proves that the node is safe to free)
+        is returned into the pool and is reused by next node allocation instead of calling the allocator.
+
+        \p Type is a pool policy that has nested template <tt>rebind<Node>::other</tt>;
+        the rebinding result is an allocator with \p std::allocator interface for \p Node.
+        If the container supports \p %opt::node_pool option and it is specified,
+        the \p opt::allocator option is not used for the nodes.
+
+        Predefined option \p Type:
+        - \p opt::none - no node pool (default)
+        - cds::memory::vyukov_queue_node_pool - lock-free bounded free-list of nodes
+    */
+    template <typename Type>
+    struct node_pool {
+        //@cond
+            template <typename Base> struct pack: public Base
+            {
+                typedef Type node_pool;
+            };
+        //@endcond
+    };
+
     /// [type-option] Option setter for item counting
     /**
         Some data structure (for example, queues) has additional feature for item counting.
@@ -349,6 +374,12 @@ namespace opt {
                 return dec();
             }
 
+            /// Adds \p n to the counter. Returns new value of the counter
+            counter_type operator +=( counter_type n )
+            {
+                return m_nCounter += n;
+            }
+
             /// Resets count to 0
             void reset()
             {
@@ -0,0 +1,16 @@
+//$$CDS-header$$
+
+#ifndef __CDS_OS_FILE_MAP_H
+#define __CDS_OS_FILE_MAP_H
+
+#include <cds/details/defs.h>
+
+#if CDS_OS_TYPE == CDS_OS_WIN32 || CDS_OS_TYPE == CDS_OS_WIN64 || CDS_OS_TYPE == CDS_OS_MINGW
+#   include <cds/os/win/file_map.h>
+#elif CDS_OS_INTERFACE == CDS_OSI_UNIX
+#   include <cds/os/posix/file_map.h>
+#else
+#   error Unknown OS. Compilation aborted
+#endif
+
+#endif  // #ifndef __CDS_OS_FILE_MAP_H
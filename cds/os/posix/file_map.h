@@ -0,0 +1,119 @@
+//$$CDS-header$$
+
+#ifndef __CDS_OS_POSIX_FILE_MAP_H
+#define __CDS_OS_POSIX_FILE_MAP_H
+
+#include <cds/os/posix/syserror.h>
+#include <cds/details/noncopyable.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace cds { namespace OS {
+    namespace posix {
+
+        /// Read-only memory-mapped file
+        /**
+            The whole file is mapped into the address space of the process by \p open().
+            The object is not copyable.
+        */
+        class file_map: public cds::details::noncopyable
+        {
+            void *  m_pData ;   ///< Start address of the mapping, \p nullptr for empty file
+            size_t  m_nSize ;   ///< File size
+            bool    m_bOpen ;   ///< \p true if the file is mapped
+
+        public:
+            /// Creates closed object
+            file_map()
+                : m_pData( nullptr )
+                , m_nSize( 0 )
+                , m_bOpen( false )
+            {}
+
+            /// Unmaps the file
+            ~file_map()
+            {
+                close();
+            }
+
+            /// Maps the file \p pszFileName for reading
+            /**
+                Returns \p false if the file cannot be mapped, the reason can be obtained by \p getErrorCode().
+                The file opened before is closed.
+                The pages of the file are advised to be read sequentially.
+            */
+            bool open( char const * pszFileName )
+            {
+                close();
+
+                int fd = ::open( pszFileName, O_RDONLY );
+                if ( fd == -1 )
+                    return false;
+
+                struct stat st;
+                if ( ::fstat( fd, &st ) == -1 ) {
+                    error_code nErr = getErrorCode();
+                    ::close( fd );
+                    errno = nErr;
+                    return false;
+                }
+
+                m_nSize = static_cast<size_t>( st.st_size );
+                if ( m_nSize ) {
+                    void * p = ::mmap( nullptr, m_nSize, PROT_READ, MAP_PRIVATE, fd, 0 );
+                    if ( p == MAP_FAILED ) {
+                        error_code nErr = getErrorCode();
+                        ::close( fd );
+                        m_nSize = 0;
+                        errno = nErr;
+                        return false;
+                    }
+                    ::madvise( p, m_nSize, MADV_SEQUENTIAL );
+                    m_pData = p;
+                }
+
+                // The mapping stays valid after the file descriptor is closed
+                ::close( fd );
+                m_bOpen = true;
+                return true;
+            }
+
+            /// Unmaps the file
+            void close()
+            {
+                if ( m_pData )
+                    ::munmap( m_pData, m_nSize );
+                m_pData = nullptr;
+                m_nSize = 0;
+                m_bOpen = false;
+            }
+
+            /// Checks if the file is mapped
+            bool is_open() const
+            {
+                return m_bOpen;
+            }
+
+            /// Returns start address of the mapped file, \p nullptr for empty file
+            void const * data() const
+            {
+                return m_pData;
+            }
+
+            /// Returns the size of the mapped file
+            size_t size() const
+            {
+                return m_nSize;
+            }
+        };
+
+    }    // namespace posix
+
+    using posix::file_map;
+
+}} // namespace cds::OS
+
+#endif // #ifndef __CDS_OS_POSIX_FILE_MAP_H
@@ -0,0 +1,117 @@
+//$$CDS-header$$
+
+#ifndef __CDS_OS_WIN_FILE_MAP_H
+#define __CDS_OS_WIN_FILE_MAP_H
+
+#include <cds/os/win/syserror.h>
+#include <cds/details/noncopyable.h>
+
+namespace cds { namespace OS {
+    namespace Win32 {
+
+        /// Read-only memory-mapped file
+        /**
+            The whole file is mapped into the address space of the process by \p open().
+            The object is not copyable.
+        */
+        class file_map: public cds::details::noncopyable
+        {
+            void const *    m_pData ;   ///< Start address of the mapping, \p nullptr for empty file
+            size_t          m_nSize ;   ///< File size
+            bool            m_bOpen ;   ///< \p true if the file is mapped
+
+        public:
+            /// Creates closed object
+            file_map()
+                : m_pData( nullptr )
+                , m_nSize( 0 )
+                , m_bOpen( false )
+            {}
+
+            /// Unmaps the file
+            ~file_map()
+            {
+                close();
+            }
+
+            /// Maps the file \p pszFileName for reading
+            /**
+                Returns \p false if the file cannot be mapped, the reason can be obtained by \p getErrorCode().
+                The file opened before is closed.
+            */
+            bool open( char const * pszFileName )
+            {
+                close();
+
+                HANDLE hFile = ::CreateFileA( pszFileName, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+                if ( hFile == INVALID_HANDLE_VALUE )
+                    return false;
+
+                LARGE_INTEGER nFileSize;
+                if ( !::GetFileSizeEx( hFile, &nFileSize )) {
+                    error_code nErr = getErrorCode();
+                    ::CloseHandle( hFile );
+                    ::SetLastError( nErr );
+                    return false;
+                }
+
+                m_nSize = static_cast<size_t>( nFileSize.QuadPart );
+                if ( m_nSize ) {
+                    HANDLE hMapping = ::CreateFileMappingA( hFile, nullptr, PAGE_READONLY, 0, 0, nullptr );
+                    void const * p = hMapping ? ::MapViewOfFile( hMapping, FILE_MAP_READ, 0, 0, 0 ) : nullptr;
+                    error_code nErr = getErrorCode();
+                    // The view stays valid after the handles are closed
+                    if ( hMapping )
+                        ::CloseHandle( hMapping );
+                    ::CloseHandle( hFile );
+                    if ( !p ) {
+                        m_nSize = 0;
+                        ::SetLastError( nErr );
+                        return false;
+                    }
+                    m_pData = p;
+                }
+                else
+                    ::CloseHandle( hFile );
+
+                m_bOpen = true;
+                return true;
+            }
+
+            /// Unmaps the file
+            void close()
+            {
+                if ( m_pData )
+                    ::UnmapViewOfFile( m_pData );
+                m_pData = nullptr;
+                m_nSize = 0;
+                m_bOpen = false;
+            }
+
+            /// Checks if the file is mapped
+            bool is_open() const
+            {
+                return m_bOpen;
+            }
+
+            /// Returns start address of the mapped file, \p nullptr for empty file
+            void const * data() const
+            {
+                return m_pData;
+            }
+
+            /// Returns the size of the mapped file
+            size_t size() const
+            {
+                return m_nSize;
+            }
+        };
+
+    }    // namespace Win32
+
+    using Win32::file_map;
+
+}} // namespace cds::OS
+
+#endif // #ifndef __CDS_OS_WIN_FILE_MAP_H
@@ -10,6 +10,7 @@
 #include <cds/urcu/details/gp_decl.h>
 #include <cds/urcu/details/sh_decl.h>
 #include <cds/algo/elimination_tls.h>
+#include <cds/lock/spinlock.h>
 
 namespace cds {
     /// Threading support
@@ -108,6 +109,28 @@ namespace cds {
     */
     namespace threading {
 
+        /// Thread detach hook
+        /**
+            Some \p libcds components (for example, the per-thread cache of cds::memory::michael::Heap)
+            keep per-thread state that must be released when the thread is detached from \p libcds.
+            Such component links a \p thread_detach_hook object into the thread-specific data
+            of current thread by \p ThreadData::add_detach_hook. When the thread is detached
+            (the last call of \p Manager::detachThread), the hook is unlinked and \p m_pfnDetach
+            is called for it.
+        */
+        struct thread_detach_hook
+        {
+            thread_detach_hook *    m_pNextHook ;   ///< next hook in the thread's list
+            void (* m_pfnDetach)( thread_detach_hook * ) ; ///< detach handler
+
+            //@cond
+            thread_detach_hook()
+                : m_pNextHook( nullptr )
+                , m_pfnDetach( nullptr )
+            {}
+            //@endcond
+        };
+
         //@cond
         /// Thread-specific data
         struct ThreadData {
@@ -140,7 +163,12 @@ namespace cds {
             /// Per-thread elimination record
             cds::algo::elimination::record   m_EliminationRec;
 
+            /// List of detach hooks of the thread
+            thread_detach_hook *    m_pDetachHooks;
+
             //@cond
+            ThreadData *    m_pNextFree ;   // next item in the free list of thread_data_pool
+
             static CDS_EXPORT_API atomics::atomic<size_t> s_nLastUsedProcNo;
             static CDS_EXPORT_API size_t                     s_nProcCount;
             //@endcond
@@ -154,44 +182,18 @@ namespace cds {
                 , m_pSHBRCU( nullptr )
                 , m_pSHTRCU( nullptr )
 #endif
+                , m_hpManager( nullptr )
+                , m_hrcManager( nullptr )
+                , m_ptbManager( nullptr )
                 , m_nFakeProcessorNumber( s_nLastUsedProcNo.fetch_add(1, atomics::memory_order_relaxed) % s_nProcCount )
                 , m_nAttachCount(0)
-            {
-                if (cds::gc::HP::isUsed() )
-                    m_hpManager = new (m_hpManagerPlaceholder) cds::gc::HP::thread_gc_impl;
-                else
-                    m_hpManager = nullptr;
-
-                if ( cds::gc::HRC::isUsed() )
-                    m_hrcManager = new (m_hrcManagerPlaceholder) cds::gc::HRC::thread_gc_impl;
-                else
-                    m_hrcManager = nullptr;
-
-                if ( cds::gc::PTB::isUsed() )
-                    m_ptbManager = new (m_ptbManagerPlaceholder) cds::gc::PTB::thread_gc_impl;
-                else
-                    m_ptbManager = nullptr;
-            }
+                , m_pDetachHooks( nullptr )
+                , m_pNextFree( nullptr )
+            {}
 
             ~ThreadData()
             {
-                if ( m_hpManager ) {
-                    typedef cds::gc::HP::thread_gc_impl hp_thread_gc_impl;
-                    m_hpManager->~hp_thread_gc_impl();
-                    m_hpManager = nullptr;
-                }
-
-                if ( m_hrcManager ) {
-                    typedef cds::gc::HRC::thread_gc_impl hrc_thread_gc_impl;
-                    m_hrcManager->~hrc_thread_gc_impl();
-                    m_hrcManager = nullptr;
-                }
-
-                if ( m_ptbManager ) {
-                    typedef cds::gc::PTB::thread_gc_impl ptb_thread_gc_impl;
-                    m_ptbManager->~ptb_thread_gc_impl();
-                    m_ptbManager = nullptr;
-                }
+                destroy_thread_gc();
 
                 assert( m_pGPIRCU == nullptr );
                 assert( m_pGPBRCU == nullptr );
@@ -205,12 +207,20 @@ namespace cds {
             void init()
             {
                 if ( m_nAttachCount++ == 0 ) {
-                    if ( cds::gc::HP::isUsed() )
+                    // Thread GC objects are constructed on each first attach since the ThreadData object
+                    // may be recycled by thread_data_pool after a GC singleton has been destroyed
+                    if ( cds::gc::HP::isUsed() ) {
+                        m_hpManager = new (m_hpManagerPlaceholder) cds::gc::HP::thread_gc_impl;
                         m_hpManager->init();
-                    if ( cds::gc::HRC::isUsed() )
+                    }
+                    if ( cds::gc::HRC::isUsed() ) {
+                        m_hrcManager = new (m_hrcManagerPlaceholder) cds::gc::HRC::thread_gc_impl;
                         m_hrcManager->init();
-                    if ( cds::gc::PTB::isUsed() )
+                    }
+                    if ( cds::gc::PTB::isUsed() ) {
+                        m_ptbManager = new (m_ptbManagerPlaceholder) cds::gc::PTB::thread_gc_impl;
                         m_ptbManager->init();
+                    }
 
                     if ( cds::urcu::details::singleton<cds::urcu::general_instant_tag>::isUsed() )
                         m_pGPIRCU = cds::urcu::details::singleton<cds::urcu::general_instant_tag>::attach_thread();
@@ -227,15 +237,43 @@ namespace cds {
                 }
             }
 
+            void add_detach_hook( thread_detach_hook * pHook )
+            {
+                assert( pHook->m_pfnDetach != nullptr );
+                pHook->m_pNextHook = m_pDetachHooks;
+                m_pDetachHooks = pHook;
+            }
+
+            bool remove_detach_hook( thread_detach_hook * pHook )
+            {
+                for ( thread_detach_hook ** ppHook = &m_pDetachHooks; *ppHook; ppHook = &(*ppHook)->m_pNextHook ) {
+                    if ( *ppHook == pHook ) {
+                        *ppHook = pHook->m_pNextHook;
+                        pHook->m_pNextHook = nullptr;
+                        return true;
+                    }
+                }
+                return false;
+            }
+
             bool fini()
             {
                 if ( --m_nAttachCount == 0 ) {
+                    // Detach hooks are called first since they may use GC or other libcds features
+                    while ( m_pDetachHooks ) {
+                        thread_detach_hook * pHook = m_pDetachHooks;
+                        m_pDetachHooks = pHook->m_pNextHook;
+                        pHook->m_pNextHook = nullptr;
+                        pHook->m_pfnDetach( pHook );
+                    }
+
                     if ( cds::gc::PTB::isUsed() )
                         m_ptbManager->fini();
                     if ( cds::gc::HRC::isUsed() )
                         m_hrcManager->fini();
                     if ( cds::gc::HP::isUsed() )
                         m_hpManager->fini();
+                    destroy_thread_gc();
 
                     if ( cds::urcu::details::singleton<cds::urcu::general_instant_tag>::isUsed() ) {
                         cds::urcu::details::singleton<cds::urcu::general_instant_tag>::detach_thread( m_pGPIRCU );
@@ -268,10 +306,132 @@ namespace cds {
             {
                 return m_nFakeProcessorNumber;
             }
+
+        private:
+            // If a GC singleton has been destroyed before the thread is detached,
+            // the thread GC object refers to the freed singleton; it is just dropped
+            void destroy_thread_gc()
+            {
+                if ( m_hpManager && cds::gc::HP::isUsed() ) {
+                    typedef cds::gc::HP::thread_gc_impl hp_thread_gc_impl;
+                    m_hpManager->~hp_thread_gc_impl();
+                }
+                m_hpManager = nullptr;
+
+                if ( m_hrcManager && cds::gc::HRC::isUsed() ) {
+                    typedef cds::gc::HRC::thread_gc_impl hrc_thread_gc_impl;
+                    m_hrcManager->~hrc_thread_gc_impl();
+                }
+                m_hrcManager = nullptr;
+
+                if ( m_ptbManager && cds::gc::PTB::isUsed() ) {
+                    typedef cds::gc::PTB::thread_gc_impl ptb_thread_gc_impl;
+                    m_ptbManager->~ptb_thread_gc_impl();
+                }
+                m_ptbManager = nullptr;
+            }
             //@endcond
         };
         //@endcond
 
+        /// Pool of recycled \p ThreadData objects
+        /**
+            The threading managers that allocate \p ThreadData in the heap
+            (\p cds::threading::pthread::Manager and \p cds::threading::wintls::Manager)
+            take \p ThreadData from the pool when a thread is attached and return it to the pool
+            when the thread is detached. So, the applications with short-lived threads do not
+            allocate and free \p ThreadData for each thread. The recycled object keeps
+            its per-thread elimination record and "fake current processor" number.
+
+            The pool keeps up to \p c_nCapacity free objects, the extra objects are deleted.
+            The pool is cleared by \p cds::Terminate().
+        */
+        class thread_data_pool
+        {
+        public:
+            static const size_t c_nCapacity = 64 ;  ///< Max count of free objects in the pool
+
+        private:
+            //@cond
+            typedef cds::lock::Spin lock_type;
+            typedef cds::lock::scoped_lock< lock_type > scoped_lock;
+
+            lock_type       m_Lock;
+            ThreadData *    m_pFreeList;
+            size_t          m_nFreeCount;
+
+            static CDS_EXPORT_API thread_data_pool s_Instance;
+            //@endcond
+
+        public:
+            //@cond
+            thread_data_pool()
+                : m_pFreeList( nullptr )
+                , m_nFreeCount( 0 )
+            {}
+
+            ~thread_data_pool()
+            {
+                clear();
+            }
+            //@endcond
+
+            /// Returns the pool singleton
+            static thread_data_pool& instance()
+            {
+                return s_Instance;
+            }
+
+            /// Takes an object from the pool or allocates new one if the pool is empty
+            ThreadData * alloc()
+            {
+                {
+                    scoped_lock al( m_Lock );
+                    ThreadData * p = m_pFreeList;
+                    if ( p ) {
+                        m_pFreeList = p->m_pNextFree;
+                        p->m_pNextFree = nullptr;
+                        --m_nFreeCount;
+                        return p;
+                    }
+                }
+                return new ThreadData;
+            }
+
+            /// Returns detached object \p p to the pool
+            void free( ThreadData * p )
+            {
+                assert( p->m_nAttachCount == 0 );
+                {
+                    scoped_lock al( m_Lock );
+                    if ( m_nFreeCount < c_nCapacity ) {
+                        p->m_pNextFree = m_pFreeList;
+                        m_pFreeList = p;
+                        ++m_nFreeCount;
+                        return;
+                    }
+                }
+                delete p;
+            }
+
+            /// Deletes all free objects of the pool
+            void clear()
+            {
+                ThreadData * p;
+                {
+                    scoped_lock al( m_Lock );
+                    p = m_pFreeList;
+                    m_pFreeList = nullptr;
+                    m_nFreeCount = 0;
+                }
+                while ( p ) {
+                    ThreadData * pNext = p->m_pNextFree;
+                    delete p;
+                    p = pNext;
+                }
+            }
+        };
+
     } // namespace threading
 } // namespace cds::threading
 
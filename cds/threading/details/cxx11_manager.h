@@ -16,7 +16,19 @@ namespace cds { namespace threading {
     struct cxx11_internal {
         typedef unsigned char  ThreadDataPlaceholder[ sizeof(ThreadData) ];
         static thread_local ThreadDataPlaceholder CDS_DATA_ALIGNMENT(8) s_threadData;
-        static thread_local ThreadData * s_pThreadData;
+        static thread_local ThreadData * s_pThreadData CDS_TLS_INITIAL_EXEC;
+
+        // Detaches the thread attached lazily when the thread terminates
+        struct lazy_detacher {
+            ~lazy_detacher()
+            {
+                ThreadData * p = s_pThreadData;
+                if ( p && p->fini() ) {
+                    s_pThreadData = nullptr;
+                    p->ThreadData::~ThreadData();
+                }
+            }
+        };
     };
     //@endcond
 
@@ -24,6 +36,11 @@ namespace cds { namespace threading {
     CDS_CXX11_INLINE_NAMESPACE namespace cxx11 {
 
         /// Thread-specific data manager based on c++11 thread_local feature
+        /**
+            The thread that uses a GC without \p attachThread() call is attached lazily on the first access
+            to its thread-specific data (for example, on first container operation), and it is detached
+            automatically by the destructor of a \p thread_local object when the thread terminates.
+        */
         class Manager {
         private :
             //@cond
@@ -49,6 +66,20 @@ namespace cds { namespace threading {
                     p->ThreadData::~ThreadData();
                 }
             }
+
+            // Returns ThreadData of current thread; attaches the thread if it is not attached yet
+            static ThreadData * attached_data()
+            {
+                ThreadData * p = _threadData();
+                if ( !p ) {
+                    // The detacher is constructed on first lazy attach of the thread only
+                    static thread_local cxx11_internal::lazy_detacher s_Detacher;
+                    CDS_UNUSED( s_Detacher );
+                    attachThread();
+                    p = _threadData();
+                }
+                return p;
+            }
             //@endcond
 
         public:
@@ -90,51 +121,52 @@ namespace cds { namespace threading {
             /// Returns ThreadData pointer for the current thread
             static ThreadData * thread_data()
             {
-                ThreadData * p = _threadData();
-                assert( p );
-                return p;
+                return attached_data();
             }
 
             /// Get gc::HP thread GC implementation for current thread
             /**
-                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
-                or if you did not use gc::HP.
+                If the current thread is not attached yet, it is attached automatically (see \ref Manager).
+                The object returned may be uninitialized if you did not use gc::HP.
                 To initialize gc::HP GC you must constuct cds::gc::HP object in the beginning of your application
             */
             static gc::HP::thread_gc_impl&   getHZPGC()
             {
-                assert( _threadData()->m_hpManager != nullptr );
-                return *(_threadData()->m_hpManager);
+                ThreadData * p = attached_data();
+                assert( p->m_hpManager != nullptr );
+                return *(p->m_hpManager);
             }
 
             /// Get gc::HRC thread GC implementation for current thread
             /**
-                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
-                or if you did not use gc::HRC.
+                If the current thread is not attached yet, it is attached automatically (see \ref Manager).
+                The object returned may be uninitialized if you did not use gc::HRC.
                 To initialize gc::HRC GC you must constuct cds::gc::HRC object in the beginning of your application
             */
             static gc::HRC::thread_gc_impl&   getHRCGC()
             {
-                assert( _threadData()->m_hrcManager != nullptr );
-                return *(_threadData()->m_hrcManager);
+                ThreadData * p = attached_data();
+                assert( p->m_hrcManager != nullptr );
+                return *(p->m_hrcManager);
             }
 
             /// Get gc::PTB thread GC implementation for current thread
             /**
-                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
-                or if you did not use gc::PTB.
+                If the current thread is not attached yet, it is attached automatically (see \ref Manager).
+                The object returned may be uninitialized if you did not use gc::PTB.
                 To initialize gc::PTB GC you must constuct cds::gc::PTB object in the beginning of your application
             */
             static gc::PTB::thread_gc_impl&   getPTBGC()
             {
-                assert( _threadData()->m_ptbManager != nullptr );
-                return *(_threadData()->m_ptbManager);
+                ThreadData * p = attached_data();
+                assert( p->m_ptbManager != nullptr );
+                return *(p->m_ptbManager);
             }
 
             //@cond
             static size_t fake_current_processor()
             {
-                return _threadData()->fake_current_processor();
+                return attached_data()->fake_current_processor();
             }
             //@endcond
         };
@@ -16,7 +16,22 @@ namespace cds { namespace threading {
     struct gcc_internal {
         typedef unsigned char  ThreadDataPlaceholder[ sizeof(ThreadData) ];
         static __thread ThreadDataPlaceholder CDS_DATA_ALIGNMENT(8) s_threadData;
-        static __thread ThreadData * s_pThreadData;
+        static __thread ThreadData * s_pThreadData CDS_TLS_INITIAL_EXEC;
+
+#ifdef CDS_CXX11_THREAD_LOCAL_SUPPORT
+        // Detaches the thread attached lazily when the thread terminates.
+        // __thread variables have no destructors, so a thread_local object is used
+        struct lazy_detacher {
+            ~lazy_detacher()
+            {
+                ThreadData * p = s_pThreadData;
+                if ( p && p->fini() ) {
+                    s_pThreadData = nullptr;
+                    p->ThreadData::~ThreadData();
+                }
+            }
+        };
+#endif
     };
     //@endcond
 
@@ -24,6 +39,16 @@ namespace cds { namespace threading {
     CDS_CXX11_INLINE_NAMESPACE namespace gcc {
 
         /// Thread-specific data manager based on GCC __thread feature
+        /**
+            If the compiler supports C++11 \p thread_local (\p CDS_CXX11_THREAD_LOCAL_SUPPORT is defined),
+            the thread that uses a GC without \p attachThread() call is attached lazily on the first access
+            to its thread-specific data, and it is detached automatically by the destructor of a \p thread_local object
+            when the thread terminates.
+
+            Otherwise, \p __thread variables cannot have destructors, so there is no way to detach a lazily
+            attached thread: each thread must call \p attachThread() before using libcds
+            and \p detachThread() before termination.
+        */
         class Manager {
         private :
             //@cond
@@ -49,6 +74,23 @@ namespace cds { namespace threading {
                     p->ThreadData::~ThreadData();
                 }
             }
+
+            // Returns ThreadData of current thread; attaches the thread if it is not attached yet
+            static ThreadData * attached_data()
+            {
+                ThreadData * p = _threadData();
+#ifdef CDS_CXX11_THREAD_LOCAL_SUPPORT
+                if ( !p ) {
+                    // The detacher is constructed on first lazy attach of the thread only
+                    static thread_local gcc_internal::lazy_detacher s_Detacher;
+                    CDS_UNUSED( s_Detacher );
+                    attachThread();
+                    p = _threadData();
+                }
+#endif
+                assert( p );
+                return p;
+            }
             //@endcond
 
         public:
@@ -90,51 +132,52 @@ namespace cds { namespace threading {
             /// Returns ThreadData pointer for the current thread
             static ThreadData * thread_data()
             {
-                ThreadData * p = _threadData();
-                assert( p );
-                return p;
+                return attached_data();
             }
 
             /// Get gc::HP thread GC implementation for current thread
             /**
-                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
-                or if you did not use gc::HP.
+                If the current thread is not attached yet, it is attached automatically (see \ref Manager).
+                The object returned may be uninitialized if you did not use gc::HP.
                 To initialize gc::HP GC you must constuct cds::gc::HP object in the beginning of your application
             */
             static gc::HP::thread_gc_impl&   getHZPGC()
             {
-                assert( _threadData()->m_hpManager );
-                return *(_threadData()->m_hpManager);
+                ThreadData * p = attached_data();
+                assert( p->m_hpManager != nullptr );
+                return *(p->m_hpManager);
             }
 
             /// Get gc::HRC thread GC implementation for current thread
             /**
-                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
-                or if you did not use gc::HRC.
+                If the current thread is not attached yet, it is attached automatically (see \ref Manager).
+                The object returned may be uninitialized if you did not use gc::HRC.
                 To initialize gc::HRC GC you must constuct cds::gc::HRC object in the beginning of your application
             */
             static gc::HRC::thread_gc_impl&   getHRCGC()
             {
-                assert( _threadData()->m_hrcManager );
-                return *(_threadData()->m_hrcManager);
+                ThreadData * p = attached_data();
+                assert( p->m_hrcManager != nullptr );
+                return *(p->m_hrcManager);
             }
 
             /// Get gc::PTB thread GC implementation for current thread
             /**
-                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
-                or if you did not use gc::PTB.
+                If the current thread is not attached yet, it is attached automatically (see \ref Manager).
+                The object returned may be uninitialized if you did not use gc::PTB.
                 To initialize gc::PTB GC you must constuct cds::gc::PTB object in the beginning of your application
             */
             static gc::PTB::thread_gc_impl&   getPTBGC()
             {
-                assert( _threadData()->m_ptbManager );
-                return *(_threadData()->m_ptbManager);
+                ThreadData * p = attached_data();
+                assert( p->m_ptbManager != nullptr );
+                return *(p->m_ptbManager);
             }
 
             //@cond
             static size_t fake_current_processor()
             {
-                return _threadData()->fake_current_processor();
+                return attached_data()->fake_current_processor();
             }
             //@endcond
         };
@@ -16,6 +16,11 @@ namespace cds { namespace threading {
         /// Thread-specific data manager based on pthread thread-specific data functions
         /**
             Manager throws an exception of Manager::pthread_exception class if an error occurs
+
+            The thread that uses a GC without \p attachThread() call is attached lazily on the first access
+            to its thread-specific data (for example, on first container operation), and it is detached
+            automatically by the TLS key destructor when the thread terminates.
+            \p ThreadData objects are recycled by \p thread_data_pool.
         */
         class Manager {
         private :
@@ -46,7 +51,7 @@ namespace cds { namespace threading {
                 {
                     if ( p ) {
                         reinterpret_cast<ThreadData *>(p)->fini();
-                        delete reinterpret_cast<ThreadData *>(p);
+                        thread_data_pool::instance().free( reinterpret_cast<ThreadData *>(p) );
                     }
                 }
 
@@ -72,16 +77,18 @@ namespace cds { namespace threading {
                 static void alloc()
                 {
                     pthread_error_code  nErr;
-                    ThreadData * pData = new ThreadData;
-                    if ( ( nErr = pthread_setspecific( m_key, pData )) != 0 )
+                    ThreadData * pData = thread_data_pool::instance().alloc();
+                    if ( ( nErr = pthread_setspecific( m_key, pData )) != 0 ) {
+                        thread_data_pool::instance().free( pData );
                         throw pthread_exception( nErr, "pthread_setspecific" );
+                    }
                 }
                 static void free()
                 {
                     ThreadData * p = get();
                     pthread_setspecific( m_key, nullptr );
                     if ( p )
-                        delete p;
+                        thread_data_pool::instance().free( p );
                 }
             //@endcond
             };
@@ -121,6 +128,18 @@ namespace cds { namespace threading {
                 assert(false)   ;   // how did we get here?
                 return nullptr;
             }
+
+            // Returns ThreadData of current thread; attaches the thread if it is not attached yet.
+            // The lazily attached thread is detached by the TLS key destructor when the thread terminates
+            static ThreadData * attached_data()
+            {
+                ThreadData * pData = Holder::get();
+                if ( !pData ) {
+                    attachThread();
+                    pData = Holder::get();
+                }
+                return pData;
+            }
             //@endcond
 
         public:
@@ -190,46 +209,46 @@ namespace cds { namespace threading {
             /// Returns ThreadData pointer for the current thread
             static ThreadData * thread_data()
             {
-                return _threadData( do_getData );
+                return attached_data();
             }
 
             /// Get gc::HP thread GC implementation for current thread
             /**
-                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
-                or if you did not use gc::HP.
+                If the current thread is not attached yet, it is attached automatically (see \ref Manager).
+                The object returned may be uninitialized if you did not use gc::HP.
                 To initialize gc::HP GC you must constuct cds::gc::HP object in the beginning of your application
             */
             static gc::HP::thread_gc_impl&   getHZPGC()
             {
-                return *(_threadData( do_getData )->m_hpManager);
+                return *(attached_data()->m_hpManager);
             }
 
             /// Get gc::HRC thread GC implementation for current thread
             /**
-                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
-                or if you did not use gc::HRC.
+                If the current thread is not attached yet, it is attached automatically (see \ref Manager).
+                The object returned may be uninitialized if you did not use gc::HRC.
                 To initialize gc::HRC GC you must constuct cds::gc::HRC object in the beginning of your application
             */
             static gc::HRC::thread_gc_impl&   getHRCGC()
             {
-                return *(_threadData( do_getData )->m_hrcManager);
+                return *(attached_data()->m_hrcManager);
             }
 
             /// Get gc::PTB thread GC implementation for current thread
             /**
-                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
-                or if you did not use gc::PTB.
+                If the current thread is not attached yet, it is attached automatically (see \ref Manager).
+                The object returned may be uninitialized if you did not use gc::PTB.
                 To initialize gc::PTB GC you must constuct cds::gc::PTB object in the beginning of your application
             */
             static gc::PTB::thread_gc_impl&   getPTBGC()
             {
-                return *(_threadData( do_getData )->m_ptbManager);
+                return *(attached_data()->m_ptbManager);
             }
 
             //@cond
             static size_t fake_current_processor()
             {
-                return _threadData( do_getData )->fake_current_processor();
+                return attached_data()->fake_current_processor();
             }
             //@endcond
 
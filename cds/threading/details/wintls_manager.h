@@ -82,16 +82,19 @@ namespace cds { namespace threading {
 
                 static void alloc()
                 {
-                    ThreadData * pData = new ThreadData;
-                    if ( !::TlsSetValue( m_key, pData ))
-                        throw api_exception( ::GetLastError(), "TlsSetValue" );
+                    ThreadData * pData = thread_data_pool::instance().alloc();
+                    if ( !::TlsSetValue( m_key, pData )) {
+                        api_error_code nErr = ::GetLastError();
+                        thread_data_pool::instance().free( pData );
+                        throw api_exception( nErr, "TlsSetValue" );
+                    }
                 }
                 static void free()
                 {
                     ThreadData * p = get();
                     ::TlsSetValue( m_key, nullptr );
                     if ( p )
-                        delete p;
+                        thread_data_pool::instance().free( p );
                 }
             };
             //@endcond
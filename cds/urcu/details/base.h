@@ -5,6 +5,7 @@
 
 #include <cds/cxx11_atomic.h>
 #include <cds/gc/details/retired_ptr.h>
+#include <cds/gc/telemetry.h>
 #include <cds/details/allocator.h>
 #include <cds/os/thread.h>
 #include <cds/details/marked_ptr.h>
@@ -379,6 +380,17 @@ namespace cds {
                     return m_pHead.load( mo );
                 }
 
+                // Adds telemetry counters of thread records to s
+                void collect_telemetry( cds::gc::telemetry::snapshot& s ) const
+                {
+                    cds::OS::ThreadId const nullThreadId = cds::OS::c_NullThreadId;
+                    for ( thread_record * pRec = m_pHead.load( atomics::memory_order_acquire ); pRec; pRec = pRec->m_list.m_pNext ) {
+                        if ( pRec->m_list.m_idOwner.load( atomics::memory_order_relaxed ) != nullThreadId )
+                            ++s.nThreadCount;
+                        pRec->m_Telemetry.collect( s );
+                    }
+                }
+
             private:
                 void destroy()
                 {
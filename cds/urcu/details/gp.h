@@ -70,6 +70,16 @@ namespace cds { namespace urcu { namespace details {
 
 
     // gp_singleton
+    template <typename RCUtag>
+    inline void gp_singleton<RCUtag>::on_retire( size_t nCount )
+    {
+        thread_record * pRec = cds::threading::Manager::isThreadAttached() ? cds::threading::getRCU<RCUtag>() : nullptr;
+        if ( pRec )
+            pRec->m_Telemetry.onRetire( nCount );
+        else
+            m_Telemetry.onRetire( nCount );
+    }
+
     template <typename RCUtag>
     inline bool gp_singleton<RCUtag>::check_grace_period( typename gp_singleton<RCUtag>::thread_record * pRec ) const
     {
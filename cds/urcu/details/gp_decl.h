@@ -17,6 +17,7 @@ namespace cds { namespace urcu { namespace details {
     template <> struct thread_data<tag_> { \
         atomics::atomic<uint32_t>        m_nAccessControl ; \
         thread_list_record< thread_data >   m_list ; \
+        cds::gc::telemetry::thread_counters m_Telemetry ; \
         thread_data(): m_nAccessControl(0) {} \
         ~thread_data() {} \
     }
@@ -103,6 +104,7 @@ namespace cds { namespace urcu { namespace details {
     protected:
         atomics::atomic<uint32_t>    m_nGlobalControl;
         thread_list< rcu_tag >          m_ThreadList;
+        cds::gc::telemetry::shared_counters m_Telemetry;    // grace periods and objects retired by not attached threads
 
     protected:
         gp_singleton()
@@ -142,7 +144,29 @@ namespace cds { namespace urcu { namespace details {
             return m_nGlobalControl.load( mo );
         }
 
+        // nDisposed - count of objects freed by reclamation thread of threaded RCU
+        void get_telemetry( cds::gc::telemetry::snapshot& s, size_t nDisposed = 0 ) const
+        {
+            s.clear();
+            m_Telemetry.collect( s );
+            m_ThreadList.collect_telemetry( s );
+            s.nScanCount = s.nGracePeriodCount;
+            s.nReclaimed += nDisposed;
+            s.nBacklog = s.nRetired > s.nReclaimed ? s.nRetired - s.nReclaimed : 0;
+        }
+
     protected:
+        void on_retire( size_t nCount );
+        void on_grace_period( uint64_t nDuration )
+        {
+            // Called under synchronization lock
+            m_Telemetry.onGracePeriod( nDuration );
+        }
+        void on_reclaim( size_t nCount )
+        {
+            m_Telemetry.onReclaim( nCount );
+        }
+
         bool check_grace_period( thread_record * pRec ) const;
 
         template <class Backoff>
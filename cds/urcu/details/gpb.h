@@ -109,14 +109,18 @@ namespace cds { namespace urcu {
         void clear_buffer( uint64_t nEpoch )
         {
             epoch_retired_ptr p;
+            size_t nCount = 0;
             while ( m_Buffer.pop( p )) {
-                if ( p.m_nEpoch <= nEpoch )
+                if ( p.m_nEpoch <= nEpoch ) {
                     p.free();
+                    ++nCount;
+                }
                 else {
                     push_buffer( p );
                     break;
                 }
             }
+            base_class::on_reclaim( nCount );
         }
 
         // Return: true - synchronize has been called, false - otherwise
@@ -125,8 +129,10 @@ namespace cds { namespace urcu {
             bool bPushed = m_Buffer.push( ep );
             if ( !bPushed || m_Buffer.size() >= capacity() ) {
                 synchronize();
-                if ( !bPushed )
+                if ( !bPushed ) {
                     ep.free();
+                    base_class::on_reclaim( 1 );
+                }
                 return true;
             }
             return false;
@@ -166,6 +172,7 @@ namespace cds { namespace urcu {
         virtual void retire_ptr( retired_ptr& p )
         {
             if ( p.m_p ) {
+                base_class::on_retire( 1 );
                 epoch_retired_ptr ep( p, m_nCurEpoch.load( atomics::memory_order_relaxed ));
                 push_buffer( ep );
             }
@@ -176,11 +183,14 @@ namespace cds { namespace urcu {
         void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
         {
             uint64_t nEpoch = m_nCurEpoch.load( atomics::memory_order_relaxed );
+            size_t nCount = 0;
             while ( itFirst != itLast ) {
                 epoch_retired_ptr ep( *itFirst, nEpoch );
                 ++itFirst;
+                ++nCount;
                 push_buffer( ep );
             }
+            base_class::on_retire( nCount );
         }
 
         /// Wait to finish a grace period and then clear the buffer
@@ -200,8 +210,10 @@ namespace cds { namespace urcu {
                 if ( ep.m_p && m_Buffer.push( ep ) )
                     return false;
                 nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
+                cds::gc::telemetry::stopwatch sw;
                 flip_and_wait();
                 flip_and_wait();
+                base_class::on_grace_period( sw.elapsed() );
             }
             clear_buffer( nEpoch );
             atomics::atomic_thread_fence( atomics::memory_order_release );
@@ -214,6 +226,12 @@ namespace cds { namespace urcu {
         {
             return m_nCapacity;
         }
+
+        /// Fills RCU telemetry snapshot \p s, see \ref cds_gc_telemetry "telemetry"
+        void get_telemetry( cds::gc::telemetry::snapshot& s ) const
+        {
+            base_class::get_telemetry( s );
+        }
     };
 
 }} // namespace cds::urcu
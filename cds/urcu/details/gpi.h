@@ -112,8 +112,11 @@ namespace cds { namespace urcu {
         virtual void retire_ptr( retired_ptr& p )
         {
             synchronize();
-            if ( p.m_p )
+            if ( p.m_p ) {
+                base_class::on_retire( 1 );
                 p.free();
+                base_class::on_reclaim( 1 );
+            }
         }
 
         /// Retires the pointer chain [\p itFirst, \p itLast)
@@ -122,12 +125,17 @@ namespace cds { namespace urcu {
         {
             if ( itFirst != itLast ) {
                 synchronize();
+                size_t nCount = 0;
                 while ( itFirst != itLast ) {
                     retired_ptr p( *itFirst );
                     ++itFirst;
-                    if ( p.m_p )
+                    if ( p.m_p ) {
                         p.free();
+                        ++nCount;
+                    }
                 }
+                base_class::on_retire( nCount );
+                base_class::on_reclaim( nCount );
             }
         }
 
@@ -137,12 +145,20 @@ namespace cds { namespace urcu {
             atomics::atomic_thread_fence( atomics::memory_order_acquire );
             {
                 cds::lock::scoped_lock<lock_type> sl( m_Lock );
+                cds::gc::telemetry::stopwatch sw;
                 flip_and_wait();
                 flip_and_wait();
+                base_class::on_grace_period( sw.elapsed() );
             }
             atomics::atomic_thread_fence( atomics::memory_order_release );
         }
 
+        /// Fills RCU telemetry snapshot \p s, see \ref cds_gc_telemetry "telemetry"
+        void get_telemetry( cds::gc::telemetry::snapshot& s ) const
+        {
+            base_class::get_telemetry( s );
+        }
+
         //@cond
         // Added for uniformity
         size_t CDS_CONSTEXPR capacity() const
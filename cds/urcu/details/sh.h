@@ -74,6 +74,16 @@ namespace cds { namespace urcu { namespace details {
 
 
     // sh_singleton
+    template <typename RCUtag>
+    inline void sh_singleton<RCUtag>::on_retire( size_t nCount )
+    {
+        thread_record * pRec = cds::threading::getRCU<RCUtag>();
+        if ( pRec )
+            pRec->m_Telemetry.onRetire( nCount );
+        else
+            m_Telemetry.onRetire( nCount );
+    }
+
     template <typename RCUtag>
     inline void sh_singleton<RCUtag>::set_signal_handler()
     {
@@ -106,14 +106,18 @@ namespace cds { namespace urcu {
         void clear_buffer( uint64_t nEpoch )
         {
             epoch_retired_ptr p;
+            size_t nCount = 0;
             while ( m_Buffer.pop( p )) {
-                if ( p.m_nEpoch <= nEpoch )
+                if ( p.m_nEpoch <= nEpoch ) {
                     p.free();
+                    ++nCount;
+                }
                 else {
                     push_buffer( p );
                     break;
                 }
             }
+            base_class::on_reclaim( nCount );
         }
 
         bool push_buffer( epoch_retired_ptr& ep )
@@ -121,8 +125,10 @@ namespace cds { namespace urcu {
             bool bPushed = m_Buffer.push( ep );
             if ( !bPushed || m_Buffer.size() >= capacity() ) {
                 synchronize();
-                if ( !bPushed )
+                if ( !bPushed ) {
                     ep.free();
+                    base_class::on_reclaim( 1 );
+                }
                 return true;
             }
             return false;
@@ -164,6 +170,7 @@ namespace cds { namespace urcu {
         virtual void retire_ptr( retired_ptr& p )
         {
             if ( p.m_p ) {
+                base_class::on_retire( 1 );
                 epoch_retired_ptr ep( p, m_nCurEpoch.load( atomics::memory_order_relaxed ));
                 push_buffer( ep );
             }
@@ -174,11 +181,14 @@ namespace cds { namespace urcu {
         void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
         {
             uint64_t nEpoch = m_nCurEpoch.load( atomics::memory_order_relaxed );
+            size_t nCount = 0;
             while ( itFirst != itLast ) {
                 epoch_retired_ptr ep( *itFirst, nEpoch );
                 ++itFirst;
+                ++nCount;
                 push_buffer( ep );
             }
+            base_class::on_retire( nCount );
         }
 
         /// Wait to finish a grace period and then clear the buffer
@@ -199,6 +209,7 @@ namespace cds { namespace urcu {
                     return false;
                 nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
 
+                cds::gc::telemetry::stopwatch sw;
                 back_off bkOff;
                 base_class::force_membar_all_threads( bkOff );
                 base_class::switch_next_epoch();
@@ -208,6 +219,7 @@ namespace cds { namespace urcu {
                 bkOff.reset();
                 base_class::wait_for_quiescent_state( bkOff );
                 base_class::force_membar_all_threads( bkOff );
+                base_class::on_grace_period( sw.elapsed() );
             }
 
             clear_buffer( nEpoch );
@@ -221,6 +233,12 @@ namespace cds { namespace urcu {
             return m_nCapacity;
         }
 
+        /// Fills RCU telemetry snapshot \p s, see \ref cds_gc_telemetry "telemetry"
+        void get_telemetry( cds::gc::telemetry::snapshot& s ) const
+        {
+            base_class::get_telemetry( s );
+        }
+
         /// Returns the signal number stated for RCU
         int signal_no() const
         {
@@ -112,8 +112,10 @@ namespace cds { namespace urcu {
             bool bPushed = m_Buffer.push( p );
             if ( !bPushed || m_Buffer.size() >= capacity() ) {
                 synchronize();
-                if ( !bPushed )
+                if ( !bPushed ) {
                     p.free();
+                    base_class::on_reclaim( 1 );
+                }
                 return true;
             }
             return false;
@@ -169,6 +171,7 @@ namespace cds { namespace urcu {
         virtual void retire_ptr( retired_ptr& p )
         {
             if ( p.m_p ) {
+                base_class::on_retire( 1 );
                 epoch_retired_ptr ep( p, m_nCurEpoch.load( atomics::memory_order_acquire ) );
                 push_buffer( ep );
             }
@@ -179,11 +182,14 @@ namespace cds { namespace urcu {
         void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
         {
             uint64_t nEpoch = m_nCurEpoch.load( atomics::memory_order_relaxed );
+            size_t nCount = 0;
             while ( itFirst != itLast ) {
                 epoch_retired_ptr p( *itFirst, nEpoch );
                 ++itFirst;
+                ++nCount;
                 push_buffer( p );
             }
+            base_class::on_retire( nCount );
         }
 
         /// Waits to finish a grace period and calls disposing thread
@@ -201,6 +207,7 @@ namespace cds { namespace urcu {
             {
                 cds::lock::scoped_lock<lock_type> sl( m_Lock );
 
+                cds::gc::telemetry::stopwatch sw;
                 back_off bkOff;
                 base_class::force_membar_all_threads( bkOff );
                 base_class::switch_next_epoch();
@@ -210,6 +217,7 @@ namespace cds { namespace urcu {
                 bkOff.reset();
                 base_class::wait_for_quiescent_state( bkOff );
                 base_class::force_membar_all_threads( bkOff );
+                base_class::on_grace_period( sw.elapsed() );
 
                 m_DisposerThread.dispose( m_Buffer, nPrevEpoch, bSync );
             }
@@ -226,6 +234,15 @@ namespace cds { namespace urcu {
             return m_nCapacity;
         }
 
+        /// Fills RCU telemetry snapshot \p s, see \ref cds_gc_telemetry "telemetry"
+        /**
+            The objects freed by the reclamation thread are counted as reclaimed.
+        */
+        void get_telemetry( cds::gc::telemetry::snapshot& s ) const
+        {
+            base_class::get_telemetry( s, m_DisposerThread.disposed_count() );
+        }
+
         /// Returns the signal number stated for RCU
         int signal_no() const
         {
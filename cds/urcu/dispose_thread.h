@@ -8,6 +8,7 @@
 #include <mutex>
 #include <condition_variable>
 #include <cds/details/aligned_type.h>
+#include <cds/cxx11_atomic.h>
 
 namespace cds { namespace urcu {
 
@@ -62,6 +63,9 @@ namespace cds { namespace urcu {
         // disposing pass sync
         condvar_type            m_cvReady;
         bool volatile           m_bReady;
+
+        // count of freed objects, modified by disposing thread only
+        atomics::atomic<size_t> m_nDisposed;
         //@endcond
 
     private: // methods called from disposing thread
@@ -101,14 +105,18 @@ namespace cds { namespace urcu {
         void dispose_buffer( buffer_type * pBuf, uint64_t nCurEpoch )
         {
             epoch_retired_ptr p;
+            size_t nCount = 0;
             while ( pBuf->pop( p ) ) {
-                if ( p.m_nEpoch <= nCurEpoch )
+                if ( p.m_nEpoch <= nCurEpoch ) {
                     p.free();
+                    ++nCount;
+                }
                 else {
                     pBuf->push( p );
                     break;
                 }
             }
+            m_nDisposed.store( m_nDisposed.load( atomics::memory_order_relaxed ) + nCount, atomics::memory_order_relaxed );
         }
         //@endcond
 
@@ -119,6 +127,7 @@ namespace cds { namespace urcu {
             , m_nCurEpoch(0)
             , m_bQuit( false )
             , m_bReady( false )
+            , m_nDisposed( 0 )
         {}
         //@endcond
 
@@ -192,6 +201,12 @@ namespace cds { namespace urcu {
                     m_cvReady.wait( lock );
             }
         }
+
+        /// Returns the count of objects freed by the reclamation thread
+        size_t disposed_count() const
+        {
+            return m_nDisposed.load( atomics::memory_order_relaxed );
+        }
     };
 }} // namespace cds::urcu
 
@@ -146,6 +146,15 @@ namespace cds { namespace urcu {
         {
             synchronize();
         }
+        /// Fills RCU telemetry snapshot \p s
+        /**
+            See \ref cds_gc_telemetry "telemetry" for explanation.
+        */
+        static cds::gc::telemetry::snapshot& get_telemetry( cds::gc::telemetry::snapshot& s )
+        {
+            rcu_implementation::instance()->get_telemetry( s );
+            return s;
+        }
     };
 
 }} // namespace cds::urcu
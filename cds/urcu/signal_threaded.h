@@ -166,6 +166,15 @@ namespace cds { namespace urcu {
         {
             rcu_implementation::instance()->force_dispose();
         }
+        /// Fills RCU telemetry snapshot \p s
+        /**
+            See \ref cds_gc_telemetry "telemetry" for explanation.
+        */
+        static cds::gc::telemetry::snapshot& get_telemetry( cds::gc::telemetry::snapshot& s )
+        {
+            rcu_implementation::instance()->get_telemetry( s );
+            return s;
+        }
     };
 
 }} // namespace cds::urcu
@@ -1,4 +1,9 @@
 CDS_TESTHDR_MAP := \
+    tests/test-hdr/map/hdr_art_map_rcu.cpp \
+    tests/test-hdr/map/hdr_bplus_tree_map_rcu.cpp \
+    tests/test-hdr/map/hdr_clock_cache.cpp \
+    tests/test-hdr/map/hdr_expiring_map.cpp \
+    tests/test-hdr/map/hdr_fat_skip_list_map_rcu.cpp \
     tests/test-hdr/map/hdr_michael_map_hp.cpp \
     tests/test-hdr/map/hdr_michael_map_hrc.cpp \
     tests/test-hdr/map/hdr_michael_map_ptb.cpp \
@@ -25,6 +30,7 @@ CDS_TESTHDR_MAP := \
     tests/test-hdr/map/hdr_refinable_hashmap_boost_flat_map.cpp \
     tests/test-hdr/map/hdr_refinable_hashmap_boost_unordered_map.cpp \
     tests/test-hdr/map/hdr_refinable_hashmap_slist.cpp \
+    tests/test-hdr/map/hdr_snapshot.cpp \
     tests/test-hdr/map/hdr_skiplist_map_hp.cpp \
     tests/test-hdr/map/hdr_skiplist_map_hrc.cpp \
     tests/test-hdr/map/hdr_skiplist_map_ptb.cpp \
@@ -63,7 +69,10 @@ CDS_TESTHDR_MAP := \
     tests/test-hdr/map/hdr_striped_map_reg.cpp
 
 CDS_TESTHDR_DEQUE := \
-    tests/test-hdr/deque/hdr_fcdeque.cpp
+    tests/test-hdr/deque/hdr_chase_lev_deque.cpp \
+    tests/test-hdr/deque/hdr_fcdeque.cpp \
+    tests/test-hdr/deque/hdr_intrusive_sundell_list.cpp \
+    tests/test-hdr/deque/hdr_sundell_list.cpp
 
 CDS_TESTHDR_ORDLIST := \
     tests/test-hdr/ordered_list/hdr_intrusive_lazy_hrc.cpp \
@@ -283,7 +292,14 @@ CDS_TESTHDR_MISC := \
     tests/test-hdr/misc/find_option.cpp \
     tests/test-hdr/misc/allocator_test.cpp \
     tests/test-hdr/misc/michael_allocator.cpp \
+    tests/test-hdr/misc/michael_thread_cache.cpp \
     tests/test-hdr/misc/hash_tuple.cpp \
+    tests/test-hdr/misc/fast_hash.cpp \
+    tests/test-hdr/misc/gc_batch_retire.cpp \
+    tests/test-hdr/misc/hp_fence.cpp \
+    tests/test-hdr/misc/hrc_deferred_rc.cpp \
+    tests/test-hdr/misc/ptb_unattached.cpp \
+    tests/test-hdr/misc/thread_lazy_attach.cpp \
     tests/test-hdr/misc/bitop_st.cpp \
     tests/test-hdr/misc/permutation_generator.cpp \
     tests/test-hdr/misc/thread_init_fini.cpp
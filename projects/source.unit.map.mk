@@ -1,5 +1,6 @@
 
 CDSUNIT_MAP_SOURCES := \
+    tests/unit/map2/map_cache_zipf.cpp \
     tests/unit/map2/map_find_int.cpp \
     tests/unit/map2/map_find_string.cpp \
     tests/unit/map2/map_insdel_func.cpp \
@@ -9,4 +10,5 @@ CDSUNIT_MAP_SOURCES := \
     tests/unit/map2/map_insdel_item_string.cpp \
     tests/unit/map2/map_insfind_int.cpp \
     tests/unit/map2/map_insdelfind.cpp \
+    tests/unit/map2/map_snapshot.cpp \
     tests/unit/map2/map_delodd.cpp
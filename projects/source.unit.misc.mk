@@ -5,4 +5,6 @@ CDSUNIT_MISC_SOURCES := \
     tests/unit/alloc/linux_scale.cpp \
     tests/unit/alloc/michael_allocator.cpp \
     tests/unit/alloc/random.cpp \
+    tests/unit/executor/bulk_insert.cpp \
+    tests/unit/executor/fork_join.cpp \
     tests/unit/lock/spinlock.cpp
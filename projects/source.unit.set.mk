@@ -9,4 +9,6 @@ CDSUNIT_SET_SOURCES := \
 	tests/unit/set2/set_insdel_func7.cpp \
 	tests/unit/set2/set_insdel_string.cpp \
 	tests/unit/set2/set_insdelfind.cpp \
+	tests/unit/set2/set_finger.cpp \
+	tests/unit/set2/set_find_next.cpp \
 	tests/unit/set2/set_delodd.cpp
@@ -21,6 +21,7 @@ namespace cds { namespace gc {
     namespace hrc {
 
         GarbageCollector * GarbageCollector::m_pGC = nullptr;
+        atomics::atomic<bool> GarbageCollector::m_bDeferredRC( false );
 
         GarbageCollector::GarbageCollector(
             size_t nHazardPtrCount,
@@ -36,6 +37,10 @@ namespace cds { namespace gc {
 
         GarbageCollector::~GarbageCollector()
         {
+            // Apply pending decrements before the nodes are freed
+            for ( thread_list_node * pNode = m_pListHead.load( atomics::memory_order_relaxed ); pNode; pNode = pNode->m_pNext )
+                pNode->m_DeferredRC.flush();
+
             thread_list_node * pNode = m_pListHead.load( atomics::memory_order_relaxed );
             while ( pNode ) {
                 assert( pNode->m_idOwner.load( atomics::memory_order_relaxed ) == cds::OS::c_NullThreadId );
@@ -63,7 +68,9 @@ namespace cds { namespace gc {
                 if ( nMaxTransientLinks == 0 )
                     nMaxTransientLinks = c_nHRCMaxTransientLinks;
 
-                size_t nRetiredNodeArraySize = nMaxThreadCount * ( nHazardPtrCount + nMaxNodeLinkCount + nMaxTransientLinks + 1 );
+                // Each pending decrement of deferred reference counting mode can hold one more node
+                size_t nRetiredNodeArraySize = nMaxThreadCount * ( nHazardPtrCount + nMaxNodeLinkCount + nMaxTransientLinks + 1
+                    + details::deferred_rc_buffer::c_nCapacity );
 
                 m_pGC = new GarbageCollector( nHazardPtrCount, nMaxThreadCount, nRetiredNodeArraySize );
             }
@@ -188,9 +195,15 @@ namespace cds { namespace gc {
 
             typedef std::vector< ContainerNode * > hazard_ptr_list;
 
+            cds::gc::telemetry::stopwatch sw;
+            size_t nReclaimed = 0;
+
             details::thread_descriptor * pRec = pThreadGC->m_pDesc;
             assert( static_cast< thread_list_node *>( pRec )->m_idOwner.load(atomics::memory_order_relaxed) == cds::OS::getCurrentThreadId() );
 
+            // Step 0: apply pending decrements of the thread
+            pRec->m_DeferredRC.flush_local();
+
             // Step 1: mark all pRec->m_arrRetired items as "traced"
             {
                 details::retired_vector::const_iterator itEnd = pRec->m_arrRetired.end();
@@ -255,6 +268,7 @@ namespace cds { namespace gc {
                             node.m_funcFree( pNode );
 
                             arr.pop( nRetired );
+                            ++nReclaimed;
                             CDS_HRC_STATISTIC( ++m_Stat.m_DeletedNode );
                             continue;
                         }
@@ -268,6 +282,8 @@ namespace cds { namespace gc {
                     }
                 }
             }
+
+            pRec->m_Telemetry.onScan( sw.elapsed(), nReclaimed );
         }
 
         void GarbageCollector::HelpScan( ThreadGC * pThis )
@@ -276,6 +292,7 @@ namespace cds { namespace gc {
                 return;
 
             CDS_HRC_STATISTIC( ++m_Stat.m_HelpScanCalls );
+            pThis->m_pDesc->m_Telemetry.onHelpScan();
 
             const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
             const cds::OS::ThreadId curThreadId  = cds::OS::getCurrentThreadId();
@@ -291,6 +308,7 @@ namespace cds { namespace gc {
 
                 // We own threadDesc.
                 assert( pRec->m_pOwner == nullptr );
+                pRec->m_DeferredRC.flush();
 
                 if ( !pRec->m_bFree ) {
                     // All undeleted pointers is moved to pThis (it is private for the current thread)
@@ -330,6 +348,10 @@ namespace cds { namespace gc {
             CDS_HRC_STATISTIC( ++m_Stat.m_CleanUpAllCalls );
 
             //const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
+            // Apply pending decrements of all threads, otherwise an idle thread could hold the nodes forever
+            for ( thread_list_node * pThread = m_pListHead.load(atomics::memory_order_acquire); pThread; pThread = pThread->m_pNext )
+                pThread->m_DeferredRC.flush();
+
             thread_list_node * pThread = m_pListHead.load(atomics::memory_order_acquire);
             while ( pThread ) {
                 for ( size_t i = 0; i < pThread->m_arrRetired.capacity(); ++i ) {
@@ -360,7 +382,9 @@ namespace cds { namespace gc {
             stat.nHRCRecAllocated            =
                 stat.nHRCRecUsed             =
                 stat.nTotalRetiredPtrCount   =
-                stat.nRetiredPtrInFreeHRCRecs = 0;
+                stat.nRetiredPtrInFreeHRCRecs =
+                stat.nDeferredRCDec          =
+                stat.nDeferredRCCanceled     = 0;
 
             // Walk through HRC records
             for ( thread_list_node *hprec = m_pListHead.load(atomics::memory_order_acquire); hprec; hprec = hprec->m_pNext ) {
@@ -373,6 +397,8 @@ namespace cds { namespace gc {
                     ++stat.nHRCRecUsed;
                 }
                 stat.nTotalRetiredPtrCount += nRetiredNodeCount;
+                stat.nDeferredRCDec += hprec->m_DeferredRC.deferred_count();
+                stat.nDeferredRCCanceled += hprec->m_DeferredRC.canceled_count();
             }
 
             // Events
@@ -395,6 +421,24 @@ namespace cds { namespace gc {
             return stat;
         }
 
+        cds::gc::telemetry::snapshot& GarbageCollector::getTelemetry( cds::gc::telemetry::snapshot& s ) const
+        {
+            s.clear();
+            for ( thread_list_node * hprec = m_pListHead.load(atomics::memory_order_acquire); hprec; hprec = hprec->m_pNext ) {
+                if ( hprec->m_idOwner.load( atomics::memory_order_relaxed ) != cds::OS::c_NullThreadId )
+                    ++s.nThreadCount;
+                for ( size_t i = 0; i < m_nHazardPointerCount; ++i ) {
+                    ContainerNode * hptr = hprec->m_hzp[i];
+                    if ( hptr )
+                        ++s.nGuardsInUse;
+                }
+                hprec->m_Telemetry.collect( s );
+            }
+
+            s.nBacklog = s.nRetired > s.nReclaimed ? s.nRetired - s.nReclaimed : 0;
+            return s;
+        }
+
         void ContainerNode::cleanUp( ThreadGC * /*pGC*/ )
         {
             CDS_PURE_VIRTUAL_FUNCTION_CALLED_("cds::gc::hrc::ContainerNode::cleanUp");
@@ -12,7 +12,14 @@
 #include <cds/gc/hzp/hzp.h>
 
 #include <algorithm>    // std::sort
+#include <cstdlib>      // std::abort
 #include "hzp_const.h"
+#include "reclaimer_thread.h"
+
+#if CDS_OS_TYPE == CDS_OS_LINUX
+#   include <unistd.h>
+#   include <sys/syscall.h>
+#endif
 
 #define    CDS_HAZARDPTR_STATISTIC( _x )    if ( m_bStatEnabled ) { _x; }
 
@@ -23,6 +30,71 @@ namespace cds { namespace gc {
         static const size_t c_nMaxRetireNodeCount = c_nHazardPointerPerThread * c_nMaxThreadCount * 2;
 
         GarbageCollector *    GarbageCollector::m_pHZPManager = nullptr;
+        atomics::atomic<bool> GarbageCollector::m_bAsymmetricFence( false );
+
+        namespace {
+#       if CDS_OS_TYPE == CDS_OS_LINUX && defined(SYS_membarrier)
+            // membarrier commands, see linux/membarrier.h
+            static const int c_nMembarrierQuery = 0;
+            static const int c_nMembarrierPrivateExpedited = 1 << 3;
+            static const int c_nMembarrierRegisterPrivateExpedited = 1 << 4;
+
+            static int membarrier( int nCmd )
+            {
+                return static_cast<int>( ::syscall( SYS_membarrier, nCmd, 0 ));
+            }
+
+            static bool register_membarrier()
+            {
+                int nCmdMask = membarrier( c_nMembarrierQuery );
+                if ( nCmdMask < 0
+                    || !(nCmdMask & c_nMembarrierPrivateExpedited)
+                    || !(nCmdMask & c_nMembarrierRegisterPrivateExpedited) )
+                {
+                    return false;
+                }
+                return membarrier( c_nMembarrierRegisterPrivateExpedited ) == 0;
+            }
+
+            static bool heavy_fence()
+            {
+                return membarrier( c_nMembarrierPrivateExpedited ) == 0;
+            }
+#       else
+            static bool register_membarrier()
+            {
+                return false;
+            }
+
+            static bool heavy_fence()
+            {
+                return false;
+            }
+#       endif
+        } // namespace
+
+        bool CDS_STDCALL GarbageCollector::enableAsymmetricFence()
+        {
+            if ( !m_bAsymmetricFence.load( atomics::memory_order_acquire ) && register_membarrier() )
+                m_bAsymmetricFence.store( true, atomics::memory_order_release );
+            return m_bAsymmetricFence.load( atomics::memory_order_acquire );
+        }
+
+        inline void GarbageCollector::scan_fence()
+        {
+            if ( m_bAsymmetricFence.load( atomics::memory_order_acquire )) {
+                // The readers issue compiler barrier only, the system-wide barrier makes their hazard pointers visible.
+                // A local fence cannot replace it: it does not order the stores of other threads,
+                // so the scan could miss a hazard pointer and free the guarded object.
+                // membarrier cannot fail after successful registration, so the failure is fatal
+                if ( !heavy_fence() ) {
+                    assert( false );
+                    std::abort();
+                }
+            }
+            else
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+        }
 
         void CDS_STDCALL GarbageCollector::Construct( size_t nHazardPtrCount, size_t nMaxThreadCount, size_t nMaxRetiredPtrCount, scan_type nScanType )
         {
@@ -34,6 +106,7 @@ namespace cds { namespace gc {
         void CDS_STDCALL GarbageCollector::Destruct( bool bDetachAll )
         {
             if ( m_pHZPManager ) {
+                m_pHZPManager->stopReclaimer();
                 if ( bDetachAll )
                     m_pHZPManager->detachAllThread();
 
@@ -54,6 +127,9 @@ namespace cds { namespace gc {
             ,m_nMaxThreadCount( nMaxThreadCount == 0 ? c_nMaxThreadCount : nMaxThreadCount )
             ,m_nMaxRetiredPtrCount( nMaxRetiredPtrCount > c_nMaxRetireNodeCount ? nMaxRetiredPtrCount : c_nMaxRetireNodeCount )
             ,m_nScanType( nScanType )
+            ,m_pReclaimer( nullptr )
+            ,m_nReclaimerPassCount( 0 )
+            ,m_nReclaimerScanTime( 0 )
         {}
 
         GarbageCollector::~GarbageCollector()
@@ -142,7 +218,9 @@ namespace cds { namespace gc {
             CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_RetireHPRec );
 
             pRec->clear();
-            Scan( pRec );
+            // Scan is useless if the thread has nothing retired; it is the most part of the detach cost
+            if ( pRec->m_arrRetired.size() )
+                Scan( pRec );
             hplist_node * pNode = static_cast<hplist_node *>( pRec );
             pNode->m_idOwner.store( cds::OS::c_NullThreadId, atomics::memory_order_release );
         }
@@ -159,7 +237,7 @@ namespace cds { namespace gc {
             }
         }
 
-        void GarbageCollector::classic_scan( details::HPRec * pRec )
+        void GarbageCollector::classic_scan( details::HPRec * pRec, details::retired_ptr * pBatch, size_t nBatchSize )
         {
             CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_ScanCallCount );
 
@@ -169,6 +247,7 @@ namespace cds { namespace gc {
 
             // Stage 1: Scan HP list and insert non-null values in plist
 
+            scan_fence();
             hplist_node * pNode = m_pListHead.load(atomics::memory_order_acquire);
 
             while ( pNode ) {
@@ -203,6 +282,16 @@ namespace cds { namespace gc {
                     DeletePtr( *itRetired );
                 ++itRetired;
             }
+
+            // The pointers guarded are not more than the hazard pointers, so the array cannot overflow
+            for ( details::retired_ptr * pEnd = pBatch + nBatchSize; pBatch != pEnd; ++pBatch ) {
+                if ( std::binary_search( itBegin, itEnd, pBatch->m_p )) {
+                    CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_DeferredNode );
+                    arrRetired.push( *pBatch );
+                }
+                else
+                    DeletePtr( *pBatch );
+            }
         }
 
         void GarbageCollector::inplace_scan( details::HPRec * pRec )
@@ -230,6 +319,7 @@ namespace cds { namespace gc {
 
             // Search guarded pointers in retired array
 
+            scan_fence();
             hplist_node * pNode = m_pListHead.load(atomics::memory_order_acquire);
 
             while ( pNode ) {
@@ -268,6 +358,7 @@ namespace cds { namespace gc {
         void GarbageCollector::HelpScan( details::HPRec * pThis )
         {
             CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_HelpScanCallCount );
+            pThis->m_Telemetry.onHelpScan();
 
             assert( static_cast<hplist_node *>(pThis)->m_idOwner.load(atomics::memory_order_relaxed) == cds::OS::getCurrentThreadId() );
 
@@ -316,6 +407,118 @@ namespace cds { namespace gc {
             }
         }
 
+        // Background reclamation thread
+        class GarbageCollector::reclaimer: public cds::gc::details::reclaimer_thread
+        {
+            // Retired array handed off by a thread
+            struct batch {
+                batch *                             pNext;
+                std::vector< details::retired_ptr > arrRetired;
+            };
+
+            GarbageCollector&           m_gc;
+            size_t const                m_nMaxPending;
+            atomics::atomic<batch *>    m_pBatches  ;   // stack of batches
+            atomics::atomic<size_t>     m_nPending  ;   // count of batches in m_pBatches
+            details::HPRec *            m_pRec      ;   // HP record of the reclamation thread
+
+        public:
+            reclaimer( GarbageCollector& gc, size_t nMaxPending )
+                : m_gc( gc )
+                , m_nMaxPending( nMaxPending ? nMaxPending : 1 )
+                , m_pBatches( nullptr )
+                , m_nPending( 0 )
+                , m_pRec( nullptr )
+            {}
+
+            bool push( details::HPRec * pRec )
+            {
+                if ( m_nPending.load( atomics::memory_order_relaxed ) >= m_nMaxPending )
+                    return false;
+
+                batch * pBatch = new batch;
+                details::retired_vector& arr = pRec->m_arrRetired;
+                pBatch->arrRetired.assign( arr.begin(), arr.end() );
+                arr.clear();
+
+                m_nPending.fetch_add( 1, atomics::memory_order_relaxed );
+                batch * pHead = m_pBatches.load( atomics::memory_order_relaxed );
+                do {
+                    pBatch->pNext = pHead;
+                } while ( !m_pBatches.compare_exchange_weak( pHead, pBatch, atomics::memory_order_release, atomics::memory_order_relaxed ));
+
+                wakeup();
+                return true;
+            }
+
+        protected:
+            virtual void on_start()
+            {
+                m_pRec = m_gc.AllocateHPRec();
+            }
+
+            virtual void on_stop()
+            {
+                assert( m_pBatches.load( atomics::memory_order_relaxed ) == nullptr );
+                m_gc.RetireHPRec( m_pRec );
+                m_pRec = nullptr;
+            }
+
+            virtual void reclaim()
+            {
+                details::retired_vector& arrRetired = m_pRec->m_arrRetired;
+
+                batch * pBatch = m_pBatches.exchange( nullptr, atomics::memory_order_acquire );
+                while ( pBatch ) {
+                    for ( std::vector< details::retired_ptr >::const_iterator it = pBatch->arrRetired.begin(); it != pBatch->arrRetired.end(); ++it ) {
+                        arrRetired.push( *it );
+                        if ( arrRetired.isFull() )
+                            m_gc.Scan( m_pRec );
+                    }
+
+                    batch * pNext = pBatch->pNext;
+                    delete pBatch;
+                    pBatch = pNext;
+                    m_nPending.fetch_sub( 1, atomics::memory_order_relaxed );
+                }
+
+                m_gc.Scan( m_pRec );
+                m_gc.HelpScan( m_pRec );
+            }
+        };
+
+        void GarbageCollector::startReclaimer( size_t nMaxPendingBatches )
+        {
+            if ( !m_pReclaimer ) {
+                m_pReclaimer = new reclaimer( *this, nMaxPendingBatches );
+                m_pReclaimer->start();
+            }
+        }
+
+        void GarbageCollector::stopReclaimer()
+        {
+            if ( m_pReclaimer ) {
+                reclaimer * p = m_pReclaimer;
+                m_pReclaimer = nullptr;
+                p->stop();
+
+                // Collect the reclamation thread statistics before the object is deleted
+                m_nReclaimerPassCount += p->pass_count();
+                m_nReclaimerScanTime += p->scan_time();
+                delete p;
+            }
+        }
+
+        bool GarbageCollector::handOffBatch( details::HPRec * pRec )
+        {
+            if ( m_pReclaimer->push( pRec )) {
+                CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_ReclaimerBatch );
+                return true;
+            }
+            CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_ReclaimerBackpressure );
+            return false;
+        }
+
         GarbageCollector::InternalState& GarbageCollector::getInternalState( GarbageCollector::InternalState& stat) const
         {
             stat.nHPCount                = m_nHazardPointerCount;
@@ -356,9 +559,36 @@ namespace cds { namespace gc {
             stat.evcDeletedNode  = m_Stat.m_DeletedNode;
             stat.evcDeferredNode = m_Stat.m_DeferredNode;
 
+            stat.evcReclaimerBatch          = m_Stat.m_ReclaimerBatch;
+            stat.evcReclaimerBackpressure   = m_Stat.m_ReclaimerBackpressure;
+            stat.nReclaimerPassCount        = m_nReclaimerPassCount;
+            stat.nReclaimerScanTime         = m_nReclaimerScanTime;
+            if ( m_pReclaimer ) {
+                stat.nReclaimerPassCount += m_pReclaimer->pass_count();
+                stat.nReclaimerScanTime  += m_pReclaimer->scan_time();
+            }
+
             return stat;
         }
 
+        cds::gc::telemetry::snapshot& GarbageCollector::getTelemetry( cds::gc::telemetry::snapshot& s ) const
+        {
+            s.clear();
+            for ( hplist_node * hprec = m_pListHead.load(atomics::memory_order_acquire); hprec; hprec = hprec->m_pNextNode ) {
+                if ( !hprec->m_bFree.load( atomics::memory_order_relaxed ))
+                    ++s.nThreadCount;
+                for ( size_t i = 0; i < m_nHazardPointerCount; ++i ) {
+                    void * hptr = hprec->m_hzp[i];
+                    if ( hptr )
+                        ++s.nGuardsInUse;
+                }
+                hprec->m_Telemetry.collect( s );
+            }
+
+            // The retired pointers of the batches handed off to the reclamation thread are counted too
+            s.nBacklog = s.nRetired > s.nReclaimed ? s.nRetired - s.nReclaimed : 0;
+            return s;
+        }
 
     } //namespace hzp
 }} // namespace cds::gc
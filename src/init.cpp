@@ -23,6 +23,7 @@ namespace cds {
 
     CDS_EXPORT_API atomics::atomic<size_t> threading::ThreadData::s_nLastUsedProcNo(0);
     CDS_EXPORT_API size_t threading::ThreadData::s_nProcCount = 1;
+    CDS_EXPORT_API threading::thread_data_pool threading::thread_data_pool::s_Instance;
 
 #if CDS_OS_INTERFACE == CDS_OSI_WINDOWS
     CDS_EXPORT_API DWORD cds::threading::wintls::Manager::Holder::m_key = TLS_OUT_OF_INDEXES;
@@ -35,13 +36,13 @@ namespace cds {
 
 #   if CDS_COMPILER == CDS_COMPILER_GCC || CDS_COMPILER == CDS_COMPILER_CLANG
         __thread threading::gcc_internal::ThreadDataPlaceholder CDS_DATA_ALIGNMENT(8) threading::gcc_internal::s_threadData;
-        __thread threading::ThreadData * threading::gcc_internal::s_pThreadData = nullptr;
+        __thread threading::ThreadData * threading::gcc_internal::s_pThreadData CDS_TLS_INITIAL_EXEC = nullptr;
 #   endif
 #endif
 
 #ifdef CDS_CXX11_THREAD_LOCAL_SUPPORT
     thread_local threading::cxx11_internal::ThreadDataPlaceholder CDS_DATA_ALIGNMENT(8) threading::cxx11_internal::s_threadData;
-    thread_local threading::ThreadData * threading::cxx11_internal::s_pThreadData = nullptr;
+    thread_local threading::ThreadData * threading::cxx11_internal::s_pThreadData CDS_TLS_INITIAL_EXEC = nullptr;
 #endif
 
     namespace details {
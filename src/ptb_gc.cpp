@@ -7,6 +7,7 @@
 
 #include <cds/gc/ptb/ptb.h>
 #include <cds/algo/int_algo.h>
+#include "reclaimer_thread.h"
 
 namespace cds { namespace gc { namespace ptb {
 
@@ -91,7 +92,8 @@ namespace cds { namespace gc { namespace ptb {
 
             typedef std::pair<item_type, item_type>     list_range;
 
-            list_range free_all()
+            // Links all items by m_pNextFree field. The retired pointers are not freed
+            list_range extract_all()
             {
                 item_type pTail = nullptr;
                 list_range ret = std::make_pair( pTail, pTail );
@@ -108,12 +110,10 @@ namespace cds { namespace gc { namespace ptb {
                         pTail = pBucket;
                         for (;;) {
                             item_type pNext = pTail->m_pNext;
-                            pTail->m_ptr.free();
                             pTail->m_pNext = nullptr;
 
                             while ( pTail->m_pNextFree ) {
                                 pTail = pTail->m_pNextFree;
-                                pTail->m_ptr.free();
                                 pTail->m_pNext = nullptr;
                             }
 
@@ -148,6 +148,7 @@ namespace cds { namespace gc { namespace ptb {
     void CDS_STDCALL GarbageCollector::Destruct()
     {
         if ( m_pManager ) {
+            m_pManager->stopReclaimer();
             delete m_pManager;
             m_pManager = nullptr;
         }
@@ -157,12 +158,142 @@ namespace cds { namespace gc { namespace ptb {
         : m_nLiberateThreshold( nLiberateThreshold ? nLiberateThreshold : 1024 )
         , m_nInitialThreadGuardCount( nInitialThreadGuardCount ? nInitialThreadGuardCount : 8 )
         //, m_nInLiberate(0)
+        , m_pTelemetryList( nullptr )
+        , m_pReclaimer( nullptr )
+        , m_nMaxPending( 0 )
+        , m_nReclaimerPassCount( 0 )
+        , m_nReclaimerScanTime( 0 )
+        , m_nPendingChunks( 0 )
     {
+        for ( size_t i = 0; i < c_nLiberateSlotCount; ++i )
+            m_arrLiberateChunk[i].store( nullptr, atomics::memory_order_relaxed );
+    }
+
+    // Background reclamation thread
+    class GarbageCollector::reclaimer: public cds::gc::details::reclaimer_thread
+    {
+        GarbageCollector&           m_gc;
+        details::thread_telemetry * m_pTelemetry    ;   // telemetry record of the reclamation thread
+    public:
+        reclaimer( GarbageCollector& gc )
+            : m_gc( gc )
+            , m_pTelemetry( nullptr )
+        {}
+
+    protected:
+        virtual void on_start()
+        {
+            m_pTelemetry = m_gc.allocTelemetry();
+        }
+
+        virtual void on_stop()
+        {
+            m_gc.freeTelemetry( m_pTelemetry );
+            m_pTelemetry = nullptr;
+        }
+
+        virtual void reclaim()
+        {
+            m_gc.liberate( m_pTelemetry->m_Counters );
+        }
+    };
+
+    void GarbageCollector::startReclaimer( size_t nMaxPending )
+    {
+        if ( !m_pReclaimer ) {
+            m_nMaxPending = nMaxPending > 1 ? nMaxPending : 2;
+            m_pReclaimer = new reclaimer( *this );
+            m_pReclaimer->start();
+        }
+    }
+
+    void GarbageCollector::stopReclaimer()
+    {
+        if ( m_pReclaimer ) {
+            reclaimer * p = m_pReclaimer;
+            m_pReclaimer = nullptr;
+            p->stop();
+            m_nReclaimerPassCount += p->pass_count();
+            m_nReclaimerScanTime += p->scan_time();
+            delete p;
+        }
+    }
+
+    bool GarbageCollector::wakeupReclaimer( size_t nRetiredCount )
+    {
+        if ( nRetiredCount >= m_nLiberateThreshold.load(atomics::memory_order_relaxed) * m_nMaxPending ) {
+            // The reclamation thread lags
+            m_stat.m_nReclaimerBackpressure.fetch_add( 1, atomics::memory_order_relaxed );
+            return false;
+        }
+        m_pReclaimer->wakeup();
+        return true;
+    }
+
+    GarbageCollector::InternalState& GarbageCollector::getInternalState( GarbageCollector::InternalState& stat ) const
+    {
+        stat = m_stat;
+        stat.m_nReclaimerPassCount = m_nReclaimerPassCount;
+        stat.m_nReclaimerScanTime = m_nReclaimerScanTime;
+        if ( m_pReclaimer ) {
+            stat.m_nReclaimerPassCount += m_pReclaimer->pass_count();
+            stat.m_nReclaimerScanTime += m_pReclaimer->scan_time();
+        }
+        return stat;
+    }
+
+    details::thread_telemetry * GarbageCollector::allocTelemetry()
+    {
+        // First try to reuse a record of terminated thread
+        details::thread_telemetry * pRec = m_pTelemetryList.load( atomics::memory_order_acquire );
+        for ( ; pRec; pRec = pRec->m_pNext ) {
+            bool bFree = true;
+            if ( pRec->m_bFree.load( atomics::memory_order_relaxed )
+                && pRec->m_bFree.compare_exchange_strong( bFree, false, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+            {
+                return pRec;
+            }
+        }
+
+        pRec = new details::thread_telemetry;
+        details::thread_telemetry * pHead = m_pTelemetryList.load( atomics::memory_order_relaxed );
+        do {
+            pRec->m_pNext = pHead;
+        } while ( !m_pTelemetryList.compare_exchange_weak( pHead, pRec, atomics::memory_order_release, atomics::memory_order_relaxed ));
+        return pRec;
+    }
+
+    cds::gc::telemetry::snapshot& GarbageCollector::getTelemetry( cds::gc::telemetry::snapshot& s ) const
+    {
+        s.clear();
+        for ( details::thread_telemetry * pRec = m_pTelemetryList.load( atomics::memory_order_acquire ); pRec; pRec = pRec->m_pNext ) {
+            if ( !pRec->m_bFree.load( atomics::memory_order_relaxed ))
+                ++s.nThreadCount;
+            pRec->m_Counters.collect( s );
+        }
+        m_UnattachedTelemetry.m_Counters.collect( s );
+
+        for ( details::guard_data * pGuard = m_GuardPool.begin(); pGuard; pGuard = pGuard->pGlobalNext.load(atomics::memory_order_acquire) ) {
+            if ( pGuard->pPost.load( atomics::memory_order_relaxed ))
+                ++s.nGuardsInUse;
+        }
+
+        s.nBacklog = m_RetiredBuffer.size();
+        return s;
     }
 
     GarbageCollector::~GarbageCollector()
     {
-        liberate();
+        // The counters are not needed anymore
+        cds::gc::telemetry::thread_counters tm;
+        liberate( tm );
+
+        details::thread_telemetry * pRec = m_pTelemetryList.exchange( nullptr, atomics::memory_order_relaxed );
+        while ( pRec ) {
+            details::thread_telemetry * pNext = pRec->m_pNext;
+            delete pRec;
+            pRec = pNext;
+        }
 
 #if 0
         details::retired_ptr_node * pHead = nullptr;
@@ -187,8 +318,11 @@ namespace cds { namespace gc { namespace ptb {
 #endif
     }
 
-    void GarbageCollector::liberate()
+    void GarbageCollector::liberate( cds::gc::telemetry::thread_counters& tm )
     {
+        cds::gc::telemetry::stopwatch sw;
+        size_t nReclaimed = 0;
+
         details::retired_ptr_buffer::privatize_result retiredList = m_RetiredBuffer.privatize();
         if ( retiredList.first ) {
 
@@ -227,19 +361,100 @@ namespace cds { namespace gc { namespace ptb {
             }
 
             // Free all retired pointers
-            details::liberate_set::list_range range = set.free_all();
+            details::liberate_set::list_range range = set.extract_all();
 
             m_RetiredAllocator.inc_epoch();
 
             if ( range.first ) {
                 assert( range.second != nullptr );
-                m_RetiredAllocator.free_range( range.first, range.second );
+                nReclaimed = freeRetired( range.first );
             }
             else {
                 // liberate cycle did not free any retired pointer - double liberate threshold
                 m_nLiberateThreshold.compare_exchange_strong( nLiberateThreshold, nLiberateThreshold * 2, atomics::memory_order_release, atomics::memory_order_relaxed );
             }
         }
+
+        // Free the chunks published by this or concurrent liberate calls that nobody has taken yet
+        for ( size_t nFreed = helpLiberate(); nFreed; nFreed = helpLiberate() )
+            nReclaimed += nFreed;
+
+        tm.onScan( sw.elapsed(), nReclaimed );
+    }
+
+    size_t GarbageCollector::freeRetired( details::retired_ptr_node * pList )
+    {
+        size_t nFreed = 0;
+        // Split the list into chunks. The first chunk is freed by current thread,
+        // the others are published for the threads that call liberate or retirePtr concurrently
+        details::retired_ptr_node * pRest = pList;
+        bool bFirst = true;
+        while ( pRest ) {
+            details::retired_ptr_node * pChunk = pRest;
+            details::retired_ptr_node * pTail = pChunk;
+            for ( size_t n = 1; n < c_nLiberateChunkSize && pTail->m_pNextFree; ++n )
+                pTail = pTail->m_pNextFree;
+            pRest = pTail->m_pNextFree;
+            pTail->m_pNextFree = nullptr;
+
+            if ( bFirst )
+                bFirst = false;
+            else if ( !publishChunk( pChunk ))
+                nFreed += freeChunk( pChunk );
+        }
+
+        return nFreed + freeChunk( pList );
+    }
+
+    size_t GarbageCollector::freeChunk( details::retired_ptr_node * pChunk )
+    {
+        size_t nCount = 1;
+        details::retired_ptr_node * pTail = pChunk;
+        for (;;) {
+            pTail->m_ptr.free();
+            if ( !pTail->m_pNextFree )
+                break;
+            pTail = pTail->m_pNextFree;
+            ++nCount;
+        }
+        m_RetiredAllocator.free_range( pChunk, pTail );
+        return nCount;
+    }
+
+    bool GarbageCollector::publishChunk( details::retired_ptr_node * pChunk )
+    {
+        // The counter is incremented before publishing so it never underflows
+        m_nPendingChunks.fetch_add( 1, atomics::memory_order_relaxed );
+        for ( size_t i = 0; i < c_nLiberateSlotCount; ++i ) {
+            details::retired_ptr_node * pExpected = nullptr;
+            if ( m_arrLiberateChunk[i].load( atomics::memory_order_relaxed ) == nullptr
+                && m_arrLiberateChunk[i].compare_exchange_strong( pExpected, pChunk, atomics::memory_order_release, atomics::memory_order_relaxed ))
+            {
+                m_stat.m_nLiberateChunkCount.fetch_add( 1, atomics::memory_order_relaxed );
+                return true;
+            }
+        }
+        // All slots are busy
+        m_nPendingChunks.fetch_sub( 1, atomics::memory_order_relaxed );
+        return false;
+    }
+
+    size_t GarbageCollector::helpLiberate()
+    {
+        if ( m_nPendingChunks.load( atomics::memory_order_relaxed ) == 0 )
+            return 0;
+
+        for ( size_t i = 0; i < c_nLiberateSlotCount; ++i ) {
+            if ( m_arrLiberateChunk[i].load( atomics::memory_order_relaxed ) != nullptr ) {
+                // exchange is ABA-free: the thread that gets non-null chunk owns it
+                details::retired_ptr_node * pChunk = m_arrLiberateChunk[i].exchange( nullptr, atomics::memory_order_acquire );
+                if ( pChunk ) {
+                    m_nPendingChunks.fetch_sub( 1, atomics::memory_order_relaxed );
+                    return freeChunk( pChunk );
+                }
+            }
+        }
+        return 0;
     }
 
 #if 0
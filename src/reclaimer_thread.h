@@ -0,0 +1,132 @@
+//$$CDS-header$$
+
+#ifndef __CDSIMPL_RECLAIMER_THREAD_H
+#define __CDSIMPL_RECLAIMER_THREAD_H
+
+/*
+    File: reclaimer_thread.h
+
+    Background reclamation thread for Hazard Pointer and Pass The Buck GC
+*/
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cds/cxx11_atomic.h>
+
+namespace cds { namespace gc { namespace details {
+
+    // Reclamation thread
+    // The derived class defines reclamation pass (reclaim() function)
+    // and optional thread initialization and termination (on_start() and on_stop()).
+    // Any thread may request the reclamation pass by wakeup() call.
+    class reclaimer_thread
+    {
+        typedef std::mutex                      mutex_type;
+        typedef std::condition_variable         condvar_type;
+        typedef std::unique_lock< mutex_type >  unique_lock;
+
+        std::thread             m_Thread;
+        mutex_type              m_Mutex;
+        condvar_type            m_cvWakeup;
+        atomics::atomic<bool>   m_bPending  ;   // the reclamation pass is requested
+        bool                    m_bQuit     ;   // protected by m_Mutex
+
+        atomics::atomic<size_t> m_nPassCount;   // count of reclamation passes
+        atomics::atomic<size_t> m_nScanTime ;   // total duration of reclamation passes, microseconds
+
+    public:
+        reclaimer_thread()
+            : m_bPending( false )
+            , m_bQuit( false )
+            , m_nPassCount( 0 )
+            , m_nScanTime( 0 )
+        {}
+
+        virtual ~reclaimer_thread()
+        {
+            assert( !m_Thread.joinable() );
+        }
+
+        // Starts the thread
+        void start()
+        {
+            m_Thread = std::thread( thread_func, this );
+        }
+
+        // Stops the thread; the thread performs the last reclamation pass before exiting
+        void stop()
+        {
+            {
+                unique_lock lock( m_Mutex );
+                m_bQuit = true;
+            }
+            m_cvWakeup.notify_one();
+            m_Thread.join();
+        }
+
+        // Requests reclamation pass. If the pass has been already requested, the function does nothing
+        void wakeup()
+        {
+            if ( !m_bPending.exchange( true, atomics::memory_order_acq_rel ) ) {
+                unique_lock lock( m_Mutex );
+                m_cvWakeup.notify_one();
+            }
+        }
+
+        size_t pass_count() const
+        {
+            return m_nPassCount.load( atomics::memory_order_relaxed );
+        }
+
+        size_t scan_time() const
+        {
+            return m_nScanTime.load( atomics::memory_order_relaxed );
+        }
+
+    protected:
+        virtual void on_start() {}
+        virtual void on_stop()  {}
+        virtual void reclaim() = 0;
+
+    private:
+        static void thread_func( reclaimer_thread * pThis )
+        {
+            pThis->execute();
+        }
+
+        void execute()
+        {
+            on_start();
+
+            bool bQuit = false;
+            while ( !bQuit ) {
+                {
+                    unique_lock lock( m_Mutex );
+                    while ( !m_bPending.load( atomics::memory_order_acquire ) && !m_bQuit )
+                        m_cvWakeup.wait( lock );
+                    bQuit = m_bQuit;
+                }
+
+                m_bPending.store( false, atomics::memory_order_release );
+                pass();
+            }
+
+            on_stop();
+        }
+
+        void pass()
+        {
+            std::chrono::steady_clock::time_point tStart = std::chrono::steady_clock::now();
+            reclaim();
+            std::chrono::steady_clock::duration d = std::chrono::steady_clock::now() - tStart;
+
+            m_nPassCount.fetch_add( 1, atomics::memory_order_relaxed );
+            m_nScanTime.fetch_add( static_cast<size_t>( std::chrono::duration_cast<std::chrono::microseconds>( d ).count() ), atomics::memory_order_relaxed );
+        }
+    };
+
+}}} // namespace cds::gc::details
+
+#endif // #ifndef __CDSIMPL_RECLAIMER_THREAD_H
@@ -69,6 +69,10 @@ std::ostream& operator << (std::ostream& s, const cds::gc::hzp::GarbageCollector
         << "\n\t\tScan calls from HelpScan=" << stat.evcScanFromHelpScan
         << "\n\t\tretired objects deleting=" << stat.evcDeletedNode
         << "\n\t\tguarded objects on Scan=" << stat.evcDeferredNode
+        << "\n\t\tbatches handed off to reclaimer=" << stat.evcReclaimerBatch
+        << "\n\t\treclaimer backpressure events=" << stat.evcReclaimerBackpressure
+        << "\n\t\treclaimer passes=" << stat.nReclaimerPassCount
+        << "\n\t\treclaimer scan time, mcs=" << stat.nReclaimerScanTime
         << std::endl;
 
     return s;
@@ -92,6 +96,8 @@ std::ostream& operator << (std::ostream& s, const cds::gc::hrc::GarbageCollector
         << "\n\t\tretired objects deleting=" << stat.evcDeletedNode
         << "\n\t\tguarded nodes on Scan=" << stat.evcScanGuarded
         << "\n\t\tclaimed node on Scan=" << stat.evcScanClaimGuarded
+        << "\n\t\tdeferred RC decrements=" << stat.nDeferredRCDec
+        << "\n\t\tcanceled RC decrements=" << stat.nDeferredRCCanceled
 #ifdef _DEBUG
         << "\n\t\tnode constructed count=" << stat.evcNodeConstruct
         << "\n\t\tnode destructed count=" << stat.evcNodeDestruct
@@ -101,6 +107,22 @@ std::ostream& operator << (std::ostream& s, const cds::gc::hrc::GarbageCollector
     return s;
 }
 
+std::ostream& operator << (std::ostream& s, const cds::gc::telemetry::snapshot& t)
+{
+    s << "\n\t\tattached threads=" << t.nThreadCount
+        << "\n\t\tretired=" << t.nRetired
+        << "\n\t\treclaimed=" << t.nReclaimed
+        << "\n\t\tbacklog=" << t.nBacklog
+        << "\n\t\treclamation passes=" << t.nScanCount
+        << "\n\t\thelp passes=" << t.nHelpScanCount
+        << "\n\t\tguards in use=" << t.nGuardsInUse
+        << "\n\t\treclamation pass time p50/p99/max, ns <= "
+            << t.scanTime.percentile( 50 ) << " / " << t.scanTime.percentile( 99 ) << " / " << t.scanTime.percentile( 100 )
+        << std::endl;
+
+    return s;
+}
+
 namespace CppUnitMini
 {
   int TestCase::m_numErrors = 0;
@@ -154,6 +176,13 @@ namespace CppUnitMini
               cds::gc::hrc::GarbageCollector::internal_state stat;
               std::cout << cds::gc::hrc::GarbageCollector::instance().getInternalState( stat ) << std::endl;
           }
+
+          {
+              cds::gc::telemetry::snapshot s;
+              std::cout << "\nHP telemetry:" << cds::gc::HP::get_telemetry( s );
+              std::cout << "\nPTB telemetry:" << cds::gc::PTB::get_telemetry( s );
+              std::cout << "\nHRC telemetry:" << cds::gc::HRC::get_telemetry( s ) << std::endl;
+          }
       }
   }
 
@@ -419,6 +448,17 @@ int main(int argc, char** argv)
         std::cout << "     Hazard Pointer count: " << hzpGC.max_hazard_count() << "\n"
                   << "  Max thread count for HP: " << hzpGC.max_thread_count() << "\n"
                   << "Retired HP array capacity: " << hzpGC.retired_array_capacity() << "\n";
+
+        if ( cfg.getBool( "GC_reclaimer_thread", false )) {
+            cds::gc::HP::start_reclaimer();
+            cds::gc::PTB::start_reclaimer();
+            std::cout << "Use background reclamation thread for HP and PTB\n";
+        }
+
+        if ( cfg.getBool( "HRC_deferred_rc", false )) {
+            cds::gc::HRC::enable_deferred_rc();
+            std::cout << "Use deferred reference counting for HRC\n";
+        }
       }
 
       if ( CppUnitMini::TestCase::m_bPrintGCState ) {
@@ -456,6 +496,9 @@ int main(int argc, char** argv)
     // Detach main thread from CDS GC
     cds::threading::Manager::detachThread();
 
+    cds::gc::HP::stop_reclaimer();
+    cds::gc::PTB::stop_reclaimer();
+
   }
 
   // Finalize CDS runtime
@@ -0,0 +1,357 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include <cds/gc/hp.h>
+#include <cds/gc/ptb.h>
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/general_threaded.h>
+#include <cds/urcu/signal_buffered.h>
+#include <cds/urcu/signal_threaded.h>
+#include <cds/container/chase_lev_deque_rcu.h>
+#include <vector>
+
+namespace deque {
+
+    namespace {
+        static size_t s_nThiefCount = 4;
+        static size_t s_nItemCount = 100000;
+        static size_t s_nOwnerPassCount = 1000000;
+    }
+
+    class HdrChaseLevDeque: public CppUnitMini::TestCase
+    {
+        typedef std::vector< atomics::atomic<unsigned int> > taken_array;
+
+        template <class Deque>
+        class Owner: public CppUnitMini::TestThread
+        {
+            Deque&          m_Deque;
+            taken_array&    m_arrTaken;
+            size_t          m_nPopRate;
+
+            virtual TestThread *    clone()
+            {
+                return new Owner( *this );
+            }
+        public:
+            atomics::atomic<bool>&  m_bDone;
+            size_t  m_nPopped;
+
+        public:
+            Owner( CppUnitMini::ThreadPool& pool, Deque& dq, taken_array& arr, atomics::atomic<bool>& bDone, size_t nPopRate )
+                : CppUnitMini::TestThread( pool )
+                , m_Deque( dq )
+                , m_arrTaken( arr )
+                , m_nPopRate( nPopRate )
+                , m_bDone( bDone )
+                , m_nPopped( 0 )
+            {}
+            Owner( Owner& src )
+                : CppUnitMini::TestThread( src )
+                , m_Deque( src.m_Deque )
+                , m_arrTaken( src.m_arrTaken )
+                , m_nPopRate( src.m_nPopRate )
+                , m_bDone( src.m_bDone )
+                , m_nPopped( 0 )
+            {}
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                size_t v;
+                for ( size_t i = 0; i < m_arrTaken.size(); ++i ) {
+                    m_Deque.push( i );
+                    if ( m_nPopRate && i % m_nPopRate == 0 && m_Deque.pop( v ) ) {
+                        m_arrTaken[v].fetch_add( 1, atomics::memory_order_relaxed );
+                        ++m_nPopped;
+                    }
+                }
+                // Steal-heavy mode: the rest of the items is left for the thieves
+                if ( m_nPopRate ) {
+                    while ( m_Deque.pop( v ) ) {
+                        m_arrTaken[v].fetch_add( 1, atomics::memory_order_relaxed );
+                        ++m_nPopped;
+                    }
+                }
+                m_bDone.store( true, atomics::memory_order_release );
+            }
+        };
+
+        template <class Deque>
+        class Thief: public CppUnitMini::TestThread
+        {
+            Deque&          m_Deque;
+            taken_array&    m_arrTaken;
+            atomics::atomic<bool>&  m_bDone;
+
+            virtual TestThread *    clone()
+            {
+                return new Thief( *this );
+            }
+        public:
+            size_t  m_nStolen;
+
+        public:
+            Thief( CppUnitMini::ThreadPool& pool, Deque& dq, taken_array& arr, atomics::atomic<bool>& bDone )
+                : CppUnitMini::TestThread( pool )
+                , m_Deque( dq )
+                , m_arrTaken( arr )
+                , m_bDone( bDone )
+                , m_nStolen( 0 )
+            {}
+            Thief( Thief& src )
+                : CppUnitMini::TestThread( src )
+                , m_Deque( src.m_Deque )
+                , m_arrTaken( src.m_arrTaken )
+                , m_bDone( src.m_bDone )
+                , m_nStolen( 0 )
+            {}
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                size_t v;
+                while ( !m_bDone.load( atomics::memory_order_acquire ) || !m_Deque.empty() ) {
+                    if ( m_Deque.steal( v ) ) {
+                        m_arrTaken[v].fetch_add( 1, atomics::memory_order_relaxed );
+                        ++m_nStolen;
+                    }
+                }
+            }
+        };
+
+    protected:
+        template <class Deque>
+        void test_st()
+        {
+            size_t const nSize = 1000;
+            Deque dq( 4 );
+            size_t v;
+
+            CPPUNIT_ASSERT( dq.empty() );
+            CPPUNIT_ASSERT( dq.size() == 0 );
+            CPPUNIT_ASSERT( dq.capacity() == 4 );
+            CPPUNIT_ASSERT( !dq.pop( v ));
+            CPPUNIT_ASSERT( !dq.steal( v ));
+
+            // push/pop - LIFO, the array grows
+            for ( size_t i = 0; i < nSize; ++i )
+                CPPUNIT_ASSERT( dq.push( i ));
+            CPPUNIT_ASSERT( !dq.empty() );
+            CPPUNIT_CHECK( dq.size() == nSize );
+            CPPUNIT_CHECK( dq.capacity() >= nSize );
+            for ( size_t i = nSize; i > 0; --i ) {
+                CPPUNIT_ASSERT( dq.pop( v ));
+                CPPUNIT_CHECK_EX( v == i - 1, "expected=" << i - 1 << ", popped=" << v );
+            }
+            CPPUNIT_ASSERT( dq.empty() );
+            CPPUNIT_ASSERT( !dq.pop( v ));
+
+            // push/steal - FIFO
+            for ( size_t i = 0; i < nSize; ++i )
+                CPPUNIT_ASSERT( dq.push( i ));
+            for ( size_t i = 0; i < nSize; ++i ) {
+                CPPUNIT_ASSERT( dq.steal( v ));
+                CPPUNIT_CHECK_EX( v == i, "expected=" << i << ", stolen=" << v );
+            }
+            CPPUNIT_ASSERT( dq.empty() );
+            CPPUNIT_ASSERT( !dq.steal( v ));
+
+            // The circular array wraps around
+            size_t const nCapacity = dq.capacity();
+            for ( size_t nPass = 0; nPass < 3; ++nPass ) {
+                for ( size_t i = 0; i < nCapacity; ++i )
+                    CPPUNIT_ASSERT( dq.push( i ));
+                CPPUNIT_ASSERT( dq.steal( v ));
+                CPPUNIT_CHECK( v == 0 );
+                CPPUNIT_ASSERT( dq.pop( v ));
+                CPPUNIT_CHECK( v == nCapacity - 1 );
+                CPPUNIT_CHECK( dq.size() == nCapacity - 2 );
+                dq.clear();
+                CPPUNIT_ASSERT( dq.empty() );
+            }
+            CPPUNIT_CHECK( dq.capacity() == nCapacity );
+
+            // Mixed pop/steal of the last item
+            CPPUNIT_ASSERT( dq.push( 1 ));
+            CPPUNIT_ASSERT( dq.push( 2 ));
+            CPPUNIT_ASSERT( dq.steal( v ));
+            CPPUNIT_CHECK( v == 1 );
+            CPPUNIT_ASSERT( dq.pop( v ));
+            CPPUNIT_CHECK( v == 2 );
+            CPPUNIT_ASSERT( !dq.pop( v ));
+            CPPUNIT_ASSERT( !dq.steal( v ));
+            CPPUNIT_ASSERT( dq.empty() );
+        }
+
+        template <class Deque>
+        void test_steal( size_t nPopRate )
+        {
+            Deque dq;
+            taken_array arrTaken( s_nItemCount );
+            for ( size_t i = 0; i < arrTaken.size(); ++i )
+                arrTaken[i].store( 0, atomics::memory_order_relaxed );
+            atomics::atomic<bool> bDone( false );
+
+            CPPUNIT_MSG( "   owner pop rate=" << nPopRate << ", thief count=" << s_nThiefCount << ", item count=" << s_nItemCount << "..." );
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Owner<Deque>( pool, dq, arrTaken, bDone, nPopRate ), 1 );
+            pool.add( new Thief<Deque>( pool, dq, arrTaken, bDone ), s_nThiefCount );
+
+            cds::OS::Timer timer;
+            pool.run();
+            CPPUNIT_MSG( "      Duration=" << timer.duration() );
+
+            size_t nPopped = 0;
+            size_t nStolen = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Owner<Deque> * pOwner = dynamic_cast<Owner<Deque> *>( *it );
+                if ( pOwner )
+                    nPopped += pOwner->m_nPopped;
+                else
+                    nStolen += static_cast<Thief<Deque> *>( *it )->m_nStolen;
+            }
+            CPPUNIT_MSG( "      popped=" << nPopped << ", stolen=" << nStolen );
+            CPPUNIT_CHECK_EX( nPopped + nStolen == s_nItemCount, "popped=" << nPopped << ", stolen=" << nStolen << ", expected total=" << s_nItemCount );
+
+            size_t nErrors = 0;
+            for ( size_t i = 0; i < arrTaken.size(); ++i ) {
+                if ( arrTaken[i].load( atomics::memory_order_relaxed ) != 1 ) {
+                    if ( ++nErrors <= 10 )
+                        CPPUNIT_MSG( "      item " << i << " is taken " << arrTaken[i].load( atomics::memory_order_relaxed ) << " times" );
+                }
+            }
+            CPPUNIT_CHECK( nErrors == 0 );
+            CPPUNIT_CHECK( dq.empty() );
+        }
+
+        template <class Deque>
+        void test_owner_only()
+        {
+            Deque dq;
+            size_t const nBatch = 64;
+            size_t v;
+            size_t nSum = 0;
+
+            CPPUNIT_MSG( "   owner only, pass count=" << s_nOwnerPassCount << "..." );
+            cds::OS::Timer timer;
+            for ( size_t nPass = 0; nPass < s_nOwnerPassCount; nPass += nBatch ) {
+                for ( size_t i = 0; i < nBatch; ++i )
+                    dq.push( i );
+                while ( dq.pop( v ))
+                    nSum += v;
+            }
+            CPPUNIT_MSG( "      Duration=" << timer.duration() );
+            CPPUNIT_CHECK( nSum == ( s_nOwnerPassCount + nBatch - 1 ) / nBatch * ( nBatch * ( nBatch - 1 ) / 2 ));
+            CPPUNIT_CHECK( dq.capacity() == nBatch );
+        }
+
+        template <class Deque>
+        void test()
+        {
+            test_st<Deque>();
+
+            // Steal-heavy: the owner only pushes, the thieves take all items
+            test_steal<Deque>( 0 );
+            // Mixed: the owner pops one item per 4 pushes
+            test_steal<Deque>( 4 );
+
+            test_owner_only<Deque>();
+        }
+
+        void HP()
+        {
+            typedef cds::container::ChaseLevDeque< cds::gc::HP, size_t > deque_type;
+            test<deque_type>();
+        }
+
+        void HP_stat()
+        {
+            typedef cds::container::ChaseLevDeque< cds::gc::HP, size_t,
+                cds::container::chase_lev_deque::make_traits<
+                    cds::opt::stat< cds::container::chase_lev_deque::stat<> >
+                    ,cds::opt::alignment< cds::opt::no_special_alignment >
+                >::type
+            > deque_type;
+            test<deque_type>();
+        }
+
+        void PTB()
+        {
+            typedef cds::container::ChaseLevDeque< cds::gc::PTB, size_t > deque_type;
+            test<deque_type>();
+        }
+
+        void RCU_GPI()
+        {
+            typedef cds::container::ChaseLevDeque< cds::urcu::gc< cds::urcu::general_instant<> >, size_t > deque_type;
+            test<deque_type>();
+        }
+
+        void RCU_GPB()
+        {
+            typedef cds::container::ChaseLevDeque< cds::urcu::gc< cds::urcu::general_buffered<> >, size_t > deque_type;
+            test<deque_type>();
+        }
+
+        void RCU_GPT()
+        {
+            typedef cds::container::ChaseLevDeque< cds::urcu::gc< cds::urcu::general_threaded<> >, size_t > deque_type;
+            test<deque_type>();
+        }
+
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        void RCU_SHB()
+        {
+            typedef cds::container::ChaseLevDeque< cds::urcu::gc< cds::urcu::signal_buffered<> >, size_t > deque_type;
+            test<deque_type>();
+        }
+
+        void RCU_SHT()
+        {
+            typedef cds::container::ChaseLevDeque< cds::urcu::gc< cds::urcu::signal_threaded<> >, size_t > deque_type;
+            test<deque_type>();
+        }
+#endif
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nThiefCount = cfg.getULong("ThiefCount", 4 );
+            s_nItemCount = cfg.getULong("ItemCount", 100000 );
+            s_nOwnerPassCount = cfg.getULong("OwnerPassCount", 1000000 );
+        }
+
+        CPPUNIT_TEST_SUITE(HdrChaseLevDeque)
+            CPPUNIT_TEST(HP)
+            CPPUNIT_TEST(HP_stat)
+            CPPUNIT_TEST(PTB)
+            CPPUNIT_TEST(RCU_GPI)
+            CPPUNIT_TEST(RCU_GPB)
+            CPPUNIT_TEST(RCU_GPT)
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+            CPPUNIT_TEST(RCU_SHB)
+            CPPUNIT_TEST(RCU_SHT)
+#endif
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+} // namespace deque
+
+CPPUNIT_TEST_SUITE_REGISTRATION(deque::HdrChaseLevDeque);
@@ -0,0 +1,483 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include <cds/intrusive/sundell_list_hp.h>
+#include <cds/intrusive/sundell_list_ptb.h>
+#include <vector>
+
+namespace deque {
+
+    namespace {
+        static size_t s_nThreadCount = 4;
+        static size_t s_nItemCount = 100000;
+    }
+
+    class HdrIntrusiveSundellList: public CppUnitMini::TestCase
+    {
+        template <typename GC>
+        struct base_item: public cds::intrusive::sundell_list::node< GC >
+        {
+            size_t  nKey;
+            atomics::atomic<unsigned int>   nTaken      ;   // count of successful pop/unlink
+            atomics::atomic<unsigned int>   nDisposed   ;   // count of disposer calls
+            atomics::atomic<bool>           bLinked     ;   // set after push
+
+            base_item()
+                : nKey( 0 )
+                , nTaken( 0 )
+                , nDisposed( 0 )
+                , bLinked( false )
+            {}
+            base_item( base_item const& s )
+                : nKey( s.nKey )
+                , nTaken( 0 )
+                , nDisposed( 0 )
+                , bLinked( false )
+            {}
+        };
+
+        template <typename GC>
+        struct member_item
+        {
+            size_t  nKey;
+            atomics::atomic<unsigned int>   nTaken;
+            atomics::atomic<unsigned int>   nDisposed;
+            atomics::atomic<bool>           bLinked;
+            cds::intrusive::sundell_list::node< GC > hMember;
+
+            member_item()
+                : nKey( 0 )
+                , nTaken( 0 )
+                , nDisposed( 0 )
+                , bLinked( false )
+            {}
+            member_item( member_item const& s )
+                : nKey( s.nKey )
+                , nTaken( 0 )
+                , nDisposed( 0 )
+                , bLinked( false )
+            {}
+        };
+
+        struct disposer {
+            template <typename T>
+            void operator()( T * p )
+            {
+                p->nDisposed.fetch_add( 1, atomics::memory_order_relaxed );
+            }
+        };
+
+        template <class List>
+        class Pusher: public CppUnitMini::TestThread
+        {
+            typedef typename List::value_type value_type;
+
+            List&                       m_List;
+            std::vector<value_type>&    m_arrItems;
+
+            virtual TestThread *    clone()
+            {
+                return new Pusher( *this );
+            }
+        public:
+            Pusher( CppUnitMini::ThreadPool& pool, List& l, std::vector<value_type>& arr )
+                : CppUnitMini::TestThread( pool )
+                , m_List( l )
+                , m_arrItems( arr )
+            {}
+            Pusher( Pusher& src )
+                : CppUnitMini::TestThread( src )
+                , m_List( src.m_List )
+                , m_arrItems( src.m_arrItems )
+            {}
+
+            HdrIntrusiveSundellList&  getTest()
+            {
+                return reinterpret_cast<HdrIntrusiveSundellList&>( m_Pool.m_Test );
+            }
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                size_t const nStep = getTest().m_nPusherCount;
+                for ( size_t i = m_nThreadNo; i < m_arrItems.size(); i += nStep ) {
+                    value_type& v = m_arrItems[i];
+                    if ( i & 1 )
+                        m_List.push_back( v );
+                    else
+                        m_List.push_front( v );
+                    v.bLinked.store( true, atomics::memory_order_release );
+                }
+                getTest().m_nPushersDone.fetch_add( 1, atomics::memory_order_release );
+            }
+
+            size_t m_nThreadNo;
+        };
+
+        template <class List>
+        class Popper: public CppUnitMini::TestThread
+        {
+            typedef typename List::value_type value_type;
+
+            List&                       m_List;
+            std::vector<value_type>&    m_arrItems;
+
+            virtual TestThread *    clone()
+            {
+                return new Popper( *this );
+            }
+        public:
+            size_t  m_nPopped;
+            size_t  m_nUnlinked;
+            bool    m_bUnlinker;
+
+        public:
+            Popper( CppUnitMini::ThreadPool& pool, List& l, std::vector<value_type>& arr, bool bUnlinker )
+                : CppUnitMini::TestThread( pool )
+                , m_List( l )
+                , m_arrItems( arr )
+                , m_nPopped( 0 )
+                , m_nUnlinked( 0 )
+                , m_bUnlinker( bUnlinker )
+            {}
+            Popper( Popper& src )
+                : CppUnitMini::TestThread( src )
+                , m_List( src.m_List )
+                , m_arrItems( src.m_arrItems )
+                , m_nPopped( 0 )
+                , m_nUnlinked( 0 )
+                , m_bUnlinker( src.m_bUnlinker )
+            {}
+
+            HdrIntrusiveSundellList&  getTest()
+            {
+                return reinterpret_cast<HdrIntrusiveSundellList&>( m_Pool.m_Test );
+            }
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            bool pop( size_t nPass )
+            {
+                typename List::guarded_ptr gp;
+                bool bOk = ( nPass & 1 ) ? m_List.pop_back( gp ) : m_List.pop_front( gp );
+                if ( bOk ) {
+                    gp->nTaken.fetch_add( 1, atomics::memory_order_relaxed );
+                    ++m_nPopped;
+                }
+                return bOk;
+            }
+
+            virtual void test()
+            {
+                size_t const nPusherCount = getTest().m_nPusherCount;
+                size_t nPass = 0;
+                size_t nUnlinkIdx = m_bUnlinker ? m_arrItems.size() - 1 : 0;
+
+                while ( true ) {
+                    bool bDone = getTest().m_nPushersDone.load( atomics::memory_order_acquire ) == nPusherCount;
+
+                    if ( m_bUnlinker ) {
+                        // Unlink the items from the middle of the list in reverse order of pushing
+                        if ( nUnlinkIdx < m_arrItems.size() ) {
+                            value_type& v = m_arrItems[nUnlinkIdx];
+                            if ( v.bLinked.load( atomics::memory_order_acquire ) ) {
+                                if ( m_List.unlink( v ) ) {
+                                    v.nTaken.fetch_add( 1, atomics::memory_order_relaxed );
+                                    ++m_nUnlinked;
+                                }
+                                nUnlinkIdx -= 3;
+                            }
+                        }
+                        else if ( bDone )
+                            break;
+                    }
+                    else if ( !pop( nPass++ ) && bDone ) {
+                        // Check the list is empty after all pushers have finished
+                        if ( !pop( nPass++ ))
+                            break;
+                    }
+                }
+            }
+        };
+
+    public:
+        atomics::atomic<size_t> m_nPushersDone;
+        size_t                  m_nPusherCount;
+
+    protected:
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nThreadCount = cfg.getULong("ThreadCount", 4 );
+            s_nItemCount = cfg.getULong("ItemCount", 100000 );
+        }
+
+        template <class List>
+        void test_seq()
+        {
+            typedef typename List::value_type value_type;
+            typedef typename List::guarded_ptr guarded_ptr;
+
+            size_t const c_nSize = 100;
+            std::vector<value_type> arr( c_nSize );
+            for ( size_t i = 0; i < c_nSize; ++i )
+                arr[i].nKey = i;
+
+            {
+                List l;
+                CPPUNIT_ASSERT( l.empty() );
+                CPPUNIT_ASSERT( l.size() == 0 );
+
+                guarded_ptr gp;
+                CPPUNIT_CHECK( !l.pop_front( gp ));
+                CPPUNIT_CHECK( !l.pop_back( gp ));
+
+                // push_back/pop_front - FIFO
+                for ( size_t i = 0; i < c_nSize; ++i )
+                    CPPUNIT_CHECK( l.push_back( arr[i] ));
+                CPPUNIT_CHECK( l.size() == c_nSize );
+                CPPUNIT_CHECK( !l.empty() );
+                for ( size_t i = 0; i < c_nSize; ++i ) {
+                    CPPUNIT_ASSERT( l.pop_front( gp ));
+                    CPPUNIT_CHECK_EX( gp->nKey == i, "expected=" << i << " real=" << gp->nKey );
+                }
+                gp.release();
+                CPPUNIT_CHECK( l.empty() );
+                CPPUNIT_CHECK( l.size() == 0 );
+                List::gc::force_dispose();
+                for ( size_t i = 0; i < c_nSize; ++i ) {
+                    CPPUNIT_CHECK( arr[i].nDisposed.load() == 1 );
+                    arr[i].nDisposed.store( 0 );
+                }
+
+                // push_front/pop_front - LIFO
+                for ( size_t i = 0; i < c_nSize; ++i )
+                    CPPUNIT_CHECK( l.push_front( arr[i] ));
+                for ( size_t i = c_nSize; i > 0; --i ) {
+                    CPPUNIT_ASSERT( l.pop_front( gp ));
+                    CPPUNIT_CHECK_EX( gp->nKey == i - 1, "expected=" << i - 1 << " real=" << gp->nKey );
+                }
+                CPPUNIT_CHECK( !l.pop_front( gp ));
+                gp.release();
+                List::gc::force_dispose();
+
+                // push_front/pop_back - FIFO
+                for ( size_t i = 0; i < c_nSize; ++i )
+                    CPPUNIT_CHECK( l.push_front( arr[i] ));
+                for ( size_t i = 0; i < c_nSize; ++i ) {
+                    CPPUNIT_ASSERT( l.pop_back( gp ));
+                    CPPUNIT_CHECK_EX( gp->nKey == i, "expected=" << i << " real=" << gp->nKey );
+                }
+                CPPUNIT_CHECK( !l.pop_back( gp ));
+                gp.release();
+                List::gc::force_dispose();
+
+                // unlink from the middle: push_back all, unlink odd items, pop the rest from the back
+                for ( size_t i = 0; i < c_nSize; ++i )
+                    CPPUNIT_CHECK( l.push_back( arr[i] ));
+                for ( size_t i = 1; i < c_nSize; i += 2 ) {
+                    CPPUNIT_CHECK( l.unlink( arr[i] ));
+                    CPPUNIT_CHECK( !l.unlink( arr[i] ));
+                }
+                CPPUNIT_CHECK( l.size() == c_nSize / 2 );
+                for ( size_t i = c_nSize; i > 0; i -= 2 ) {
+                    CPPUNIT_ASSERT( l.pop_back( gp ));
+                    CPPUNIT_CHECK_EX( gp->nKey == i - 2, "expected=" << i - 2 << " real=" << gp->nKey );
+                }
+                CPPUNIT_CHECK( l.empty() );
+                gp.release();
+                List::gc::force_dispose();
+                for ( size_t i = 0; i < c_nSize; ++i ) {
+                    CPPUNIT_CHECK( arr[i].nDisposed.load() == 3 );
+                    arr[i].nDisposed.store( 0 );
+                }
+
+                // The unlinked item is not in the list
+                value_type v;
+                CPPUNIT_CHECK( !l.unlink( v ));
+
+                // clear
+                for ( size_t i = 0; i < c_nSize; ++i )
+                    CPPUNIT_CHECK( l.push_front( arr[i] ));
+                l.clear();
+                CPPUNIT_CHECK( l.empty() );
+                CPPUNIT_CHECK( l.size() == 0 );
+
+                // the destructor clears the list
+                for ( size_t i = 0; i < c_nSize; ++i )
+                    CPPUNIT_CHECK( l.push_front( arr[i] ));
+            }
+            List::gc::force_dispose();
+            for ( size_t i = 0; i < c_nSize; ++i )
+                CPPUNIT_CHECK( arr[i].nDisposed.load() == 2 );
+        }
+
+        template <class List>
+        void test_mt()
+        {
+            typedef typename List::value_type value_type;
+
+            std::vector<value_type> arr( s_nItemCount );
+            for ( size_t i = 0; i < s_nItemCount; ++i )
+                arr[i].nKey = i;
+
+            size_t const nPusherCount = s_nThreadCount / 2 ? s_nThreadCount / 2 : 1;
+            m_nPusherCount = nPusherCount;
+            m_nPushersDone.store( 0 );
+
+            {
+                List l;
+
+                CppUnitMini::ThreadPool pool( *this );
+                for ( size_t i = 0; i < nPusherCount; ++i ) {
+                    Pusher<List> * p = new Pusher<List>( pool, l, arr );
+                    p->m_nThreadNo = i;
+                    pool.add( p, 1 );
+                }
+                pool.add( new Popper<List>( pool, l, arr, false ), nPusherCount );
+                pool.add( new Popper<List>( pool, l, arr, true ), 1 );
+
+                CPPUNIT_MSG( "   Push/pop/unlink test, pusher count=" << nPusherCount
+                    << " popper count=" << nPusherCount
+                    << " item count=" << s_nItemCount << " ..." );
+                pool.run();
+                CPPUNIT_MSG( "   Duration=" << pool.avgDuration() );
+
+                size_t nPopped = 0;
+                size_t nUnlinked = 0;
+                for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                    Popper<List> * p = dynamic_cast<Popper<List> *>( *it );
+                    if ( p ) {
+                        nPopped += p->m_nPopped;
+                        nUnlinked += p->m_nUnlinked;
+                    }
+                }
+                CPPUNIT_MSG( "   Popped=" << nPopped << " unlinked=" << nUnlinked );
+
+                CPPUNIT_CHECK( l.empty() );
+                CPPUNIT_CHECK_EX( nPopped + nUnlinked == s_nItemCount, "popped=" << nPopped << " unlinked=" << nUnlinked << " expected=" << s_nItemCount );
+            }
+
+            // The first call adopts the items retired by the terminated threads, the second one disposes them
+            List::gc::force_dispose();
+            List::gc::force_dispose();
+            size_t nErrors = 0;
+            for ( size_t i = 0; i < s_nItemCount; ++i ) {
+                if ( arr[i].nTaken.load() != 1 || arr[i].nDisposed.load() != 1 ) {
+                    if ( nErrors < 10 ) {
+                        CPPUNIT_MSG( "   Item " << i << ": taken=" << arr[i].nTaken.load() << " disposed=" << arr[i].nDisposed.load() );
+                    }
+                    ++nErrors;
+                }
+            }
+            CPPUNIT_CHECK_EX( nErrors == 0, "Errors: " << nErrors );
+        }
+
+        template <class List>
+        void test()
+        {
+            test_seq<List>();
+            test_mt<List>();
+        }
+
+        void HP_base();
+        void HP_base_seqcst();
+        void HP_member();
+        void PTB_base();
+        void PTB_member_cnt();
+
+        CPPUNIT_TEST_SUITE(HdrIntrusiveSundellList)
+            CPPUNIT_TEST(HP_base)
+            CPPUNIT_TEST(HP_base_seqcst)
+            CPPUNIT_TEST(HP_member)
+            CPPUNIT_TEST(PTB_base)
+            CPPUNIT_TEST(PTB_member_cnt)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+    void HdrIntrusiveSundellList::HP_base()
+    {
+        typedef cds::intrusive::SundellList< cds::gc::HP, base_item< cds::gc::HP >,
+            cds::intrusive::sundell_list::make_traits<
+                cds::intrusive::opt::hook< cds::intrusive::sundell_list::base_hook< cds::opt::gc< cds::gc::HP > > >
+                ,cds::intrusive::opt::disposer< disposer >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > list_type;
+        test<list_type>();
+    }
+
+    void HdrIntrusiveSundellList::HP_base_seqcst()
+    {
+        typedef cds::intrusive::SundellList< cds::gc::HP, base_item< cds::gc::HP >,
+            cds::intrusive::sundell_list::make_traits<
+                cds::intrusive::opt::hook< cds::intrusive::sundell_list::base_hook< cds::opt::gc< cds::gc::HP > > >
+                ,cds::intrusive::opt::disposer< disposer >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::memory_model< cds::opt::v::sequential_consistent >
+                ,cds::opt::back_off< cds::backoff::yield >
+            >::type
+        > list_type;
+        test<list_type>();
+    }
+
+    void HdrIntrusiveSundellList::HP_member()
+    {
+        typedef member_item< cds::gc::HP > item_type;
+        typedef cds::intrusive::SundellList< cds::gc::HP, item_type,
+            cds::intrusive::sundell_list::make_traits<
+                cds::intrusive::opt::hook< cds::intrusive::sundell_list::member_hook<
+                    offsetof( item_type, hMember ),
+                    cds::opt::gc< cds::gc::HP >
+                > >
+                ,cds::intrusive::opt::disposer< disposer >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > list_type;
+        test<list_type>();
+    }
+
+    void HdrIntrusiveSundellList::PTB_base()
+    {
+        typedef cds::intrusive::SundellList< cds::gc::PTB, base_item< cds::gc::PTB >,
+            cds::intrusive::sundell_list::make_traits<
+                cds::intrusive::opt::hook< cds::intrusive::sundell_list::base_hook< cds::opt::gc< cds::gc::PTB > > >
+                ,cds::intrusive::opt::disposer< disposer >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > list_type;
+        test<list_type>();
+    }
+
+    void HdrIntrusiveSundellList::PTB_member_cnt()
+    {
+        typedef member_item< cds::gc::PTB > item_type;
+        typedef cds::intrusive::SundellList< cds::gc::PTB, item_type,
+            cds::intrusive::sundell_list::make_traits<
+                cds::intrusive::opt::hook< cds::intrusive::sundell_list::member_hook<
+                    offsetof( item_type, hMember ),
+                    cds::opt::gc< cds::gc::PTB >
+                > >
+                ,cds::intrusive::opt::disposer< disposer >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > list_type;
+        test<list_type>();
+    }
+
+} // namespace deque
+
+CPPUNIT_TEST_SUITE_REGISTRATION(deque::HdrIntrusiveSundellList);
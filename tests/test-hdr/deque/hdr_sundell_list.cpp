@@ -0,0 +1,167 @@
+//$$CDS-header$$
+
+#include "cppunit/cppunit_proxy.h"
+#include <cds/container/sundell_list_hp.h>
+#include <cds/container/sundell_list_ptb.h>
+#include <string>
+
+namespace deque {
+
+    class HdrSundellList: public CppUnitMini::TestCase
+    {
+        struct item {
+            int         nKey;
+            std::string strVal;
+
+            item()
+                : nKey( 0 )
+            {}
+            item( int key )
+                : nKey( key )
+            {}
+            item( int key, std::string const& s )
+                : nKey( key )
+                , strVal( s )
+            {}
+        };
+
+        template <class Deque>
+        void test()
+        {
+            typedef typename Deque::guarded_ptr guarded_ptr;
+
+            int const c_nSize = 100;
+            Deque dq;
+            item val;
+
+            CPPUNIT_ASSERT( dq.empty() );
+            CPPUNIT_CHECK( !dq.pop_front( val ));
+            CPPUNIT_CHECK( !dq.pop_back( val ));
+
+            // push_front/pop_front
+            for ( int i = 0; i < c_nSize; ++i )
+                CPPUNIT_CHECK( dq.push_front( i ));
+            CPPUNIT_CHECK( dq.size() == static_cast<size_t>( c_nSize ));
+            for ( int i = c_nSize - 1; i >= 0; --i ) {
+                CPPUNIT_ASSERT( dq.pop_front( val ));
+                CPPUNIT_CHECK_EX( val.nKey == i, "expected=" << i << " real=" << val.nKey );
+            }
+            CPPUNIT_CHECK( dq.empty() );
+            CPPUNIT_CHECK( dq.size() == 0 );
+
+            // push_back/pop_back
+            for ( int i = 0; i < c_nSize; ++i )
+                CPPUNIT_CHECK( dq.push_back( i ));
+            for ( int i = c_nSize - 1; i >= 0; --i ) {
+                CPPUNIT_ASSERT( dq.pop_back( val ));
+                CPPUNIT_CHECK_EX( val.nKey == i, "expected=" << i << " real=" << val.nKey );
+            }
+            CPPUNIT_CHECK( dq.empty() );
+
+            // push_back/pop_front
+            for ( int i = 0; i < c_nSize; ++i )
+                CPPUNIT_CHECK( dq.push_back( i ));
+            for ( int i = 0; i < c_nSize; ++i ) {
+                CPPUNIT_ASSERT( dq.pop_front( val ));
+                CPPUNIT_CHECK_EX( val.nKey == i, "expected=" << i << " real=" << val.nKey );
+            }
+            CPPUNIT_CHECK( dq.empty() );
+
+            // emplace and guarded_ptr
+            for ( int i = 0; i < c_nSize; ++i ) {
+                if ( i & 1 ) {
+                    CPPUNIT_CHECK( dq.emplace_back( i, std::string( "back" )));
+                }
+                else {
+                    CPPUNIT_CHECK( dq.emplace_front( i, std::string( "front" )));
+                }
+            }
+            {
+                guarded_ptr gp;
+                for ( int i = c_nSize - 1; i >= 0; i -= 2 ) {
+                    CPPUNIT_ASSERT( dq.pop_back( gp ));
+                    CPPUNIT_CHECK_EX( gp->nKey == i, "expected=" << i << " real=" << gp->nKey );
+                    CPPUNIT_CHECK( gp->strVal == "back" );
+                }
+                for ( int i = c_nSize - 2; i >= 0; i -= 2 ) {
+                    CPPUNIT_ASSERT( dq.pop_front( gp ));
+                    CPPUNIT_CHECK_EX( gp->nKey == i, "expected=" << i << " real=" << gp->nKey );
+                    CPPUNIT_CHECK( gp->strVal == "front" );
+                }
+                CPPUNIT_CHECK( !dq.pop_front( gp ));
+                CPPUNIT_CHECK( !dq.pop_back( gp ));
+            }
+            CPPUNIT_CHECK( dq.empty() );
+
+            // clear
+            for ( int i = 0; i < c_nSize; ++i )
+                CPPUNIT_CHECK( dq.push_front( i ));
+            CPPUNIT_CHECK( !dq.empty() );
+            dq.clear();
+            CPPUNIT_CHECK( dq.empty() );
+            CPPUNIT_CHECK( dq.size() == 0 );
+
+            // the destructor frees the items
+            for ( int i = 0; i < c_nSize; ++i )
+                CPPUNIT_CHECK( dq.push_back( i ));
+        }
+
+        void HP();
+        void HP_seqcst();
+        void PTB();
+        void PTB_seqcst();
+
+        CPPUNIT_TEST_SUITE(HdrSundellList)
+            CPPUNIT_TEST(HP)
+            CPPUNIT_TEST(HP_seqcst)
+            CPPUNIT_TEST(PTB)
+            CPPUNIT_TEST(PTB_seqcst)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+    void HdrSundellList::HP()
+    {
+        typedef cds::container::SundellList< cds::gc::HP, item,
+            cds::container::sundell_list::make_traits<
+                cds::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > deque_type;
+        test<deque_type>();
+    }
+
+    void HdrSundellList::HP_seqcst()
+    {
+        typedef cds::container::SundellList< cds::gc::HP, item,
+            cds::container::sundell_list::make_traits<
+                cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::memory_model< cds::opt::v::sequential_consistent >
+            >::type
+        > deque_type;
+        test<deque_type>();
+    }
+
+    void HdrSundellList::PTB()
+    {
+        typedef cds::container::SundellList< cds::gc::PTB, item,
+            cds::container::sundell_list::make_traits<
+                cds::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > deque_type;
+        test<deque_type>();
+    }
+
+    void HdrSundellList::PTB_seqcst()
+    {
+        typedef cds::container::SundellList< cds::gc::PTB, item,
+            cds::container::sundell_list::make_traits<
+                cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::memory_model< cds::opt::v::sequential_consistent >
+                ,cds::opt::back_off< cds::backoff::yield >
+            >::type
+        > deque_type;
+        test<deque_type>();
+    }
+
+} // namespace deque
+
+CPPUNIT_TEST_SUITE_REGISTRATION(deque::HdrSundellList);
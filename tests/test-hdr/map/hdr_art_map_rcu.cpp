@@ -0,0 +1,395 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/general_threaded.h>
+#include <cds/container/art_map_rcu.h>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+namespace map {
+
+    namespace cc = cds::container;
+
+    class ArtMapRCUHdrTest: public CppUnitMini::TestCase
+    {
+        static size_t const c_nItemCount = 10000;
+        static size_t const c_nKeyRange = 2000;
+        static size_t const c_nPassCount = 20000;
+        static size_t const c_nWorkerCount = 3;
+
+        template <class Map>
+        class Worker: public CppUnitMini::TestThread
+        {
+            Map&    m_Map;
+
+            virtual TestThread *    clone()
+            {
+                return new Worker( *this );
+            }
+        public:
+            size_t  m_nInsert;
+            size_t  m_nErase;
+            size_t  m_nError;
+
+        public:
+            Worker( CppUnitMini::ThreadPool& pool, Map& m )
+                : CppUnitMini::TestThread( pool )
+                , m_Map( m )
+            {}
+            Worker( Worker& src )
+                : CppUnitMini::TestThread( src )
+                , m_Map( src.m_Map )
+            {}
+
+            virtual void init() { cds::threading::Manager::attachThread(); }
+            virtual void fini() { cds::threading::Manager::detachThread(); }
+
+            virtual void test()
+            {
+                typedef typename Map::value_type value_type;
+                m_nInsert = m_nErase = m_nError = 0;
+
+                unsigned int nRand = static_cast<unsigned int>( m_nThreadNo + 1 );
+                for ( size_t nPass = 0; nPass < c_nPassCount; ++nPass ) {
+                    nRand = cds::bitop::RandXorShift( nRand );
+                    // Negative keys and the keys differing in the high bytes check the key encoding
+                    int nKey = static_cast<int>( nRand % c_nKeyRange ) - static_cast<int>( c_nKeyRange / 2 );
+                    nKey *= 1031;
+
+                    switch ( ( nRand >> 16 ) % 5 ) {
+                    case 0:
+                        if ( m_Map.insert( nKey, nKey * 3 ))
+                            ++m_nInsert;
+                        break;
+                    case 1:
+                        if ( m_Map.erase( nKey ))
+                            ++m_nErase;
+                        break;
+                    case 2:
+                        m_Map.find( nKey, [this, nKey]( value_type const& v ) {
+                            if ( v.first != nKey || ( v.second != nKey * 3 && v.second != nKey * 5 ))
+                                ++m_nError;
+                        });
+                        break;
+                    case 3:
+                        if ( m_Map.ensure( nKey, [nKey]( bool bNew, value_type& v ) { v.second = bNew ? nKey * 3 : nKey * 5; } ).second )
+                            ++m_nInsert;
+                        break;
+                    default:
+                        {
+                            // The scan reports the items in ascending order of the keys within the range
+                            bool bFirst = true;
+                            int nPrev = 0;
+                            int nTo = nKey + 100 * 1031;
+                            m_Map.scan( nKey, nTo, [this, &nPrev, &bFirst, nKey, nTo]( value_type const& v ) {
+                                int k = v.first;
+                                if ( ( !bFirst && k <= nPrev ) || k < nKey || k >= nTo || ( v.second != k * 3 && v.second != k * 5 ))
+                                    ++m_nError;
+                                nPrev = k;
+                                bFirst = false;
+                            });
+                        }
+                        break;
+                    }
+                }
+            }
+        };
+
+    protected:
+        template <class Map>
+        void test_int()
+        {
+            typedef typename Map::value_type value_type;
+
+            Map m;
+            CPPUNIT_ASSERT( m.empty() );
+            CPPUNIT_ASSERT( m.check_consistency() );
+
+            // Shuffled keys -c_nItemCount, -c_nItemCount + 2, ..., c_nItemCount - 2
+            int const nItemCount = static_cast<int>( c_nItemCount );
+            std::vector<int> arrKeys;
+            for ( int i = 0; i < nItemCount; ++i )
+                arrKeys.push_back( i * 2 - nItemCount );
+            std::random_shuffle( arrKeys.begin(), arrKeys.end() );
+
+            for ( size_t i = 0; i < arrKeys.size(); ++i )
+                CPPUNIT_CHECK_EX( m.insert( arrKeys[i], arrKeys[i] * 3 ), "key=" << arrKeys[i] );
+            CPPUNIT_CHECK( !m.empty() );
+            CPPUNIT_CHECK( m.size() == c_nItemCount );
+            CPPUNIT_CHECK( m.check_consistency() );
+
+            CPPUNIT_CHECK( !m.insert( 10, 0 ));
+            CPPUNIT_CHECK( m.statistics().m_nInsertFailed.get() == 1 );
+            CPPUNIT_CHECK( m.statistics().m_nNodeGrow.get() > 0 );
+            CPPUNIT_CHECK( m.statistics().m_nLeafSplit.get() > 0 );
+
+            for ( int i = -nItemCount; i < nItemCount; ++i ) {
+                int nVal = -1;
+                bool bFound = m.find( i, [&nVal]( value_type const& v ) { nVal = v.second; } );
+                CPPUNIT_CHECK_EX( bFound == ( i % 2 == 0 ), "key=" << i );
+                if ( bFound ) {
+                    CPPUNIT_CHECK_EX( nVal == i * 3, "key=" << i );
+                }
+            }
+            CPPUNIT_CHECK( !m.find( nItemCount * 1000 ));
+            CPPUNIT_CHECK( !m.find( -nItemCount * 1000 ));
+
+            // ensure()
+            std::pair<bool, bool> ret = m.ensure( 100, []( bool bNew, value_type& v ) {
+                if ( !bNew )
+                    v.second = -100;
+            });
+            CPPUNIT_CHECK( ret.first && !ret.second );
+            ret = m.ensure( 101, []( bool bNew, value_type& v ) {
+                if ( bNew )
+                    v.second = v.first * 3;
+            });
+            CPPUNIT_CHECK( ret.first && ret.second );
+            CPPUNIT_CHECK( m.find( 100, []( value_type const& v ) { CPPUNIT_ASSERT_CURRENT( v.second == -100 ); } ));
+            CPPUNIT_CHECK( m.find( 101, []( value_type const& v ) { CPPUNIT_ASSERT_CURRENT( v.second == 303 ); } ));
+            CPPUNIT_CHECK( m.size() == c_nItemCount + 1 );
+
+            // insert_key()
+            CPPUNIT_CHECK( m.insert_key( 103, []( value_type& v ) { v.second = v.first * 3; } ));
+            CPPUNIT_CHECK( !m.insert_key( 103, []( value_type& ) {} ));
+
+            // scan()
+            {
+                std::vector<int> arrScan;
+                size_t nCount = m.scan( 95, 110, [&arrScan]( value_type const& v ) { arrScan.push_back( v.first ); } );
+                CPPUNIT_ASSERT( nCount == 9 );
+                CPPUNIT_ASSERT( arrScan.size() == nCount );
+                int const arrExpected[] = { 96, 98, 100, 101, 102, 103, 104, 106, 108 };
+                for ( size_t i = 0; i < nCount; ++i )
+                    CPPUNIT_CHECK_EX( arrScan[i] == arrExpected[i], "i=" << i << ", key=" << arrScan[i] );
+
+                // The negative keys precede the positive ones
+                arrScan.clear();
+                nCount = m.scan( -5, 5, [&arrScan]( value_type const& v ) { arrScan.push_back( v.first ); } );
+                CPPUNIT_ASSERT( nCount == 5 );
+                CPPUNIT_CHECK( arrScan.front() == -4 );
+                CPPUNIT_CHECK( arrScan.back() == 4 );
+
+                arrScan.clear();
+                nCount = m.scan( -nItemCount * 4, nItemCount * 4, [&arrScan]( value_type const& v ) { arrScan.push_back( v.first ); } );
+                CPPUNIT_CHECK( nCount == c_nItemCount + 2 );
+                CPPUNIT_CHECK( std::is_sorted( arrScan.begin(), arrScan.end() ));
+
+                CPPUNIT_CHECK( m.scan( 50, 50, []( value_type const& ) {} ) == 0 );
+                CPPUNIT_CHECK( m.scan( 50, 40, []( value_type const& ) {} ) == 0 );
+
+                arrScan.clear();
+                CPPUNIT_CHECK( m.scan_n( 1001, 5, [&arrScan]( value_type const& v ) { arrScan.push_back( v.first ); } ) == 5 );
+                CPPUNIT_CHECK( arrScan.size() == 5 );
+                CPPUNIT_CHECK( arrScan.front() == 1002 );
+                CPPUNIT_CHECK( arrScan.back() == 1010 );
+            }
+
+            // erase()
+            CPPUNIT_CHECK( m.erase( 101 ));
+            CPPUNIT_CHECK( !m.erase( 101 ));
+            CPPUNIT_CHECK( m.erase( 103, []( value_type& v ) { CPPUNIT_ASSERT_CURRENT( v.second == 309 ); } ));
+            CPPUNIT_CHECK( !m.erase( 1001 ));
+
+            // Erase every second key, then the rest in shuffled order, the nodes shrink
+            for ( int i = 0; i < nItemCount; i += 2 )
+                CPPUNIT_CHECK_EX( m.erase( i * 2 - nItemCount ), "key=" << i * 2 - nItemCount );
+            CPPUNIT_CHECK( m.size() == c_nItemCount / 2 );
+            CPPUNIT_CHECK( m.check_consistency() );
+            for ( int i = -nItemCount; i < nItemCount; ++i )
+                CPPUNIT_CHECK_EX( m.find( i ) == ( ( i + nItemCount ) % 4 == 2 ), "key=" << i );
+
+            std::random_shuffle( arrKeys.begin(), arrKeys.end() );
+            for ( size_t i = 0; i < arrKeys.size(); ++i )
+                CPPUNIT_CHECK_EX( m.erase( arrKeys[i] ) == ( ( arrKeys[i] + nItemCount ) % 4 == 2 ), "key=" << arrKeys[i] );
+            CPPUNIT_CHECK( m.empty() );
+            CPPUNIT_CHECK( m.size() == 0 );
+            CPPUNIT_CHECK( m.check_consistency() );
+            CPPUNIT_CHECK( m.statistics().m_nNodeShrink.get() > 0 );
+            CPPUNIT_CHECK( m.statistics().m_nPathCompress.get() > 0 );
+
+            // clear()
+            for ( int i = 0; i < nItemCount; ++i )
+                CPPUNIT_CHECK( m.insert( i, i * 3 ));
+            m.clear();
+            CPPUNIT_CHECK( m.empty() );
+            CPPUNIT_CHECK( m.size() == 0 );
+            CPPUNIT_CHECK( m.check_consistency() );
+
+            Map::gc::force_dispose();
+        }
+
+        template <class Map>
+        void test_string()
+        {
+            typedef typename Map::value_type value_type;
+
+            Map m;
+
+            // The keys "k0" ... "k999" and their prefixes: "k1" is the prefix of "k10", "k100" and so on
+            std::vector<std::string> arrKeys;
+            for ( int i = 0; i < 1000; ++i ) {
+                std::ostringstream os;
+                os << "k" << i;
+                arrKeys.push_back( os.str() );
+            }
+            arrKeys.push_back( std::string() );
+            arrKeys.push_back( "k" );
+            arrKeys.push_back( "long common path of the key 1" );
+            arrKeys.push_back( "long common path of the key 2" );
+            arrKeys.push_back( "long common" );
+            arrKeys.push_back( "long uncommon path" );
+            std::random_shuffle( arrKeys.begin(), arrKeys.end() );
+
+            for ( size_t i = 0; i < arrKeys.size(); ++i )
+                CPPUNIT_CHECK_EX( m.insert( arrKeys[i], static_cast<int>( arrKeys[i].size() )), "key=" << arrKeys[i] );
+            CPPUNIT_CHECK( m.size() == arrKeys.size() );
+            CPPUNIT_CHECK( m.check_consistency() );
+
+            // The key diverges inside the compressed path "ommon" after "long c"
+            CPPUNIT_CHECK( m.insert( "long commander", 0 ));
+            CPPUNIT_CHECK( m.statistics().m_nPrefixSplit.get() > 0 );
+            CPPUNIT_CHECK( m.check_consistency() );
+            CPPUNIT_CHECK( m.erase( "long commander" ));
+
+            for ( size_t i = 0; i < arrKeys.size(); ++i ) {
+                std::string const& key = arrKeys[i];
+                CPPUNIT_CHECK_EX( m.find( key, [&key]( value_type const& v ) {
+                    CPPUNIT_ASSERT_CURRENT( v.first == key && v.second == static_cast<int>( key.size() ));
+                }), "key=" << key );
+            }
+            CPPUNIT_CHECK( m.find( "k12" ));
+            CPPUNIT_CHECK( !m.find( "k1000" ));
+            CPPUNIT_CHECK( !m.find( "long" ));
+            CPPUNIT_CHECK( !m.find( "long common path" ));
+            CPPUNIT_CHECK( !m.find( "long common path of the key 3" ));
+
+            // scan_prefix()
+            {
+                std::vector<std::string> arrScan;
+                size_t nCount = m.scan_prefix( "k12", [&arrScan]( value_type const& v ) { arrScan.push_back( v.first ); } );
+                // "k12", "k120" ... "k129"
+                CPPUNIT_ASSERT( nCount == 11 );
+                CPPUNIT_ASSERT( arrScan.size() == nCount );
+                CPPUNIT_CHECK( arrScan.front() == "k12" );
+                CPPUNIT_CHECK( arrScan.back() == "k129" );
+                CPPUNIT_CHECK( std::is_sorted( arrScan.begin(), arrScan.end() ));
+
+                CPPUNIT_CHECK( m.scan_prefix( "k", []( value_type const& ) {} ) == 1001 );
+                CPPUNIT_CHECK( m.scan_prefix( "long common", []( value_type const& ) {} ) == 3 );
+                CPPUNIT_CHECK( m.scan_prefix( "long c", []( value_type const& ) {} ) == 3 );
+                CPPUNIT_CHECK( m.scan_prefix( "long", []( value_type const& ) {} ) == 4 );
+                CPPUNIT_CHECK( m.scan_prefix( "x", []( value_type const& ) {} ) == 0 );
+                CPPUNIT_CHECK( m.scan_prefix( "", []( value_type const& ) {} ) == arrKeys.size() );
+
+                // Range scan in the order of std::string
+                arrScan.clear();
+                nCount = m.scan( std::string( "k5" ), std::string( "k51" ), [&arrScan]( value_type const& v ) { arrScan.push_back( v.first ); } );
+                // "k5", "k50", "k500" ... "k509"
+                CPPUNIT_CHECK( nCount == 12 );
+                CPPUNIT_CHECK( arrScan.size() == nCount && std::is_sorted( arrScan.begin(), arrScan.end() ));
+            }
+
+            // erase() the keys which are the prefixes of other keys
+            CPPUNIT_CHECK( m.erase( "k1" ));
+            CPPUNIT_CHECK( m.erase( "long common" ));
+            CPPUNIT_CHECK( m.erase( std::string() ));
+            CPPUNIT_CHECK( !m.erase( "k1" ));
+            CPPUNIT_CHECK( m.find( "k10" ));
+            CPPUNIT_CHECK( m.find( "long common path of the key 1" ));
+            CPPUNIT_CHECK( m.check_consistency() );
+
+            m.clear();
+            CPPUNIT_CHECK( m.empty() );
+            CPPUNIT_CHECK( m.check_consistency() );
+
+            Map::gc::force_dispose();
+        }
+
+        template <class Map>
+        void test_mt()
+        {
+            Map m;
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Worker<Map>( pool, m ), c_nWorkerCount );
+            pool.run();
+
+            size_t nInsert = 0;
+            size_t nErase = 0;
+            size_t nError = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Worker<Map> * p = static_cast<Worker<Map> *>( *it );
+                nInsert += p->m_nInsert;
+                nErase += p->m_nErase;
+                nError += p->m_nError;
+            }
+
+            typename Map::stat const& s = m.statistics();
+            CPPUNIT_MSG( "   Insert=" << nInsert << " erase=" << nErase
+                << " restart=" << s.m_nRestart.get()
+                << " grow=" << s.m_nNodeGrow.get() << " shrink=" << s.m_nNodeShrink.get()
+                << " compress=" << s.m_nPathCompress.get() );
+            CPPUNIT_CHECK( nError == 0 );
+            CPPUNIT_CHECK( m.size() == nInsert - nErase );
+            CPPUNIT_CHECK( m.check_consistency() );
+
+            int const nBound = static_cast<int>( c_nKeyRange ) * 1031;
+            size_t nCount = m.scan( -nBound, nBound, []( typename Map::value_type const& ) {} );
+            CPPUNIT_CHECK( nCount == nInsert - nErase );
+
+            m.clear();
+            CPPUNIT_CHECK( m.empty() );
+            Map::gc::force_dispose();
+        }
+
+        template <class RCU>
+        void test()
+        {
+            typedef cc::ArtMap< cds::urcu::gc<RCU>, int, int,
+                typename cc::art::make_traits<
+                    cds::opt::item_counter< cds::atomicity::item_counter >
+                    ,cds::opt::stat< cc::art::stat<> >
+                >::type
+            > int_map;
+            test_int<int_map>();
+            test_mt<int_map>();
+
+            typedef cc::ArtMap< cds::urcu::gc<RCU>, std::string, int,
+                typename cc::art::make_traits<
+                    cds::opt::item_counter< cds::atomicity::item_counter >
+                    ,cds::opt::stat< cc::art::stat<> >
+                >::type
+            > string_map;
+            test_string<string_map>();
+        }
+
+        void ART_RCU_GPI()
+        {
+            test< cds::urcu::general_instant<> >();
+        }
+
+        void ART_RCU_GPB()
+        {
+            test< cds::urcu::general_buffered<> >();
+        }
+
+        void ART_RCU_GPT()
+        {
+            test< cds::urcu::general_threaded<> >();
+        }
+
+        CPPUNIT_TEST_SUITE(ArtMapRCUHdrTest)
+            CPPUNIT_TEST(ART_RCU_GPI)
+            CPPUNIT_TEST(ART_RCU_GPB)
+            CPPUNIT_TEST(ART_RCU_GPT)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace map
+
+CPPUNIT_TEST_SUITE_REGISTRATION(map::ArtMapRCUHdrTest);
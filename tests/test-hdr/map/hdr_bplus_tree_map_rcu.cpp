@@ -0,0 +1,299 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/general_threaded.h>
+#include <cds/container/bplus_tree_map_rcu.h>
+#include <vector>
+#include <algorithm>
+
+namespace map {
+
+    namespace cc = cds::container;
+
+    class BPlusTreeMapRCUHdrTest: public CppUnitMini::TestCase
+    {
+        static size_t const c_nItemCount = 10000;
+        static size_t const c_nKeyRange = 2000;
+        static size_t const c_nPassCount = 20000;
+        static size_t const c_nWorkerCount = 3;
+
+        struct value_type {
+            int     nKey;
+            int     nVal;
+        };
+
+        template <class Map>
+        class Worker: public CppUnitMini::TestThread
+        {
+            Map&    m_Map;
+
+            virtual TestThread *    clone()
+            {
+                return new Worker( *this );
+            }
+        public:
+            size_t  m_nInsert;
+            size_t  m_nErase;
+            size_t  m_nError;
+
+        public:
+            Worker( CppUnitMini::ThreadPool& pool, Map& m )
+                : CppUnitMini::TestThread( pool )
+                , m_Map( m )
+            {}
+            Worker( Worker& src )
+                : CppUnitMini::TestThread( src )
+                , m_Map( src.m_Map )
+            {}
+
+            virtual void init() { cds::threading::Manager::attachThread(); }
+            virtual void fini() { cds::threading::Manager::detachThread(); }
+
+            virtual void test()
+            {
+                m_nInsert = m_nErase = m_nError = 0;
+
+                unsigned int nRand = static_cast<unsigned int>( m_nThreadNo + 1 );
+                for ( size_t nPass = 0; nPass < c_nPassCount; ++nPass ) {
+                    nRand = cds::bitop::RandXorShift( nRand );
+                    int nKey = static_cast<int>( nRand % c_nKeyRange );
+                    value_type val = { nKey, nKey * 3 };
+
+                    switch ( ( nRand >> 16 ) % 4 ) {
+                    case 0:
+                        if ( m_Map.insert( nKey, val ))
+                            ++m_nInsert;
+                        break;
+                    case 1:
+                        if ( m_Map.erase( nKey ))
+                            ++m_nErase;
+                        break;
+                    case 2:
+                        m_Map.find( nKey, [this, nKey]( int k, value_type const& v ) {
+                            if ( k != nKey || v.nKey != nKey || v.nVal != nKey * 3 )
+                                ++m_nError;
+                        });
+                        break;
+                    default:
+                        {
+                            // The scan reports the items in ascending order of the keys within the range
+                            int nPrev = -1;
+                            int nTo = nKey + 100;
+                            m_Map.scan( nKey, nTo, [this, &nPrev, nKey, nTo]( int k, value_type const& v ) {
+                                if ( k <= nPrev || k < nKey || k >= nTo || v.nKey != k || v.nVal != k * 3 )
+                                    ++m_nError;
+                                nPrev = k;
+                            });
+                        }
+                        break;
+                    }
+                }
+            }
+        };
+
+    protected:
+        template <class Map>
+        void test_seq()
+        {
+            Map m;
+            CPPUNIT_ASSERT( m.empty() );
+            CPPUNIT_ASSERT( m.check_consistency() );
+
+            // Shuffled keys 0, 2, 4, ...
+            std::vector<int> arrKeys;
+            for ( int i = 0; i < static_cast<int>( c_nItemCount ); ++i )
+                arrKeys.push_back( i * 2 );
+            std::random_shuffle( arrKeys.begin(), arrKeys.end() );
+
+            for ( size_t i = 0; i < arrKeys.size(); ++i ) {
+                value_type val = { arrKeys[i], arrKeys[i] * 3 };
+                CPPUNIT_CHECK_EX( m.insert( arrKeys[i], val ), "key=" << arrKeys[i] );
+            }
+            CPPUNIT_CHECK( !m.empty() );
+            CPPUNIT_CHECK( m.size() == c_nItemCount );
+            CPPUNIT_CHECK( m.check_consistency() );
+
+            value_type valDummy = { 0, 0 };
+            CPPUNIT_CHECK( !m.insert( 10, valDummy ));
+            CPPUNIT_CHECK( m.statistics().m_nInsertFailed.get() == 1 );
+            CPPUNIT_CHECK( m.statistics().m_nLeafSplit.get() > 0 );
+            CPPUNIT_CHECK( m.statistics().m_nHeightInc.get() > 1 );
+
+            for ( int i = 0; i < static_cast<int>( c_nItemCount * 2 ); ++i ) {
+                int nVal = -1;
+                bool bFound = m.find( i, [&nVal]( int, value_type const& v ) { nVal = v.nVal; } );
+                CPPUNIT_CHECK_EX( bFound == ( i % 2 == 0 ), "key=" << i );
+                if ( bFound ) {
+                    CPPUNIT_CHECK_EX( nVal == i * 3, "key=" << i );
+                }
+            }
+
+            // ensure()
+            std::pair<bool, bool> ret = m.ensure( 100, []( bool bNew, int, value_type& v ) {
+                if ( !bNew )
+                    v.nVal = -100;
+            });
+            CPPUNIT_CHECK( ret.first && !ret.second );
+            ret = m.ensure( 101, []( bool bNew, int k, value_type& v ) {
+                if ( bNew ) {
+                    v.nKey = k;
+                    v.nVal = k * 3;
+                }
+            });
+            CPPUNIT_CHECK( ret.first && ret.second );
+            CPPUNIT_CHECK( m.find( 100, []( int, value_type const& v ) { CPPUNIT_ASSERT_CURRENT( v.nVal == -100 ); } ));
+            CPPUNIT_CHECK( m.find( 101, []( int, value_type const& v ) { CPPUNIT_ASSERT_CURRENT( v.nVal == 303 ); } ));
+            CPPUNIT_CHECK( m.size() == c_nItemCount + 1 );
+
+            // insert_key()
+            CPPUNIT_CHECK( m.insert_key( 103, []( int k, value_type& v ) { v.nKey = k; v.nVal = k * 3; } ));
+            CPPUNIT_CHECK( !m.insert_key( 103, []( int, value_type& ) {} ));
+
+            // scan()
+            {
+                std::vector<int> arrScan;
+                size_t nCount = m.scan( 95, 110, [&arrScan]( int k, value_type const& ) { arrScan.push_back( k ); } );
+                CPPUNIT_ASSERT( nCount == 9 );
+                CPPUNIT_ASSERT( arrScan.size() == nCount );
+                int const arrExpected[] = { 96, 98, 100, 101, 102, 103, 104, 106, 108 };
+                for ( size_t i = 0; i < nCount; ++i )
+                    CPPUNIT_CHECK_EX( arrScan[i] == arrExpected[i], "i=" << i << ", key=" << arrScan[i] );
+
+                arrScan.clear();
+                nCount = m.scan( -10, static_cast<int>( c_nItemCount * 4 ), [&arrScan]( int k, value_type const& ) { arrScan.push_back( k ); } );
+                CPPUNIT_CHECK( nCount == c_nItemCount + 2 );
+                CPPUNIT_CHECK( std::is_sorted( arrScan.begin(), arrScan.end() ));
+
+                CPPUNIT_CHECK( m.scan( 50, 50, []( int, value_type const& ) {} ) == 0 );
+                CPPUNIT_CHECK( m.scan( 50, 40, []( int, value_type const& ) {} ) == 0 );
+
+                arrScan.clear();
+                CPPUNIT_CHECK( m.scan_n( 1001, 5, [&arrScan]( int k, value_type const& ) { arrScan.push_back( k ); } ) == 5 );
+                CPPUNIT_CHECK( arrScan.size() == 5 );
+                CPPUNIT_CHECK( arrScan.front() == 1002 );
+                CPPUNIT_CHECK( arrScan.back() == 1010 );
+            }
+
+            // erase()
+            CPPUNIT_CHECK( m.erase( 101 ));
+            CPPUNIT_CHECK( !m.erase( 101 ));
+            CPPUNIT_CHECK( m.erase( 103, []( int k, value_type& v ) { CPPUNIT_ASSERT_CURRENT( v.nKey == k ); } ));
+            CPPUNIT_CHECK( !m.erase( 1001 ));
+
+            // Erase every second key, then the rest in shuffled order, the tree shrinks by merges
+            for ( int i = 0; i < static_cast<int>( c_nItemCount ); i += 2 )
+                CPPUNIT_CHECK_EX( m.erase( i * 2 ), "key=" << i * 2 );
+            CPPUNIT_CHECK( m.size() == c_nItemCount / 2 );
+            CPPUNIT_CHECK( m.check_consistency() );
+            for ( int i = 0; i < static_cast<int>( c_nItemCount * 2 ); ++i )
+                CPPUNIT_CHECK_EX( m.find( i ) == ( i % 4 == 2 ), "key=" << i );
+
+            std::random_shuffle( arrKeys.begin(), arrKeys.end() );
+            for ( size_t i = 0; i < arrKeys.size(); ++i )
+                CPPUNIT_CHECK_EX( m.erase( arrKeys[i] ) == ( arrKeys[i] % 4 == 2 ), "key=" << arrKeys[i] );
+            CPPUNIT_CHECK( m.empty() );
+            CPPUNIT_CHECK( m.size() == 0 );
+            CPPUNIT_CHECK( m.check_consistency() );
+            CPPUNIT_CHECK( m.statistics().m_nLeafMerge.get() > 0 );
+
+            // clear()
+            for ( int i = 0; i < static_cast<int>( c_nItemCount ); ++i ) {
+                value_type val = { i, i * 3 };
+                CPPUNIT_CHECK( m.insert( i, val ));
+            }
+            m.clear();
+            CPPUNIT_CHECK( m.empty() );
+            CPPUNIT_CHECK( m.size() == 0 );
+            CPPUNIT_CHECK( m.check_consistency() );
+
+            Map::gc::force_dispose();
+        }
+
+        template <class Map>
+        void test_mt()
+        {
+            Map m;
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Worker<Map>( pool, m ), c_nWorkerCount );
+            pool.run();
+
+            size_t nInsert = 0;
+            size_t nErase = 0;
+            size_t nError = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Worker<Map> * p = static_cast<Worker<Map> *>( *it );
+                nInsert += p->m_nInsert;
+                nErase += p->m_nErase;
+                nError += p->m_nError;
+            }
+
+            typename Map::stat const& s = m.statistics();
+            CPPUNIT_MSG( "   Insert=" << nInsert << " erase=" << nErase
+                << " restart=" << s.m_nRestart.get()
+                << " split=" << s.m_nLeafSplit.get() << "/" << s.m_nInnerSplit.get()
+                << " merge=" << s.m_nLeafMerge.get() << "/" << s.m_nInnerMerge.get() );
+            CPPUNIT_CHECK( nError == 0 );
+            CPPUNIT_CHECK( m.size() == nInsert - nErase );
+            CPPUNIT_CHECK( m.check_consistency() );
+
+            size_t nCount = m.scan( 0, static_cast<int>( c_nKeyRange ), []( int, value_type const& ) {} );
+            CPPUNIT_CHECK( nCount == nInsert - nErase );
+
+            m.clear();
+            CPPUNIT_CHECK( m.empty() );
+            Map::gc::force_dispose();
+        }
+
+        template <class RCU>
+        void test()
+        {
+            typedef cc::BPlusTreeMap< cds::urcu::gc<RCU>, int, value_type,
+                typename cc::bplus_tree::make_traits<
+                    cds::opt::item_counter< cds::atomicity::item_counter >
+                    ,cds::opt::stat< cc::bplus_tree::stat<> >
+                >::type
+            > map_type;
+            test_seq<map_type>();
+            test_mt<map_type>();
+
+            // The minimal node capacity makes the tree high
+            typedef cc::BPlusTreeMap< cds::urcu::gc<RCU>, int, value_type,
+                typename cc::bplus_tree::make_traits<
+                    cds::opt::less< std::less<int> >
+                    ,cds::opt::item_counter< cds::atomicity::item_counter >
+                    ,cds::opt::stat< cc::bplus_tree::stat<> >
+                    ,cc::bplus_tree::node_capacity< 4 >
+                >::type
+            > narrow_map_type;
+            test_seq<narrow_map_type>();
+            test_mt<narrow_map_type>();
+        }
+
+        void BPlusTree_RCU_GPI()
+        {
+            test< cds::urcu::general_instant<> >();
+        }
+
+        void BPlusTree_RCU_GPB()
+        {
+            test< cds::urcu::general_buffered<> >();
+        }
+
+        void BPlusTree_RCU_GPT()
+        {
+            test< cds::urcu::general_threaded<> >();
+        }
+
+        CPPUNIT_TEST_SUITE(BPlusTreeMapRCUHdrTest)
+            CPPUNIT_TEST(BPlusTree_RCU_GPI)
+            CPPUNIT_TEST(BPlusTree_RCU_GPB)
+            CPPUNIT_TEST(BPlusTree_RCU_GPT)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace map
+
+CPPUNIT_TEST_SUITE_REGISTRATION(map::BPlusTreeMapRCUHdrTest);
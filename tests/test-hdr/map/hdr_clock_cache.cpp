@@ -0,0 +1,237 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include <cds/container/michael_list_hp.h>
+#include <cds/container/michael_list_ptb.h>
+#include <cds/container/clock_cache.h>
+
+namespace map {
+
+    namespace cc = cds::container;
+
+    class HdrClockCache: public CppUnitMini::TestCase
+    {
+        struct map_traits: public cc::split_list::make_traits<
+            cc::split_list::ordered_list< cc::michael_list_tag >
+            ,cds::opt::hash< std::hash<int> >
+            ,cc::split_list::ordered_list_traits<
+                cc::michael_list::make_traits<
+                    cds::opt::less< std::less<int> >
+                >::type
+            >
+        >::type
+        {};
+
+        static size_t const c_nCapacity = 100;
+        static size_t const c_nKeyRange = 1000;
+        static size_t const c_nPassCount = 20000;
+
+        template <class Cache>
+        class Worker: public CppUnitMini::TestThread
+        {
+            Cache&  m_Cache;
+
+            virtual TestThread *    clone()
+            {
+                return new Worker( *this );
+            }
+        public:
+            size_t  m_nHit;
+            size_t  m_nMiss;
+            size_t  m_nError;
+            size_t  m_nOverflow;
+
+        public:
+            Worker( CppUnitMini::ThreadPool& pool, Cache& c )
+                : CppUnitMini::TestThread( pool )
+                , m_Cache( c )
+            {}
+            Worker( Worker& src )
+                : CppUnitMini::TestThread( src )
+                , m_Cache( src.m_Cache )
+            {}
+
+            virtual void init() { cds::threading::Manager::attachThread(); }
+            virtual void fini() { cds::threading::Manager::detachThread(); }
+
+            virtual void test()
+            {
+                m_nHit = m_nMiss = m_nError = m_nOverflow = 0;
+
+                // The keys are skewed to the small values: key = r * r / range
+                unsigned int nRand = static_cast<unsigned int>( m_nThreadNo + 1 );
+                for ( size_t nPass = 0; nPass < c_nPassCount; ++nPass ) {
+                    nRand = cds::bitop::RandXorShift( nRand );
+                    size_t r = nRand % c_nKeyRange;
+                    int nKey = static_cast<int>( r * r / c_nKeyRange );
+
+                    int nVal;
+                    if ( m_Cache.get( nKey, nVal )) {
+                        ++m_nHit;
+                        if ( nVal != nKey * 2 )
+                            ++m_nError;
+                    }
+                    else {
+                        ++m_nMiss;
+                        m_Cache.insert( nKey, nKey * 2 );
+                    }
+
+                    if ( nPass % 16 == 0 && nRand % 64 == 0 )
+                        m_Cache.erase( nKey );
+                    if ( m_Cache.size() > m_Cache.capacity() )
+                        ++m_nOverflow;
+                }
+            }
+        };
+
+    protected:
+        template <class Cache>
+        void test_seq()
+        {
+            Cache c( c_nCapacity );
+            int const nCapacity = static_cast<int>( c_nCapacity );
+
+            CPPUNIT_ASSERT( c.empty() );
+            CPPUNIT_ASSERT( c.capacity() == c_nCapacity );
+
+            int nVal;
+            CPPUNIT_CHECK( !c.get( 1, nVal ));
+            CPPUNIT_CHECK( c.statistics().m_nMiss.get() == 1 );
+
+            // Fill the cache
+            for ( int i = 0; i < nCapacity; ++i )
+                CPPUNIT_CHECK( c.insert( i, i * 2 ));
+            CPPUNIT_CHECK( c.size() == c_nCapacity );
+            CPPUNIT_CHECK( !c.insert( 5, 5 ));
+            CPPUNIT_CHECK( c.statistics().m_nEvict.get() == 0 );
+            CPPUNIT_CHECK( c.statistics().m_nInsertFailed.get() == 1 );
+
+            // Touch the first half of the items
+            for ( int i = 0; i < nCapacity / 2; ++i ) {
+                CPPUNIT_ASSERT( c.get( i, nVal ));
+                CPPUNIT_CHECK( nVal == i * 2 );
+            }
+            CPPUNIT_CHECK( c.statistics().m_nHit.get() == c_nCapacity / 2 );
+
+            // The untouched items are evicted, the touched ones get second chance
+            for ( int i = nCapacity; i < nCapacity + nCapacity / 2; ++i )
+                CPPUNIT_CHECK( c.insert( i, i * 2 ));
+            CPPUNIT_CHECK( c.size() == c_nCapacity );
+            CPPUNIT_CHECK( c.statistics().m_nEvict.get() == c_nCapacity / 2 );
+            for ( int i = 0; i < nCapacity / 2; ++i )
+                CPPUNIT_CHECK_EX( c.contains( i ), "key=" << i );
+            for ( int i = nCapacity / 2; i < nCapacity; ++i )
+                CPPUNIT_CHECK_EX( !c.contains( i ), "key=" << i );
+
+            // find() with functor
+            {
+                int nFound = -1;
+                CPPUNIT_CHECK( c.find( nCapacity, [&nFound]( int, int& v ) { nFound = v; } ));
+                CPPUNIT_CHECK( nFound == nCapacity * 2 );
+            }
+
+            // The slot of erased item is reused without eviction
+            CPPUNIT_CHECK( c.erase( 0 ));
+            CPPUNIT_CHECK( !c.erase( 0 ));
+            CPPUNIT_CHECK( c.size() == c_nCapacity - 1 );
+            size_t nEvicted = c.statistics().m_nEvict.get();
+            CPPUNIT_CHECK( c.evict() == 1 );    // the clock hand points to the slot of erased item
+            CPPUNIT_CHECK( c.statistics().m_nStaleSlot.get() == 1 );
+            CPPUNIT_CHECK( c.insert( 0, 0 ));
+            CPPUNIT_CHECK( c.size() == c_nCapacity );
+            CPPUNIT_CHECK( c.statistics().m_nEvict.get() == nEvicted );
+
+            // evict() frees the slots of the victims, the insertion uses them without eviction
+            CPPUNIT_CHECK( c.evict( 10 ) == 10 );
+            CPPUNIT_CHECK( c.size() == c_nCapacity - 10 );
+            nEvicted = c.statistics().m_nEvict.get();
+            for ( int i = 500; i < 510; ++i )
+                CPPUNIT_CHECK( c.insert( i, i * 2 ));
+            CPPUNIT_CHECK( c.size() == c_nCapacity );
+            CPPUNIT_CHECK( c.statistics().m_nEvict.get() == nEvicted );
+
+            // Insertion never exceeds the capacity
+            for ( int i = 1000; i < 1000 + nCapacity * 3; ++i ) {
+                CPPUNIT_CHECK( c.insert( i, i * 2 ));
+                CPPUNIT_CHECK( c.size() <= c_nCapacity );
+            }
+            CPPUNIT_CHECK( c.size() == c_nCapacity );
+
+            c.clear();
+            CPPUNIT_CHECK( c.empty() );
+            for ( int i = 0; i < nCapacity; ++i )
+                CPPUNIT_CHECK( c.insert( i, i * 2 ));
+            CPPUNIT_CHECK( c.size() == c_nCapacity );
+        }
+
+        template <class Cache>
+        void test_mt()
+        {
+            Cache c( c_nCapacity );
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Worker<Cache>( pool, c ), 4 );
+            pool.run();
+
+            size_t nHit = 0;
+            size_t nMiss = 0;
+            size_t nError = 0;
+            size_t nOverflow = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Worker<Cache> * p = static_cast<Worker<Cache> *>( *it );
+                nHit += p->m_nHit;
+                nMiss += p->m_nMiss;
+                nError += p->m_nError;
+                nOverflow += p->m_nOverflow;
+            }
+            CPPUNIT_MSG( "   Hit=" << nHit << " miss=" << nMiss
+                << " evicted=" << c.statistics().m_nEvict.get()
+                << " second chance=" << c.statistics().m_nSecondChance.get() );
+
+            CPPUNIT_CHECK( nHit + nMiss == c_nPassCount * 4 );
+            CPPUNIT_CHECK( nError == 0 );
+            CPPUNIT_CHECK( nOverflow == 0 );
+            CPPUNIT_CHECK( c.size() <= c_nCapacity );
+            CPPUNIT_CHECK( c.statistics().m_nHit.get() == nHit );
+            CPPUNIT_CHECK( c.statistics().m_nMiss.get() == nMiss );
+        }
+
+        template <class Cache>
+        void test()
+        {
+            test_seq<Cache>();
+            test_mt<Cache>();
+        }
+
+        void HP()
+        {
+            typedef cc::ClockCache< cds::gc::HP, int, int,
+                cc::clock_cache::make_traits<
+                    cc::clock_cache::map_traits< map_traits >
+                    ,cds::opt::stat< cc::clock_cache::stat<> >
+                >::type
+            > cache_type;
+            test<cache_type>();
+        }
+
+        void PTB()
+        {
+            typedef cc::ClockCache< cds::gc::PTB, int, int,
+                cc::clock_cache::make_traits<
+                    cc::clock_cache::map_traits< map_traits >
+                    ,cds::opt::stat< cc::clock_cache::stat<> >
+                    ,cds::opt::back_off< cds::backoff::yield >
+                >::type
+            > cache_type;
+            test<cache_type>();
+        }
+
+        CPPUNIT_TEST_SUITE(HdrClockCache)
+            CPPUNIT_TEST(HP)
+            CPPUNIT_TEST(PTB)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace map
+
+CPPUNIT_TEST_SUITE_REGISTRATION(map::HdrClockCache);
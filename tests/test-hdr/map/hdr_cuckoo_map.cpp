@@ -330,6 +330,36 @@ namespace map {
 
             test_cuckoo<map_t>();
         }
+
+        CPPUNIT_MESSAGE( "equal, derived hash");
+        {
+            typedef cc::CuckooMap< CuckooMapHdrTest::key_type, CuckooMapHdrTest::value_type,
+                cc::cuckoo::make_traits<
+                    co::mutex_policy< cc::cuckoo::striping<> >
+                    ,co::equal_to< std::equal_to< int > >
+                    ,cc::cuckoo::store_hash< false >
+                    ,cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+                    ,co::hash< co::v::derived_hash_list< co::v::mix128_hash, 2 > >
+                >::type
+            > map_t;
+
+            test_cuckoo<map_t>();
+        }
+
+        CPPUNIT_MESSAGE( "equal, derived hash, store hash");
+        {
+            typedef cc::CuckooMap< CuckooMapHdrTest::key_type, CuckooMapHdrTest::value_type,
+                cc::cuckoo::make_traits<
+                    co::mutex_policy< cc::cuckoo::striping< std::recursive_mutex, 3 > >
+                    ,co::equal_to< std::equal_to< int > >
+                    ,cc::cuckoo::store_hash< true >
+                    ,cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+                    ,co::hash< co::v::derived_hash_list< co::v::mix128_hash, 3 > >
+                >::type
+            > map_t;
+
+            test_cuckoo<map_t>();
+        }
     }
 
 
@@ -489,6 +519,36 @@ namespace map {
             test_cuckoo<map_t>();
         }
 
+
+        CPPUNIT_MESSAGE( "equal, derived hash");
+        {
+            typedef cc::CuckooMap< CuckooMapHdrTest::key_type, CuckooMapHdrTest::value_type,
+                cc::cuckoo::make_traits<
+                    co::mutex_policy< cc::cuckoo::refinable<> >
+                    ,co::equal_to< std::equal_to< int > >
+                    ,cc::cuckoo::store_hash< false >
+                    ,cc::cuckoo::probeset_type< cc::cuckoo::list >
+                    ,co::hash< co::v::derived_hash_list< co::v::mix128_hash, 2 > >
+                >::type
+            > map_t;
+
+            test_cuckoo<map_t>();
+        }
+
+        CPPUNIT_MESSAGE( "equal, derived hash, store hash");
+        {
+            typedef cc::CuckooMap< CuckooMapHdrTest::key_type, CuckooMapHdrTest::value_type,
+                cc::cuckoo::make_traits<
+                    co::mutex_policy< cc::cuckoo::refinable< std::recursive_mutex, 3 > >
+                    ,co::equal_to< std::equal_to< int > >
+                    ,cc::cuckoo::store_hash< true >
+                    ,cc::cuckoo::probeset_type< cc::cuckoo::list >
+                    ,co::hash< co::v::derived_hash_list< co::v::mix128_hash, 3 > >
+                >::type
+            > map_t;
+
+            test_cuckoo<map_t>();
+        }
     }
 
 
@@ -0,0 +1,286 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include <cds/intrusive/michael_list_hp.h>
+#include <cds/intrusive/michael_list_ptb.h>
+#include <cds/container/expiring_map.h>
+#include <vector>
+#include <algorithm>
+
+namespace map {
+
+    namespace cc = cds::container;
+
+    namespace {
+        // The clock is advanced by the test explicitly, so the expiration does not depend on the test speed
+        struct test_clock {
+            typedef std::chrono::milliseconds   duration;
+            typedef duration::rep               rep;
+            typedef duration::period            period;
+            typedef std::chrono::time_point< test_clock > time_point;
+            static const bool is_steady = true;
+
+            static atomics::atomic<rep> s_nNow;
+
+            static time_point now()
+            {
+                return time_point( duration( s_nNow.load( atomics::memory_order_acquire )));
+            }
+
+            static void advance( rep nMilliseconds )
+            {
+                s_nNow.fetch_add( nMilliseconds, atomics::memory_order_acq_rel );
+            }
+        };
+        atomics::atomic<test_clock::rep> test_clock::s_nNow( 1000000 );
+    }
+
+    class HdrExpiringMap: public CppUnitMini::TestCase
+    {
+        typedef std::chrono::milliseconds ms;
+
+        static size_t const c_nKeyRange = 1000;
+        static size_t const c_nPassCount = 20000;
+        static size_t const c_nWorkerCount = 3;
+
+        template <class Map>
+        class Worker: public CppUnitMini::TestThread
+        {
+            Map&    m_Map;
+
+            virtual TestThread *    clone()
+            {
+                return new Worker( *this );
+            }
+        public:
+            size_t  m_nInsert;
+            size_t  m_nFind;
+            size_t  m_nError;
+
+        public:
+            Worker( CppUnitMini::ThreadPool& pool, Map& m )
+                : CppUnitMini::TestThread( pool )
+                , m_Map( m )
+            {}
+            Worker( Worker& src )
+                : CppUnitMini::TestThread( src )
+                , m_Map( src.m_Map )
+            {}
+
+            virtual void init() { cds::threading::Manager::attachThread(); }
+            virtual void fini() { cds::threading::Manager::detachThread(); }
+
+            virtual void test()
+            {
+                m_nInsert = m_nFind = m_nError = 0;
+
+                // The workers share the key range
+                unsigned int nRand = static_cast<unsigned int>( m_nThreadNo + 1 );
+                for ( size_t nPass = 0; nPass < c_nPassCount; ++nPass ) {
+                    nRand = cds::bitop::RandXorShift( nRand );
+                    int nKey = static_cast<int>( nRand % c_nKeyRange );
+
+                    bool bFound = m_Map.find( nKey, [this, nKey]( typename Map::value_type& item ) {
+                        if ( item.second != nKey * 2 )
+                            ++m_nError;
+                    });
+                    if ( bFound ) {
+                        ++m_nFind;
+                        if ( nRand % 8 == 0 )
+                            m_Map.touch( nKey, ms( nRand % 200 ));
+                        else if ( nRand % 32 == 1 )
+                            m_Map.erase( nKey );
+                    }
+                    else if ( m_Map.insert( nKey, nKey * 2, ms( 10 + nRand % 300 )))
+                        ++m_nInsert;
+
+                    if ( m_nThreadNo == 0 && nPass % 64 == 0 ) {
+                        // The thread is also the housekeeper
+                        test_clock::advance( 5 );
+                        m_Map.expire();
+                    }
+                }
+            }
+        };
+
+    protected:
+        template <class Map>
+        void test_seq()
+        {
+            Map m( 256, 4 );
+            CPPUNIT_ASSERT( m.empty() );
+
+            // Keys 0..99 expire in (key % 10 + 1) * 10 ms, keys 100..149 never expire
+            for ( int i = 0; i < 100; ++i )
+                CPPUNIT_CHECK( m.insert( i, i * 2, ms(( i % 10 + 1 ) * 10 )));
+            for ( int i = 100; i < 150; ++i )
+                CPPUNIT_CHECK( m.insert( i, i * 2 ));
+            CPPUNIT_CHECK( m.size() == 150 );
+            CPPUNIT_CHECK( m.timer_count() == 100 );
+            CPPUNIT_CHECK( !m.insert( 5, 0, ms( 1000 )));
+            CPPUNIT_CHECK( !m.emplace( 120, 0 ));
+            CPPUNIT_CHECK( m.statistics().m_nInsertFailed.get() == 2 );
+
+            for ( int i = 0; i < 150; ++i ) {
+                int nVal = -1;
+                CPPUNIT_CHECK_EX( m.find( i, [&nVal]( typename Map::value_type& item ) { nVal = item.second; } ), "key=" << i );
+                CPPUNIT_CHECK_EX( nVal == i * 2, "key=" << i );
+            }
+
+            // Nothing is due yet
+            CPPUNIT_CHECK( m.expire() == 0 );
+            CPPUNIT_CHECK( m.size() == 150 );
+
+            // Keys with TTL 10, 20, 30 ms expire
+            test_clock::advance( 35 );
+            CPPUNIT_CHECK( !m.find( 0 ));   // the expired item is removed lazily
+            CPPUNIT_CHECK( m.statistics().m_nExpireLazy.get() == 1 );
+            CPPUNIT_CHECK( m.size() == 149 );
+
+            std::vector<int> arrExpired;
+            CPPUNIT_CHECK( m.expire( [&arrExpired]( typename Map::value_type& item ) { arrExpired.push_back( item.first ); } ) == 29 );
+            CPPUNIT_CHECK( m.statistics().m_nStaleTimer.get() == 1 );
+            CPPUNIT_CHECK( m.size() == 120 );
+            CPPUNIT_CHECK( arrExpired.size() == 29 );
+            for ( size_t i = 0; i < arrExpired.size(); ++i ) {
+                CPPUNIT_CHECK_EX( arrExpired[i] % 10 < 3, "key=" << arrExpired[i] );
+                CPPUNIT_CHECK_EX( arrExpired[i] != 0, "key=" << arrExpired[i] );
+            }
+            for ( int i = 0; i < 100; ++i )
+                CPPUNIT_CHECK_EX( m.find( i ) == ( i % 10 >= 3 ), "key=" << i );
+            CPPUNIT_CHECK( m.timer_count() == 70 );
+
+            // touch() prolongs the live item only
+            CPPUNIT_CHECK( m.touch( 5, ms( 1000 )));    // expires in 60 ms
+            CPPUNIT_CHECK( !m.touch( 11, ms( 1000 )));  // expired
+            CPPUNIT_CHECK( !m.touch( 500, ms( 1000 ))); // not found
+            CPPUNIT_CHECK( m.touch( 100, ms( 20 )));    // never expiring item becomes expiring
+            CPPUNIT_CHECK( m.timer_count() == 71 );
+
+            // Keys with TTL 40..100 ms and key 100 expire, key 5 is prolonged
+            test_clock::advance( 100 );
+            CPPUNIT_CHECK( m.expire() == 70 );
+            CPPUNIT_CHECK( m.size() == 50 );
+            CPPUNIT_CHECK( m.find( 5 ));
+            CPPUNIT_CHECK( !m.find( 100 ));
+            CPPUNIT_CHECK( m.timer_count() == 1 );      // the record of key 5 is rescheduled
+
+            // An expired item is replaced by insertion
+            CPPUNIT_CHECK( m.insert( 9, 99, ms( 10 )));
+            test_clock::advance( 20 );
+            size_t nLazy = m.statistics().m_nExpireLazy.get();
+            CPPUNIT_CHECK( m.insert( 9, 999 ));
+            CPPUNIT_CHECK( m.statistics().m_nExpireLazy.get() == nLazy + 1 );
+            {
+                typename Map::guarded_ptr gp;
+                CPPUNIT_ASSERT( m.get( gp, 9 ));
+                CPPUNIT_CHECK( gp->first == 9 );
+                CPPUNIT_CHECK( gp->second == 999 );
+            }
+            // The stale timer record of key 9 does not remove the new item
+            CPPUNIT_CHECK( m.expire() == 0 );
+            CPPUNIT_CHECK( m.find( 9 ));
+
+            // extract() and erase()
+            {
+                typename Map::guarded_ptr gp;
+                CPPUNIT_ASSERT( m.extract( gp, 101 ));
+                CPPUNIT_CHECK( gp->second == 202 );
+                CPPUNIT_CHECK( !m.find( 101 ));
+            }
+            CPPUNIT_CHECK( m.erase( 102 ));
+            CPPUNIT_CHECK( !m.erase( 102 ));
+            CPPUNIT_CHECK( m.insert( 8, 16, ms( 10 )));
+            test_clock::advance( 20 );
+            CPPUNIT_CHECK( !m.erase( 8 ));     // the expired item is removed but it is not found
+
+            // The rest expire
+            test_clock::advance( 1000 );
+            CPPUNIT_CHECK( m.expire() == 1 );
+            CPPUNIT_CHECK( !m.find( 5 ));
+            CPPUNIT_CHECK( m.timer_count() == 0 );
+
+            m.clear();
+            CPPUNIT_CHECK( m.empty() );
+        }
+
+        template <class Map>
+        void test_mt()
+        {
+            Map m( c_nKeyRange, 2 );
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Worker<Map>( pool, m ), c_nWorkerCount );
+            pool.run();
+
+            size_t nInsert = 0;
+            size_t nFind = 0;
+            size_t nError = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Worker<Map> * p = static_cast<Worker<Map> *>( *it );
+                nInsert += p->m_nInsert;
+                nFind += p->m_nFind;
+                nError += p->m_nError;
+            }
+
+            typename Map::stat const& s = m.statistics();
+            CPPUNIT_MSG( "   Insert=" << nInsert << " find=" << nFind
+                << " expired by timer=" << s.m_nExpireTimer.get()
+                << " expired lazily=" << s.m_nExpireLazy.get()
+                << " stale timer=" << s.m_nStaleTimer.get() );
+            CPPUNIT_CHECK( nError == 0 );
+            CPPUNIT_CHECK( s.m_nInsert.get() == nInsert );
+
+            // All items expire. The timer record scheduled concurrently with expire()
+            // is processed not later than by the next expire()
+            test_clock::advance( 1000 );
+            m.expire();
+            CPPUNIT_CHECK( m.empty() );
+            CPPUNIT_CHECK( m.timer_count() == 0 );
+            for ( int i = 0; i < static_cast<int>( c_nKeyRange ); ++i )
+                CPPUNIT_CHECK_EX( !m.find( i ), "key=" << i );
+        }
+
+        template <class Map>
+        void test()
+        {
+            test_seq<Map>();
+            test_mt<Map>();
+        }
+
+        void HP()
+        {
+            typedef cc::ExpiringHashMap< cds::gc::HP, int, int,
+                cc::expiring_map::make_traits<
+                    cds::opt::hash< std::hash<int> >
+                    ,cds::opt::less< std::less<int> >
+                    ,cds::opt::stat< cc::expiring_map::stat<> >
+                    ,cc::expiring_map::clock< test_clock >
+                >::type
+            > map_type;
+            test<map_type>();
+        }
+
+        void PTB()
+        {
+            typedef cc::ExpiringHashMap< cds::gc::PTB, int, int,
+                cc::expiring_map::make_traits<
+                    cds::opt::hash< std::hash<int> >
+                    ,cds::opt::compare< cds::opt::details::make_comparator_from_less< std::less<int> > >
+                    ,cds::opt::stat< cc::expiring_map::stat<> >
+                    ,cc::expiring_map::clock< test_clock >
+                    ,cc::expiring_map::resolution< 5 >
+                >::type
+            > map_type;
+            test<map_type>();
+        }
+
+        CPPUNIT_TEST_SUITE(HdrExpiringMap)
+            CPPUNIT_TEST(HP)
+            CPPUNIT_TEST(PTB)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace map
+
+CPPUNIT_TEST_SUITE_REGISTRATION(map::HdrExpiringMap);
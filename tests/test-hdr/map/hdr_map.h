@@ -253,6 +253,34 @@ namespace map {
             test_iter<Map>();
         }
 
+        // unlink() deletes only the item pointed by guarded_ptr
+        template <class Map>
+        void test_unlink()
+        {
+            Map m( 100, 4 );
+            typename Map::guarded_ptr gp;
+
+            CPPUNIT_ASSERT( m.insert( 10, 10 ));
+            CPPUNIT_ASSERT( m.get( gp, 10 ));
+
+            // The key is erased and inserted again, gp points to the old item
+            CPPUNIT_ASSERT( m.erase( 10 ));
+            CPPUNIT_ASSERT( m.insert( 10, 20 ));
+            CPPUNIT_CHECK( !m.unlink( gp ));
+            CPPUNIT_CHECK( m.find( 10 ));
+            gp.release();
+
+            CPPUNIT_ASSERT( m.get( gp, 10 ));
+            CPPUNIT_CHECK( gp->second.m_val == 20 );
+            CPPUNIT_CHECK( m.unlink( gp ));
+            CPPUNIT_CHECK( !m.find( 10 ));
+            CPPUNIT_CHECK( !m.unlink( gp ));
+            gp.release();
+
+            CPPUNIT_CHECK( !m.unlink( gp ));
+            CPPUNIT_ASSERT( m.empty() );
+        }
+
         template <class Map>
         void test_rcu()
         {
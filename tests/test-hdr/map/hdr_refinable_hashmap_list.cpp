@@ -4,6 +4,7 @@
 #include <cds/container/striped_map/std_list.h>
 #include <cds/container/striped_map.h>
 #include <cds/lock/spinlock.h>
+#include <cds/lock/elided_lock.h>
 
 namespace map {
 
@@ -56,6 +57,15 @@ namespace map {
         >   map_spin;
         test_striped2< map_spin >();
 
+        // Elided recursive spinlock as lock policy
+        CPPUNIT_MESSAGE( "elided spinlock");
+        typedef cc::StripedMap< sequence_t
+            ,co::mutex_policy< cc::striped_set::refinable< cds::lock::ElidedLock<cds::lock::ReentrantSpin> > >
+            , co::hash< hash_int >
+            , co::less< less >
+        >   map_elided_spin;
+        test_striped2< map_elided_spin >();
+
         // Resizing policy
         CPPUNIT_MESSAGE( "load_factor_resizing<0>(8)");
         {
@@ -0,0 +1,437 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include <cds/opt/hash.h>
+#include <cds/container/skip_list_map_hp.h>
+#include <cds/container/michael_list_hp.h>
+#include <cds/container/split_list_map.h>
+#include <cds/container/michael_kvlist_hp.h>
+#include <cds/container/michael_map.h>
+#include <cds/container/michael_set.h>
+#include <cds/container/cuckoo_map.h>
+#include <cds/container/snapshot.h>
+#include <vector>
+#include <string>
+#include <cstdio>
+
+namespace map {
+
+    namespace cc = cds::container;
+    namespace co = cds::opt;
+    namespace snapshot = cds::container::snapshot;
+
+    class SnapshotHdrTest: public CppUnitMini::TestCase
+    {
+        static size_t const c_nItemCount = 5000;
+        static size_t const c_nPassCount = 20;
+        static char const * c_szFileName() { return "cds_snapshot_test.tmp"; }
+
+        struct hash1 {
+            size_t operator()( int i ) const
+            {
+                return cds::opt::v::hash<int>()( i );
+            }
+        };
+
+        struct hash2: private hash1 {
+            size_t operator()( int i ) const
+            {
+                size_t h = ~( hash1::operator()(i) );
+                return ~h + 0x9e3779b9 + (h << 6) + (h >> 2);
+            }
+        };
+
+        static std::string make_string( int n )
+        {
+            char buf[32];
+            sprintf( buf, "%d", n * 7 );
+            return std::string( buf ) + ( n % 3 ? "" : " long string to be sure the length prefix is right" );
+        }
+
+        // Inserts and erases the keys out of [0, c_nItemCount) while the map is being saved
+        template <class Map>
+        class Writer: public CppUnitMini::TestThread
+        {
+            Map&    m_Map;
+
+            virtual TestThread *    clone()
+            {
+                return new Writer( *this );
+            }
+        public:
+            atomics::atomic<bool>&  m_bStop;
+
+        public:
+            Writer( CppUnitMini::ThreadPool& pool, Map& m, atomics::atomic<bool>& bStop )
+                : CppUnitMini::TestThread( pool )
+                , m_Map( m )
+                , m_bStop( bStop )
+            {}
+            Writer( Writer& src )
+                : CppUnitMini::TestThread( src )
+                , m_Map( src.m_Map )
+                , m_bStop( src.m_bStop )
+            {}
+
+            virtual void init() { cds::threading::Manager::attachThread(); }
+            virtual void fini() { cds::threading::Manager::detachThread(); }
+
+            virtual void test()
+            {
+                int const nFirst = static_cast<int>( c_nItemCount );
+                int nKey = nFirst;
+                while ( !m_bStop.load( atomics::memory_order_acquire )) {
+                    m_Map.insert( nKey, nKey );
+                    if ( nKey & 1 )
+                        m_Map.erase( nKey - 1 );
+                    if ( ++nKey == nFirst * 2 )
+                        nKey = nFirst;
+                }
+            }
+        };
+
+        // Saves the map and checks the snapshot while Writer changes the map
+        template <class Map>
+        class Saver: public CppUnitMini::TestThread
+        {
+            Map&    m_Map;
+
+            virtual TestThread *    clone()
+            {
+                return new Saver( *this );
+            }
+        public:
+            atomics::atomic<bool>&  m_bStop;
+            size_t                  m_nError;
+
+        public:
+            Saver( CppUnitMini::ThreadPool& pool, Map& m, atomics::atomic<bool>& bStop )
+                : CppUnitMini::TestThread( pool )
+                , m_Map( m )
+                , m_bStop( bStop )
+            {}
+            Saver( Saver& src )
+                : CppUnitMini::TestThread( src )
+                , m_Map( src.m_Map )
+                , m_bStop( src.m_bStop )
+            {}
+
+            virtual void init() { cds::threading::Manager::attachThread(); }
+            virtual void fini() { cds::threading::Manager::detachThread(); }
+
+            virtual void test()
+            {
+                typedef snapshot::loader< snapshot::default_codec< typename Map::value_type > > loader;
+
+                m_nError = 0;
+                for ( size_t nPass = 0; nPass < c_nPassCount; ++nPass ) {
+                    snapshot::save( m_Map, c_szFileName() );
+
+                    // The snapshot of a skip-list is sorted, all keys of [0, c_nItemCount) are saved
+                    loader ld( c_szFileName() );
+                    int nPrev = -1;
+                    size_t nCount = 0;
+                    for ( typename loader::iterator it = ld.begin(); it != ld.end(); ++it ) {
+                        if ( nPrev >= it->first )
+                            ++m_nError;
+                        nPrev = it->first;
+                        if ( it->first < static_cast<int>( c_nItemCount )) {
+                            if ( it->second != it->first * 2 )
+                                ++m_nError;
+                            ++nCount;
+                        }
+                    }
+                    if ( nCount != c_nItemCount )
+                        ++m_nError;
+
+                    Map m2( ld.begin(), ld.end() );
+                    if ( m2.size() != ld.size() )
+                        ++m_nError;
+                }
+                m_bStop.store( true, atomics::memory_order_release );
+            }
+        };
+
+        template <class Map>
+        void fill_map( Map& m )
+        {
+            for ( size_t i = 0; i < c_nItemCount; ++i ) {
+                int const nKey = static_cast<int>( (i * 7919) % c_nItemCount );
+                CPPUNIT_ASSERT( m.insert( nKey, nKey * 2 ));
+            }
+        }
+
+        template <class Map>
+        void check_map( Map& m )
+        {
+            CPPUNIT_CHECK_EX( m.size() == c_nItemCount, "size=" << m.size() );
+            for ( size_t i = 0; i < c_nItemCount; ++i ) {
+                int const nKey = static_cast<int>( i );
+                int nVal = -1;
+                CPPUNIT_CHECK( m.find( nKey, [&nVal]( typename Map::value_type& v ) { nVal = v.second; } ));
+                CPPUNIT_CHECK( nVal == nKey * 2 );
+            }
+        }
+
+        template <class Map>
+        void test_reload()
+        {
+            typedef snapshot::loader< snapshot::default_codec< typename Map::value_type > > loader;
+
+            Map m;
+            fill_map( m );
+            CPPUNIT_ASSERT( snapshot::save( m, c_szFileName() ) == c_nItemCount );
+
+            {
+                loader ld( c_szFileName() );
+                CPPUNIT_ASSERT( ld.size() == c_nItemCount );
+
+                // The range can be traversed twice
+                size_t nCount = 0;
+                for ( typename loader::iterator it = ld.begin(); it != ld.end(); ++it ) {
+                    CPPUNIT_CHECK( it->second == it->first * 2 );
+                    ++nCount;
+                }
+                CPPUNIT_CHECK( nCount == c_nItemCount );
+
+                Map m2( ld.begin(), ld.end() );
+                check_map( m2 );
+            }
+
+            Map m3;
+            CPPUNIT_CHECK( snapshot::load( m3, c_szFileName() ) == c_nItemCount );
+            check_map( m3 );
+            // The items are in the map already
+            CPPUNIT_CHECK( snapshot::load( m3, c_szFileName() ) == 0 );
+
+            std::remove( c_szFileName() );
+        }
+
+        template <class Map>
+        void test_load( Map& m, Map& m2 )
+        {
+            fill_map( m );
+            CPPUNIT_ASSERT( snapshot::save( m, c_szFileName() ) == c_nItemCount );
+            CPPUNIT_CHECK( snapshot::load( m2, c_szFileName() ) == c_nItemCount );
+            check_map( m2 );
+            std::remove( c_szFileName() );
+        }
+
+    public:
+        void SkipListMap_HP()
+        {
+            typedef cc::SkipListMap< cds::gc::HP, int, int,
+                cc::skip_list::make_traits<
+                    co::less< std::less<int> >
+                    ,co::item_counter< cds::atomicity::item_counter >
+                >::type
+            > map_type;
+
+            test_reload< map_type >();
+        }
+
+        void SplitListMap_HP()
+        {
+            typedef cc::SplitListMap< cds::gc::HP, int, int,
+                cc::split_list::make_traits<
+                    cc::split_list::ordered_list< cc::michael_list_tag >
+                    ,co::hash< hash1 >
+                    ,co::item_counter< cds::atomicity::item_counter >
+                    ,cc::split_list::ordered_list_traits<
+                        cc::michael_list::make_traits< co::less< std::less<int> > >::type
+                    >
+                >::type
+            > map_type;
+
+            test_reload< map_type >();
+        }
+
+        void MichaelHashMap_HP()
+        {
+            typedef cc::MichaelKVList< cds::gc::HP, int, int,
+                cc::michael_list::make_traits< co::less< std::less<int> > >::type
+            > list_type;
+            typedef cc::MichaelHashMap< cds::gc::HP, list_type,
+                cc::michael_map::make_traits< co::hash< hash1 > >::type
+            > map_type;
+
+            map_type m( c_nItemCount, 4 );
+            map_type m2( c_nItemCount, 4 );
+            test_load( m, m2 );
+        }
+
+        void CuckooMap()
+        {
+            typedef cc::CuckooMap< int, int,
+                cc::cuckoo::make_traits<
+                    co::equal_to< std::equal_to<int> >
+                    ,co::hash< std::tuple< hash1, hash2 > >
+                >::type
+            > map_type;
+
+            map_type m;
+            map_type m2;
+            test_load( m, m2 );
+
+            size_t nCount = 0;
+            m2.for_each( [&nCount]( map_type::value_type& v ) {
+                ++nCount;
+                v.second = v.first;
+            });
+            CPPUNIT_CHECK( nCount == c_nItemCount );
+            int nVal = -1;
+            CPPUNIT_CHECK( m2.find( 10, [&nVal]( map_type::value_type& v ) { nVal = v.second; } ));
+            CPPUNIT_CHECK( nVal == 10 );
+        }
+
+        void StringCodec()
+        {
+            typedef cc::SplitListMap< cds::gc::HP, int, std::string,
+                cc::split_list::make_traits<
+                    cc::split_list::ordered_list< cc::michael_list_tag >
+                    ,co::hash< hash1 >
+                    ,co::item_counter< cds::atomicity::item_counter >
+                    ,cc::split_list::ordered_list_traits<
+                        cc::michael_list::make_traits< co::less< std::less<int> > >::type
+                    >
+                >::type
+            > map_type;
+            typedef cc::MichaelList< cds::gc::HP, std::string,
+                cc::michael_list::make_traits< co::less< std::less<std::string> > >::type
+            > list_type;
+            typedef cc::MichaelHashSet< cds::gc::HP, list_type,
+                cc::michael_set::make_traits< co::hash< std::hash<std::string> > >::type
+            > set_type;
+
+            map_type m;
+            set_type s( c_nItemCount, 2 );
+            for ( int i = 0; i < static_cast<int>( c_nItemCount ); ++i ) {
+                CPPUNIT_ASSERT( m.insert( i, make_string( i )));
+                CPPUNIT_ASSERT( s.insert( make_string( i )));
+            }
+            CPPUNIT_ASSERT( snapshot::save( m, c_szFileName() ) == c_nItemCount );
+
+            {
+                snapshot::loader< snapshot::default_codec< map_type::value_type > > ld( c_szFileName() );
+                map_type m2( ld.begin(), ld.end() );
+                CPPUNIT_CHECK( m2.size() == c_nItemCount );
+                for ( int i = 0; i < static_cast<int>( c_nItemCount ); ++i ) {
+                    std::string str;
+                    CPPUNIT_CHECK( m2.find( i, [&str]( map_type::value_type& v ) { str = v.second; } ));
+                    CPPUNIT_CHECK( str == make_string( i ));
+                }
+            }
+
+            CPPUNIT_ASSERT( snapshot::save( s, c_szFileName() ) == c_nItemCount );
+            set_type s2( c_nItemCount, 2 );
+            CPPUNIT_CHECK( snapshot::load( s2, c_szFileName() ) == c_nItemCount );
+            for ( int i = 0; i < static_cast<int>( c_nItemCount ); ++i )
+                CPPUNIT_CHECK( s2.find( make_string( i )));
+
+            std::remove( c_szFileName() );
+        }
+
+        void ConcurrentSave()
+        {
+            typedef cc::SkipListMap< cds::gc::HP, int, int,
+                cc::skip_list::make_traits<
+                    co::less< std::less<int> >
+                    ,co::item_counter< cds::atomicity::item_counter >
+                >::type
+            > map_type;
+
+            map_type m;
+            fill_map( m );
+
+            atomics::atomic<bool> bStop( false );
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Writer<map_type>( pool, m, bStop ), 1 );
+            pool.add( new Saver<map_type>( pool, m, bStop ), 1 );
+            pool.run();
+
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Saver<map_type> * pSaver = dynamic_cast<Saver<map_type> *>( *it );
+                if ( pSaver )
+                    CPPUNIT_CHECK_EX( pSaver->m_nError == 0, "errors=" << pSaver->m_nError );
+            }
+            std::remove( c_szFileName() );
+        }
+
+        void Errors()
+        {
+            typedef snapshot::loader< snapshot::pod_codec<int> > loader;
+
+            std::remove( c_szFileName() );
+            CPPUNIT_CHECK_EX( check_error( c_szFileName() ), "no file" );
+
+            // incomplete file: the header is not committed
+            {
+                snapshot::writer w( c_szFileName() );
+                int n = 10;
+                w.write( &n, sizeof(n) );
+            }
+            CPPUNIT_CHECK_EX( check_error( c_szFileName() ), "not committed" );
+
+            // the count of the items is greater than the data
+            {
+                snapshot::writer w( c_szFileName() );
+                int n = 10;
+                w.write( &n, sizeof(n) );
+                w.commit( 2 );
+            }
+            {
+                loader ld( c_szFileName() );
+                CPPUNIT_CHECK( ld.size() == 2 );
+                loader::iterator it = ld.begin();
+                CPPUNIT_CHECK( *it == 10 );
+                bool bError = false;
+                try {
+                    ++it;
+                }
+                catch ( snapshot::snapshot_error& ) {
+                    bError = true;
+                }
+                CPPUNIT_CHECK( bError );
+            }
+
+            // empty snapshot
+            {
+                snapshot::writer w( c_szFileName() );
+                w.commit( 0 );
+            }
+            {
+                loader ld( c_szFileName() );
+                CPPUNIT_CHECK( ld.empty() );
+                CPPUNIT_CHECK( ld.begin() == ld.end() );
+            }
+
+            std::remove( c_szFileName() );
+        }
+
+    protected:
+        static bool check_error( char const * pszFileName )
+        {
+            try {
+                snapshot::loader< snapshot::pod_codec<int> > ld( pszFileName );
+            }
+            catch ( snapshot::snapshot_error& e ) {
+                CPPUNIT_MSG( "   expected error: " << e.what() );
+                return true;
+            }
+            return false;
+        }
+
+        CPPUNIT_TEST_SUITE(SnapshotHdrTest)
+            CPPUNIT_TEST(SkipListMap_HP)
+            CPPUNIT_TEST(SplitListMap_HP)
+            CPPUNIT_TEST(MichaelHashMap_HP)
+            CPPUNIT_TEST(CuckooMap)
+            CPPUNIT_TEST(StringCodec)
+            CPPUNIT_TEST(ConcurrentSave)
+            CPPUNIT_TEST(Errors)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+} // namespace map
+
+CPPUNIT_TEST_SUITE_REGISTRATION(map::SnapshotHdrTest);
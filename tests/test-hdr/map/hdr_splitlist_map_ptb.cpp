@@ -54,6 +54,7 @@ namespace map {
         // traits-based version
         typedef cc::SplitListMap< cds::gc::PTB, key_type, value_type, PTB_cmp_traits > map_type;
         test_int< map_type >();
+        test_unlink< map_type >();
 
         // option-based version
         typedef cc::SplitListMap< cds::gc::PTB,
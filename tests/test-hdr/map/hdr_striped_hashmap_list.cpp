@@ -4,6 +4,7 @@
 #include <cds/container/striped_map/std_list.h>
 #include <cds/container/striped_map.h>
 #include <cds/lock/spinlock.h>
+#include <cds/lock/elided_lock.h>
 
 namespace map {
 
@@ -55,6 +56,15 @@ namespace map {
         >   map_spin;
         test_striped2< map_spin >();
 
+        // Elided spinlock as lock policy
+        CPPUNIT_MESSAGE( "elided spinlock");
+        typedef cc::StripedMap< sequence_t
+            , co::hash< hash_int >
+            , co::less< less >
+            ,co::mutex_policy< cc::striped_set::striping< cds::lock::ElidedLock<cds::lock::Spin, 3, cds::lock::elided_lock_stat<> > > >
+        >   map_elided_spin;
+        test_striped2< map_elided_spin >();
+
         // Resizing policy
         CPPUNIT_MESSAGE( "load_factor_resizing<0>(8)");
         {
@@ -3,9 +3,15 @@
 #include "misc/michael_allocator.h"
 #include <cds/os/timer.h>
 #include <cds/details/allocator.h>
+#include <vector>
 
 #include "cppunit/cppunit_proxy.h"
 
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+#   include <cds/memory/michael/mmap_page_heap.h>
+#   define CDS_TEST_MICHAEL_MMAP_PAGE_HEAP
+#endif
+
 namespace misc {
 
     static size_t s_nPassCount = 10;
@@ -142,6 +148,50 @@ namespace misc {
         }
 
 
+#ifdef CDS_TEST_MICHAEL_MMAP_PAGE_HEAP
+        void mmap_page_heap_stat()
+        {
+            namespace ma = cds::memory::michael;
+            typedef ma::mmap_page_heap< 2 * 1024 * 1024, ma::mmap_huge_page_none, ma::os_allocated_atomic > page_heap;
+            typedef ma::Heap<
+                ma::opt::page_heap< page_heap >,
+                ma::opt::os_allocated_stat< ma::os_allocated_atomic >
+            > heap_type;
+
+            heap_type * pHeap = new heap_type;
+            summary_stat s;
+
+            // The arenas mapped by the page heap are counted as OS-allocated memory
+            std::vector<char *> arr( 100000 );
+            for ( size_t i = 0; i < arr.size(); ++i ) {
+                arr[i] = reinterpret_cast<char *>( pHeap->alloc( 16 + i % 1000 ));
+                CPPUNIT_ASSERT( arr[i] != nullptr );
+            }
+            pHeap->summaryStat( s );
+            CPPUNIT_CHECK( s.nSysAllocCount > 0 );
+            CPPUNIT_CHECK_EX( s.nSysBytesAllocated == s.nSysAllocCount * page_heap::c_nArenaSize,
+                "OS allocated bytes=" << s.nSysBytesAllocated << ", alloc count=" << s.nSysAllocCount );
+
+            // Large blocks allocated from OS directly are counted as well
+            size_t const nLargeSize = 4 * 1024 * 1024;
+            void * pLarge = pHeap->alloc( nLargeSize );
+            CPPUNIT_ASSERT( pLarge != nullptr );
+            summary_stat sLarge;
+            pHeap->summaryStat( sLarge );
+            CPPUNIT_CHECK( sLarge.nSysAllocCount == s.nSysAllocCount + 1 );
+            CPPUNIT_CHECK( sLarge.nSysBytesAllocated >= s.nSysBytesAllocated + nLargeSize );
+
+            pHeap->free( pLarge );
+            for ( size_t i = 0; i < arr.size(); ++i )
+                pHeap->free( arr[i] );
+            pHeap->summaryStat( s );
+            CPPUNIT_CHECK( s.nSysFreeCount > 0 );
+            CPPUNIT_CHECK( s.nSysBytesAllocated >= static_cast<cds::atomic64u_t>( s.nSysBytesDeallocated ));
+
+            delete pHeap;
+        }
+#endif
+
         void setUpParams( const CppUnitMini::TestCfg& cfg )
         {
             s_nPassCount = cfg.getULong( "PassCount", 10 );
@@ -162,6 +212,9 @@ namespace misc {
             CPPUNIT_TEST(alloc_free_std)
             CPPUNIT_TEST(alloc_all_free_all_michael)
             CPPUNIT_TEST(alloc_all_free_all_std)
+#ifdef CDS_TEST_MICHAEL_MMAP_PAGE_HEAP
+            CPPUNIT_TEST(mmap_page_heap_stat)
+#endif
         CPPUNIT_TEST_SUITE_END();
     };
 }   // namespace memory
@@ -0,0 +1,172 @@
+//$$CDS-header$$
+
+#include <cds/opt/hash.h>
+#include <set>
+#include <vector>
+#include <string>
+
+#include "cppunit/cppunit_proxy.h"
+
+namespace misc {
+
+    class FastHash: public CppUnitMini::TestCase
+    {
+        static std::string make_key( size_t nLen, size_t nSalt )
+        {
+            std::string s( nLen, ' ' );
+            for ( size_t i = 0; i < nLen; ++i )
+                s[i] = static_cast<char>( 'a' + ( i * 7 + nSalt * 31 + ( i >> 3 ) * nSalt ) % 26 );
+            return s;
+        }
+
+        template <class Hash>
+        void test_functor()
+        {
+            Hash h;
+
+            // std::string, C-string and byte range give the same value
+            for ( size_t nLen = 0; nLen < 1200; nLen += ( nLen < 80 ? 1 : 61 )) {
+                std::string const s = make_key( nLen, nLen );
+                size_t const nHash = h( s );
+                CPPUNIT_ASSERT_EX( h( s.c_str() ) == nHash, "len=" << nLen );
+                CPPUNIT_ASSERT_EX( h( s.data(), s.size() ) == nHash, "len=" << nLen );
+                CPPUNIT_ASSERT_EX( Hash()( s ) == nHash, "len=" << nLen );
+            }
+
+            // The hash value does not depend on the alignment of the key
+            {
+                std::vector<char> buf( 1200 + 16 );
+                for ( size_t nLen = 1; nLen < 1200; nLen += ( nLen < 80 ? 1 : 61 )) {
+                    std::string const s = make_key( nLen, 3 );
+                    size_t const nHash = h( s );
+                    for ( size_t nOffset = 1; nOffset < 8; ++nOffset ) {
+                        std::copy( s.begin(), s.end(), buf.begin() + nOffset );
+                        CPPUNIT_ASSERT_EX( h( &buf[nOffset], nLen ) == nHash, "len=" << nLen << ", offset=" << nOffset );
+                    }
+                }
+            }
+
+            // The seed changes the hash value
+            {
+                Hash h1( 1 );
+                Hash h2( 0x12345678 );
+                size_t nEqual = 0;
+                for ( size_t nLen = 1; nLen < 1200; nLen += 13 ) {
+                    std::string const s = make_key( nLen, 7 );
+                    if ( h( s ) == h1( s ) || h1( s ) == h2( s ))
+                        ++nEqual;
+                }
+                CPPUNIT_ASSERT( nEqual == 0 );
+                CPPUNIT_ASSERT( h( 42 ) != h1( 42 ));
+            }
+
+            // No collisions on integer and string keys; the string keys differ in one or two characters
+            {
+                std::set<size_t> hashes;
+                for ( int i = 0; i < 10000; ++i )
+                    hashes.insert( h( i ));
+                CPPUNIT_ASSERT( hashes.size() == 10000 );
+
+                size_t const arrLen[] = { 3, 8, 20, 100, 600, 3000 };
+                for ( size_t k = 0; k < sizeof(arrLen) / sizeof(arrLen[0]); ++k ) {
+                    hashes.clear();
+                    std::set<std::string> keys;
+                    std::string s = make_key( arrLen[k], k );
+                    for ( int i = 0; i < 2000; ++i ) {
+                        s[ ( i * 17 ) % s.size() ] = static_cast<char>( i );
+                        s[ s.size() / 2 ] = static_cast<char>( i >> 8 );
+                        keys.insert( s );
+                        hashes.insert( h( s ));
+                    }
+                    CPPUNIT_ASSERT_EX( hashes.size() == keys.size(), "len=" << arrLen[k] );
+                }
+            }
+        }
+
+        void crc32c()
+        {
+            char const * pCheck = "123456789";
+            CPPUNIT_ASSERT( ~cds::crc32c::update_sw( ~0u, pCheck, 9 ) == 0xE3069283 );
+            CPPUNIT_ASSERT( ~cds::crc32c::update( ~0u, pCheck, 9 ) == 0xE3069283 );
+
+            CPPUNIT_MSG( "   SSE4.2 crc32 is " << ( cds::crc32c::is_hw_supported() ? "" : "not " ) << "supported" );
+            if ( cds::crc32c::is_hw_supported() ) {
+                std::string const s = make_key( 600, 5 );
+                for ( size_t nLen = 0; nLen < 520; ++nLen ) {
+                    for ( size_t nOffset = 0; nOffset < 8; ++nOffset )
+                        CPPUNIT_ASSERT( cds::crc32c::update_hw( 0x1234, s.data() + nOffset, nLen ) == cds::crc32c::update_sw( 0x1234, s.data() + nOffset, nLen ));
+                }
+            }
+
+            test_functor< cds::opt::v::crc32c_hash >();
+        }
+
+        void mix64()
+        {
+            test_functor< cds::opt::v::mix64_hash >();
+        }
+
+        void striped()
+        {
+            CPPUNIT_MSG( "   AVX2 is " << ( cds::simd_hash::is_avx2_supported() ? "" : "not " ) << "supported" );
+            if ( cds::simd_hash::is_avx2_supported() ) {
+                // AVX2 and portable implementations are equal
+                uint64_t const arrSecret[4] = { 1, 0x9E3779B97F4A7C15ULL, 3, 0xC2B2AE3D27D4EB4FULL };
+                std::string const s = make_key( 5000, 9 );
+                for ( size_t nLen = 64; nLen < 5000; nLen += 37 ) {
+                    uint64_t acc1[8];
+                    uint64_t acc2[8];
+                    cds::opt::details::striped_algorithm::accumulate( acc1, reinterpret_cast<unsigned char const *>( s.data() ), nLen, nLen, arrSecret, 4 );
+                    cds::simd_hash::accumulate_avx2( acc2, reinterpret_cast<unsigned char const *>( s.data() ), nLen, nLen, arrSecret, 4 );
+                    for ( size_t i = 0; i < 8; ++i )
+                        CPPUNIT_ASSERT_EX( acc1[i] == acc2[i], "len=" << nLen << ", acc[" << i << "]" );
+                }
+            }
+
+            test_functor< cds::opt::v::striped_hash >();
+        }
+
+        void fast()
+        {
+            test_functor< cds::opt::v::fast_hash >();
+        }
+
+        void derived()
+        {
+            typedef cds::opt::v::derived_hash_list< cds::opt::v::mix128_hash, 4 > hash_list;
+            CPPUNIT_ASSERT( hash_list::size == 4 );
+
+            hash_list h;
+            cds::opt::v::mix128_hash h128;
+            size_t val[hash_list::size];
+            for ( int i = 0; i < 1000; ++i ) {
+                h( val, i );
+                cds::opt::v::hash128_value const h2 = h128( i );
+                CPPUNIT_ASSERT( h2.lo != h2.hi );
+                CPPUNIT_ASSERT( val[0] == cds::opt::details::hash_fold( h2.lo ));
+                for ( size_t k = 0; k < hash_list::size; ++k ) {
+                    for ( size_t j = k + 1; j < hash_list::size; ++j )
+                        CPPUNIT_ASSERT_EX( val[k] != val[j], "key=" << i << ", k=" << k << ", j=" << j );
+                }
+            }
+
+            // the seeded functor is passed by the hash tuple
+            hash_list hs( hash_list::hash_tuple_type( cds::opt::v::mix128_hash( 100 )));
+            size_t val2[hash_list::size];
+            h( val, std::string( "derived" ));
+            hs( val2, std::string( "derived" ));
+            CPPUNIT_ASSERT( val[0] != val2[0] );
+        }
+
+    public:
+        CPPUNIT_TEST_SUITE(FastHash)
+            CPPUNIT_TEST( crc32c )
+            CPPUNIT_TEST( mix64 )
+            CPPUNIT_TEST( striped )
+            CPPUNIT_TEST( fast )
+            CPPUNIT_TEST( derived )
+        CPPUNIT_TEST_SUITE_END()
+    };
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::FastHash);
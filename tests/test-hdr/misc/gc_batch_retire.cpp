@@ -0,0 +1,105 @@
+//$$CDS-header$$
+
+#include <cds/gc/hp.h>
+#include <cds/gc/ptb.h>
+#include <vector>
+
+#include "cppunit/cppunit_proxy.h"
+
+namespace misc {
+    namespace {
+        struct item {
+            static size_t s_nDisposed;
+
+            static void dispose( void * p )
+            {
+                ++s_nDisposed;
+                delete static_cast<item *>( p );
+            }
+        };
+        size_t item::s_nDisposed = 0;
+    }
+
+    class GCBatchRetire: public CppUnitMini::TestCase
+    {
+        template <class GC>
+        void test( size_t nCount )
+        {
+            typedef typename GC::retired_ptr retired_ptr;
+
+            std::vector< retired_ptr > arr;
+            arr.reserve( nCount );
+            for ( size_t i = 0; i < nCount; ++i )
+                arr.push_back( retired_ptr( new item, item::dispose ));
+
+            cds::gc::telemetry::snapshot before;
+            GC::get_telemetry( before );
+
+            item::s_nDisposed = 0;
+            GC::batch_retire( arr.begin(), arr.end() );
+
+            // Empty range
+            GC::batch_retire( arr.end(), arr.end() );
+
+            GC::force_dispose();
+            CPPUNIT_CHECK_EX( item::s_nDisposed == nCount, "disposed=" << item::s_nDisposed << ", expected=" << nCount );
+
+            cds::gc::telemetry::snapshot after;
+            GC::get_telemetry( after );
+            CPPUNIT_CHECK( after.nRetired - before.nRetired == nCount );
+            CPPUNIT_CHECK( after.nReclaimed - before.nReclaimed >= nCount );
+        }
+
+        template <class GC>
+        void test_guarded( size_t nCount )
+        {
+            typedef typename GC::retired_ptr retired_ptr;
+
+            std::vector< retired_ptr > arr;
+            arr.reserve( nCount );
+            for ( size_t i = 0; i < nCount; ++i )
+                arr.push_back( retired_ptr( new item, item::dispose ));
+
+            item::s_nDisposed = 0;
+            {
+                // The guarded items survive the scan of the batch
+                typename GC::Guard g1;
+                typename GC::Guard g2;
+                g1.assign( static_cast<item *>( arr.front().m_p ));
+                g2.assign( static_cast<item *>( arr.back().m_p ));
+
+                GC::batch_retire( arr.begin(), arr.end() );
+                GC::force_dispose();
+                CPPUNIT_CHECK_EX( item::s_nDisposed == nCount - 2, "disposed=" << item::s_nDisposed << ", expected=" << nCount - 2 );
+            }
+            GC::force_dispose();
+            CPPUNIT_CHECK_EX( item::s_nDisposed == nCount, "disposed=" << item::s_nDisposed << ", expected=" << nCount );
+        }
+
+        void HP()
+        {
+            size_t const nCapacity = cds::gc::hzp::GarbageCollector::instance().getMaxRetiredPtrCount();
+
+            // Less than retired array capacity
+            test< cds::gc::HP >( nCapacity / 2 );
+            // Several scans
+            test< cds::gc::HP >( nCapacity * 3 + nCapacity / 2 );
+            test_guarded< cds::gc::HP >( nCapacity * 2 );
+        }
+
+        void PTB()
+        {
+            test< cds::gc::PTB >( 10 );
+            test< cds::gc::PTB >( 10000 );
+        }
+
+    public:
+        CPPUNIT_TEST_SUITE(GCBatchRetire)
+            CPPUNIT_TEST( HP )
+            CPPUNIT_TEST( PTB )
+        CPPUNIT_TEST_SUITE_END()
+
+    };
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::GCBatchRetire);
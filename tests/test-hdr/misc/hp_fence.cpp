@@ -0,0 +1,223 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include <cds/gc/hp.h>
+#include <cds/algo/backoff_strategy.h>
+#include <vector>
+
+namespace misc {
+
+    namespace {
+        static size_t s_nReaderCount = 2;
+        static size_t s_nItemCount = 100000;
+    }
+
+    // Hazard pointer publication with full fence and with asymmetric fence (membarrier)
+    class HP_Fence: public CppUnitMini::TestCase
+    {
+        typedef cds::gc::hzp::GarbageCollector  hp_gc;
+
+        struct item {
+            atomics::atomic<bool>   bDisposed;
+
+            item()
+                : bDisposed( false )
+            {}
+            item( item const& )
+                : bDisposed( false )
+            {}
+        };
+
+        std::vector<item>       m_arrItems;
+        atomics::atomic<item *> m_pShared;
+        atomics::atomic<bool>   m_bWriterDone;
+        atomics::atomic<size_t> m_nReadyReaders;
+        atomics::atomic<size_t> m_nDisposedGuarded;
+        size_t                  m_nProtectCount;
+
+        // The items are not freed, the disposer marks an item as disposed only
+        static void dispose( item * p )
+        {
+            p->bDisposed.store( true, atomics::memory_order_release );
+        }
+
+        // Protects the shared item and checks it is not disposed while it is guarded
+        class ReaderThread: public CppUnitMini::TestThread
+        {
+            virtual ReaderThread * clone()
+            {
+                return new ReaderThread( *this );
+            }
+        public:
+            size_t  m_nProtectCount;
+
+        public:
+            ReaderThread( CppUnitMini::ThreadPool& pool )
+                : CppUnitMini::TestThread( pool )
+                , m_nProtectCount( 0 )
+            {}
+            ReaderThread( ReaderThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_nProtectCount( 0 )
+            {}
+
+            HP_Fence& getTest()
+            {
+                return reinterpret_cast<HP_Fence&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                HP_Fence& t = getTest();
+                cds::gc::HP::Guard g;
+                t.m_nReadyReaders.fetch_add( 1, atomics::memory_order_release );
+                while ( !t.m_bWriterDone.load( atomics::memory_order_acquire )) {
+                    item * p = g.protect( t.m_pShared );
+                    if ( p->bDisposed.load( atomics::memory_order_acquire ))
+                        t.m_nDisposedGuarded.fetch_add( 1, atomics::memory_order_relaxed );
+                    g.clear();
+                    ++m_nProtectCount;
+                }
+            }
+        };
+
+        // Replaces the shared item and retires the old one
+        class WriterThread: public CppUnitMini::TestThread
+        {
+            virtual WriterThread * clone()
+            {
+                return new WriterThread( *this );
+            }
+        public:
+            WriterThread( CppUnitMini::ThreadPool& pool )
+                : CppUnitMini::TestThread( pool )
+            {}
+            WriterThread( WriterThread& src )
+                : CppUnitMini::TestThread( src )
+            {}
+
+            HP_Fence& getTest()
+            {
+                return reinterpret_cast<HP_Fence&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                HP_Fence& t = getTest();
+                cds::backoff::yield bkoff;
+                while ( t.m_nReadyReaders.load( atomics::memory_order_acquire ) != s_nReaderCount )
+                    bkoff();
+
+                for ( size_t i = 1; i < t.m_arrItems.size(); ++i ) {
+                    item * pOld = t.m_pShared.exchange( &t.m_arrItems[i], atomics::memory_order_acq_rel );
+                    cds::gc::HP::retire( pOld, dispose );
+                    if ( ( i & 0xFF ) == 0 ) {
+                        cds::gc::HP::scan();
+                        // let the readers run on a system with few processors
+                        bkoff();
+                    }
+                }
+                cds::gc::HP::scan();
+                t.m_bWriterDone.store( true, atomics::memory_order_release );
+            }
+        };
+
+        void run( cds::gc::hzp::scan_type nScanType )
+        {
+            hp_gc& gc = hp_gc::instance();
+            cds::gc::hzp::scan_type const nPrevScanType = gc.getScanType();
+            gc.setScanType( nScanType );
+
+            m_arrItems.clear();
+            m_arrItems.resize( s_nItemCount );
+            m_pShared.store( &m_arrItems[0], atomics::memory_order_release );
+            m_bWriterDone.store( false, atomics::memory_order_release );
+            m_nReadyReaders.store( 0, atomics::memory_order_release );
+            m_nDisposedGuarded.store( 0, atomics::memory_order_release );
+
+            {
+                CppUnitMini::ThreadPool pool( *this );
+                pool.add( new ReaderThread( pool ), s_nReaderCount );
+                pool.add( new WriterThread( pool ), 1 );
+                pool.run();
+
+                m_nProtectCount = 0;
+                for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                    ReaderThread * pReader = dynamic_cast<ReaderThread *>( *it );
+                    if ( pReader )
+                        m_nProtectCount += pReader->m_nProtectCount;
+                }
+            }
+
+            CPPUNIT_MSG( "   Scan type=" << (nScanType == cds::gc::hzp::classic ? "classic" : "inplace")
+                << ", protect count=" << m_nProtectCount );
+            CPPUNIT_CHECK_EX( m_nDisposedGuarded.load( atomics::memory_order_relaxed ) == 0,
+                "disposed while guarded: " << m_nDisposedGuarded.load( atomics::memory_order_relaxed ));
+
+            // All items replaced are disposed when they are not guarded anymore, the current item is not retired.
+            // The first scan moves the items retired by the detached threads to the current thread, the second one disposes them
+            cds::gc::HP::force_dispose();
+            cds::gc::HP::force_dispose();
+            size_t nNotDisposed = 0;
+            for ( size_t i = 0; i + 1 < m_arrItems.size(); ++i ) {
+                if ( !m_arrItems[i].bDisposed.load( atomics::memory_order_acquire ))
+                    ++nNotDisposed;
+            }
+            CPPUNIT_CHECK_EX( nNotDisposed == 0, "not disposed: " << nNotDisposed );
+            CPPUNIT_CHECK( !m_pShared.load( atomics::memory_order_relaxed )->bDisposed.load( atomics::memory_order_relaxed ));
+
+            gc.setScanType( nPrevScanType );
+            m_arrItems.clear();
+        }
+
+        // The scan issues full fence, the readers publish hazard pointers by release store
+        void full_fence()
+        {
+            if ( hp_gc::isAsymmetricFenceEnabled() ) {
+                CPPUNIT_MSG( "   Asymmetric fence is already enabled, full fence path is skipped" );
+                return;
+            }
+            run( cds::gc::hzp::classic );
+            run( cds::gc::hzp::inplace );
+            CPPUNIT_CHECK( !hp_gc::isAsymmetricFenceEnabled() );
+        }
+
+        // The scan issues membarrier, the readers issue compiler barrier only.
+        // If membarrier is unavailable the test falls back to the full fence path
+        void asymmetric_fence()
+        {
+            if ( hp_gc::enableAsymmetricFence() ) {
+                CPPUNIT_CHECK( hp_gc::isAsymmetricFenceEnabled() );
+            }
+            else {
+                CPPUNIT_MSG( "   membarrier is not available, full fence is used" );
+            }
+            run( cds::gc::hzp::classic );
+            run( cds::gc::hzp::inplace );
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg )
+        {
+            s_nReaderCount = cfg.getULong( "ReaderCount", 2 );
+            s_nItemCount = cfg.getULong( "ItemCount", 100000 );
+            if ( s_nReaderCount == 0 )
+                s_nReaderCount = 1;
+            if ( s_nItemCount < 2 )
+                s_nItemCount = 2;
+        }
+
+        CPPUNIT_TEST_SUITE(HP_Fence)
+            CPPUNIT_TEST(full_fence)
+            CPPUNIT_TEST(asymmetric_fence)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::HP_Fence);
@@ -0,0 +1,334 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include <cds/gc/hrc.h>
+#include <cds/algo/backoff_strategy.h>
+#include <vector>
+
+namespace misc {
+
+    namespace {
+        static size_t s_nThreadCount = 4;
+        static size_t s_nPairCount = 100000;
+    }
+
+    // Deferred reference counting mode of HRC GC
+    class HRC_DeferredRC: public CppUnitMini::TestCase
+    {
+        typedef cds::gc::hrc::GarbageCollector  hrc_gc;
+        typedef cds::gc::hrc::ThreadGC          thread_gc;
+        typedef cds::gc::hrc::details::deferred_rc_buffer deferred_rc_buffer;
+
+        // More nodes than the buffer capacity, so the buffer is flushed when it is full too
+        static const size_t c_nNodeCount = deferred_rc_buffer::c_nCapacity + deferred_rc_buffer::c_nCapacity / 2;
+
+        struct node: public cds::gc::HRC::container_node
+        {
+            virtual void cleanUp( thread_gc * /*pGC*/ )
+            {}
+            virtual void terminate( thread_gc * /*pGC*/, bool /*bConcurrent*/ )
+            {}
+        };
+        typedef cds::gc::HRC::atomic_ref<node>  node_ref;
+
+        static atomics::atomic<size_t>  s_nDisposed;
+
+        static void dispose( node * p )
+        {
+            s_nDisposed.fetch_add( 1, atomics::memory_order_relaxed );
+            delete p;
+        }
+
+        std::vector<node *>     m_arrNodes;
+        atomics::atomic<size_t> m_nReadyCount;
+        atomics::atomic<bool>   m_bCleanedUp;
+        size_t                  m_nPendingBeforeCleanUp;
+        size_t                  m_nPendingAfterCleanUp;
+
+        // Increments and decrements the reference counters of nodes [pFirst, pFirst + nCount) by the link hub.
+        // The decrement of the last linked node is left pending
+        static void make_pairs( node ** pFirst, size_t nCount )
+        {
+            node_ref hub( nullptr );
+            for ( size_t i = 0; i < s_nPairCount; ++i ) {
+                hub.store( pFirst[ i % nCount ], atomics::memory_order_release );
+
+                // Failed CAS increments and decrements the reference counter of the new node
+                node * pExpected = pFirst[ (i + 1) % nCount ];
+                hub.compare_exchange_strong( pExpected, pFirst[ (i + 1) % nCount ], atomics::memory_order_release, atomics::memory_order_relaxed );
+            }
+            hub.store( nullptr, atomics::memory_order_release );
+        }
+
+        // The nodes are not linked, so each reference is a pending decrement
+        static size_t pending_count( node ** pFirst, size_t nCount )
+        {
+            size_t nPending = 0;
+            for ( size_t i = 0; i < nCount; ++i )
+                nPending += pFirst[i]->getRefCount();
+            return nPending;
+        }
+
+        size_t pending_count()
+        {
+            return pending_count( &m_arrNodes[0], m_arrNodes.size() );
+        }
+
+        void alloc_nodes( size_t nCount )
+        {
+            m_arrNodes.resize( nCount );
+            for ( size_t i = 0; i < nCount; ++i )
+                m_arrNodes[i] = new node;
+            s_nDisposed.store( 0, atomics::memory_order_relaxed );
+        }
+
+        // Retires all nodes by current thread and checks that all of them are reclaimed
+        void retire_nodes()
+        {
+            for ( size_t i = 0; i < m_arrNodes.size(); ++i )
+                cds::gc::HRC::retire( m_arrNodes[i], dispose );
+            check_reclaimed();
+        }
+
+        void check_reclaimed()
+        {
+            // The first scan takes over the retired nodes of detached threads, the second one reclaims them
+            cds::gc::HRC::force_dispose();
+            cds::gc::HRC::force_dispose();
+            CPPUNIT_CHECK_EX( s_nDisposed.load( atomics::memory_order_relaxed ) == m_arrNodes.size(),
+                "disposed=" << s_nDisposed.load( atomics::memory_order_relaxed ) << ", expected=" << m_arrNodes.size() );
+            m_arrNodes.clear();
+        }
+
+        size_t canceled_count()
+        {
+            hrc_gc::internal_state stat;
+            hrc_gc::instance().getInternalState( stat );
+            return stat.nDeferredRCCanceled;
+        }
+
+        // Makes pending decrements on its own nodes; it is attached in init() and detached in fini()
+        class PairThread: public CppUnitMini::TestThread
+        {
+            virtual PairThread * clone()
+            {
+                return new PairThread( *this );
+            }
+        public:
+            bool    m_bRetire;
+            bool    m_bWaitCleanUp;
+
+        public:
+            PairThread( CppUnitMini::ThreadPool& pool, bool bRetire, bool bWaitCleanUp )
+                : CppUnitMini::TestThread( pool )
+                , m_bRetire( bRetire )
+                , m_bWaitCleanUp( bWaitCleanUp )
+            {}
+            PairThread( PairThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_bRetire( src.m_bRetire )
+                , m_bWaitCleanUp( src.m_bWaitCleanUp )
+            {}
+
+            HRC_DeferredRC& getTest()
+            {
+                return reinterpret_cast<HRC_DeferredRC&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                HRC_DeferredRC& t = getTest();
+                node ** pFirst = &t.m_arrNodes[ m_nThreadNo * c_nNodeCount ];
+
+                make_pairs( pFirst, c_nNodeCount );
+                if ( m_bRetire ) {
+                    // The nodes are retired while their decrements are pending
+                    for ( size_t i = 0; i < c_nNodeCount; ++i )
+                        cds::gc::HRC::retire( pFirst[i], dispose );
+                }
+
+                t.m_nReadyCount.fetch_add( 1, atomics::memory_order_release );
+                if ( m_bWaitCleanUp ) {
+                    // Keeps the pending decrements until CleanUpThread applies them
+                    cds::backoff::yield bkoff;
+                    while ( !t.m_bCleanedUp.load( atomics::memory_order_acquire ))
+                        bkoff();
+                }
+            }
+        };
+
+        // Applies pending decrements of PairThread by CleanUpAll
+        class CleanUpThread: public CppUnitMini::TestThread
+        {
+            virtual CleanUpThread * clone()
+            {
+                return new CleanUpThread( *this );
+            }
+        public:
+            CleanUpThread( CppUnitMini::ThreadPool& pool )
+                : CppUnitMini::TestThread( pool )
+            {}
+            CleanUpThread( CleanUpThread& src )
+                : CppUnitMini::TestThread( src )
+            {}
+
+            HRC_DeferredRC& getTest()
+            {
+                return reinterpret_cast<HRC_DeferredRC&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                HRC_DeferredRC& t = getTest();
+                cds::backoff::yield bkoff;
+                while ( t.m_nReadyCount.load( atomics::memory_order_acquire ) != s_nThreadCount )
+                    bkoff();
+
+                t.m_nPendingBeforeCleanUp = t.pending_count();
+                hrc_gc::instance().CleanUpAll( &cds::threading::getGC<cds::gc::HRC>() );
+                t.m_nPendingAfterCleanUp = t.pending_count();
+                t.m_bCleanedUp.store( true, atomics::memory_order_release );
+            }
+        };
+
+        void run_pair_threads( bool bRetire, bool bCleanUp )
+        {
+            alloc_nodes( s_nThreadCount * c_nNodeCount );
+            m_nReadyCount.store( 0, atomics::memory_order_relaxed );
+            m_bCleanedUp.store( false, atomics::memory_order_relaxed );
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new PairThread( pool, bRetire, bCleanUp ), s_nThreadCount );
+            if ( bCleanUp )
+                pool.add( new CleanUpThread( pool ), 1 );
+            pool.run();
+        }
+
+        void retired_array_size()
+        {
+            // Each pending decrement can hold one more node, so the retired array of each thread
+            // is enlarged by the buffer capacity
+            hrc_gc& gc = hrc_gc::instance();
+            size_t const nMinSize = gc.getMaxThreadCount() * ( gc.getHazardPointerCount() + 1 + deferred_rc_buffer::c_nCapacity );
+            CPPUNIT_CHECK_EX( gc.getMaxRetiredPtrCount() >= nMinSize,
+                "retired array size=" << gc.getMaxRetiredPtrCount() << ", expected at least " << nMinSize );
+
+            hrc_gc::internal_state stat;
+            gc.getInternalState( stat );
+            CPPUNIT_CHECK( stat.nMaxRetiredPtrCount == gc.getMaxRetiredPtrCount() );
+        }
+
+        void scan_flush()
+        {
+            bool const bPrev = cds::gc::HRC::enable_deferred_rc( true );
+            alloc_nodes( c_nNodeCount );
+
+            size_t const nCanceled = canceled_count();
+            make_pairs( &m_arrNodes[0], m_arrNodes.size() );
+            // Nearly each pair cancels a pending decrement, except for the decrements applied when the buffer was full
+            CPPUNIT_CHECK_EX( canceled_count() - nCanceled >= s_nPairCount / 2,
+                "canceled=" << canceled_count() - nCanceled << ", pair count=" << s_nPairCount );
+
+            size_t const nPending = pending_count();
+            CPPUNIT_CHECK( nPending > 0 );
+            CPPUNIT_CHECK_EX( nPending <= deferred_rc_buffer::c_nCapacity, "pending=" << nPending );
+
+            hrc_gc::instance().Scan( &cds::threading::getGC<cds::gc::HRC>() );
+            CPPUNIT_CHECK_EX( pending_count() == 0, "pending after Scan=" << pending_count() );
+
+            retire_nodes();
+            cds::gc::HRC::enable_deferred_rc( bPrev );
+        }
+
+        void cleanup_all_flush()
+        {
+            bool const bPrev = cds::gc::HRC::enable_deferred_rc( true );
+            m_nPendingBeforeCleanUp = m_nPendingAfterCleanUp = 0;
+
+            run_pair_threads( false, true );
+            CPPUNIT_CHECK( m_nPendingBeforeCleanUp > 0 );
+            CPPUNIT_CHECK_EX( m_nPendingAfterCleanUp == 0, "pending after CleanUpAll=" << m_nPendingAfterCleanUp );
+
+            retire_nodes();
+            cds::gc::HRC::enable_deferred_rc( bPrev );
+        }
+
+        void help_scan_flush()
+        {
+            bool const bPrev = cds::gc::HRC::enable_deferred_rc( true );
+            alloc_nodes( deferred_rc_buffer::c_nCapacity );
+
+            hrc_gc& gc = hrc_gc::instance();
+            thread_gc& tgc = cds::threading::getGC<cds::gc::HRC>();
+
+            // Simulates a thread descriptor that is retired with pending decrements.
+            // The links to the nodes are removed by the owner of the descriptor, the decrements are deferred
+            cds::gc::hrc::details::thread_descriptor * pRec = gc.allocateHRCThreadDesc( &tgc );
+            for ( size_t i = 0; i < m_arrNodes.size(); ++i ) {
+                m_arrNodes[i]->incRefCount();
+                CPPUNIT_CHECK( pRec->m_DeferredRC.push( m_arrNodes[i] ));
+            }
+            gc.retireHRCThreadDesc( pRec );
+            CPPUNIT_CHECK( pending_count() == m_arrNodes.size() );
+
+            gc.HelpScan( &tgc );
+            CPPUNIT_CHECK_EX( pending_count() == 0, "pending after HelpScan=" << pending_count() );
+
+            retire_nodes();
+            cds::gc::HRC::enable_deferred_rc( bPrev );
+        }
+
+        void detach_flush()
+        {
+            bool const bPrev = cds::gc::HRC::enable_deferred_rc( true );
+
+            // The threads retire nothing, so the pending decrements are applied by detach only
+            run_pair_threads( false, false );
+            CPPUNIT_CHECK_EX( pending_count() == 0, "pending after detach=" << pending_count() );
+
+            retire_nodes();
+            cds::gc::HRC::enable_deferred_rc( bPrev );
+        }
+
+        void detach_reclaim()
+        {
+            bool const bPrev = cds::gc::HRC::enable_deferred_rc( true );
+
+            // The nodes retired by the threads with pending decrements are reclaimed after the threads are detached
+            run_pair_threads( true, false );
+            check_reclaimed();
+
+            cds::gc::HRC::enable_deferred_rc( bPrev );
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg )
+        {
+            s_nThreadCount = cfg.getULong( "ThreadCount", 4 );
+            s_nPairCount = cfg.getULong( "PairCount", 100000 );
+            if ( s_nThreadCount == 0 )
+                s_nThreadCount = 1;
+            if ( s_nPairCount == 0 )
+                s_nPairCount = 1;
+        }
+
+        CPPUNIT_TEST_SUITE(HRC_DeferredRC)
+            CPPUNIT_TEST(retired_array_size)
+            CPPUNIT_TEST(scan_flush)
+            CPPUNIT_TEST(cleanup_all_flush)
+            CPPUNIT_TEST(help_scan_flush)
+            CPPUNIT_TEST(detach_flush)
+            CPPUNIT_TEST(detach_reclaim)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+    atomics::atomic<size_t> HRC_DeferredRC::s_nDisposed( 0 );
+
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::HRC_DeferredRC);
@@ -0,0 +1,223 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include <cds/memory/michael/allocator.h>
+#include <vector>
+
+namespace misc {
+    namespace ma = cds::memory::michael;
+
+    namespace {
+        static size_t s_nThreadCount = 4;
+        static size_t s_nPassCount = 100;
+        static size_t s_nBlockCount = 1000;
+    }
+
+    // Per-thread cache of Michael's heap
+    class MichaelHeap_ThreadCache: public CppUnitMini::TestCase
+    {
+        typedef ma::Heap<
+            ma::opt::procheap_stat< ma::procheap_atomic_stat >,
+            ma::opt::os_allocated_stat< ma::os_allocated_atomic >,
+            ma::opt::thread_cache< ma::thread_magazine< 64, 256, 16 > >
+        > heap_type;
+
+        heap_type *                 m_pHeap;
+        atomics::atomic<size_t>     m_nFreeCount;
+        atomics::atomic<size_t>     m_nRequestedBytes;
+        atomics::atomic<size_t>     m_nReadyCount;
+        atomics::atomic<bool>       m_bHeapDestroyed;
+
+        // Allocates and frees small blocks, the thread is detached in fini()
+        class AllocThread: public CppUnitMini::TestThread
+        {
+            virtual AllocThread * clone()
+            {
+                return new AllocThread( *this );
+            }
+        public:
+            AllocThread( CppUnitMini::ThreadPool& pool )
+                : CppUnitMini::TestThread( pool )
+            {}
+            AllocThread( AllocThread& src )
+                : CppUnitMini::TestThread( src )
+            {}
+
+            MichaelHeap_ThreadCache& getTest()
+            {
+                return reinterpret_cast<MichaelHeap_ThreadCache&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                getTest().alloc_free( m_nThreadNo );
+            }
+        };
+
+        // Uses the heap and stays attached until the heap is destroyed by DestroyThread
+        class OwnerThread: public AllocThread
+        {
+            virtual OwnerThread * clone()
+            {
+                return new OwnerThread( *this );
+            }
+        public:
+            OwnerThread( CppUnitMini::ThreadPool& pool )
+                : AllocThread( pool )
+            {}
+            OwnerThread( OwnerThread& src )
+                : AllocThread( src )
+            {}
+
+            virtual void test()
+            {
+                MichaelHeap_ThreadCache& t = getTest();
+                t.alloc_free( m_nThreadNo );
+                t.m_nReadyCount.fetch_add( 1, atomics::memory_order_release );
+
+                cds::backoff::yield bkoff;
+                while ( !t.m_bHeapDestroyed.load( atomics::memory_order_acquire ))
+                    bkoff();
+                // fini() detaches the thread after the heap is destroyed
+            }
+        };
+
+        class DestroyThread: public AllocThread
+        {
+            virtual DestroyThread * clone()
+            {
+                return new DestroyThread( *this );
+            }
+        public:
+            DestroyThread( CppUnitMini::ThreadPool& pool )
+                : AllocThread( pool )
+            {}
+            DestroyThread( DestroyThread& src )
+                : AllocThread( src )
+            {}
+
+            virtual void test()
+            {
+                MichaelHeap_ThreadCache& t = getTest();
+                t.alloc_free( m_nThreadNo );
+
+                cds::backoff::yield bkoff;
+                while ( t.m_nReadyCount.load( atomics::memory_order_acquire ) != s_nThreadCount )
+                    bkoff();
+
+                delete t.m_pHeap;
+                t.m_pHeap = nullptr;
+                t.m_bHeapDestroyed.store( true, atomics::memory_order_release );
+            }
+        };
+
+        void alloc_free( size_t nThreadNo )
+        {
+            std::vector<char *> arr( s_nBlockCount );
+            size_t nRequested = 0;
+            for ( size_t nPass = 0; nPass < s_nPassCount; ++nPass ) {
+                for ( size_t i = 0; i < arr.size(); ++i ) {
+                    size_t const nSize = 8 + ( i + nThreadNo ) % 200;
+                    arr[i] = reinterpret_cast<char *>( m_pHeap->alloc( nSize ));
+                    CPPUNIT_ASSERT( arr[i] != nullptr );
+                    memset( arr[i], static_cast<int>( nThreadNo ), nSize );
+                    nRequested += nSize;
+                }
+                for ( size_t i = 0; i < arr.size(); ++i )
+                    m_pHeap->free( arr[i] );
+            }
+            m_nFreeCount.fetch_add( s_nPassCount * s_nBlockCount, atomics::memory_order_relaxed );
+            m_nRequestedBytes.fetch_add( nRequested, atomics::memory_order_relaxed );
+        }
+
+        void reset()
+        {
+            m_nFreeCount.store( 0, atomics::memory_order_relaxed );
+            m_nRequestedBytes.store( 0, atomics::memory_order_relaxed );
+            m_nReadyCount.store( 0, atomics::memory_order_relaxed );
+            m_bHeapDestroyed.store( false, atomics::memory_order_relaxed );
+        }
+
+        void check_stat()
+        {
+            ma::summary_stat s;
+            m_pHeap->summaryStat( s );
+
+            // Each block allocated or freed, including the blocks served by the thread cache, is counted.
+            // The superblocks of small blocks are allocated from the heap itself, so allocated bytes may exceed deallocated
+            size_t const nRequested = m_nRequestedBytes.load( atomics::memory_order_relaxed );
+            CPPUNIT_CHECK_EX( s.nBytesAllocated >= nRequested, "allocated=" << s.nBytesAllocated << ", requested=" << nRequested );
+            CPPUNIT_CHECK_EX( s.nBytesDeallocated >= nRequested, "deallocated=" << s.nBytesDeallocated << ", requested=" << nRequested );
+            CPPUNIT_CHECK_EX( s.nBytesAllocated >= s.nBytesDeallocated,
+                "allocated=" << s.nBytesAllocated << ", deallocated=" << s.nBytesDeallocated );
+            CPPUNIT_CHECK_EX( s.nFreeCount == m_nFreeCount.load( atomics::memory_order_relaxed ),
+                "free count=" << s.nFreeCount << ", expected=" << m_nFreeCount.load( atomics::memory_order_relaxed ));
+        }
+
+        void detach_then_destroy()
+        {
+            CPPUNIT_MSG( "   Thread count=" << s_nThreadCount << " pass count=" << s_nPassCount << " block count=" << s_nBlockCount );
+            reset();
+            m_pHeap = new heap_type;
+
+            // The cache of a thread is flushed on detach
+            {
+                CppUnitMini::ThreadPool pool( *this );
+                pool.add( new AllocThread( pool ), s_nThreadCount );
+                pool.run();
+            }
+            check_stat();
+
+            // The records of the detached threads are reused
+            {
+                CppUnitMini::ThreadPool pool( *this );
+                pool.add( new AllocThread( pool ), s_nThreadCount );
+                pool.run();
+            }
+            check_stat();
+
+            // Current thread uses the heap too
+            alloc_free( 0 );
+            check_stat();
+
+            delete m_pHeap;
+            m_pHeap = nullptr;
+        }
+
+        void destroy_then_detach()
+        {
+            CPPUNIT_MSG( "   Thread count=" << s_nThreadCount << " pass count=" << s_nPassCount << " block count=" << s_nBlockCount );
+            reset();
+            m_pHeap = new heap_type;
+
+            // The heap is destroyed while the owner threads are attached.
+            // The owner threads free their cache records on detach
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new OwnerThread( pool ), s_nThreadCount );
+            pool.add( new DestroyThread( pool ), 1 );
+            pool.run();
+
+            CPPUNIT_CHECK( m_pHeap == nullptr );
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg )
+        {
+            s_nThreadCount = cfg.getULong( "ThreadCount", 4 );
+            s_nPassCount = cfg.getULong( "PassCount", 100 );
+            s_nBlockCount = cfg.getULong( "BlockCount", 1000 );
+            if ( s_nThreadCount == 0 )
+                s_nThreadCount = 1;
+        }
+
+        CPPUNIT_TEST_SUITE(MichaelHeap_ThreadCache)
+            CPPUNIT_TEST(detach_then_destroy)
+            CPPUNIT_TEST(destroy_then_detach)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::MichaelHeap_ThreadCache);
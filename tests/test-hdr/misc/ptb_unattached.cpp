@@ -0,0 +1,147 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include <cds/gc/ptb.h>
+#include <vector>
+
+namespace misc {
+
+    namespace {
+        static size_t s_nThreadCount = 4;
+        static size_t s_nItemCount = 10000;
+    }
+
+    // PTB::retire called by the threads that are not attached to libcds
+    class PTB_Unattached: public CppUnitMini::TestCase
+    {
+        typedef cds::gc::PTB::retired_ptr retired_ptr;
+
+        struct item {
+            atomics::atomic<bool>   bDisposed;
+
+            item()
+                : bDisposed( false )
+            {}
+            item( item const& )
+                : bDisposed( false )
+            {}
+        };
+
+        struct disposer {
+            void operator()( item * p )
+            {
+                dispose( p );
+            }
+        };
+
+        std::vector<item>       m_arrItems;
+        atomics::atomic<size_t> m_nAttached;
+
+        // The items are not freed, the disposer marks an item as disposed only
+        static void dispose( item * p )
+        {
+            p->bDisposed.store( true, atomics::memory_order_release );
+        }
+        static void dispose_ptr( void * p )
+        {
+            dispose( static_cast<item *>( p ));
+        }
+
+        // The thread is not attached: init() and fini() are empty
+        class RetireThread: public CppUnitMini::TestThread
+        {
+            virtual RetireThread * clone()
+            {
+                return new RetireThread( *this );
+            }
+        public:
+            RetireThread( CppUnitMini::ThreadPool& pool )
+                : CppUnitMini::TestThread( pool )
+            {}
+            RetireThread( RetireThread& src )
+                : CppUnitMini::TestThread( src )
+            {}
+
+            PTB_Unattached& getTest()
+            {
+                return reinterpret_cast<PTB_Unattached&>( m_Pool.m_Test );
+            }
+
+            virtual void test()
+            {
+                PTB_Unattached& t = getTest();
+                size_t const nFirst = m_nThreadNo * s_nItemCount;
+                size_t const nLast = nFirst + s_nItemCount;
+
+                // One quarter by pFunc, one quarter by Disposer, the rest by batch
+                size_t i = nFirst;
+                for ( ; i < nFirst + s_nItemCount / 4; ++i )
+                    cds::gc::PTB::retire( &t.m_arrItems[i], dispose );
+                for ( ; i < nFirst + s_nItemCount / 2; ++i )
+                    cds::gc::PTB::retire<disposer>( &t.m_arrItems[i] );
+                cds::gc::PTB::scan();
+
+                std::vector< retired_ptr > arr;
+                arr.reserve( nLast - i );
+                for ( ; i < nLast; ++i )
+                    arr.push_back( retired_ptr( &t.m_arrItems[i], dispose_ptr ));
+                cds::gc::PTB::batch_retire( arr.begin(), arr.end() );
+
+                // Retiring must not attach the thread
+                if ( cds::threading::Manager::isThreadAttached() )
+                    t.m_nAttached.fetch_add( 1, atomics::memory_order_relaxed );
+            }
+        };
+
+        void retire()
+        {
+            CPPUNIT_MSG( "   Thread count=" << s_nThreadCount << " item count=" << s_nItemCount );
+
+            m_arrItems.clear();
+            m_arrItems.resize( s_nThreadCount * s_nItemCount );
+            m_nAttached.store( 0, atomics::memory_order_relaxed );
+
+            cds::gc::telemetry::snapshot before;
+            cds::gc::PTB::get_telemetry( before );
+
+            {
+                CppUnitMini::ThreadPool pool( *this );
+                pool.add( new RetireThread( pool ), s_nThreadCount );
+                pool.run();
+            }
+            CPPUNIT_CHECK_EX( m_nAttached.load( atomics::memory_order_relaxed ) == 0,
+                "attached threads: " << m_nAttached.load( atomics::memory_order_relaxed ));
+
+            cds::gc::PTB::force_dispose();
+            size_t nNotDisposed = 0;
+            for ( size_t i = 0; i < m_arrItems.size(); ++i ) {
+                if ( !m_arrItems[i].bDisposed.load( atomics::memory_order_acquire ))
+                    ++nNotDisposed;
+            }
+            CPPUNIT_CHECK_EX( nNotDisposed == 0, "not disposed: " << nNotDisposed );
+
+            // The retiring of the unattached threads is counted by the common telemetry record
+            cds::gc::telemetry::snapshot after;
+            cds::gc::PTB::get_telemetry( after );
+            CPPUNIT_CHECK_EX( after.nRetired - before.nRetired == m_arrItems.size(),
+                "retired=" << after.nRetired - before.nRetired << ", expected=" << m_arrItems.size() );
+
+            m_arrItems.clear();
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg )
+        {
+            s_nThreadCount = cfg.getULong( "ThreadCount", 4 );
+            s_nItemCount = cfg.getULong( "ItemCount", 10000 );
+            if ( s_nThreadCount == 0 )
+                s_nThreadCount = 1;
+        }
+
+        CPPUNIT_TEST_SUITE(PTB_Unattached)
+            CPPUNIT_TEST(retire)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::PTB_Unattached);
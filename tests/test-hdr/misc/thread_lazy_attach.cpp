@@ -0,0 +1,190 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include <cds/gc/hp.h>
+#include <cds/gc/ptb.h>
+#include <vector>
+
+// The threading managers that attach a thread on first access to its data
+#if defined(CDS_THREADING_PTHREAD) || defined(CDS_THREADING_CXX11) || ( defined(CDS_THREADING_GCC) && defined(CDS_CXX11_THREAD_LOCAL_SUPPORT))
+#   define CDS_TEST_LAZY_ATTACH
+#endif
+
+namespace misc {
+
+    namespace {
+        static size_t s_nThreadCount = 8;
+        static size_t s_nRoundCount = 10;
+        static size_t s_nItemCount = 100;
+    }
+
+    // Many short-lived threads that use HP and PTB without attachThread() call
+    class ThreadLazyAttach: public CppUnitMini::TestCase
+    {
+        typedef cds::gc::hzp::GarbageCollector  hp_gc;
+
+        struct item {
+            atomics::atomic<bool>   bDisposed;
+
+            item()
+                : bDisposed( false )
+            {}
+            item( item const& )
+                : bDisposed( false )
+            {}
+        };
+
+        std::vector<item>       m_arrHPItems;
+        std::vector<item>       m_arrPTBItems;
+        atomics::atomic<size_t> m_nLazyAttached;
+
+        // The items are not freed, the disposer marks an item as disposed only
+        static void dispose( item * p )
+        {
+            p->bDisposed.store( true, atomics::memory_order_release );
+        }
+
+        class WorkerThread: public CppUnitMini::TestThread
+        {
+            virtual WorkerThread * clone()
+            {
+                return new WorkerThread( *this );
+            }
+        public:
+            size_t  m_nRound;
+
+        public:
+            WorkerThread( CppUnitMini::ThreadPool& pool, size_t nRound )
+                : CppUnitMini::TestThread( pool )
+                , m_nRound( nRound )
+            {}
+            WorkerThread( WorkerThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_nRound( src.m_nRound )
+            {}
+
+            ThreadLazyAttach& getTest()
+            {
+                return reinterpret_cast<ThreadLazyAttach&>( m_Pool.m_Test );
+            }
+
+#ifndef CDS_TEST_LAZY_ATTACH
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+#endif
+
+            virtual void test()
+            {
+                ThreadLazyAttach& t = getTest();
+                size_t const nFirst = ( m_nRound * s_nThreadCount + m_nThreadNo ) * s_nItemCount;
+
+#ifdef CDS_TEST_LAZY_ATTACH
+                if ( cds::threading::Manager::isThreadAttached() )
+                    return;
+#endif
+                {
+                    // The guard attaches the thread
+                    cds::gc::HP::Guard g;
+                    g.assign( &t.m_arrHPItems[nFirst] );
+                    for ( size_t i = nFirst; i < nFirst + s_nItemCount; ++i )
+                        cds::gc::HP::retire( &t.m_arrHPItems[i], dispose );
+                }
+                {
+                    cds::gc::PTB::Guard g;
+                    g.assign( &t.m_arrPTBItems[nFirst] );
+                    for ( size_t i = nFirst; i < nFirst + s_nItemCount; ++i )
+                        cds::gc::PTB::retire( &t.m_arrPTBItems[i], dispose );
+                }
+
+                if ( cds::threading::Manager::isThreadAttached() )
+                    t.m_nLazyAttached.fetch_add( 1, atomics::memory_order_relaxed );
+                // The thread is detached when it terminates
+            }
+        };
+
+        static size_t not_disposed( std::vector<item> const& arr )
+        {
+            size_t nCount = 0;
+            for ( size_t i = 0; i < arr.size(); ++i ) {
+                if ( !arr[i].bDisposed.load( atomics::memory_order_acquire ))
+                    ++nCount;
+            }
+            return nCount;
+        }
+
+        void short_lived_threads()
+        {
+            size_t const nTotalThreads = s_nThreadCount * s_nRoundCount;
+            CPPUNIT_MSG( "   Thread count=" << s_nThreadCount << " round count=" << s_nRoundCount
+                << " (" << nTotalThreads << " threads, thread data pool capacity " << cds::threading::thread_data_pool::c_nCapacity << ")" );
+
+            m_arrHPItems.clear();
+            m_arrHPItems.resize( nTotalThreads * s_nItemCount );
+            m_arrPTBItems.clear();
+            m_arrPTBItems.resize( nTotalThreads * s_nItemCount );
+            m_nLazyAttached.store( 0, atomics::memory_order_relaxed );
+
+            hp_gc::InternalState hpBefore;
+            hp_gc::instance().getInternalState( hpBefore );
+            cds::gc::telemetry::snapshot ptbBefore;
+            cds::gc::PTB::get_telemetry( ptbBefore );
+
+            for ( size_t nRound = 0; nRound < s_nRoundCount; ++nRound ) {
+                CppUnitMini::ThreadPool pool( *this );
+                pool.add( new WorkerThread( pool, nRound ), s_nThreadCount );
+                pool.run();
+            }
+
+            CPPUNIT_CHECK_EX( m_nLazyAttached.load( atomics::memory_order_relaxed ) == nTotalThreads,
+                "attached=" << m_nLazyAttached.load( atomics::memory_order_relaxed ) << ", expected=" << nTotalThreads );
+
+            // The PTB telemetry records of terminated threads are freed
+            cds::gc::telemetry::snapshot ptbAfter;
+            cds::gc::PTB::get_telemetry( ptbAfter );
+            CPPUNIT_CHECK_EX( ptbAfter.nThreadCount == ptbBefore.nThreadCount,
+                "PTB threads: " << ptbAfter.nThreadCount << ", before=" << ptbBefore.nThreadCount );
+
+            // The pointers retired by terminated threads are freed.
+            // The first HP scan moves the pointers of the free HP records to the current thread, the second one frees them
+            cds::gc::HP::force_dispose();
+            cds::gc::HP::force_dispose();
+            cds::gc::PTB::force_dispose();
+            size_t const nHPNotDisposed = not_disposed( m_arrHPItems );
+            size_t const nPTBNotDisposed = not_disposed( m_arrPTBItems );
+            CPPUNIT_CHECK_EX( nHPNotDisposed == 0, "HP: not disposed " << nHPNotDisposed );
+            CPPUNIT_CHECK_EX( nPTBNotDisposed == 0, "PTB: not disposed " << nPTBNotDisposed );
+
+            // The HP records of terminated threads are reused: no more records than concurrent threads are allocated.
+            // A record is marked as free by the scan that takes its retired pointers over
+            hp_gc::InternalState hpAfter;
+            hp_gc::instance().getInternalState( hpAfter );
+            CPPUNIT_CHECK_EX( hpAfter.nHPRecAllocated - hpBefore.nHPRecAllocated <= s_nThreadCount,
+                "HP records allocated: " << hpAfter.nHPRecAllocated - hpBefore.nHPRecAllocated << ", max=" << s_nThreadCount );
+            CPPUNIT_CHECK_EX( hpAfter.nHPRecUsed <= hpBefore.nHPRecUsed,
+                "HP records used: " << hpAfter.nHPRecUsed << ", before=" << hpBefore.nHPRecUsed );
+
+            m_arrHPItems.clear();
+            m_arrPTBItems.clear();
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg )
+        {
+            s_nThreadCount = cfg.getULong( "ThreadCount", 8 );
+            s_nRoundCount = cfg.getULong( "RoundCount", 10 );
+            s_nItemCount = cfg.getULong( "ItemCount", 100 );
+            if ( s_nThreadCount == 0 )
+                s_nThreadCount = 1;
+            if ( s_nRoundCount == 0 )
+                s_nRoundCount = 1;
+            if ( s_nItemCount == 0 )
+                s_nItemCount = 1;
+        }
+
+        CPPUNIT_TEST_SUITE(ThreadLazyAttach)
+            CPPUNIT_TEST(short_lived_threads)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::ThreadLazyAttach);
@@ -2,6 +2,7 @@
 
 #include <cds/container/basket_queue.h>
 #include <cds/gc/hp.h>
+#include <cds/memory/vyukov_queue_pool.h>
 
 #include "queue/queue_test_header.h"
 
@@ -104,4 +105,23 @@ namespace queue {
         >();
     }
 
+    void Queue_TestHeader::BasketQueue_HP_pool()
+    {
+        testNoItemCounter<
+            cds::container::BasketQueue< cds::gc::HP, int
+                ,cds::opt::node_pool< cds::memory::vyukov_queue_node_pool<> >
+            >
+        >();
+    }
+
+    void Queue_TestHeader::BasketQueue_HP_Counted_pool()
+    {
+        testWithItemCounter<
+            cds::container::BasketQueue< cds::gc::HP, int
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::node_pool< cds::memory::vyukov_queue_node_pool<256> >
+            >
+        >();
+    }
+
 }   // namespace queue
@@ -1,6 +1,7 @@
 //$$CDS-header$$
 
 #include <cds/container/fcqueue.h>
+#include <cds/lock/elided_lock.h>
 #include "queue/queue_test_header.h"
 
 #include <list>
@@ -33,6 +34,16 @@ namespace queue {
         testFCQueue<queue_type>();
     }
 
+    void Queue_TestHeader::FCQueue_deque_elided_lock()
+    {
+        typedef cds::container::FCQueue<int, std::queue< int, std::deque<int> >,
+            cds::container::fcqueue::make_traits<
+                cds::opt::lock_type< cds::lock::ElidedLock< cds::lock::Spin > >
+            >::type
+        > queue_type;
+        testFCQueue<queue_type>();
+    }
+
     void Queue_TestHeader::FCQueue_deque_stat()
     {
         typedef cds::container::FCQueue<int, std::queue< int, std::deque<int> >,
@@ -149,6 +149,8 @@ namespace queue {
         void MSQueue_HP_Counted_seqcst();
         void MSQueue_HP_Counted_relax_align();
         void MSQueue_HP_Counted_seqcst_align();
+        void MSQueue_HP_pool();
+        void MSQueue_HP_Counted_pool();
 
         void MSQueue_HRC();
         void MSQueue_HRC_relax();
@@ -182,6 +184,8 @@ namespace queue {
         void MoirQueue_HP_Counted_seqcst();
         void MoirQueue_HP_Counted_relax_align();
         void MoirQueue_HP_Counted_seqcst_align();
+        void MoirQueue_HP_pool();
+        void MoirQueue_HP_Counted_pool();
 
         void MoirQueue_HRC();
         void MoirQueue_HRC_relax();
@@ -215,6 +219,8 @@ namespace queue {
         void OptimisticQueue_HP_Counted_seqcst();
         void OptimisticQueue_HP_Counted_relax_align();
         void OptimisticQueue_HP_Counted_seqcst_align();
+        void OptimisticQueue_HP_pool();
+        void OptimisticQueue_HP_Counted_pool();
 
         void OptimisticQueue_PTB();
         void OptimisticQueue_PTB_relax();
@@ -237,6 +243,8 @@ namespace queue {
         void BasketQueue_HP_Counted_seqcst();
         void BasketQueue_HP_Counted_relax_align();
         void BasketQueue_HP_Counted_seqcst_align();
+        void BasketQueue_HP_pool();
+        void BasketQueue_HP_Counted_pool();
 
         void BasketQueue_HRC();
         void BasketQueue_HRC_relax();
@@ -263,6 +271,7 @@ namespace queue {
         void FCQueue_deque();
         void FCQueue_deque_elimination();
         void FCQueue_deque_mutex();
+        void FCQueue_deque_elided_lock();
         void FCQueue_deque_stat();
         void FCQueue_list();
         void FCQueue_list_elimination();
@@ -286,6 +295,8 @@ namespace queue {
             CPPUNIT_TEST(MSQueue_HP_Counted_seqcst);
             CPPUNIT_TEST(MSQueue_HP_Counted_relax_align);
             CPPUNIT_TEST(MSQueue_HP_Counted_seqcst_align);
+            CPPUNIT_TEST(MSQueue_HP_pool);
+            CPPUNIT_TEST(MSQueue_HP_Counted_pool);
 
             CPPUNIT_TEST(MSQueue_HRC);
             CPPUNIT_TEST(MSQueue_HRC_relax);
@@ -319,6 +330,8 @@ namespace queue {
             CPPUNIT_TEST(MoirQueue_HP_Counted_seqcst);
             CPPUNIT_TEST(MoirQueue_HP_Counted_relax_align);
             CPPUNIT_TEST(MoirQueue_HP_Counted_seqcst_align);
+            CPPUNIT_TEST(MoirQueue_HP_pool);
+            CPPUNIT_TEST(MoirQueue_HP_Counted_pool);
 
             CPPUNIT_TEST(MoirQueue_HRC);
             CPPUNIT_TEST(MoirQueue_HRC_relax);
@@ -352,6 +365,8 @@ namespace queue {
             CPPUNIT_TEST(OptimisticQueue_HP_Counted_seqcst);
             CPPUNIT_TEST(OptimisticQueue_HP_Counted_relax_align);
             CPPUNIT_TEST(OptimisticQueue_HP_Counted_seqcst_align);
+            CPPUNIT_TEST(OptimisticQueue_HP_pool);
+            CPPUNIT_TEST(OptimisticQueue_HP_Counted_pool);
 
             CPPUNIT_TEST(OptimisticQueue_PTB);
             CPPUNIT_TEST(OptimisticQueue_PTB_relax);
@@ -374,6 +389,8 @@ namespace queue {
             CPPUNIT_TEST(BasketQueue_HP_Counted_seqcst);
             CPPUNIT_TEST(BasketQueue_HP_Counted_relax_align);
             CPPUNIT_TEST(BasketQueue_HP_Counted_seqcst_align);
+            CPPUNIT_TEST(BasketQueue_HP_pool);
+            CPPUNIT_TEST(BasketQueue_HP_Counted_pool);
 
             CPPUNIT_TEST(BasketQueue_HRC);
             CPPUNIT_TEST(BasketQueue_HRC_relax);
@@ -400,6 +417,7 @@ namespace queue {
             CPPUNIT_TEST(FCQueue_deque)
             CPPUNIT_TEST(FCQueue_deque_elimination)
             CPPUNIT_TEST(FCQueue_deque_mutex)
+            CPPUNIT_TEST(FCQueue_deque_elided_lock)
             CPPUNIT_TEST(FCQueue_deque_stat)
             CPPUNIT_TEST(FCQueue_list)
             CPPUNIT_TEST(FCQueue_list_elimination)
@@ -0,0 +1,79 @@
+//$$CDS-header$$
+
+#ifndef __CDSHDRTEST_SET_BULK_ITERATOR_H
+#define __CDSHDRTEST_SET_BULK_ITERATOR_H
+
+#include <cstddef>
+#include <iterator>
+
+namespace set {
+
+    // Exception thrown by throwing_iterator
+    struct bulk_error {};
+
+    // Random access iterator adapter that throws bulk_error when the item at position nThrowAt is dereferenced.
+    // It is used to test the exception safety of bulk-load constructors
+    template <typename Iterator>
+    class throwing_iterator
+    {
+        Iterator    m_it;
+        Iterator    m_itBegin;
+        ptrdiff_t   m_nThrowAt;
+
+    public:
+        typedef typename std::iterator_traits<Iterator>::reference reference;
+
+        throwing_iterator( Iterator it, Iterator itBegin, ptrdiff_t nThrowAt )
+            : m_it( it )
+            , m_itBegin( itBegin )
+            , m_nThrowAt( nThrowAt )
+        {}
+
+        reference operator *() const
+        {
+            if ( m_it - m_itBegin == m_nThrowAt )
+                throw bulk_error();
+            return *m_it;
+        }
+
+        reference operator []( ptrdiff_t n ) const
+        {
+            return *( *this + n );
+        }
+
+        throwing_iterator& operator ++()
+        {
+            ++m_it;
+            return *this;
+        }
+
+        throwing_iterator operator +( ptrdiff_t n ) const
+        {
+            return throwing_iterator( m_it + n, m_itBegin, m_nThrowAt );
+        }
+
+        ptrdiff_t operator -( throwing_iterator const& it ) const
+        {
+            return m_it - it.m_it;
+        }
+
+        bool operator ==( throwing_iterator const& it ) const
+        {
+            return m_it == it.m_it;
+        }
+
+        bool operator !=( throwing_iterator const& it ) const
+        {
+            return m_it != it.m_it;
+        }
+    };
+
+    template <typename Iterator>
+    static inline throwing_iterator<Iterator> make_throwing_iterator( Iterator it, Iterator itBegin, ptrdiff_t nThrowAt )
+    {
+        return throwing_iterator<Iterator>( it, itBegin, nThrowAt );
+    }
+
+} // namespace set
+
+#endif // #ifndef __CDSHDRTEST_SET_BULK_ITERATOR_H
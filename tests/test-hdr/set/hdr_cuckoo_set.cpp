@@ -625,6 +625,66 @@ namespace set {
         test_int<set_t, less<item> >();
     }
 
+    void CuckooSetHdrTest::Cuckoo_Striped_list_derived_hash()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::mutex_policy< cc::cuckoo::striping<> >
+                ,co::equal_to< equal< item > >
+                ,cc::cuckoo::store_hash< false >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::list >
+                ,co::hash< co::v::derived_hash_list< hash128, 2 > >
+            >::type
+        > set_t;
+
+        test_int<set_t, equal< item > >();
+    }
+
+    void CuckooSetHdrTest::Cuckoo_Striped_vector_derived_hash_storehash()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::mutex_policy< cc::cuckoo::striping< std::recursive_mutex, 3 > >
+                ,co::less< less< item > >
+                ,cc::cuckoo::store_hash< true >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+                ,co::hash< co::v::derived_hash_list< hash128, 3 > >
+            >::type
+        > set_t;
+
+        test_int<set_t, less< item > >();
+    }
+
+    void CuckooSetHdrTest::Cuckoo_Refinable_list_derived_hash_storehash()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::mutex_policy< cc::cuckoo::refinable<> >
+                ,co::compare< cmp< item > >
+                ,cc::cuckoo::store_hash< true >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::list >
+                ,co::hash< co::v::derived_hash_list< hash128, 2 > >
+            >::type
+        > set_t;
+
+        test_int<set_t, less< item > >();
+    }
+
+    void CuckooSetHdrTest::Cuckoo_Refinable_vector_derived_hash()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::mutex_policy< cc::cuckoo::refinable< std::recursive_mutex, 3 > >
+                ,co::less< less< item > >
+                ,cc::cuckoo::store_hash< false >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+                ,co::hash< co::v::derived_hash_list< hash128, 3 > >
+            >::type
+        > set_t;
+
+        test_int<set_t, less< item > >();
+    }
+
 } // namespace set
 
 CPPUNIT_TEST_SUITE_REGISTRATION(set::CuckooSetHdrTest);
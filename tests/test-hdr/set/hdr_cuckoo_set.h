@@ -136,6 +136,25 @@ namespace set {
             }
         };
 
+        // 128-bit hash for co::v::derived_hash_list
+        struct hash128 {
+            co::v::hash128_value operator()( int i ) const
+            {
+                return co::v::mix128_hash()( i );
+            }
+
+            co::v::hash128_value operator()( std::pair<int,int> const& i ) const
+            {
+                return (*this)( i.first );
+            }
+
+            template <typename Item>
+            co::v::hash128_value operator()( Item const& i ) const
+            {
+                return (*this)( i.key() );
+            }
+        };
+
         struct simple_item_counter {
             size_t  m_nCount;
 
@@ -554,6 +573,11 @@ namespace set {
         void Cuckoo_Refinable_vector_less_cmp_eq();
         void Cuckoo_Refinable_vector_less_cmp_eq_storehash();
 
+        void Cuckoo_Striped_list_derived_hash();
+        void Cuckoo_Striped_vector_derived_hash_storehash();
+        void Cuckoo_Refinable_list_derived_hash_storehash();
+        void Cuckoo_Refinable_vector_derived_hash();
+
         CPPUNIT_TEST_SUITE(CuckooSetHdrTest)
             CPPUNIT_TEST( Cuckoo_Striped_list_unord)
             CPPUNIT_TEST( Cuckoo_Striped_list_unord_storehash)
@@ -598,6 +622,11 @@ namespace set {
             CPPUNIT_TEST( Cuckoo_Refinable_vector_less_cmp_storehash)
             CPPUNIT_TEST( Cuckoo_Refinable_vector_less_cmp_eq)
             CPPUNIT_TEST( Cuckoo_Refinable_vector_less_cmp_eq_storehash)
+
+            CPPUNIT_TEST( Cuckoo_Striped_list_derived_hash)
+            CPPUNIT_TEST( Cuckoo_Striped_vector_derived_hash_storehash)
+            CPPUNIT_TEST( Cuckoo_Refinable_list_derived_hash_storehash)
+            CPPUNIT_TEST( Cuckoo_Refinable_vector_derived_hash)
         CPPUNIT_TEST_SUITE_END()
     };
 
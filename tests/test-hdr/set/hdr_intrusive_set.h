@@ -6,6 +6,8 @@
 #include <cds/opt/hash.h>
 #include <functional>   // ref
 #include <algorithm>    // random_shuffle
+#include <vector>
+#include <cds/cxx11_atomic.h>
 
 // forward declaration
 namespace cds { namespace intrusive {} }
@@ -479,6 +481,9 @@ namespace set {
             // Iterator test
             test_iter<Set>();
 
+            // parallel_for_each/parallel_clear test
+            test_parallel<Set>();
+
             // extract/get test
             {
                 typedef typename Set::value_type    value_type;
@@ -591,6 +596,50 @@ namespace set {
             }
         }
 
+        template <class Set>
+        void test_parallel()
+        {
+            typedef typename Set::value_type    value_type;
+
+            static size_t const nLimit = 4000;
+            std::vector<int> arrKeys( nLimit );
+            for ( size_t i = 0; i < nLimit; ++i )
+                arrKeys[i] = static_cast<int>( i );
+            std::random_shuffle( arrKeys.begin(), arrKeys.end() );
+
+            std::vector<value_type> arrItems( nLimit );
+            for ( size_t i = 0; i < nLimit; ++i ) {
+                arrItems[i].nKey = arrKeys[i];
+                arrItems[i].nVal = arrKeys[i];
+            }
+
+            {
+                Set s( nLimit, 2 );
+                for ( size_t i = 0; i < nLimit; ++i )
+                    CPPUNIT_ASSERT( s.insert( arrItems[i] ));
+                CPPUNIT_ASSERT( check_size( s, nLimit ));
+
+                atomics::atomic<size_t> nCount( 0 );
+                s.parallel_for_each( [&nCount]( value_type& v ) {
+                    nCount.fetch_add( 1, atomics::memory_order_relaxed );
+                    v.nVal = v.nKey * 3;
+                }, 4 );
+                CPPUNIT_CHECK( nCount.load() == nLimit );
+                for ( size_t i = 0; i < nLimit; ++i )
+                    CPPUNIT_CHECK( arrItems[i].nVal == arrItems[i].nKey * 3 );
+
+                s.parallel_clear( 4 );
+                CPPUNIT_CHECK( s.empty() );
+                CPPUNIT_CHECK( check_size( s, 0 ));
+                for ( int i = 0; i < static_cast<int>( nLimit ); i += 10 )
+                    CPPUNIT_CHECK( !s.find( i ));
+            }
+
+            Set::gc::force_dispose();
+            for ( size_t i = 0; i < nLimit; ++i )
+                CPPUNIT_CHECK( arrItems[i].nDisposeCount == 1 );
+        }
+
         template <class Set>
         void test_int_nogc()
         {
@@ -1,6 +1,8 @@
 //$$CDS-header$$
 
 #include "set/hdr_intrusive_set.h"
+#include "set/hdr_bulk_iterator.h"
+#include <cds/algo/work_stealing.h>
 
 namespace set {
 
@@ -310,6 +312,59 @@ namespace set {
                 Set::gc::force_dispose();
             }
 
+            CPPUNIT_MSG( "bulk-load test" );
+            // bulk-load test
+            {
+                typedef typename Set::node_traits node_traits;
+
+                for ( int i = 0; i < (int) c_nArrSize; ++i ) {
+                    v[i].nKey = i;
+                    v[i].nVal = i * 2;
+                    v[i].nDisposeCount = 0;
+                }
+
+                // The items are not disposed and the towers built are freed if the sequence throws
+                bool bCaught = false;
+                try {
+                    Set sb( make_throwing_iterator( v, v, c_nArrSize / 2 ), make_throwing_iterator( v + c_nArrSize, v, c_nArrSize / 2 ));
+                }
+                catch ( bulk_error const& ) {
+                    bCaught = true;
+                }
+                CPPUNIT_CHECK( bCaught );
+                for ( size_t i = 0; i < c_nArrSize; ++i ) {
+                    CPPUNIT_CHECK( v[i].nDisposeCount == 0 );
+                    CPPUNIT_CHECK( node_traits::to_node_ptr( v[i] )->height() == 1 );
+                }
+
+                {
+                    cds::algo::work_stealing::executor<> ex( 2 );
+                    bCaught = false;
+                    try {
+                        Set sb( make_throwing_iterator( v, v, c_nArrSize / 2 ), make_throwing_iterator( v + c_nArrSize, v, c_nArrSize / 2 ), ex );
+                    }
+                    catch ( bulk_error const& ) {
+                        bCaught = true;
+                    }
+                    CPPUNIT_CHECK( bCaught );
+                    for ( size_t i = 0; i < c_nArrSize; ++i ) {
+                        CPPUNIT_CHECK( v[i].nDisposeCount == 0 );
+                        CPPUNIT_CHECK( node_traits::to_node_ptr( v[i] )->height() == 1 );
+                    }
+                }
+
+                // The items can be loaded again
+                {
+                    Set sb( v, v + c_nArrSize );
+                    CPPUNIT_ASSERT( check_size( sb, c_nArrSize ));
+                    for ( int i = 0; i < (int) c_nArrSize; ++i )
+                        CPPUNIT_CHECK( sb.find( i ));
+                }
+                Set::gc::force_dispose();
+                for ( size_t i = 0; i < c_nArrSize; ++i )
+                    CPPUNIT_CHECK( v[i].nDisposeCount == 1 );
+            }
+
             CPPUNIT_MSG( PrintStat()(s, nullptr) );
         }
 
@@ -2,6 +2,7 @@
 
 #include "cppunit/cppunit_proxy.h"
 #include <cds/opt/hash.h>
+#include <cds/cxx11_atomic.h>
 
 // cds::intrusive namespace forward declaration
 namespace cds { namespace intrusive {}}
@@ -451,6 +452,41 @@ namespace set {
                 Set s(256);
                 test_with(s);
             }
+
+            // parallel_for_each/parallel_clear
+            {
+                Set s(256);
+                test_parallel(s);
+            }
+        }
+
+        template <class Set>
+        void test_parallel( Set& s )
+        {
+            typedef typename Set::value_type    value_type;
+
+            size_t const nSize = 10000;
+            value_type * arr = new value_type[nSize];
+            auto_dispose<value_type> ad(arr);
+            for ( size_t i = 0; i < nSize; ++i ) {
+                value_type * p = new (arr + i) value_type( (int) i, (int) i * 2 );
+                CPPUNIT_ASSERT( s.insert( *p ));
+            }
+
+            atomics::atomic<size_t> nCount( 0 );
+            s.parallel_for_each( [&nCount]( value_type& v ) {
+                nCount.fetch_add( 1, atomics::memory_order_relaxed );
+                v.nVal = v.nKey * 3;
+            }, 4 );
+            CPPUNIT_CHECK( nCount.load() == nSize );
+            for ( size_t i = 0; i < nSize; ++i )
+                CPPUNIT_CHECK_EX( arr[i].nVal == arr[i].nKey * 3, "i=" << i );
+
+            s.parallel_clear( 4 );
+            CPPUNIT_CHECK( s.empty() );
+            CPPUNIT_CHECK( s.size() == 0 );
+            for ( size_t i = 0; i < nSize; i += 100 )
+                CPPUNIT_CHECK( !s.find( (int) i ));
         }
 
         template <class Set>
@@ -37,6 +37,7 @@ namespace set {
         // traits-based version
         typedef cc::MichaelHashSet< cds::gc::HP, list, set_traits > set;
         test_int< set >();
+        test_int_parallel< set >();
 
         // option-based version
         typedef cc::MichaelHashSet< cds::gc::HP, list,
@@ -10,6 +10,9 @@
 #include <cds/os/timer.h>
 #include <functional>   // ref
 #include <algorithm>    // random_shuffle
+#include <vector>
+#include <memory>       // unique_ptr
+#include <cds/cxx11_atomic.h>
 
 // forward namespace declaration
 namespace cds {
@@ -141,6 +144,11 @@ namespace set {
                 return --m_nCount;
             }
 
+            size_t operator +=( size_t n )
+            {
+                return m_nCount += n;
+            }
+
             void reset()
             {
                 m_nCount = 0;
@@ -339,6 +347,93 @@ namespace set {
             }
         };
 
+        // Bulk-load constructors; ex is the executor for parallel bulk build
+        template <class Set, class Executor>
+        void test_int_bulk( Executor& ex )
+        {
+            const int nLimit = 1000;
+            std::vector<int> arrKeys;
+            for ( int i = 0; i < nLimit; ++i )
+                arrKeys.push_back( i * 2 );
+            std::random_shuffle( arrKeys.begin(), arrKeys.end() );
+            // duplicate keys are not inserted
+            arrKeys.push_back( arrKeys[0] );
+            arrKeys.push_back( arrKeys[1] );
+
+            for ( int nPass = 0; nPass < 2; ++nPass ) {
+                std::unique_ptr<Set> ps( nPass == 0
+                    ? new Set( arrKeys.begin(), arrKeys.end(), 2 )
+                    : new Set( arrKeys.begin(), arrKeys.end(), ex ));
+                Set& s = *ps;
+
+                CPPUNIT_ASSERT( !s.empty() );
+                CPPUNIT_ASSERT( check_size( s, nLimit ));
+                for ( int i = 0; i < nLimit * 2; ++i )
+                    CPPUNIT_CHECK( s.find( i ) == ( (i & 1) == 0 ));
+
+                // the set is a usual set after building
+                for ( int i = 1; i < nLimit * 2; i += 2 ) {
+                    CPPUNIT_ASSERT( s.insert( i ));
+                    CPPUNIT_ASSERT( !s.insert( i - 1 ));
+                }
+                CPPUNIT_ASSERT( check_size( s, nLimit * 2 ));
+                for ( int i = 0; i < nLimit * 2; ++i )
+                    CPPUNIT_ASSERT( s.erase( i ));
+                CPPUNIT_ASSERT( s.empty() );
+                CPPUNIT_ASSERT( check_size( s, 0 ));
+            }
+
+            Set s( arrKeys.begin(), arrKeys.begin() );
+            CPPUNIT_ASSERT( s.empty() );
+            CPPUNIT_ASSERT( s.insert( 1 ));
+            CPPUNIT_ASSERT( s.find( 1 ));
+        }
+
+        // parallel_for_each and parallel_clear
+        template <class Set>
+        void test_int_parallel()
+        {
+            const int nLimit = 5000;
+            std::vector<int> arrKeys;
+            for ( int i = 0; i < nLimit; ++i )
+                arrKeys.push_back( i );
+            std::random_shuffle( arrKeys.begin(), arrKeys.end() );
+
+            Set s( nLimit, 2 );
+            for ( size_t nThreads = 1; nThreads <= 4; nThreads += 3 ) {
+                for ( int i = 0; i < nLimit; ++i )
+                    CPPUNIT_ASSERT( s.insert( arrKeys[i] ));
+                CPPUNIT_ASSERT( check_size( s, nLimit ));
+
+                atomics::atomic<size_t> nCount( 0 );
+                atomics::atomic<size_t> nKeySum( 0 );
+                s.parallel_for_each( [&nCount, &nKeySum]( item& i ) {
+                    nCount.fetch_add( 1, atomics::memory_order_relaxed );
+                    nKeySum.fetch_add( static_cast<size_t>( i.nKey ), atomics::memory_order_relaxed );
+                    i.nVal = i.nKey * 2;
+                }, nThreads );
+                CPPUNIT_CHECK( nCount.load() == static_cast<size_t>( nLimit ));
+                CPPUNIT_CHECK( nKeySum.load() == static_cast<size_t>( nLimit ) * ( nLimit - 1 ) / 2 );
+                for ( int i = 0; i < nLimit; ++i ) {
+                    copy_found<item> f;
+                    CPPUNIT_ASSERT( s.find( i, std::ref( f )));
+                    CPPUNIT_CHECK( f.m_found.nVal == i * 2 );
+                }
+
+                s.parallel_clear( nThreads );
+                CPPUNIT_ASSERT( s.empty() );
+                CPPUNIT_ASSERT( check_size( s, 0 ));
+                for ( int i = 0; i < nLimit; ++i )
+                    CPPUNIT_CHECK( !s.find( i ));
+            }
+
+            // the set is usable after clearing
+            CPPUNIT_ASSERT( s.insert( 1 ));
+            CPPUNIT_ASSERT( s.find( 1 ));
+            s.parallel_clear();
+            CPPUNIT_ASSERT( s.empty() );
+        }
+
         template <class Set>
         void test_int()
         {
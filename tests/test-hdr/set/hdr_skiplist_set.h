@@ -1,6 +1,8 @@
 //$$CDS-header$$
 
 #include "set/hdr_set.h"
+#include "set/hdr_bulk_iterator.h"
+#include <cds/algo/work_stealing.h>
 
 namespace set {
 
@@ -245,9 +247,163 @@ namespace set {
                 CPPUNIT_ASSERT( gp.empty() );
             }
 
+            // search finger test
+            {
+                typedef typename Set::value_type value_type;
+                typename Set::finger f;
+                CPPUNIT_ASSERT( f.empty() );
+
+                // ascending insert of even keys
+                for ( int i = 0; i < nLimit; i += 2 )
+                    CPPUNIT_ASSERT( s.insert( f, i ));
+                CPPUNIT_ASSERT( !f.empty() );
+                CPPUNIT_ASSERT( check_size( s, nLimit / 2 ));
+
+                // ascending find, the finger is behind the key
+                for ( int i = 0; i < nLimit; ++i )
+                    CPPUNIT_CHECK( s.find( f, i ) == ((i & 1) == 0) );
+
+                // ascending insert of odd keys from the finger pointed to the tail
+                for ( int i = 1; i < nLimit; i += 2 ) {
+                    CPPUNIT_ASSERT( s.insert( f, i, []( value_type& v ) { v.nVal = v.nKey * 2; } ));
+                    CPPUNIT_ASSERT( !s.insert( f, i ));
+                }
+                CPPUNIT_ASSERT( check_size( s, nLimit ));
+
+                // random order, the finger is often ahead of the key
+                for ( int i = 0; i < nLimit; ++i ) {
+                    int nKey = arrRandom[i];
+                    CPPUNIT_ASSERT( s.find( f, nKey, []( value_type& v, int const& key ) { v.nVal = key * 4; } ));
+                    CPPUNIT_CHECK( !s.find( f, nLimit + nKey ));
+                }
+
+                // clustered keys
+                for ( int i = 0; i < nLimit; i += 16 ) {
+                    for ( int j = 7; j >= 0; --j ) {
+                        int nKey = i + j * 2;
+                        if ( nKey < nLimit ) {
+                            int nFound = -1;
+                            CPPUNIT_ASSERT( s.find( f, nKey, [&nFound]( value_type& v, int const& ) { nFound = v.nKey; } ));
+                            CPPUNIT_CHECK( nFound == nKey );
+                            CPPUNIT_ASSERT( s.get( gp, nKey ));
+                            CPPUNIT_CHECK( gp->nVal == nKey * 4 );
+                        }
+                    }
+                }
+                gp.release();
+
+                // the finger node is erased
+                CPPUNIT_ASSERT( s.find( f, 100 ));
+                for ( int i = 90; i <= 110; ++i )
+                    CPPUNIT_ASSERT( s.erase( i ));
+                CPPUNIT_CHECK( !s.find( f, 101 ));
+                CPPUNIT_CHECK( s.find( f, 111 ));
+                CPPUNIT_ASSERT( s.insert( f, 100 ));
+                CPPUNIT_CHECK( s.find( f, 100 ));
+                CPPUNIT_CHECK( !s.find( f, 105 ));
+                CPPUNIT_CHECK( s.find( f, 89 ));
+
+                s.clear();
+                CPPUNIT_ASSERT( s.empty() );
+                CPPUNIT_CHECK( !s.find( f, 120 ));
+                CPPUNIT_ASSERT( s.insert( f, 120 ));
+                CPPUNIT_CHECK( s.find( f, 120 ));
+                f.reset();
+                CPPUNIT_ASSERT( f.empty() );
+                CPPUNIT_CHECK( s.find( f, 120 ));
+                s.clear();
+            }
+
+            // bulk-load test
+            {
+                std::vector<int> arrKeys;
+                for ( int i = 0; i < nLimit; ++i )
+                    arrKeys.push_back( i * 2 );
+
+                {
+                    Set sb( arrKeys.begin(), arrKeys.begin() );
+                    CPPUNIT_ASSERT( sb.empty() );
+                    CPPUNIT_ASSERT( sb.insert( 1 ));
+                    CPPUNIT_ASSERT( check_size( sb, 1 ));
+                }
+                {
+                    Set sb( arrKeys.begin(), arrKeys.end() );
+                    test_bulk( sb, nLimit );
+                    CPPUNIT_MSG( PrintStat()(sb, "Bulk-load test") );
+                }
+                {
+                    cds::algo::work_stealing::executor<> ex( 2 );
+                    Set sb( arrKeys.begin(), arrKeys.end(), ex );
+                    test_bulk( sb, nLimit );
+                    CPPUNIT_MSG( PrintStat()(sb, "Parallel bulk-load test") );
+                }
+
+                // The element factory throws: the nodes created are freed, the exception is propagated
+                {
+                    bool bCaught = false;
+                    try {
+                        Set sb( make_throwing_iterator( arrKeys.cbegin(), arrKeys.cbegin(), nLimit / 2 ),
+                                make_throwing_iterator( arrKeys.cend(), arrKeys.cbegin(), nLimit / 2 ));
+                    }
+                    catch ( bulk_error const& ) {
+                        bCaught = true;
+                    }
+                    CPPUNIT_CHECK( bCaught );
+                }
+                {
+                    cds::algo::work_stealing::executor<> ex( 2 );
+                    bool bCaught = false;
+                    try {
+                        Set sb( make_throwing_iterator( arrKeys.cbegin(), arrKeys.cbegin(), nLimit / 2 ),
+                                make_throwing_iterator( arrKeys.cend(), arrKeys.cbegin(), nLimit / 2 ), ex );
+                    }
+                    catch ( bulk_error const& ) {
+                        bCaught = true;
+                    }
+                    CPPUNIT_CHECK( bCaught );
+                }
+            }
+
             CPPUNIT_MSG( PrintStat()(s, nullptr) );
         }
 
+        // The set is built from the keys 0, 2, ..., (nLimit - 1) * 2
+        template <class Set>
+        void test_bulk( Set& s, int nLimit )
+        {
+            typedef typename Set::value_type value_type;
+
+            CPPUNIT_ASSERT( !s.empty() );
+            CPPUNIT_ASSERT( check_size( s, nLimit ));
+
+            int nCount = 0;
+            for ( typename Set::iterator it = s.begin(), itEnd = s.end(); it != itEnd; ++it ) {
+                CPPUNIT_CHECK( it->nKey == nCount * 2 );
+                ++nCount;
+            }
+            CPPUNIT_CHECK( nCount == nLimit );
+
+            for ( int i = 0; i < nLimit * 2; ++i )
+                CPPUNIT_CHECK( s.find( i ) == ( (i & 1) == 0 ));
+
+            // the set is a usual set after building
+            for ( int i = 1; i < nLimit * 2; i += 2 ) {
+                CPPUNIT_ASSERT( s.insert( i ));
+                CPPUNIT_ASSERT( !s.insert( i - 1 ));
+            }
+            CPPUNIT_ASSERT( check_size( s, nLimit * 2 ));
+            CPPUNIT_CHECK( s.find( nLimit - 1, []( value_type& v, int ) { v.nVal = -1; } ));
+
+            typename Set::guarded_ptr gp;
+            for ( int i = 0; i < nLimit * 2; ++i ) {
+                CPPUNIT_ASSERT( s.extract_min( gp ));
+                CPPUNIT_CHECK( gp->nKey == i );
+            }
+            gp.release();
+            CPPUNIT_ASSERT( s.empty() );
+            CPPUNIT_ASSERT( check_size( s, 0 ));
+        }
+
         template <class Set, typename PrintStat >
         void test_nogc()
         {
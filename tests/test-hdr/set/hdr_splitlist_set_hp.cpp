@@ -3,6 +3,7 @@
 #include "set/hdr_set.h"
 #include <cds/container/michael_list_hp.h>
 #include <cds/container/split_list_set.h>
+#include <cds/algo/work_stealing.h>
 
 namespace set {
 
@@ -55,6 +56,10 @@ namespace set {
         typedef cc::SplitListSet< cds::gc::HP, item, HP_cmp_traits > set;
 
         test_int< set >();
+        test_int_parallel< set >();
+
+        cds::algo::work_stealing::executor<> ex( 2 );
+        test_int_bulk< set >( ex );
 
         // option-based version
         typedef cc::SplitListSet< cds::gc::HP, item,
@@ -72,6 +77,8 @@ namespace set {
             >::type
         > opt_set;
         test_int< opt_set >();
+        test_int_parallel< opt_set >();
+        test_int_bulk< opt_set >( ex );
     }
 
     void HashSetHdrTest::Split_HP_less()
@@ -97,6 +104,7 @@ namespace set {
             >::type
         > opt_set;
         test_int< opt_set >();
+        test_int_parallel< opt_set >();
     }
 
     void HashSetHdrTest::Split_HP_cmpmix()
@@ -55,6 +55,7 @@ namespace set {
         typedef cc::SplitListSet< cds::gc::HP, item, HP_cmp_traits > set;
 
         test_int< set >();
+        test_int_parallel< set >();
 
         // option-based version
         typedef cc::SplitListSet< cds::gc::HP, item,
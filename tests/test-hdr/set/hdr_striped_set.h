@@ -10,6 +10,7 @@
 #include <cds/os/timer.h>
 #include <functional>   // ref
 #include <algorithm>    // random_shuffle
+#include <cds/cxx11_atomic.h>
 
 // forward namespace declaration
 namespace cds {
@@ -336,6 +337,30 @@ namespace set {
             }
 
             CPPUNIT_MSG( "   Duration=" << timer.duration() );
+
+            test_parallel( s );
+        }
+
+        template <class Set>
+        void test_parallel( Set& s )
+        {
+            size_t const nSize = s.size();
+            CPPUNIT_ASSERT( nSize > 0 );
+
+            atomics::atomic<size_t> nCount( 0 );
+            atomics::atomic<size_t> nKeySum( 0 );
+            s.parallel_for_each( [&nCount, &nKeySum]( typename Set::value_type const& v ) {
+                nCount.fetch_add( 1, atomics::memory_order_relaxed );
+                nKeySum.fetch_add( static_cast<size_t>( v.key() ), atomics::memory_order_relaxed );
+            }, 4 );
+            CPPUNIT_CHECK( nCount.load() == nSize );
+            CPPUNIT_CHECK( nKeySum.load() == nSize * ( nSize - 1 ) / 2 );
+
+            s.parallel_clear( 4 );
+            CPPUNIT_CHECK( s.empty() );
+            CPPUNIT_CHECK( check_size( s, 0 ));
+            CPPUNIT_CHECK( !s.find( 0 ));
+            CPPUNIT_CHECK( !s.find( static_cast<int>( nSize / 2 )));
         }
 
         template <class Set>
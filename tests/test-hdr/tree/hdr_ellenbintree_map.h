@@ -120,6 +120,33 @@ namespace tree {
         };
 
     protected:
+        struct range_functor
+        {
+            int     nFrom;
+            int     nTo;
+            int     nPrev;
+            size_t  nCount;
+            bool    bOk;
+
+            range_functor( int from, int to )
+                : nFrom( from )
+                , nTo( to )
+                , nPrev( from - 1 )
+                , nCount( 0 )
+                , bOk( true )
+            {}
+
+            template <typename Pair>
+            void operator()( Pair& i )
+            {
+                // keys must be strictly increasing and belong to [nFrom, nTo]
+                if ( i.first <= nPrev || i.first < nFrom || i.first > nTo )
+                    bOk = false;
+                nPrev = i.first;
+                ++nCount;
+            }
+        };
+
         template <typename Map>
         struct insert_functor
         {
@@ -363,6 +390,139 @@ namespace tree {
             CPPUNIT_ASSERT( check_size( s, c_nItemCount ));
         }
 
+        // The map contains even keys 0, 2, ..., 2 * (c_nItemCount - 1)
+        template <typename Map>
+        void fill_even( Map& s )
+        {
+            CPPUNIT_ASSERT( s.empty() );
+            for ( int i = 0; i < static_cast<int>( c_nItemCount ); ++i ) {
+                CPPUNIT_ASSERT( s.insert( i * 2 ));
+            }
+            CPPUNIT_ASSERT( check_size( s, c_nItemCount ));
+        }
+
+        template <typename Map>
+        void test_range( Map& s )
+        {
+            const int nMaxKey = static_cast<int>( c_nItemCount - 1 ) * 2;
+            {
+                range_functor f( 11, 40 );
+                CPPUNIT_CHECK( s.for_each_range( 11, 40, std::ref( f )) == 15 );
+                CPPUNIT_CHECK( f.bOk );
+                CPPUNIT_CHECK( f.nCount == 15 );
+            }
+            {
+                range_functor f( 12, 12 );
+                CPPUNIT_CHECK( s.for_each_range( 12, 12, std::ref( f )) == 1 );
+                CPPUNIT_CHECK( f.bOk );
+            }
+            {
+                range_functor f( 13, 13 );
+                CPPUNIT_CHECK( s.for_each_range( 13, 13, std::ref( f )) == 0 );
+            }
+            {
+                range_functor f( -100, nMaxKey + 100 );
+                CPPUNIT_CHECK( s.for_each_range( -100, nMaxKey + 100, std::ref( f )) == c_nItemCount );
+                CPPUNIT_CHECK( f.bOk );
+                CPPUNIT_CHECK( f.nPrev == nMaxKey );
+            }
+            {
+                range_functor f( nMaxKey - 9, nMaxKey + 9 );
+                CPPUNIT_CHECK( s.for_each_range_with( nMaxKey - 9, nMaxKey + 9, less(), std::ref( f )) == 5 );
+                CPPUNIT_CHECK( f.bOk );
+            }
+        }
+
+        template <class Map>
+        void test_ordered( Map& s )
+        {
+            typename Map::guarded_ptr gp;
+            const int nMaxKey = static_cast<int>( c_nItemCount - 1 ) * 2;
+
+            fill_even( s );
+            for ( int nKey = -2; nKey <= nMaxKey + 2; ++nKey ) {
+                int nNext = nKey < 0 ? 0 : ( nKey / 2 + 1 ) * 2;
+                if ( nNext <= nMaxKey ) {
+                    CPPUNIT_ASSERT( s.find_next( gp, nKey ));
+                    CPPUNIT_CHECK( gp->first == nNext );
+                    CPPUNIT_ASSERT( s.find_next_with( gp, nKey, less() ));
+                    CPPUNIT_CHECK( gp->first == nNext );
+                }
+                else {
+                    CPPUNIT_CHECK( !s.find_next( gp, nKey ));
+                    CPPUNIT_CHECK( !s.find_next_with( gp, nKey, less() ));
+                }
+
+                if ( nKey > 0 ) {
+                    int nPrev = nKey > nMaxKey ? nMaxKey : (( nKey - 1 ) / 2 ) * 2;
+                    CPPUNIT_ASSERT( s.find_prev( gp, nKey ));
+                    CPPUNIT_CHECK( gp->first == nPrev );
+                    CPPUNIT_ASSERT( s.find_prev_with( gp, nKey, less() ));
+                    CPPUNIT_CHECK( gp->first == nPrev );
+                }
+                else {
+                    CPPUNIT_CHECK( !s.find_prev( gp, nKey ));
+                    CPPUNIT_CHECK( !s.find_prev_with( gp, nKey, less() ));
+                }
+            }
+            gp.release();
+            test_range( s );
+
+            s.clear();
+            CPPUNIT_ASSERT( s.empty() );
+            CPPUNIT_CHECK( !s.find_next( gp, 0 ));
+            CPPUNIT_CHECK( !s.find_prev( gp, 0 ));
+            CPPUNIT_CHECK( s.for_each_range( -100, 100, range_functor( -100, 100 )) == 0 );
+        }
+
+        template <class Map>
+        void test_ordered_rcu( Map& s )
+        {
+            typedef typename Map::value_type value_type;
+            const int nMaxKey = static_cast<int>( c_nItemCount - 1 ) * 2;
+
+            fill_even( s );
+            for ( int nKey = -2; nKey <= nMaxKey + 2; ++nKey ) {
+                typename Map::rcu_lock l;
+
+                int nNext = nKey < 0 ? 0 : ( nKey / 2 + 1 ) * 2;
+                value_type * p = s.find_next( nKey );
+                value_type * pWith = s.find_next_with( nKey, less() );
+                if ( nNext <= nMaxKey ) {
+                    CPPUNIT_ASSERT( p != nullptr );
+                    CPPUNIT_CHECK( p->first == nNext );
+                    CPPUNIT_CHECK( p == pWith );
+                }
+                else {
+                    CPPUNIT_CHECK( p == nullptr );
+                    CPPUNIT_CHECK( pWith == nullptr );
+                }
+
+                p = s.find_prev( nKey );
+                pWith = s.find_prev_with( nKey, less() );
+                if ( nKey > 0 ) {
+                    int nPrev = nKey > nMaxKey ? nMaxKey : (( nKey - 1 ) / 2 ) * 2;
+                    CPPUNIT_ASSERT( p != nullptr );
+                    CPPUNIT_CHECK( p->first == nPrev );
+                    CPPUNIT_CHECK( p == pWith );
+                }
+                else {
+                    CPPUNIT_CHECK( p == nullptr );
+                    CPPUNIT_CHECK( pWith == nullptr );
+                }
+            }
+            test_range( s );
+
+            s.clear();
+            CPPUNIT_ASSERT( s.empty() );
+            {
+                typename Map::rcu_lock l;
+                CPPUNIT_CHECK( s.find_next( 0 ) == nullptr );
+                CPPUNIT_CHECK( s.find_prev( 0 ) == nullptr );
+            }
+            CPPUNIT_CHECK( s.for_each_range( -100, 100, range_functor( -100, 100 )) == 0 );
+        }
+
         template <class Map, class PrintStat>
         void test()
         {
@@ -452,6 +612,9 @@ namespace tree {
                 CPPUNIT_ASSERT( check_size( m, 0 ));
             }
 
+            // find_next/find_prev/for_each_range
+            test_ordered( m );
+
             PrintStat()( m );
         }
 
@@ -550,6 +713,9 @@ namespace tree {
                 CPPUNIT_ASSERT( check_size( m, 0 ));
             }
 
+            // find_next/find_prev/for_each_range
+            test_ordered_rcu( m );
+
             PrintStat()( m );
         }
 
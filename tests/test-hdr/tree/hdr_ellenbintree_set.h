@@ -7,6 +7,8 @@
 #include "size_check.h"
 #include <functional>   // ref
 #include <algorithm>
+#include <vector>
+#include <cds/algo/work_stealing.h>
 
 namespace tree {
     using misc::check_size;
@@ -273,6 +275,32 @@ namespace tree {
         };
 
 
+        struct range_functor
+        {
+            int     nFrom;
+            int     nTo;
+            int     nPrev;
+            size_t  nCount;
+            bool    bOk;
+
+            range_functor( int from, int to )
+                : nFrom( from )
+                , nTo( to )
+                , nPrev( from - 1 )
+                , nCount( 0 )
+                , bOk( true )
+            {}
+
+            void operator()( value_type& i )
+            {
+                // keys must be strictly increasing and belong to [nFrom, nTo]
+                if ( i.nKey <= nPrev || i.nKey < nFrom || i.nKey > nTo )
+                    bOk = false;
+                nPrev = i.nKey;
+                ++nCount;
+            }
+        };
+
     protected:
         template <class Set>
         void test_with( Set& s)
@@ -473,6 +501,139 @@ namespace tree {
 
         }
 
+        // The set contains even keys 0, 2, ..., 2 * (c_nItemCount - 1)
+        template <typename Set>
+        void fill_even( Set& s )
+        {
+            CPPUNIT_ASSERT( s.empty() );
+            for ( int i = 0; i < static_cast<int>( c_nItemCount ); ++i ) {
+                CPPUNIT_ASSERT( s.insert( i * 2 ));
+            }
+            CPPUNIT_ASSERT( check_size( s, c_nItemCount ));
+        }
+
+        template <typename Set>
+        void test_range( Set& s )
+        {
+            const int nMaxKey = static_cast<int>( c_nItemCount - 1 ) * 2;
+            {
+                range_functor f( 11, 40 );
+                CPPUNIT_CHECK( s.for_each_range( 11, 40, std::ref( f )) == 15 );
+                CPPUNIT_CHECK( f.bOk );
+                CPPUNIT_CHECK( f.nCount == 15 );
+            }
+            {
+                range_functor f( 12, 12 );
+                CPPUNIT_CHECK( s.for_each_range( 12, 12, std::ref( f )) == 1 );
+                CPPUNIT_CHECK( f.bOk );
+            }
+            {
+                range_functor f( 13, 13 );
+                CPPUNIT_CHECK( s.for_each_range( 13, 13, std::ref( f )) == 0 );
+            }
+            {
+                range_functor f( -100, nMaxKey + 100 );
+                CPPUNIT_CHECK( s.for_each_range( -100, nMaxKey + 100, std::ref( f )) == c_nItemCount );
+                CPPUNIT_CHECK( f.bOk );
+                CPPUNIT_CHECK( f.nPrev == nMaxKey );
+            }
+            {
+                range_functor f( nMaxKey - 9, nMaxKey + 9 );
+                CPPUNIT_CHECK( s.for_each_range_with( nMaxKey - 9, nMaxKey + 9, less(), std::ref( f )) == 5 );
+                CPPUNIT_CHECK( f.bOk );
+            }
+        }
+
+        template <class Set>
+        void test_ordered( Set& s )
+        {
+            typename Set::guarded_ptr gp;
+            const int nMaxKey = static_cast<int>( c_nItemCount - 1 ) * 2;
+
+            fill_even( s );
+            for ( int nKey = -2; nKey <= nMaxKey + 2; ++nKey ) {
+                int nNext = nKey < 0 ? 0 : ( nKey / 2 + 1 ) * 2;
+                if ( nNext <= nMaxKey ) {
+                    CPPUNIT_ASSERT( s.find_next( gp, nKey ));
+                    CPPUNIT_CHECK( gp->nKey == nNext );
+                    CPPUNIT_ASSERT( s.find_next_with( gp, nKey, less() ));
+                    CPPUNIT_CHECK( gp->nKey == nNext );
+                }
+                else {
+                    CPPUNIT_CHECK( !s.find_next( gp, nKey ));
+                    CPPUNIT_CHECK( !s.find_next_with( gp, nKey, less() ));
+                }
+
+                if ( nKey > 0 ) {
+                    int nPrev = nKey > nMaxKey ? nMaxKey : (( nKey - 1 ) / 2 ) * 2;
+                    CPPUNIT_ASSERT( s.find_prev( gp, nKey ));
+                    CPPUNIT_CHECK( gp->nKey == nPrev );
+                    CPPUNIT_ASSERT( s.find_prev_with( gp, nKey, less() ));
+                    CPPUNIT_CHECK( gp->nKey == nPrev );
+                }
+                else {
+                    CPPUNIT_CHECK( !s.find_prev( gp, nKey ));
+                    CPPUNIT_CHECK( !s.find_prev_with( gp, nKey, less() ));
+                }
+            }
+            gp.release();
+            test_range( s );
+
+            s.clear();
+            CPPUNIT_ASSERT( s.empty() );
+            CPPUNIT_CHECK( !s.find_next( gp, 0 ));
+            CPPUNIT_CHECK( !s.find_prev( gp, 0 ));
+            CPPUNIT_CHECK( s.for_each_range( -100, 100, range_functor( -100, 100 )) == 0 );
+        }
+
+        template <class Set>
+        void test_ordered_rcu( Set& s )
+        {
+            typedef typename Set::value_type value_type;
+            const int nMaxKey = static_cast<int>( c_nItemCount - 1 ) * 2;
+
+            fill_even( s );
+            for ( int nKey = -2; nKey <= nMaxKey + 2; ++nKey ) {
+                typename Set::rcu_lock l;
+
+                int nNext = nKey < 0 ? 0 : ( nKey / 2 + 1 ) * 2;
+                value_type * p = s.find_next( nKey );
+                value_type * pWith = s.find_next_with( nKey, less() );
+                if ( nNext <= nMaxKey ) {
+                    CPPUNIT_ASSERT( p != nullptr );
+                    CPPUNIT_CHECK( p->nKey == nNext );
+                    CPPUNIT_CHECK( p == pWith );
+                }
+                else {
+                    CPPUNIT_CHECK( p == nullptr );
+                    CPPUNIT_CHECK( pWith == nullptr );
+                }
+
+                p = s.find_prev( nKey );
+                pWith = s.find_prev_with( nKey, less() );
+                if ( nKey > 0 ) {
+                    int nPrev = nKey > nMaxKey ? nMaxKey : (( nKey - 1 ) / 2 ) * 2;
+                    CPPUNIT_ASSERT( p != nullptr );
+                    CPPUNIT_CHECK( p->nKey == nPrev );
+                    CPPUNIT_CHECK( p == pWith );
+                }
+                else {
+                    CPPUNIT_CHECK( p == nullptr );
+                    CPPUNIT_CHECK( pWith == nullptr );
+                }
+            }
+            test_range( s );
+
+            s.clear();
+            CPPUNIT_ASSERT( s.empty() );
+            {
+                typename Set::rcu_lock l;
+                CPPUNIT_CHECK( s.find_next( 0 ) == nullptr );
+                CPPUNIT_CHECK( s.find_prev( 0 ) == nullptr );
+            }
+            CPPUNIT_CHECK( s.for_each_range( -100, 100, range_functor( -100, 100 )) == 0 );
+        }
+
         template <class Set, class PrintStat>
         void test()
         {
@@ -555,9 +716,67 @@ namespace tree {
                 CPPUNIT_ASSERT( check_size( s, 0 ));
             }
 
+            // find_next/find_prev/for_each_range
+            test_ordered( s );
+
+            // bulk-load test
+            {
+                std::vector<int> arrKeys;
+                for ( int i = 0; i < static_cast<int>( c_nItemCount ); ++i )
+                    arrKeys.push_back( i * 2 );
+
+                {
+                    set_type sb( arrKeys.begin(), arrKeys.begin() );
+                    CPPUNIT_ASSERT( sb.empty() );
+                    CPPUNIT_ASSERT( sb.check_consistency() );
+                }
+                {
+                    set_type sb( arrKeys.begin(), arrKeys.begin() + 1 );
+                    test_bulk( sb, 1 );
+                }
+                {
+                    set_type sb( arrKeys.begin(), arrKeys.end() );
+                    test_bulk( sb, static_cast<int>( c_nItemCount ));
+                }
+                {
+                    cds::algo::work_stealing::executor<> ex( 2 );
+                    set_type sb( arrKeys.begin(), arrKeys.end(), ex );
+                    test_bulk( sb, static_cast<int>( c_nItemCount ));
+                }
+            }
+
             PrintStat()( s );
         }
 
+        // The set is built from the keys 0, 2, ..., (nCount - 1) * 2
+        template <class Set>
+        void test_bulk( Set& s, int nCount )
+        {
+            CPPUNIT_ASSERT( !s.empty() );
+            CPPUNIT_ASSERT( check_size( s, nCount ));
+            CPPUNIT_ASSERT( s.check_consistency() );
+
+            for ( int i = -1; i < nCount * 2; ++i )
+                CPPUNIT_CHECK( s.find( i ) == ( i >= 0 && (i & 1) == 0 ));
+
+            // the tree is a usual tree after building
+            for ( int i = 1; i < nCount * 2; i += 2 ) {
+                CPPUNIT_ASSERT( s.insert( i ));
+                CPPUNIT_ASSERT( !s.insert( i - 1 ));
+            }
+            CPPUNIT_ASSERT( s.insert( -1 ));
+            CPPUNIT_ASSERT( check_size( s, nCount * 2 + 1 ));
+            CPPUNIT_ASSERT( s.check_consistency() );
+
+            typename Set::guarded_ptr gp;
+            for ( int i = -1; i < nCount * 2; ++i ) {
+                CPPUNIT_ASSERT( s.extract_min( gp ));
+                CPPUNIT_CHECK( gp->nKey == i );
+            }
+            gp.release();
+            CPPUNIT_ASSERT( s.empty() );
+        }
+
         template <class Set, class PrintStat>
         void test_rcu()
         {
@@ -649,6 +868,9 @@ namespace tree {
 
             }
 
+            // find_next/find_prev/for_each_range
+            test_ordered_rcu( s );
+
             PrintStat()( s );
         }
 
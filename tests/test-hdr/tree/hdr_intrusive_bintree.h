@@ -241,6 +241,32 @@ namespace tree {
             }
         };
 
+        struct range_functor {
+            int     nFrom;
+            int     nTo;
+            int     nPrev;
+            size_t  nCount;
+            bool    bOk;
+
+            range_functor( int from, int to )
+                : nFrom( from )
+                , nTo( to )
+                , nPrev( from - 1 )
+                , nCount( 0 )
+                , bOk( true )
+            {}
+
+            template <typename T>
+            void operator()( T& v )
+            {
+                // keys must be strictly increasing and belong to [nFrom, nTo]
+                if ( v.nKey <= nPrev || v.nKey < nFrom || v.nKey > nTo )
+                    bOk = false;
+                nPrev = v.nKey;
+                ++nCount;
+            }
+        };
+
     protected:
         static const size_t c_nItemCount = 10000;
 
@@ -643,6 +669,142 @@ namespace tree {
             }
         }
 
+        // Only even keys from the array are inserted into the tree
+        template <typename Tree>
+        void fill_even( Tree& t, data_array< typename Tree::value_type >& arr )
+        {
+            typedef typename Tree::value_type value_type;
+
+            CPPUNIT_ASSERT( t.empty() );
+            for ( value_type * p = arr.begin(); p != arr.end(); ++p ) {
+                if ( (p->nKey & 1) == 0 )
+                    CPPUNIT_ASSERT( t.insert( *p ));
+            }
+            CPPUNIT_ASSERT( t.check_consistency() );
+        }
+
+        template <typename Tree>
+        void test_range( Tree& t )
+        {
+            typedef typename Tree::value_type value_type;
+            const int nMaxKey = static_cast<int>(( c_nItemCount - 1 ) & ~size_t(1));
+            {
+                range_functor f( 11, 40 );
+                CPPUNIT_CHECK( t.for_each_range( 11, 40, std::ref( f )) == 15 );
+                CPPUNIT_CHECK( f.bOk );
+                CPPUNIT_CHECK( f.nCount == 15 );
+            }
+            {
+                range_functor f( 12, 12 );
+                CPPUNIT_CHECK( t.for_each_range( 12, 12, std::ref( f )) == 1 );
+                CPPUNIT_CHECK( f.bOk );
+            }
+            {
+                range_functor f( 13, 13 );
+                CPPUNIT_CHECK( t.for_each_range( 13, 13, std::ref( f )) == 0 );
+            }
+            {
+                range_functor f( -100, nMaxKey + 100 );
+                CPPUNIT_CHECK( t.for_each_range( -100, nMaxKey + 100, std::ref( f )) == size_t( nMaxKey / 2 + 1 ));
+                CPPUNIT_CHECK( f.bOk );
+                CPPUNIT_CHECK( f.nPrev == nMaxKey );
+            }
+            {
+                range_functor f( nMaxKey - 9, nMaxKey + 9 );
+                CPPUNIT_CHECK( t.for_each_range_with( nMaxKey - 9, nMaxKey + 9, less<value_type>(), std::ref( f )) == 5 );
+                CPPUNIT_CHECK( f.bOk );
+            }
+        }
+
+        template <typename Tree>
+        void test_ordered( Tree& t )
+        {
+            typedef typename Tree::value_type value_type;
+            const int nMaxKey = static_cast<int>(( c_nItemCount - 1 ) & ~size_t(1));
+
+            data_array< value_type > arr;
+            fill_even( t, arr );
+            {
+                typename Tree::guarded_ptr gp;
+                for ( int nKey = -2; nKey <= nMaxKey + 2; ++nKey ) {
+                    int nNext = nKey < 0 ? 0 : ( nKey / 2 + 1 ) * 2;
+                    if ( nNext <= nMaxKey ) {
+                        CPPUNIT_ASSERT( t.find_next( gp, nKey ));
+                        CPPUNIT_CHECK( gp->nKey == nNext );
+                        CPPUNIT_ASSERT( t.find_next_with( gp, wrapped_int( nKey ), wrapped_less<value_type>() ));
+                        CPPUNIT_CHECK( gp->nKey == nNext );
+                    }
+                    else {
+                        CPPUNIT_CHECK( !t.find_next( gp, nKey ));
+                        CPPUNIT_CHECK( !t.find_next_with( gp, wrapped_int( nKey ), wrapped_less<value_type>() ));
+                    }
+
+                    if ( nKey > 0 ) {
+                        int nPrev = nKey > nMaxKey ? nMaxKey : (( nKey - 1 ) / 2 ) * 2;
+                        CPPUNIT_ASSERT( t.find_prev( gp, nKey ));
+                        CPPUNIT_CHECK( gp->nKey == nPrev );
+                        CPPUNIT_ASSERT( t.find_prev_with( gp, wrapped_int( nKey ), wrapped_less<value_type>() ));
+                        CPPUNIT_CHECK( gp->nKey == nPrev );
+                    }
+                    else {
+                        CPPUNIT_CHECK( !t.find_prev( gp, nKey ));
+                        CPPUNIT_CHECK( !t.find_prev_with( gp, wrapped_int( nKey ), wrapped_less<value_type>() ));
+                    }
+                }
+            }
+            test_range( t );
+
+            t.clear();
+            CPPUNIT_ASSERT( t.empty() );
+            CPPUNIT_ASSERT( t.check_consistency() );
+            Tree::gc::force_dispose();
+        }
+
+        template <typename Tree>
+        void test_ordered_rcu( Tree& t )
+        {
+            typedef typename Tree::value_type value_type;
+            const int nMaxKey = static_cast<int>(( c_nItemCount - 1 ) & ~size_t(1));
+
+            data_array< value_type > arr;
+            fill_even( t, arr );
+            for ( int nKey = -2; nKey <= nMaxKey + 2; ++nKey ) {
+                typename Tree::rcu_lock l;
+
+                int nNext = nKey < 0 ? 0 : ( nKey / 2 + 1 ) * 2;
+                value_type * p = t.find_next( nKey );
+                value_type * pWith = t.find_next_with( wrapped_int( nKey ), wrapped_less<value_type>() );
+                if ( nNext <= nMaxKey ) {
+                    CPPUNIT_ASSERT( p != nullptr );
+                    CPPUNIT_CHECK( p->nKey == nNext );
+                    CPPUNIT_CHECK( p == pWith );
+                }
+                else {
+                    CPPUNIT_CHECK( p == nullptr );
+                    CPPUNIT_CHECK( pWith == nullptr );
+                }
+
+                p = t.find_prev( nKey );
+                pWith = t.find_prev_with( wrapped_int( nKey ), wrapped_less<value_type>() );
+                if ( nKey > 0 ) {
+                    int nPrev = nKey > nMaxKey ? nMaxKey : (( nKey - 1 ) / 2 ) * 2;
+                    CPPUNIT_ASSERT( p != nullptr );
+                    CPPUNIT_CHECK( p->nKey == nPrev );
+                    CPPUNIT_CHECK( p == pWith );
+                }
+                else {
+                    CPPUNIT_CHECK( p == nullptr );
+                    CPPUNIT_CHECK( pWith == nullptr );
+                }
+            }
+            test_range( t );
+
+            t.clear();
+            CPPUNIT_ASSERT( t.empty() );
+            CPPUNIT_ASSERT( t.check_consistency() );
+            Tree::gc::force_dispose();
+        }
+
         template <class Tree, class PrintStat>
         void test()
         {
@@ -802,6 +964,9 @@ namespace tree {
                 tree_type::gc::force_dispose();
             }
 
+            // find_next/find_prev/for_each_range
+            test_ordered( t );
+
             PrintStat()( t );
         }
 
@@ -913,6 +1078,9 @@ namespace tree {
                 tree_type::gc::force_dispose();
             }
 
+            // find_next/find_prev/for_each_range
+            test_ordered_rcu( t );
+
             PrintStat()( t );
         }
 
@@ -180,6 +180,10 @@ namespace memory {
 
         TEST_ALLOC_STAT( michael_heap_stat,      MichaelHeap_Stat<int> )
         TEST_ALLOC( michael_heap_nostat,    MichaelHeap_NoStat<int> )
+        TEST_ALLOC( michael_heap_cache,     MichaelHeap_Cache<int> )
+#ifdef CDS_TEST_MICHAEL_MMAP_PAGE_HEAP
+        TEST_ALLOC( michael_heap_mmap,      MichaelHeap_Mmap<int> )
+#endif
         TEST_ALLOC( std_alloc,              std_allocator<int> )
 
         TEST_ALLOC_STAT( michael_alignheap_stat,     t_MichaelAlignHeap_Stat )
@@ -189,6 +193,10 @@ namespace memory {
         CPPUNIT_TEST_SUITE( Larson )
             CPPUNIT_TEST( michael_heap_stat )
             CPPUNIT_TEST( michael_heap_nostat )
+            CPPUNIT_TEST( michael_heap_cache )
+#ifdef CDS_TEST_MICHAEL_MMAP_PAGE_HEAP
+            CPPUNIT_TEST( michael_heap_mmap )
+#endif
             CPPUNIT_TEST( std_alloc )
 
             CPPUNIT_TEST( system_aligned_alloc )
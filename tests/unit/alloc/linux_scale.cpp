@@ -136,6 +136,10 @@ namespace memory {
 
         TEST_ALLOC_STAT( michael_heap_stat,      MichaelHeap_Stat<char> )
         TEST_ALLOC( michael_heap_nostat,    MichaelHeap_NoStat<char> )
+        TEST_ALLOC( michael_heap_cache,     MichaelHeap_Cache<char> )
+#ifdef CDS_TEST_MICHAEL_MMAP_PAGE_HEAP
+        TEST_ALLOC( michael_heap_mmap,      MichaelHeap_Mmap<char> )
+#endif
         TEST_ALLOC( std_alloc,              std_allocator<char> )
 
         TEST_ALLOC_STAT( michael_alignheap_stat,     t_MichaelAlignHeap_Stat )
@@ -144,6 +148,10 @@ namespace memory {
 
         CPPUNIT_TEST_SUITE( Linux_Scale )
             CPPUNIT_TEST( michael_heap_nostat )
+            CPPUNIT_TEST( michael_heap_cache )
+#ifdef CDS_TEST_MICHAEL_MMAP_PAGE_HEAP
+            CPPUNIT_TEST( michael_heap_mmap )
+#endif
             CPPUNIT_TEST( michael_heap_stat )
             CPPUNIT_TEST( std_alloc )
 
@@ -5,4 +5,8 @@
 namespace memory {
     t_MichaelHeap_NoStat  s_MichaelHeap_NoStat;
     t_MichaelHeap_Stat    s_MichaelHeap_Stat;
+    t_MichaelHeap_Cache   s_MichaelHeap_Cache;
+#ifdef CDS_TEST_MICHAEL_MMAP_PAGE_HEAP
+    t_MichaelHeap_Mmap    s_MichaelHeap_Mmap;
+#endif
 }
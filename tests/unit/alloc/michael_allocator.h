@@ -1,6 +1,10 @@
 //$$CDS-header$$
 
 #include <cds/memory/michael/allocator.h>
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+#   include <cds/memory/michael/mmap_page_heap.h>
+#   define CDS_TEST_MICHAEL_MMAP_PAGE_HEAP
+#endif
 #include <iostream>
 
 namespace memory {
@@ -18,10 +22,30 @@ namespace memory {
         ma::opt::check_bounds<ma::debug_bound_checking>
     >  t_MichaelHeap_Stat;
 
+    typedef ma::Heap<
+        ma::opt::procheap_stat<ma::procheap_empty_stat>,
+        ma::opt::os_allocated_stat<ma::os_allocated_empty>,
+        ma::opt::check_bounds<ma::debug_bound_checking>,
+        ma::opt::thread_cache< ma::thread_magazine<> >
+    >      t_MichaelHeap_Cache;
+
+#ifdef CDS_TEST_MICHAEL_MMAP_PAGE_HEAP
+    typedef ma::Heap<
+        ma::opt::procheap_stat<ma::procheap_empty_stat>,
+        ma::opt::os_allocated_stat<ma::os_allocated_empty>,
+        ma::opt::check_bounds<ma::debug_bound_checking>,
+        ma::opt::page_heap< ma::mmap_page_heap< 32 * 1024 * 1024, ma::mmap_huge_page_transparent > >
+    >      t_MichaelHeap_Mmap;
+#endif
+
     typedef ma::summary_stat            summary_stat;
 
     extern t_MichaelHeap_NoStat  s_MichaelHeap_NoStat;
     extern t_MichaelHeap_Stat    s_MichaelHeap_Stat;
+    extern t_MichaelHeap_Cache   s_MichaelHeap_Cache;
+#ifdef CDS_TEST_MICHAEL_MMAP_PAGE_HEAP
+    extern t_MichaelHeap_Mmap    s_MichaelHeap_Mmap;
+#endif
 
     template <typename T>
     class MichaelHeap_NoStat
@@ -51,6 +75,62 @@ namespace memory {
         }
     };
 
+    template <typename T>
+    class MichaelHeap_Cache
+    {
+    public:
+        typedef T value_type;
+        typedef T * pointer;
+
+        enum {
+            alignment = 1
+        };
+
+        pointer allocate( size_t nSize, const void * pHint )
+        {
+            return reinterpret_cast<pointer>( s_MichaelHeap_Cache.alloc( sizeof(T) * nSize ) );
+        }
+
+        void deallocate( pointer p, size_t nCount )
+        {
+            s_MichaelHeap_Cache.free( p );
+        }
+
+        static void stat(summary_stat& s)
+        {
+            s_MichaelHeap_Cache.summaryStat(s);
+        }
+    };
+
+#ifdef CDS_TEST_MICHAEL_MMAP_PAGE_HEAP
+    template <typename T>
+    class MichaelHeap_Mmap
+    {
+    public:
+        typedef T value_type;
+        typedef T * pointer;
+
+        enum {
+            alignment = 1
+        };
+
+        pointer allocate( size_t nSize, const void * pHint )
+        {
+            return reinterpret_cast<pointer>( s_MichaelHeap_Mmap.alloc( sizeof(T) * nSize ) );
+        }
+
+        void deallocate( pointer p, size_t nCount )
+        {
+            s_MichaelHeap_Mmap.free( p );
+        }
+
+        static void stat(summary_stat& s)
+        {
+            s_MichaelHeap_Mmap.summaryStat(s);
+        }
+    };
+#endif
+
     template <typename T>
     class std_allocator: public std::allocator<T>
     {
@@ -0,0 +1,125 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+
+#include <cds/algo/work_stealing.h>
+#include <cds/container/michael_list_hp.h>
+#include <cds/container/michael_set.h>
+#include <cds/os/timer.h>
+
+// Bulk insert into hash set: single thread vs. work-stealing executor
+namespace executor {
+
+    namespace {
+        static size_t s_nWorkerCount = 0;
+        static size_t s_nItemCount = 1000000;
+        static size_t s_nLoadFactor = 2;
+        static size_t s_nGrainSize = 0;
+    }
+
+    class BulkInsert: public CppUnitMini::TestCase
+    {
+        struct hash_functor {
+            size_t operator()( size_t key ) const
+            {
+                return std::hash<size_t>()( key );
+            }
+        };
+
+        typedef cds::container::MichaelList< cds::gc::HP, size_t > bucket_list;
+        typedef cds::container::MichaelHashSet< cds::gc::HP, bucket_list,
+            cds::container::michael_set::make_traits<
+                cds::opt::hash< hash_functor >
+            >::type
+        > set_type;
+
+        typedef cds::algo::work_stealing::make_traits<
+            cds::opt::stat< cds::algo::work_stealing::stat<> >
+        >::type executor_traits;
+        typedef cds::algo::work_stealing::executor< cds::gc::HP, executor_traits > executor_type;
+
+        struct insert_functor
+        {
+            set_type&               m_Set;
+            atomics::atomic<size_t>& m_nFailed;
+
+            void operator()( size_t i ) const
+            {
+                if ( !m_Set.insert( i ))
+                    m_nFailed.fetch_add( 1, atomics::memory_order_relaxed );
+            }
+        };
+
+        struct find_functor
+        {
+            set_type&               m_Set;
+            atomics::atomic<size_t>& m_nFailed;
+
+            void operator()( size_t i ) const
+            {
+                if ( !m_Set.find( i ))
+                    m_nFailed.fetch_add( 1, atomics::memory_order_relaxed );
+            }
+        };
+
+    protected:
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nWorkerCount = cfg.getULong("WorkerCount", 0 );
+            s_nItemCount = cfg.getULong("ItemCount", 1000000 );
+            s_nLoadFactor = cfg.getULong("LoadFactor", 2 );
+            s_nGrainSize = cfg.getULong("GrainSize", 0 );
+        }
+
+        void single_thread()
+        {
+            set_type s( s_nItemCount, s_nLoadFactor );
+
+            CPPUNIT_MSG( "   Single thread insert, item count=" << s_nItemCount << "..." );
+            cds::OS::Timer timer;
+            for ( size_t i = 0; i < s_nItemCount; ++i )
+                CPPUNIT_ASSERT( s.insert( i ));
+            CPPUNIT_MSG( "     Duration=" << timer.duration() );
+
+            CPPUNIT_CHECK( s.size() == s_nItemCount );
+        }
+
+        void work_stealing()
+        {
+            set_type s( s_nItemCount, s_nLoadFactor );
+            executor_type ex( s_nWorkerCount );
+            atomics::atomic<size_t> nFailed( 0 );
+
+            CPPUNIT_MSG( "   Executor insert, worker count=" << ex.worker_count()
+                << " item count=" << s_nItemCount
+                << " grain=" << s_nGrainSize
+                << "...");
+            cds::OS::Timer timer;
+            insert_functor fIns = { s, nFailed };
+            ex.parallel_for( size_t(0), s_nItemCount, fIns, s_nGrainSize );
+            CPPUNIT_MSG( "     Insert duration=" << timer.duration() );
+
+            CPPUNIT_CHECK_EX( nFailed.load() == 0, "Failed inserts: " << nFailed.load() );
+            CPPUNIT_CHECK_EX( s.size() == s_nItemCount, "Expected=" << s_nItemCount << " real=" << s.size() );
+
+            timer.reset();
+            find_functor fFind = { s, nFailed };
+            ex.parallel_for( size_t(0), s_nItemCount, fFind, s_nGrainSize );
+            CPPUNIT_MSG( "     Find duration=" << timer.duration() );
+            CPPUNIT_CHECK_EX( nFailed.load() == 0, "Failed finds: " << nFailed.load() );
+
+            CPPUNIT_MSG( "   Stat: spawn=" << ex.statistics().m_nSpawn.get()
+                << " submit=" << ex.statistics().m_nSubmit.get()
+                << " steal=" << ex.statistics().m_nSteal.get()
+                << " park=" << ex.statistics().m_nPark.get()
+            );
+        }
+
+        CPPUNIT_TEST_SUITE(BulkInsert)
+            CPPUNIT_TEST(single_thread)
+            CPPUNIT_TEST(work_stealing)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace executor
+
+CPPUNIT_TEST_SUITE_REGISTRATION(executor::BulkInsert);
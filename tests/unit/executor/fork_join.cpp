@@ -0,0 +1,187 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+
+#include <cds/algo/work_stealing.h>
+#include <cds/gc/hp.h>
+#include <cds/gc/ptb.h>
+#include <cds/os/timer.h>
+
+// Fork-join benchmark of work-stealing executor
+namespace executor {
+
+    namespace {
+        static size_t s_nWorkerCount = 0;
+        static size_t s_nFibNumber = 25;
+        static size_t s_nFibCutoff = 10;
+        static size_t s_nLoopSize = 10000000;
+        static size_t s_nSubmitCount = 100000;
+
+        size_t seq_fib( size_t n )
+        {
+            return n < 2 ? n : seq_fib( n - 1 ) + seq_fib( n - 2 );
+        }
+    }
+
+    class ForkJoin: public CppUnitMini::TestCase
+    {
+        template <class Executor>
+        struct fib_task
+        {
+            Executor&   m_Executor;
+            size_t      m_n;
+            size_t&     m_nResult;
+
+            fib_task( Executor& ex, size_t n, size_t& res )
+                : m_Executor( ex )
+                , m_n( n )
+                , m_nResult( res )
+            {}
+
+            void operator()() const
+            {
+                if ( m_n < s_nFibCutoff ) {
+                    m_nResult = seq_fib( m_n );
+                    return;
+                }
+
+                size_t r1, r2;
+                typename Executor::task_group g( m_Executor );
+                g.run( fib_task( m_Executor, m_n - 1, r1 ));
+                fib_task( m_Executor, m_n - 2, r2 )();
+                g.wait();
+                m_nResult = r1 + r2;
+            }
+        };
+
+        struct sum_functor
+        {
+            atomics::atomic<size_t>&    m_nMarks    ;   // count of indices that are multiple of 1024
+            size_t *                    m_pArr;
+
+            void operator()( size_t i ) const
+            {
+                m_pArr[i] = i;
+                if ( ( i & 0x3FF ) == 0 )
+                    m_nMarks.fetch_add( 1, atomics::memory_order_relaxed );
+            }
+        };
+
+        struct counter_task
+        {
+            atomics::atomic<size_t>& m_nCounter;
+            void operator()() const
+            {
+                m_nCounter.fetch_add( 1, atomics::memory_order_relaxed );
+            }
+        };
+
+    protected:
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nWorkerCount = cfg.getULong("WorkerCount", 0 );
+            s_nFibNumber = cfg.getULong("FibNumber", 25 );
+            s_nFibCutoff = cfg.getULong("FibCutoff", 10 );
+            s_nLoopSize = cfg.getULong("LoopSize", 10000000 );
+            s_nSubmitCount = cfg.getULong("SubmitCount", 100000 );
+        }
+
+        template <class Executor>
+        void test_fib( Executor& ex )
+        {
+            size_t nExpected = seq_fib( s_nFibNumber );
+            size_t nResult = 0;
+
+            CPPUNIT_MSG( "   fib(" << s_nFibNumber << "), cutoff=" << s_nFibCutoff << "..." );
+            cds::OS::Timer timer;
+            {
+                typename Executor::task_group g( ex );
+                g.run( fib_task<Executor>( ex, s_nFibNumber, nResult ));
+                g.wait();
+            }
+            CPPUNIT_MSG( "     Duration=" << timer.duration() );
+            CPPUNIT_ASSERT_EX( nResult == nExpected, "Expected=" << nExpected << " real=" << nResult );
+        }
+
+        template <class Executor>
+        void test_parallel_for( Executor& ex )
+        {
+            std::vector<size_t> arr( s_nLoopSize, 0 );
+            atomics::atomic<size_t> nMarks( 0 );
+            sum_functor f = { nMarks, &arr[0] };
+
+            CPPUNIT_MSG( "   parallel_for, size=" << s_nLoopSize << "..." );
+            cds::OS::Timer timer;
+            ex.parallel_for( size_t(0), s_nLoopSize, f );
+            CPPUNIT_MSG( "     Duration=" << timer.duration() );
+
+            size_t nErrors = 0;
+            for ( size_t i = 0; i < s_nLoopSize; ++i ) {
+                if ( arr[i] != i )
+                    ++nErrors;
+            }
+            CPPUNIT_CHECK_EX( nErrors == 0, "Not visited: " << nErrors );
+            CPPUNIT_CHECK( nMarks.load() == ( s_nLoopSize + 0x3FF ) / 0x400 );
+        }
+
+        template <class Executor>
+        void test_submit( Executor& ex )
+        {
+            atomics::atomic<size_t> nCounter( 0 );
+            counter_task f = { nCounter };
+
+            CPPUNIT_MSG( "   External submit, task count=" << s_nSubmitCount << "..." );
+            cds::OS::Timer timer;
+            {
+                typename Executor::task_group g( ex );
+                for ( size_t i = 0; i < s_nSubmitCount; ++i )
+                    g.run( f );
+                g.wait();
+            }
+            CPPUNIT_MSG( "     Duration=" << timer.duration() );
+            CPPUNIT_CHECK_EX( nCounter.load() == s_nSubmitCount, "Expected=" << s_nSubmitCount << " real=" << nCounter.load() );
+        }
+
+        template <class Executor>
+        void test()
+        {
+            Executor ex( s_nWorkerCount );
+            CPPUNIT_MSG( "   Worker count=" << ex.worker_count() );
+            CPPUNIT_ASSERT( !ex.is_worker() );
+
+            test_fib( ex );
+            test_parallel_for( ex );
+            test_submit( ex );
+
+            CPPUNIT_MSG( "   Stat: spawn=" << ex.statistics().m_nSpawn.get()
+                << " submit=" << ex.statistics().m_nSubmit.get()
+                << " execute=" << ex.statistics().m_nExecute.get()
+                << " steal=" << ex.statistics().m_nSteal.get()
+                << " inject=" << ex.statistics().m_nInject.get()
+                << " park=" << ex.statistics().m_nPark.get()
+                << " wakeup=" << ex.statistics().m_nWakeup.get()
+            );
+            CPPUNIT_CHECK( ex.statistics().m_nExecute.get() == ex.statistics().m_nSpawn.get() + ex.statistics().m_nSubmit.get() );
+        }
+
+        typedef cds::algo::work_stealing::make_traits<
+            cds::opt::stat< cds::algo::work_stealing::stat<> >
+        >::type stat_traits;
+
+        void executor_HP()
+        {
+            test< cds::algo::work_stealing::executor< cds::gc::HP, stat_traits > >();
+        }
+        void executor_PTB()
+        {
+            test< cds::algo::work_stealing::executor< cds::gc::PTB, stat_traits > >();
+        }
+
+        CPPUNIT_TEST_SUITE(ForkJoin)
+            CPPUNIT_TEST(executor_HP)
+            CPPUNIT_TEST(executor_PTB)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace executor
+
+CPPUNIT_TEST_SUITE_REGISTRATION(executor::ForkJoin);
@@ -3,6 +3,7 @@
 #include "cppunit/thread.h"
 
 #include <cds/lock/spinlock.h>
+#include <cds/lock/elided_lock.h>
 
 // Multi-threaded stack test for push operation
 namespace lock {
@@ -114,6 +115,9 @@ namespace lock {
         TEST_CASE(reentrantSpinlock_hint,       reentrantSpin_hint );
         TEST_CASE(reentrantSpinlock_empty,      reentrantSpin_empty );
 
+        TEST_CASE(elidedSpinLock,           cds::lock::ElidedLock< cds::lock::Spin > );
+        TEST_CASE(elidedReentrantSpinLock,  cds::lock::ElidedLock< cds::lock::ReentrantSpin > );
+
     protected:
         CPPUNIT_TEST_SUITE(Spinlock_MT)
             CPPUNIT_TEST(spinLock_exp);
@@ -129,6 +133,9 @@ namespace lock {
             CPPUNIT_TEST(reentrantSpinlock_yield)
             CPPUNIT_TEST(reentrantSpinlock_hint)
             CPPUNIT_TEST(reentrantSpinlock_empty)
+
+            CPPUNIT_TEST(elidedSpinLock)
+            CPPUNIT_TEST(elidedReentrantSpinLock)
         CPPUNIT_TEST_SUITE_END();
     };
 
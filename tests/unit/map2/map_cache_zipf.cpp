@@ -0,0 +1,279 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include <cds/container/michael_list_hp.h>
+#include <cds/container/michael_list_ptb.h>
+#include <cds/container/clock_cache.h>
+#include <cds/os/timer.h>
+#include <mutex>
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+// Bounded cache under Zipfian key distribution: ClockCache vs. LRU list protected by a mutex
+namespace map2 {
+
+    namespace {
+        static size_t s_nThreadCount = 8;
+        static size_t s_nKeyRange = 1000000;
+        static size_t s_nCapacity = 100000;
+        static size_t s_nPassCount = 1000000;
+        static double s_dZipfAlpha = 0.99;
+    }
+
+    namespace cc = cds::container;
+
+    class Map_CacheZipf: public CppUnitMini::TestCase
+    {
+        typedef size_t  key_type;
+        typedef size_t  value_type;
+
+        struct map_traits: public cc::split_list::make_traits<
+            cc::split_list::ordered_list< cc::michael_list_tag >
+            ,cds::opt::hash< std::hash<key_type> >
+            ,cc::split_list::ordered_list_traits<
+                cc::michael_list::make_traits<
+                    cds::opt::less< std::less<key_type> >
+                >::type
+            >
+        >::type
+        {};
+
+        template <typename GC>
+        struct clock_cache {
+            typedef cc::ClockCache< GC, key_type, value_type,
+                typename cc::clock_cache::make_traits<
+                    cc::clock_cache::map_traits< map_traits >
+                    ,cds::opt::stat< cc::clock_cache::stat<> >
+                >::type
+            > type;
+        };
+
+        // The cache with LRU list: the list and the hash map are protected by a mutex
+        class LockedLRUCache
+        {
+            typedef std::list< std::pair<key_type, value_type> > lru_list;
+            typedef std::unordered_map< key_type, typename lru_list::iterator > index_map;
+
+            std::mutex  m_Mutex;
+            lru_list    m_List;
+            index_map   m_Index;
+            size_t const m_nCapacity;
+
+        public:
+            LockedLRUCache( size_t nCapacity )
+                : m_nCapacity( nCapacity )
+            {}
+
+            bool get( key_type key, value_type& dest )
+            {
+                std::unique_lock< std::mutex > l( m_Mutex );
+                typename index_map::iterator it = m_Index.find( key );
+                if ( it == m_Index.end() )
+                    return false;
+                m_List.splice( m_List.begin(), m_List, it->second );
+                dest = it->second->second;
+                return true;
+            }
+
+            bool insert( key_type key, value_type val )
+            {
+                std::unique_lock< std::mutex > l( m_Mutex );
+                if ( m_Index.find( key ) != m_Index.end() )
+                    return false;
+                if ( m_List.size() >= m_nCapacity ) {
+                    m_Index.erase( m_List.back().first );
+                    m_List.pop_back();
+                }
+                m_List.push_front( std::make_pair( key, val ));
+                m_Index[key] = m_List.begin();
+                return true;
+            }
+
+            size_t size()
+            {
+                std::unique_lock< std::mutex > l( m_Mutex );
+                return m_List.size();
+            }
+        };
+
+        template <class Cache>
+        class Worker: public CppUnitMini::TestThread
+        {
+            Cache&                  m_Cache;
+            std::vector<key_type>   m_arrKeys;
+
+            virtual TestThread *    clone()
+            {
+                return new Worker( *this );
+            }
+        public:
+            size_t  m_nHit;
+            size_t  m_nMiss;
+            size_t  m_nError;
+
+        public:
+            Worker( CppUnitMini::ThreadPool& pool, Cache& c )
+                : CppUnitMini::TestThread( pool )
+                , m_Cache( c )
+            {}
+            Worker( Worker& src )
+                : CppUnitMini::TestThread( src )
+                , m_Cache( src.m_Cache )
+            {}
+
+            Map_CacheZipf&  getTest()
+            {
+                return reinterpret_cast<Map_CacheZipf&>( m_Pool.m_Test );
+            }
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+
+                // The keys are generated before the test so the generator does not affect the duration
+                std::vector<double> const& cdf = getTest().m_arrZipfCDF;
+                m_arrKeys.resize( s_nPassCount );
+                unsigned int nRand = static_cast<unsigned int>( m_nThreadNo * 2 + 1 );
+                for ( size_t i = 0; i < s_nPassCount; ++i ) {
+                    nRand = cds::bitop::RandXorShift( nRand );
+                    double p = static_cast<double>( nRand ) / 4294967296.0;
+                    m_arrKeys[i] = static_cast<key_type>( std::lower_bound( cdf.begin(), cdf.end(), p ) - cdf.begin() );
+                }
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                m_nHit = m_nMiss = m_nError = 0;
+                for ( size_t i = 0; i < m_arrKeys.size(); ++i ) {
+                    key_type key = m_arrKeys[i];
+                    value_type val;
+                    if ( m_Cache.get( key, val )) {
+                        ++m_nHit;
+                        if ( val != key * 2 )
+                            ++m_nError;
+                    }
+                    else {
+                        ++m_nMiss;
+                        m_Cache.insert( key, key * 2 );
+                    }
+                }
+            }
+        };
+
+    public:
+        std::vector<double> m_arrZipfCDF;
+
+    protected:
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nThreadCount = cfg.getULong("ThreadCount", 8 );
+            s_nKeyRange = cfg.getULong("KeyRange", 1000000 );
+            s_nCapacity = cfg.getULong("Capacity", 100000 );
+            s_nPassCount = cfg.getULong("PassCount", 1000000 );
+            s_dZipfAlpha = cfg.get("ZipfAlpha", 0.99 );
+
+            if ( s_nThreadCount == 0 )
+                s_nThreadCount = 1;
+            if ( s_nKeyRange == 0 )
+                s_nKeyRange = 1000;
+            if ( s_nCapacity == 0 )
+                s_nCapacity = 1;
+        }
+
+        void make_zipf_cdf()
+        {
+            if ( m_arrZipfCDF.size() == s_nKeyRange )
+                return;
+
+            m_arrZipfCDF.resize( s_nKeyRange );
+            double dSum = 0;
+            for ( size_t i = 0; i < s_nKeyRange; ++i ) {
+                dSum += 1.0 / std::pow( static_cast<double>( i + 1 ), s_dZipfAlpha );
+                m_arrZipfCDF[i] = dSum;
+            }
+            for ( size_t i = 0; i < s_nKeyRange; ++i )
+                m_arrZipfCDF[i] /= dSum;
+        }
+
+        template <class Cache>
+        void run_test( Cache& c )
+        {
+            make_zipf_cdf();
+
+            CPPUNIT_MSG( "   Thread count=" << s_nThreadCount << " key range=" << s_nKeyRange
+                << " capacity=" << s_nCapacity << " pass count=" << s_nPassCount
+                << " Zipf alpha=" << s_dZipfAlpha << " ..." );
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Worker<Cache>( pool, c ), s_nThreadCount );
+            pool.run();
+
+            size_t nHit = 0;
+            size_t nMiss = 0;
+            size_t nError = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Worker<Cache> * p = static_cast<Worker<Cache> *>( *it );
+                nHit += p->m_nHit;
+                nMiss += p->m_nMiss;
+                nError += p->m_nError;
+            }
+
+            double dDuration = pool.avgDuration();
+            CPPUNIT_MSG( "   Duration=" << dDuration
+                << "\n\t      Hit ratio=" << static_cast<double>( nHit ) * 100 / ( nHit + nMiss ) << '%'
+                << "\n\t          Speed=" << static_cast<size_t>(( nHit + nMiss ) / ( dDuration > 0 ? dDuration : 1 )) << " op/sec" );
+
+            CPPUNIT_CHECK( nHit + nMiss == s_nThreadCount * s_nPassCount );
+            CPPUNIT_CHECK( nError == 0 );
+            CPPUNIT_CHECK( c.size() <= s_nCapacity );
+        }
+
+        template <class Cache>
+        void test_clock()
+        {
+            Cache c( s_nCapacity );
+            run_test( c );
+
+            typename Cache::stat const& s = c.statistics();
+            CPPUNIT_MSG( "   Statistics:"
+                << "\n\t            Hit=" << s.m_nHit.get()
+                << "\n\t           Miss=" << s.m_nMiss.get()
+                << "\n\t         Insert=" << s.m_nInsert.get()
+                << "\n\t  Insert failed=" << s.m_nInsertFailed.get()
+                << "\n\t          Evict=" << s.m_nEvict.get()
+                << "\n\t  Second chance=" << s.m_nSecondChance.get()
+                << "\n\t      Free slot=" << s.m_nFreeSlot.get()
+                << "\n\t      Slot wait=" << s.m_nSlotWait.get() );
+        }
+
+        void ClockCache_HP()
+        {
+            test_clock< clock_cache< cds::gc::HP >::type >();
+        }
+
+        void ClockCache_PTB()
+        {
+            test_clock< clock_cache< cds::gc::PTB >::type >();
+        }
+
+        void LockedLRU()
+        {
+            LockedLRUCache c( s_nCapacity );
+            run_test( c );
+        }
+
+        CPPUNIT_TEST_SUITE(Map_CacheZipf)
+            CPPUNIT_TEST(ClockCache_HP)
+            CPPUNIT_TEST(ClockCache_PTB)
+            CPPUNIT_TEST(LockedLRU)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+    CPPUNIT_TEST_SUITE_REGISTRATION( Map_CacheZipf );
+} // namespace map2
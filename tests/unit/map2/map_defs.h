@@ -403,6 +403,111 @@
     CPPUNIT_TEST(EllenBinTreeMap_rcu_gpt_stat)\
     CDSUNIT_TEST_EllenBinTreeMap_RCU_signal
 
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+#   define CDSUNIT_DECLARE_BPlusTreeMap_RCU_signal \
+    TEST_MAP_NOLF(BPlusTreeMap_rcu_shb)\
+    TEST_MAP_NOLF(BPlusTreeMap_rcu_shb_stat)\
+    TEST_MAP_NOLF(BPlusTreeMap_rcu_sht)\
+    TEST_MAP_NOLF(BPlusTreeMap_rcu_sht_stat)
+
+#   define CDSUNIT_TEST_BPlusTreeMap_RCU_signal \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_shb)\
+    CPPUNIT_TEST(BPlusTreeMap_rcu_shb_stat)\
+    CPPUNIT_TEST(BPlusTreeMap_rcu_sht)\
+    CPPUNIT_TEST(BPlusTreeMap_rcu_sht_stat)
+#else
+#   define CDSUNIT_DECLARE_BPlusTreeMap_RCU_signal
+#   define CDSUNIT_TEST_BPlusTreeMap_RCU_signal
+#endif
+
+#define CDSUNIT_DECLARE_BPlusTreeMap \
+    TEST_MAP_NOLF(BPlusTreeMap_rcu_gpi)\
+    TEST_MAP_NOLF(BPlusTreeMap_rcu_gpi_stat)\
+    TEST_MAP_NOLF(BPlusTreeMap_rcu_gpb)\
+    TEST_MAP_NOLF(BPlusTreeMap_rcu_gpb_stat)\
+    TEST_MAP_NOLF(BPlusTreeMap_rcu_gpt)\
+    TEST_MAP_NOLF(BPlusTreeMap_rcu_gpt_stat)\
+    CDSUNIT_DECLARE_BPlusTreeMap_RCU_signal
+
+#define CDSUNIT_TEST_BPlusTreeMap \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpi)\
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpi_stat)\
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpb)\
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpb_stat)\
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpt)\
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpt_stat)\
+    CDSUNIT_TEST_BPlusTreeMap_RCU_signal
+
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+#   define CDSUNIT_DECLARE_ArtMap_RCU_signal \
+    TEST_MAP_NOLF(ArtMap_rcu_shb)\
+    TEST_MAP_NOLF(ArtMap_rcu_shb_stat)\
+    TEST_MAP_NOLF(ArtMap_rcu_sht)\
+    TEST_MAP_NOLF(ArtMap_rcu_sht_stat)
+
+#   define CDSUNIT_TEST_ArtMap_RCU_signal \
+    CPPUNIT_TEST(ArtMap_rcu_shb)\
+    CPPUNIT_TEST(ArtMap_rcu_shb_stat)\
+    CPPUNIT_TEST(ArtMap_rcu_sht)\
+    CPPUNIT_TEST(ArtMap_rcu_sht_stat)
+#else
+#   define CDSUNIT_DECLARE_ArtMap_RCU_signal
+#   define CDSUNIT_TEST_ArtMap_RCU_signal
+#endif
+
+#define CDSUNIT_DECLARE_ArtMap \
+    TEST_MAP_NOLF(ArtMap_rcu_gpi)\
+    TEST_MAP_NOLF(ArtMap_rcu_gpi_stat)\
+    TEST_MAP_NOLF(ArtMap_rcu_gpb)\
+    TEST_MAP_NOLF(ArtMap_rcu_gpb_stat)\
+    TEST_MAP_NOLF(ArtMap_rcu_gpt)\
+    TEST_MAP_NOLF(ArtMap_rcu_gpt_stat)\
+    CDSUNIT_DECLARE_ArtMap_RCU_signal
+
+#define CDSUNIT_TEST_ArtMap \
+    CPPUNIT_TEST(ArtMap_rcu_gpi)\
+    CPPUNIT_TEST(ArtMap_rcu_gpi_stat)\
+    CPPUNIT_TEST(ArtMap_rcu_gpb)\
+    CPPUNIT_TEST(ArtMap_rcu_gpb_stat)\
+    CPPUNIT_TEST(ArtMap_rcu_gpt)\
+    CPPUNIT_TEST(ArtMap_rcu_gpt_stat)\
+    CDSUNIT_TEST_ArtMap_RCU_signal
+
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+#   define CDSUNIT_DECLARE_FatSkipListMap_RCU_signal \
+    TEST_MAP_NOLF(FatSkipListMap_rcu_shb)\
+    TEST_MAP_NOLF(FatSkipListMap_rcu_shb_stat)\
+    TEST_MAP_NOLF(FatSkipListMap_rcu_sht)\
+    TEST_MAP_NOLF(FatSkipListMap_rcu_sht_stat)
+
+#   define CDSUNIT_TEST_FatSkipListMap_RCU_signal \
+    CPPUNIT_TEST(FatSkipListMap_rcu_shb)\
+    CPPUNIT_TEST(FatSkipListMap_rcu_shb_stat)\
+    CPPUNIT_TEST(FatSkipListMap_rcu_sht)\
+    CPPUNIT_TEST(FatSkipListMap_rcu_sht_stat)
+#else
+#   define CDSUNIT_DECLARE_FatSkipListMap_RCU_signal
+#   define CDSUNIT_TEST_FatSkipListMap_RCU_signal
+#endif
+
+#define CDSUNIT_DECLARE_FatSkipListMap \
+    TEST_MAP_NOLF(FatSkipListMap_rcu_gpi)\
+    TEST_MAP_NOLF(FatSkipListMap_rcu_gpi_stat)\
+    TEST_MAP_NOLF(FatSkipListMap_rcu_gpb)\
+    TEST_MAP_NOLF(FatSkipListMap_rcu_gpb_stat)\
+    TEST_MAP_NOLF(FatSkipListMap_rcu_gpt)\
+    TEST_MAP_NOLF(FatSkipListMap_rcu_gpt_stat)\
+    CDSUNIT_DECLARE_FatSkipListMap_RCU_signal
+
+#define CDSUNIT_TEST_FatSkipListMap \
+    CPPUNIT_TEST(FatSkipListMap_rcu_gpi)\
+    CPPUNIT_TEST(FatSkipListMap_rcu_gpi_stat)\
+    CPPUNIT_TEST(FatSkipListMap_rcu_gpb)\
+    CPPUNIT_TEST(FatSkipListMap_rcu_gpb_stat)\
+    CPPUNIT_TEST(FatSkipListMap_rcu_gpt)\
+    CPPUNIT_TEST(FatSkipListMap_rcu_gpt_stat)\
+    CDSUNIT_TEST_FatSkipListMap_RCU_signal
+
 
 #define CDSUNIT_DECLARE_StripedMap_common \
     TEST_MAP(StripedMap_list) \
@@ -255,6 +255,9 @@ namespace map2 {
         CDSUNIT_DECLARE_SkipListMap
         CDSUNIT_DECLARE_SkipListMap_nogc
         CDSUNIT_DECLARE_EllenBinTreeMap
+        CDSUNIT_DECLARE_BPlusTreeMap
+        CDSUNIT_DECLARE_ArtMap
+        CDSUNIT_DECLARE_FatSkipListMap
         CDSUNIT_DECLARE_StripedMap
         CDSUNIT_DECLARE_RefinableMap
         CDSUNIT_DECLARE_CuckooMap
@@ -268,6 +271,9 @@ namespace map2 {
             CDSUNIT_TEST_SkipListMap
             CDSUNIT_TEST_SkipListMap_nogc
             CDSUNIT_TEST_EllenBinTreeMap
+            CDSUNIT_TEST_BPlusTreeMap
+            CDSUNIT_TEST_ArtMap
+            CDSUNIT_TEST_FatSkipListMap
             CDSUNIT_TEST_StripedMap
             CDSUNIT_TEST_RefinableMap
             CDSUNIT_TEST_CuckooMap
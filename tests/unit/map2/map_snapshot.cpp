@@ -0,0 +1,296 @@
+//$$CDS-header$$
+
+#include "map2/map_types.h"
+#include "cppunit/thread.h"
+
+#include <cds/container/snapshot.h>
+#include <cds/os/topology.h>
+#include <vector>
+#include <memory>
+#include <cstdio>
+
+namespace map2 {
+
+#   define TEST_MAP(X)              void X() { test<MapTypes<key_type, value_type>::X >(); std::remove( c_strFileName.c_str() ); }
+#   define TEST_MAP_BULK(X)         void X() { test<MapTypes<key_type, value_type>::X >(); test_bulk<MapTypes<key_type, value_type>::X >(); }
+#   define TEST_MAP_NOLF_BULK(X)    void X() { test_nolf<MapTypes<key_type, value_type>::X >(); test_bulk<MapTypes<key_type, value_type>::X >(); }
+
+    namespace {
+        static size_t  c_nMapSize = 1000000    ;  // map size
+        static size_t  c_nThreadCount = 4      ;  // count of writer threads
+        static size_t  c_nPassCount = 4        ;  // count of snapshots saved while writers work
+        static size_t  c_nLoadFactor = 2       ;  // load factor
+        static std::string  c_strFileName = "map_snapshot.tmp";  // snapshot file name
+        static bool    c_bPrintGCState = true;
+    }
+
+    // Snapshot save/load benchmark
+    // The map of c_nMapSize keys is saved c_nPassCount times while the writer threads insert and erase
+    // other keys. Then the snapshot is loaded into an empty map by insertion and,
+    // for SkipListMap and SplitListMap, by bulk-load constructor
+    class Map_Snapshot: public CppUnitMini::TestCase
+    {
+        typedef size_t  key_type;
+        typedef size_t  value_type;
+
+        typedef cds::container::snapshot::default_codec< std::pair< key_type const, value_type > >  codec;
+        typedef cds::container::snapshot::loader< codec >   loader;
+
+        template <class Map>
+        class Writer: public CppUnitMini::TestThread
+        {
+            Map&     m_Map;
+
+            virtual Writer *    clone()
+            {
+                return new Writer( *this );
+            }
+        public:
+            size_t  m_nInsertSuccess;
+            size_t  m_nEraseSuccess;
+
+        public:
+            Writer( CppUnitMini::ThreadPool& pool, Map& rMap )
+                : CppUnitMini::TestThread( pool )
+                , m_Map( rMap )
+            {}
+            Writer( Writer& src )
+                : CppUnitMini::TestThread( src )
+                , m_Map( src.m_Map )
+            {}
+
+            Map_Snapshot&  getTest()
+            {
+                return reinterpret_cast<Map_Snapshot&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                Map& rMap = m_Map;
+                Map_Snapshot& t = getTest();
+
+                m_nInsertSuccess =
+                    m_nEraseSuccess = 0;
+
+                // The keys of the writers are out of [0, c_nMapSize)
+                size_t nKey = c_nMapSize + m_nThreadNo;
+                while ( !t.m_bSaveDone.load( atomics::memory_order_acquire )) {
+                    if ( rMap.insert( nKey, nKey ))
+                        ++m_nInsertSuccess;
+                    if ( nKey >= c_nMapSize + c_nThreadCount && rMap.erase( nKey - c_nThreadCount ))
+                        ++m_nEraseSuccess;
+                    nKey += c_nThreadCount;
+                    if ( nKey >= c_nMapSize * 2 )
+                        nKey = c_nMapSize + m_nThreadNo;
+                }
+            }
+        };
+
+        template <class Map>
+        class Saver: public CppUnitMini::TestThread
+        {
+            Map&     m_Map;
+
+            virtual Saver *    clone()
+            {
+                return new Saver( *this );
+            }
+        public:
+            double  m_fSaveDuration;
+            size_t  m_nSaved;
+            size_t  m_nError;
+
+        public:
+            Saver( CppUnitMini::ThreadPool& pool, Map& rMap )
+                : CppUnitMini::TestThread( pool )
+                , m_Map( rMap )
+            {}
+            Saver( Saver& src )
+                : CppUnitMini::TestThread( src )
+                , m_Map( src.m_Map )
+            {}
+
+            Map_Snapshot&  getTest()
+            {
+                return reinterpret_cast<Map_Snapshot&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                cds::OS::Timer  timer;
+
+                m_fSaveDuration = 0;
+                m_nSaved = 0;
+                m_nError = 0;
+                for ( size_t nPass = 0; nPass < c_nPassCount; ++nPass ) {
+                    timer.reset();
+                    m_nSaved += cds::container::snapshot::save( m_Map, c_strFileName.c_str() );
+                    m_fSaveDuration += timer.duration();
+
+                    // All keys of [0, c_nMapSize) should be in the snapshot
+                    loader ld( c_strFileName.c_str() );
+                    size_t nCount = 0;
+                    for ( loader::iterator it = ld.begin(), itEnd = ld.end(); it != itEnd; ++it ) {
+                        if ( it->first < c_nMapSize ) {
+                            ++nCount;
+                            if ( it->second != it->first * 8 )
+                                ++m_nError;
+                        }
+                    }
+                    if ( nCount != c_nMapSize )
+                        ++m_nError;
+                }
+
+                getTest().m_bSaveDone.store( true, atomics::memory_order_release );
+            }
+        };
+
+    protected:
+        atomics::atomic<bool>   m_bSaveDone;
+
+        template <class Map>
+        void do_test( Map& testMap, Map& loadMap )
+        {
+            typedef Writer<Map> writer_thread;
+            typedef Saver<Map>  saver_thread;
+
+            cds::OS::Timer  timer;
+
+            for ( size_t i = 0; i < c_nMapSize; ++i )
+                testMap.insert( i, i * 8 );
+
+            m_bSaveDone.store( false, atomics::memory_order_release );
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new writer_thread( pool, testMap ), c_nThreadCount );
+            pool.add( new saver_thread( pool, testMap ), 1 );
+            pool.run();
+
+            size_t nInsertSuccess = 0;
+            size_t nEraseSuccess = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                saver_thread * pSaver = dynamic_cast<saver_thread *>( *it );
+                if ( pSaver ) {
+                    CPPUNIT_MSG( "   Save: pass count=" << c_nPassCount
+                        << " saved items=" << pSaver->m_nSaved
+                        << " duration=" << pSaver->m_fSaveDuration );
+                    CPPUNIT_CHECK_EX( pSaver->m_nError == 0, "Saver errors=" << pSaver->m_nError );
+                }
+                else {
+                    writer_thread * pWriter = static_cast<writer_thread *>( *it );
+                    nInsertSuccess += pWriter->m_nInsertSuccess;
+                    nEraseSuccess += pWriter->m_nEraseSuccess;
+                }
+            }
+            CPPUNIT_MSG( "   Writers: insert=" << nInsertSuccess << " erase=" << nEraseSuccess );
+
+            timer.reset();
+            size_t nLoaded = cds::container::snapshot::load( loadMap, c_strFileName.c_str() );
+            CPPUNIT_MSG( "   Load by insert: items=" << nLoaded << " duration=" << timer.duration() );
+            CPPUNIT_CHECK( nLoaded >= c_nMapSize );
+            CPPUNIT_CHECK( loadMap.size() == nLoaded );
+
+            testMap.clear();
+            loadMap.clear();
+            additional_check( testMap );
+            print_stat( testMap );
+            additional_cleanup( testMap );
+        }
+
+        template <class Map>
+        void test()
+        {
+            CPPUNIT_MSG( "Writer thread count=" << c_nThreadCount
+                << " map size=" << c_nMapSize
+                << " load factor=" << c_nLoadFactor
+                );
+
+            Map  testMap( c_nMapSize, c_nLoadFactor );
+            Map  loadMap( c_nMapSize, c_nLoadFactor );
+            do_test( testMap, loadMap );
+            if ( c_bPrintGCState )
+                print_gc_state();
+        }
+
+        template <class Map>
+        void test_nolf()
+        {
+            CPPUNIT_MSG( "Writer thread count=" << c_nThreadCount
+                << " map size=" << c_nMapSize
+                );
+
+            Map  testMap;
+            Map  loadMap;
+            do_test( testMap, loadMap );
+            if ( c_bPrintGCState )
+                print_gc_state();
+        }
+
+        // Loads the snapshot saved by do_test() by bulk-load constructor of the map
+        template <class Map>
+        void test_bulk()
+        {
+            cds::OS::Timer  timer;
+            {
+                loader ld( c_strFileName.c_str() );
+                CPPUNIT_MSG( "   Map file: duration=" << timer.duration() );
+
+                timer.reset();
+                std::unique_ptr<Map> pMap( new Map( ld.begin(), ld.end() ));
+                CPPUNIT_MSG( "   Bulk load: items=" << ld.size() << " duration=" << timer.duration() );
+                CPPUNIT_CHECK( pMap->size() == ld.size() );
+                for ( size_t i = 0; i < c_nMapSize; ++i )
+                    CPPUNIT_CHECK( pMap->find( i ));
+            }
+            std::remove( c_strFileName.c_str() );
+            if ( c_bPrintGCState )
+                print_gc_state();
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            c_nThreadCount = cfg.getULong("ThreadCount", 4 );
+            c_nMapSize = cfg.getULong("MapSize", 1000000 );
+            c_nPassCount = cfg.getULong("PassCount", 4 );
+            c_nLoadFactor = cfg.getULong("LoadFactor", 2 );
+            c_strFileName = cfg.get("FileName", std::string( "map_snapshot.tmp" ));
+            c_bPrintGCState = cfg.getBool("PrintGCStateFlag", true );
+            if ( c_nThreadCount == 0 )
+                c_nThreadCount = cds::OS::topology::processor_count();
+            if ( c_nPassCount == 0 )
+                c_nPassCount = 1;
+            if ( c_nLoadFactor == 0 )
+                c_nLoadFactor = 1;
+        }
+
+        TEST_MAP(MichaelMap_HP_cmp_stdAlloc)
+        TEST_MAP(MichaelMap_PTB_cmp_stdAlloc)
+        TEST_MAP_BULK(SplitList_Michael_HP_dyn_cmp)
+        TEST_MAP_BULK(SplitList_Michael_HP_st_cmp)
+        TEST_MAP_BULK(SplitList_Michael_PTB_dyn_cmp)
+        TEST_MAP_NOLF_BULK(SkipListMap_hp_less_pascal)
+        TEST_MAP_NOLF_BULK(SkipListMap_hp_cmp_xorshift_stat)
+        TEST_MAP_NOLF_BULK(SkipListMap_ptb_less_pascal)
+        TEST_MAP(CuckooStripedMap_list_unord)
+        TEST_MAP(CuckooRefinableMap_list_unord)
+
+        CPPUNIT_TEST_SUITE( Map_Snapshot )
+            CPPUNIT_TEST(MichaelMap_HP_cmp_stdAlloc)
+            CPPUNIT_TEST(MichaelMap_PTB_cmp_stdAlloc)
+            CPPUNIT_TEST(SplitList_Michael_HP_dyn_cmp)
+            CPPUNIT_TEST(SplitList_Michael_HP_st_cmp)
+            CPPUNIT_TEST(SplitList_Michael_PTB_dyn_cmp)
+            CPPUNIT_TEST(SkipListMap_hp_less_pascal)
+            CPPUNIT_TEST(SkipListMap_hp_cmp_xorshift_stat)
+            CPPUNIT_TEST(SkipListMap_ptb_less_pascal)
+            CPPUNIT_TEST(CuckooStripedMap_list_unord)
+            CPPUNIT_TEST(CuckooRefinableMap_list_unord)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+    CPPUNIT_TEST_SUITE_REGISTRATION( Map_Snapshot );
+} // namespace map2
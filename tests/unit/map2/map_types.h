@@ -43,6 +43,9 @@
 #include <cds/container/ellen_bintree_map_rcu.h>
 #include <cds/container/ellen_bintree_map_hp.h>
 #include <cds/container/ellen_bintree_map_ptb.h>
+#include <cds/container/bplus_tree_map_rcu.h>
+#include <cds/container/art_map_rcu.h>
+#include <cds/container/fat_skip_list_map_rcu.h>
 
 #include <boost/version.hpp>
 #if BOOST_VERSION >= 104800
@@ -5099,6 +5102,88 @@ namespace map2 {
 
 #endif
 
+        // ***************************************************************************
+        // BPlusTreeMap
+
+        struct traits_BPlusTreeMap: public cc::bplus_tree::make_traits<
+                co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        {};
+        struct traits_BPlusTreeMap_stat: public cc::bplus_tree::make_traits<
+                co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::bplus_tree::stat<> >
+            >::type
+        {};
+
+        typedef cc::BPlusTreeMap< rcu_gpi, Key, Value, traits_BPlusTreeMap >       BPlusTreeMap_rcu_gpi;
+        typedef cc::BPlusTreeMap< rcu_gpi, Key, Value, traits_BPlusTreeMap_stat >  BPlusTreeMap_rcu_gpi_stat;
+        typedef cc::BPlusTreeMap< rcu_gpb, Key, Value, traits_BPlusTreeMap >       BPlusTreeMap_rcu_gpb;
+        typedef cc::BPlusTreeMap< rcu_gpb, Key, Value, traits_BPlusTreeMap_stat >  BPlusTreeMap_rcu_gpb_stat;
+        typedef cc::BPlusTreeMap< rcu_gpt, Key, Value, traits_BPlusTreeMap >       BPlusTreeMap_rcu_gpt;
+        typedef cc::BPlusTreeMap< rcu_gpt, Key, Value, traits_BPlusTreeMap_stat >  BPlusTreeMap_rcu_gpt_stat;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cc::BPlusTreeMap< rcu_shb, Key, Value, traits_BPlusTreeMap >       BPlusTreeMap_rcu_shb;
+        typedef cc::BPlusTreeMap< rcu_shb, Key, Value, traits_BPlusTreeMap_stat >  BPlusTreeMap_rcu_shb_stat;
+        typedef cc::BPlusTreeMap< rcu_sht, Key, Value, traits_BPlusTreeMap >       BPlusTreeMap_rcu_sht;
+        typedef cc::BPlusTreeMap< rcu_sht, Key, Value, traits_BPlusTreeMap_stat >  BPlusTreeMap_rcu_sht_stat;
+#endif
+
+        // ***************************************************************************
+        // ArtMap
+
+        struct traits_ArtMap: public cc::art::make_traits<
+                co::item_counter< cds::atomicity::item_counter >
+            >::type
+        {};
+        struct traits_ArtMap_stat: public cc::art::make_traits<
+                co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::art::stat<> >
+            >::type
+        {};
+
+        typedef cc::ArtMap< rcu_gpi, Key, Value, traits_ArtMap >       ArtMap_rcu_gpi;
+        typedef cc::ArtMap< rcu_gpi, Key, Value, traits_ArtMap_stat >  ArtMap_rcu_gpi_stat;
+        typedef cc::ArtMap< rcu_gpb, Key, Value, traits_ArtMap >       ArtMap_rcu_gpb;
+        typedef cc::ArtMap< rcu_gpb, Key, Value, traits_ArtMap_stat >  ArtMap_rcu_gpb_stat;
+        typedef cc::ArtMap< rcu_gpt, Key, Value, traits_ArtMap >       ArtMap_rcu_gpt;
+        typedef cc::ArtMap< rcu_gpt, Key, Value, traits_ArtMap_stat >  ArtMap_rcu_gpt_stat;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cc::ArtMap< rcu_shb, Key, Value, traits_ArtMap >       ArtMap_rcu_shb;
+        typedef cc::ArtMap< rcu_shb, Key, Value, traits_ArtMap_stat >  ArtMap_rcu_shb_stat;
+        typedef cc::ArtMap< rcu_sht, Key, Value, traits_ArtMap >       ArtMap_rcu_sht;
+        typedef cc::ArtMap< rcu_sht, Key, Value, traits_ArtMap_stat >  ArtMap_rcu_sht_stat;
+#endif
+
+        // ***************************************************************************
+        // FatSkipListMap
+
+        struct traits_FatSkipListMap: public cc::fat_skip_list::make_traits<
+                co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        {};
+        struct traits_FatSkipListMap_stat: public cc::fat_skip_list::make_traits<
+                co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::fat_skip_list::stat<> >
+            >::type
+        {};
+
+        typedef cc::FatSkipListMap< rcu_gpi, Key, Value, traits_FatSkipListMap >       FatSkipListMap_rcu_gpi;
+        typedef cc::FatSkipListMap< rcu_gpi, Key, Value, traits_FatSkipListMap_stat >  FatSkipListMap_rcu_gpi_stat;
+        typedef cc::FatSkipListMap< rcu_gpb, Key, Value, traits_FatSkipListMap >       FatSkipListMap_rcu_gpb;
+        typedef cc::FatSkipListMap< rcu_gpb, Key, Value, traits_FatSkipListMap_stat >  FatSkipListMap_rcu_gpb_stat;
+        typedef cc::FatSkipListMap< rcu_gpt, Key, Value, traits_FatSkipListMap >       FatSkipListMap_rcu_gpt;
+        typedef cc::FatSkipListMap< rcu_gpt, Key, Value, traits_FatSkipListMap_stat >  FatSkipListMap_rcu_gpt_stat;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cc::FatSkipListMap< rcu_shb, Key, Value, traits_FatSkipListMap >       FatSkipListMap_rcu_shb;
+        typedef cc::FatSkipListMap< rcu_shb, Key, Value, traits_FatSkipListMap_stat >  FatSkipListMap_rcu_shb_stat;
+        typedef cc::FatSkipListMap< rcu_sht, Key, Value, traits_FatSkipListMap >       FatSkipListMap_rcu_sht;
+        typedef cc::FatSkipListMap< rcu_sht, Key, Value, traits_FatSkipListMap_stat >  FatSkipListMap_rcu_sht_stat;
+#endif
+
 
         // ***************************************************************************
         // Standard implementations
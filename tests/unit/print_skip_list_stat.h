@@ -49,7 +49,9 @@ namespace std {
             << "\t\t            m_nFastExtract: " << s.m_nFastExtract.get()             << "\n"
             << "\t\t            m_nSlowExtract: " << s.m_nSlowExtract.get()             << "\n"
             << "\t\t         m_nEraseWhileFind: " << s.m_nEraseWhileFind.get()          << "\n"
-            << "\t\t       m_nExtractWhileFind: " << s.m_nExtractWhileFind.get()        << "\n";
+            << "\t\t       m_nExtractWhileFind: " << s.m_nExtractWhileFind.get()        << "\n"
+            << "\t\t              m_nFingerHit: " << s.m_nFingerHit.get()               << "\n"
+            << "\t\t             m_nFingerMiss: " << s.m_nFingerMiss.get()              << "\n";
     }
 
     static inline ostream& operator <<( ostream& o, cds::intrusive::skip_list::empty_stat const& s )
@@ -7,6 +7,7 @@
 #define CDSUNIT_DECLARE_MoirQueue( ITEM_TYPE ) \
     TEST_CASE( MoirQueue_HP, ITEM_TYPE ) \
     TEST_CASE( MoirQueue_HP_michaelAlloc, ITEM_TYPE ) \
+    TEST_CASE( MoirQueue_HP_pool, ITEM_TYPE ) \
     TEST_CASE( MoirQueue_HP_seqcst, ITEM_TYPE ) \
     TEST_CASE( MoirQueue_HP_ic, ITEM_TYPE ) \
     TEST_CASE( MoirQueue_HP_stat, ITEM_TYPE ) \
@@ -24,6 +25,7 @@
 #define CDSUNIT_TEST_MoirQueue \
     CPPUNIT_TEST(MoirQueue_HP) \
     CPPUNIT_TEST(MoirQueue_HP_michaelAlloc) \
+    CPPUNIT_TEST(MoirQueue_HP_pool) \
     CPPUNIT_TEST(MoirQueue_HP_seqcst) \
     CPPUNIT_TEST(MoirQueue_HP_ic) \
     CPPUNIT_TEST(MoirQueue_HP_stat) \
@@ -42,6 +44,7 @@
 #define CDSUNIT_DECLARE_MSQueue( ITEM_TYPE ) \
     TEST_CASE( MSQueue_HP, ITEM_TYPE  ) \
     TEST_CASE( MSQueue_HP_michaelAlloc, ITEM_TYPE  ) \
+    TEST_CASE( MSQueue_HP_pool, ITEM_TYPE  ) \
     TEST_CASE( MSQueue_HP_seqcst, ITEM_TYPE  ) \
     TEST_CASE( MSQueue_HP_ic, ITEM_TYPE  ) \
     TEST_CASE( MSQueue_HP_stat, ITEM_TYPE  ) \
@@ -59,6 +62,7 @@
 #define CDSUNIT_TEST_MSQueue \
     CPPUNIT_TEST(MSQueue_HP) \
     CPPUNIT_TEST(MSQueue_HP_michaelAlloc) \
+    CPPUNIT_TEST(MSQueue_HP_pool) \
     CPPUNIT_TEST(MSQueue_HP_seqcst) \
     CPPUNIT_TEST(MSQueue_HP_ic) \
     CPPUNIT_TEST(MSQueue_HP_stat) \
@@ -78,6 +82,7 @@
 #define CDSUNIT_DECLARE_OptimisticQueue( ITEM_TYPE ) \
     TEST_CASE(OptimisticQueue_HP, ITEM_TYPE ) \
     TEST_CASE(OptimisticQueue_HP_michaelAlloc, ITEM_TYPE ) \
+    TEST_CASE(OptimisticQueue_HP_pool, ITEM_TYPE ) \
     TEST_CASE(OptimisticQueue_HP_seqcst, ITEM_TYPE ) \
     TEST_CASE(OptimisticQueue_HP_ic, ITEM_TYPE ) \
     TEST_CASE(OptimisticQueue_HP_stat, ITEM_TYPE ) \
@@ -90,6 +95,7 @@
 #define CDSUNIT_TEST_OptimisticQueue \
     CPPUNIT_TEST(OptimisticQueue_HP) \
     CPPUNIT_TEST(OptimisticQueue_HP_michaelAlloc) \
+    CPPUNIT_TEST(OptimisticQueue_HP_pool) \
     CPPUNIT_TEST(OptimisticQueue_HP_seqcst) \
     CPPUNIT_TEST(OptimisticQueue_HP_ic) \
     CPPUNIT_TEST(OptimisticQueue_HP_stat) \
@@ -104,6 +110,7 @@
 #define CDSUNIT_DECLARE_BasketQueue( ITEM_TYPE ) \
     TEST_CASE( BasketQueue_HP, ITEM_TYPE  ) \
     TEST_CASE( BasketQueue_HP_michaelAlloc, ITEM_TYPE ) \
+    TEST_CASE( BasketQueue_HP_pool, ITEM_TYPE ) \
     TEST_CASE( BasketQueue_HP_seqcst, ITEM_TYPE  ) \
     TEST_CASE( BasketQueue_HP_ic, ITEM_TYPE  ) \
     TEST_CASE( BasketQueue_HP_stat, ITEM_TYPE  ) \
@@ -121,6 +128,7 @@
 #define CDSUNIT_TEST_BasketQueue \
     CPPUNIT_TEST(BasketQueue_HP) \
     CPPUNIT_TEST(BasketQueue_HP_michaelAlloc) \
+    CPPUNIT_TEST(BasketQueue_HP_pool) \
     CPPUNIT_TEST(BasketQueue_HP_seqcst) \
     CPPUNIT_TEST(BasketQueue_HP_ic) \
     CPPUNIT_TEST(BasketQueue_HP_stat) \
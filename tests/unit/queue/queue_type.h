@@ -13,6 +13,7 @@
 #include <cds/container/fcqueue.h>
 #include <cds/container/fcdeque.h>
 #include <cds/container/segmented_queue.h>
+#include <cds/memory/vyukov_queue_pool.h>
 
 #include <cds/gc/hp.h>
 #include <cds/gc/hrc.h>
@@ -110,6 +111,11 @@ namespace queue {
             ,cds::opt::allocator< memory::MichaelAllocator<int> >
         >   MSQueue_HP_michaelAlloc;
 
+        typedef cds::container::MSQueue<
+            cds::gc::HP , Value
+            ,cds::opt::node_pool< cds::memory::vyukov_queue_node_pool<> >
+        >   MSQueue_HP_pool;
+
         typedef cds::container::MSQueue<
             cds::gc::HP, Value
             ,cds::opt::memory_model< cds::opt::v::sequential_consistent >
@@ -186,6 +192,11 @@ namespace queue {
             ,cds::opt::allocator< memory::MichaelAllocator<int> >
         >   MoirQueue_HP_michaelAlloc;
 
+        typedef cds::container::MoirQueue<
+            cds::gc::HP , Value
+            ,cds::opt::node_pool< cds::memory::vyukov_queue_node_pool<> >
+        >   MoirQueue_HP_pool;
+
         typedef cds::container::MoirQueue< cds::gc::HP,
             Value
             ,cds::opt::memory_model< cds::opt::v::sequential_consistent >
@@ -261,6 +272,11 @@ namespace queue {
             ,cds::opt::allocator< memory::MichaelAllocator<int> >
         >   OptimisticQueue_HP_michaelAlloc;
 
+        typedef cds::container::OptimisticQueue<
+            cds::gc::HP , Value
+            ,cds::opt::node_pool< cds::memory::vyukov_queue_node_pool<> >
+        >   OptimisticQueue_HP_pool;
+
         typedef cds::container::OptimisticQueue< cds::gc::HP,
             Value
             ,cds::opt::memory_model< cds::opt::v::sequential_consistent >
@@ -467,6 +483,11 @@ namespace queue {
             ,cds::opt::allocator< memory::MichaelAllocator<int> >
         >   BasketQueue_HP_michaelAlloc;
 
+        typedef cds::container::BasketQueue<
+            cds::gc::HP , Value
+            ,cds::opt::node_pool< cds::memory::vyukov_queue_node_pool<> >
+        >   BasketQueue_HP_pool;
+
         typedef cds::container::BasketQueue<
             cds::gc::HP, Value
             ,cds::opt::memory_model< cds::opt::v::sequential_consistent >
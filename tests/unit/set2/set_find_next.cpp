@@ -0,0 +1,462 @@
+//$$CDS-header$$
+
+#include "cppunit/thread.h"
+#include "set2/set_types.h"
+#include <algorithm> // random_shuffle
+
+namespace set2 {
+
+#   define TEST_SET(X)          void X() { test<SetTypes<key_type, value_type>::X >()    ; }
+#   define TEST_SET_EXTRACT(X)  TEST_SET(X)
+#   define TEST_SET_NOLF(X)     TEST_SET(X)
+#   define TEST_SET_NOLF_EXTRACT(X) TEST_SET(X)
+
+    namespace {
+        static size_t  c_nSetSize = 100000          ;  // max count of the keys
+        static size_t  c_nInsThreadCount = 2        ;  // insert thread count
+        static size_t  c_nDelThreadCount = 2        ;  // delete thread count
+        static size_t  c_nFindThreadCount = 4       ;  // find_next/find_prev thread count
+        static size_t  c_nPassCount = 4             ;  // insert/delete pass count
+        static bool    c_bPrintGCState = true;
+
+        // Each key multiple of c_nAnchorStep is inserted before the test and is never deleted
+        static size_t const c_nAnchorStep = 32;
+    }
+
+    // Returns in \p nResult the successor of \p nKey
+    template <typename GC, typename Key, typename T, typename Traits>
+    static inline bool find_next_key( cds::container::EllenBinTreeSet<GC, Key, T, Traits>& s, size_t nKey, size_t& nResult )
+    {
+        typename cds::container::EllenBinTreeSet<GC, Key, T, Traits>::guarded_ptr gp;
+        if ( s.find_next( gp, nKey )) {
+            nResult = gp->key;
+            return true;
+        }
+        return false;
+    }
+
+    template <typename RCU, typename Key, typename T, typename Traits>
+    static inline bool find_next_key( cds::container::EllenBinTreeSet<cds::urcu::gc<RCU>, Key, T, Traits>& s, size_t nKey, size_t& nResult )
+    {
+        typename cds::container::EllenBinTreeSet<cds::urcu::gc<RCU>, Key, T, Traits>::rcu_lock l;
+        typename cds::container::EllenBinTreeSet<cds::urcu::gc<RCU>, Key, T, Traits>::value_type * p = s.find_next( nKey );
+        if ( p ) {
+            nResult = p->key;
+            return true;
+        }
+        return false;
+    }
+
+    // Returns in \p nResult the predecessor of \p nKey
+    template <typename GC, typename Key, typename T, typename Traits>
+    static inline bool find_prev_key( cds::container::EllenBinTreeSet<GC, Key, T, Traits>& s, size_t nKey, size_t& nResult )
+    {
+        typename cds::container::EllenBinTreeSet<GC, Key, T, Traits>::guarded_ptr gp;
+        if ( s.find_prev( gp, nKey )) {
+            nResult = gp->key;
+            return true;
+        }
+        return false;
+    }
+
+    template <typename RCU, typename Key, typename T, typename Traits>
+    static inline bool find_prev_key( cds::container::EllenBinTreeSet<cds::urcu::gc<RCU>, Key, T, Traits>& s, size_t nKey, size_t& nResult )
+    {
+        typename cds::container::EllenBinTreeSet<cds::urcu::gc<RCU>, Key, T, Traits>::rcu_lock l;
+        typename cds::container::EllenBinTreeSet<cds::urcu::gc<RCU>, Key, T, Traits>::value_type * p = s.find_prev( nKey );
+        if ( p ) {
+            nResult = p->key;
+            return true;
+        }
+        return false;
+    }
+
+    // Concurrent find_next/find_prev test for EllenBinTreeSet
+    // Only even keys from [0, 2 * c_nSetSize) are inserted into the set.
+    // The anchor keys (multiples of c_nAnchorStep) are inserted before the test and are never deleted,
+    // other even keys are inserted and deleted by insert and delete threads.
+    // Find threads search the successor and the predecessor of random keys and check that
+    // - the key found is strictly greater (less) than the key searched;
+    // - the key found is even and is in the key range, i.e. it could be inserted;
+    // - the key found is not beyond the nearest anchor key, i.e. the search does not skip the items
+    class Set_FindNext: public CppUnitMini::TestCase
+    {
+        std::vector<size_t>     m_arrData;
+
+    protected:
+        typedef size_t  key_type;
+        typedef size_t  value_type;
+
+        atomics::atomic<size_t>      m_nWriterThreadCount;
+
+        static size_t max_key()
+        {
+            return c_nSetSize * 2;
+        }
+
+        static size_t last_anchor()
+        {
+            return ( max_key() - 1 ) / c_nAnchorStep * c_nAnchorStep;
+        }
+
+        // Checks the successor \p nResult of \p nKey
+        static bool check_next( size_t nKey, bool bFound, size_t nResult )
+        {
+            if ( !bFound )
+                return nKey >= last_anchor();
+
+            size_t const nAnchor = nKey / c_nAnchorStep * c_nAnchorStep + c_nAnchorStep;
+            return nResult > nKey
+                && ( nResult & 1 ) == 0
+                && nResult < max_key()
+                && ( nAnchor > last_anchor() || nResult <= nAnchor );
+        }
+
+        // Checks the predecessor \p nResult of \p nKey
+        static bool check_prev( size_t nKey, bool bFound, size_t nResult )
+        {
+            if ( !bFound )
+                return nKey == 0;
+
+            size_t const nAnchor = std::min( ( nKey - 1 ) / c_nAnchorStep * c_nAnchorStep, last_anchor() );
+            return nKey > 0
+                && nResult < nKey
+                && ( nResult & 1 ) == 0
+                && nResult >= nAnchor;
+        }
+
+        // Inserts non-anchor even keys
+        template <class Set>
+        class InsertThread: public CppUnitMini::TestThread
+        {
+            Set&     m_Set;
+
+            virtual InsertThread *    clone()
+            {
+                return new InsertThread( *this );
+            }
+        public:
+            size_t  m_nInsertSuccess;
+            size_t  m_nInsertFailed;
+
+        public:
+            InsertThread( CppUnitMini::ThreadPool& pool, Set& rSet )
+                : CppUnitMini::TestThread( pool )
+                , m_Set( rSet )
+            {}
+            InsertThread( InsertThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Set( src.m_Set )
+            {}
+
+            Set_FindNext&  getTest()
+            {
+                return reinterpret_cast<Set_FindNext&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                Set& rSet = m_Set;
+
+                m_nInsertSuccess =
+                    m_nInsertFailed = 0;
+
+                std::vector<size_t>& arrData = getTest().m_arrData;
+                for ( size_t nPass = 0; nPass < c_nPassCount; ++nPass ) {
+                    for ( size_t i = 0; i < arrData.size(); ++i ) {
+                        if ( rSet.insert( arrData[i] ))
+                            ++m_nInsertSuccess;
+                        else
+                            ++m_nInsertFailed;
+                    }
+                }
+
+                getTest().m_nWriterThreadCount.fetch_sub( 1, atomics::memory_order_release );
+            }
+        };
+
+        // Deletes non-anchor even keys
+        template <class Set>
+        class DeleteThread: public CppUnitMini::TestThread
+        {
+            Set&     m_Set;
+
+            virtual DeleteThread *    clone()
+            {
+                return new DeleteThread( *this );
+            }
+        public:
+            size_t  m_nDeleteSuccess;
+            size_t  m_nDeleteFailed;
+
+        public:
+            DeleteThread( CppUnitMini::ThreadPool& pool, Set& rSet )
+                : CppUnitMini::TestThread( pool )
+                , m_Set( rSet )
+            {}
+            DeleteThread( DeleteThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Set( src.m_Set )
+            {}
+
+            Set_FindNext&  getTest()
+            {
+                return reinterpret_cast<Set_FindNext&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                Set& rSet = m_Set;
+
+                m_nDeleteSuccess =
+                    m_nDeleteFailed = 0;
+
+                std::vector<size_t>& arrData = getTest().m_arrData;
+                for ( size_t nPass = 0; nPass < c_nPassCount; ++nPass ) {
+                    for ( size_t i = arrData.size(); i > 0; --i ) {
+                        if ( rSet.erase( arrData[i - 1] ))
+                            ++m_nDeleteSuccess;
+                        else
+                            ++m_nDeleteFailed;
+                    }
+                }
+
+                getTest().m_nWriterThreadCount.fetch_sub( 1, atomics::memory_order_release );
+            }
+        };
+
+        // Searches the successor and the predecessor of random keys while the writers are running
+        template <class Set>
+        class FindThread: public CppUnitMini::TestThread
+        {
+            Set&     m_Set;
+
+            virtual FindThread *    clone()
+            {
+                return new FindThread( *this );
+            }
+        public:
+            size_t  m_nFindNextSuccess;
+            size_t  m_nFindNextFailed;
+            size_t  m_nFindPrevSuccess;
+            size_t  m_nFindPrevFailed;
+            size_t  m_nError;
+
+        public:
+            FindThread( CppUnitMini::ThreadPool& pool, Set& rSet )
+                : CppUnitMini::TestThread( pool )
+                , m_Set( rSet )
+            {}
+            FindThread( FindThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Set( src.m_Set )
+            {}
+
+            Set_FindNext&  getTest()
+            {
+                return reinterpret_cast<Set_FindNext&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                Set& rSet = m_Set;
+
+                m_nFindNextSuccess =
+                    m_nFindNextFailed =
+                    m_nFindPrevSuccess =
+                    m_nFindPrevFailed =
+                    m_nError = 0;
+
+                // The keys searched are from [0, max_key() + c_nAnchorStep)
+                size_t const nKeyRange = max_key() + c_nAnchorStep;
+                size_t nRand = m_nThreadNo;
+                do {
+                    for ( size_t i = 0; i < 1000; ++i ) {
+                        nRand = cds::bitop::RandXorShift( nRand );
+                        size_t const nKey = nRand % nKeyRange;
+                        size_t nResult = 0;
+
+                        bool bFound = find_next_key( rSet, nKey, nResult );
+                        if ( bFound )
+                            ++m_nFindNextSuccess;
+                        else
+                            ++m_nFindNextFailed;
+                        if ( !check_next( nKey, bFound, nResult )) {
+                            if ( ++m_nError < 10 )
+                                CPPUNIT_MSG( "find_next(" << nKey << ") error: found=" << bFound << ", result=" << nResult );
+                        }
+
+                        bFound = find_prev_key( rSet, nKey, nResult );
+                        if ( bFound )
+                            ++m_nFindPrevSuccess;
+                        else
+                            ++m_nFindPrevFailed;
+                        if ( !check_prev( nKey, bFound, nResult )) {
+                            if ( ++m_nError < 10 )
+                                CPPUNIT_MSG( "find_prev(" << nKey << ") error: found=" << bFound << ", result=" << nResult );
+                        }
+                    }
+                } while ( getTest().m_nWriterThreadCount.load( atomics::memory_order_acquire ) != 0 );
+            }
+        };
+
+    protected:
+        template <class Set>
+        void do_test_with( Set& testSet )
+        {
+            typedef InsertThread<Set> insert_thread;
+            typedef DeleteThread<Set> delete_thread;
+            typedef FindThread<Set>   find_thread;
+
+            for ( size_t nKey = 0; nKey < max_key(); nKey += c_nAnchorStep )
+                CPPUNIT_ASSERT( testSet.insert( nKey ));
+
+            m_nWriterThreadCount.store( c_nInsThreadCount + c_nDelThreadCount, atomics::memory_order_release );
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new insert_thread( pool, testSet ), c_nInsThreadCount );
+            pool.add( new delete_thread( pool, testSet ), c_nDelThreadCount );
+            pool.add( new find_thread( pool, testSet ), c_nFindThreadCount );
+            pool.run();
+            CPPUNIT_MSG( "   Duration=" << pool.avgDuration() );
+
+            size_t nInsertSuccess = 0;
+            size_t nInsertFailed = 0;
+            size_t nDeleteSuccess = 0;
+            size_t nDeleteFailed = 0;
+            size_t nFindNextSuccess = 0;
+            size_t nFindNextFailed = 0;
+            size_t nFindPrevSuccess = 0;
+            size_t nFindPrevFailed = 0;
+            size_t nError = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                insert_thread * pThread = dynamic_cast<insert_thread *>( *it );
+                if ( pThread ) {
+                    nInsertSuccess += pThread->m_nInsertSuccess;
+                    nInsertFailed += pThread->m_nInsertFailed;
+                    continue;
+                }
+                delete_thread * pDel = dynamic_cast<delete_thread *>( *it );
+                if ( pDel ) {
+                    nDeleteSuccess += pDel->m_nDeleteSuccess;
+                    nDeleteFailed += pDel->m_nDeleteFailed;
+                    continue;
+                }
+                find_thread * pFind = static_cast<find_thread *>( *it );
+                nFindNextSuccess += pFind->m_nFindNextSuccess;
+                nFindNextFailed += pFind->m_nFindNextFailed;
+                nFindPrevSuccess += pFind->m_nFindPrevSuccess;
+                nFindPrevFailed += pFind->m_nFindPrevFailed;
+                nError += pFind->m_nError;
+            }
+
+            CPPUNIT_MSG( "  Totals (success/failed): \n\t"
+                << "      Insert=" << nInsertSuccess << '/' << nInsertFailed << "\n\t"
+                << "      Delete=" << nDeleteSuccess << '/' << nDeleteFailed << "\n\t"
+                << "   find_next=" << nFindNextSuccess << '/' << nFindNextFailed << "\n\t"
+                << "   find_prev=" << nFindPrevSuccess << '/' << nFindPrevFailed
+                );
+            CPPUNIT_CHECK_EX( nError == 0, "find_next/find_prev errors: " << nError );
+
+            // The successor chain from the minimal key must be strictly ascending and must contain all anchor keys
+            {
+                size_t nKey = 0;
+                size_t nNext = 0;
+                size_t nAnchorCount = 1;
+                size_t nOrderError = 0;
+                while ( find_next_key( testSet, nKey, nNext )) {
+                    if ( !check_next( nKey, true, nNext ))
+                        ++nOrderError;
+                    if ( nNext % c_nAnchorStep == 0 )
+                        ++nAnchorCount;
+                    nKey = nNext;
+                }
+                CPPUNIT_CHECK_EX( nOrderError == 0, "Successor chain errors: " << nOrderError );
+                CPPUNIT_CHECK_EX( nAnchorCount == last_anchor() / c_nAnchorStep + 1, "Anchor count=" << nAnchorCount );
+            }
+
+            CPPUNIT_CHECK( testSet.check_consistency() );
+        }
+
+        template <class Set>
+        void test()
+        {
+            CPPUNIT_MSG( "Insert thread count=" << c_nInsThreadCount
+                << " delete thread count=" << c_nDelThreadCount
+                << " find thread count=" << c_nFindThreadCount
+                << " set size=" << c_nSetSize
+                << " pass count=" << c_nPassCount
+                );
+
+            {
+                Set s;
+                do_test_with( s );
+
+                s.clear();
+                CPPUNIT_CHECK( s.empty() );
+
+                additional_check( s );
+                print_stat( s );
+                additional_cleanup( s );
+            }
+
+            if ( c_bPrintGCState )
+                print_gc_state();
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            c_nSetSize = cfg.getULong("SetSize", static_cast<unsigned long>(c_nSetSize) );
+            c_nInsThreadCount = cfg.getULong("InsThreadCount", static_cast<unsigned long>(c_nInsThreadCount) );
+            c_nDelThreadCount = cfg.getULong("DelThreadCount", static_cast<unsigned long>(c_nDelThreadCount) );
+            c_nFindThreadCount = cfg.getULong("FindThreadCount", static_cast<unsigned long>(c_nFindThreadCount) );
+            c_nPassCount = cfg.getULong("PassCount", static_cast<unsigned long>(c_nPassCount) );
+            c_bPrintGCState = cfg.getBool("PrintGCStateFlag", true );
+
+            if ( c_nInsThreadCount == 0 )
+                c_nInsThreadCount = 1;
+            if ( c_nDelThreadCount == 0 )
+                c_nDelThreadCount = 1;
+            if ( c_nFindThreadCount == 0 )
+                c_nFindThreadCount = cds::OS::topology::processor_count();
+            if ( c_nSetSize < c_nAnchorStep )
+                c_nSetSize = c_nAnchorStep;
+
+            m_arrData.clear();
+            for ( size_t nKey = 0; nKey < max_key(); nKey += 2 ) {
+                if ( nKey % c_nAnchorStep != 0 )
+                    m_arrData.push_back( nKey );
+            }
+            std::random_shuffle( m_arrData.begin(), m_arrData.end() );
+        }
+
+#   include "set2/set_defs.h"
+        CDSUNIT_DECLARE_EllenBinTreeSet
+
+        // rcu_gpi is skipped: each erase waits for the RCU grace period
+        // that is extremely slow while find threads are running
+        CPPUNIT_TEST_SUITE( Set_FindNext )
+            CPPUNIT_TEST(EllenBinTreeSet_hp)
+            CPPUNIT_TEST(EllenBinTreeSet_hp_stat)
+            CPPUNIT_TEST(EllenBinTreeSet_ptb)
+            CPPUNIT_TEST(EllenBinTreeSet_ptb_stat)
+            /*CPPUNIT_TEST(EllenBinTreeSet_rcu_gpi)*/
+            /*CPPUNIT_TEST(EllenBinTreeSet_rcu_gpi_stat)*/
+            CPPUNIT_TEST(EllenBinTreeSet_rcu_gpb)
+            CPPUNIT_TEST(EllenBinTreeSet_rcu_gpb_stat)
+            CPPUNIT_TEST(EllenBinTreeSet_rcu_gpt)
+            CPPUNIT_TEST(EllenBinTreeSet_rcu_gpt_stat)
+            CDSUNIT_TEST_EllenBinTreeSet_RCU_signal
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+    CPPUNIT_TEST_SUITE_REGISTRATION( Set_FindNext );
+} // namespace set2
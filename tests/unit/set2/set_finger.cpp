@@ -0,0 +1,267 @@
+//$$CDS-header$$
+
+#include "set2/set_types.h"
+#include "cppunit/thread.h"
+#include <algorithm> // random_shuffle
+
+namespace set2 {
+
+#   define TEST_SET(X)          void X() { test<SetTypes<key_type, value_type>::X >()    ; }
+
+    namespace {
+        static size_t  c_nSetSize = 500000      ;  // total set size
+        static size_t  c_nThreadCount = 4       ;  // thread count
+        static size_t  c_nPassCount = 4         ;  // search pass count
+        static size_t  c_nClusterSize = 16      ;  // size of the cluster of the keys for clustered search
+        static bool    c_bPrintGCState = true;
+    }
+
+    // Search finger benchmark for SkipListSet
+    // Each thread works with its own contiguous range of the keys and accesses the keys
+    // in ascending order (sequential stream) or in ascending order of the clusters
+    // with random order inside each cluster (clustered stream).
+    // Each stream is processed with and without the finger
+    class Set_Finger: public CppUnitMini::TestCase
+    {
+    protected:
+        typedef size_t  key_type;
+        typedef size_t  value_type;
+
+        enum {
+            seq_insert,
+            seq_find,
+            cluster_find,
+            seq_erase,
+
+            stream_count
+        };
+
+        template <class Set>
+        class WorkThread: public CppUnitMini::TestThread
+        {
+            Set&     m_Set;
+
+            virtual WorkThread *    clone()
+            {
+                return new WorkThread( *this );
+            }
+
+            // Returns the key of the clustered stream
+            size_t cluster_key( size_t i ) const
+            {
+                return m_nFirst + ( i - i % c_nClusterSize ) + m_arrCluster[ i % c_nClusterSize ];
+            }
+
+        public:
+            size_t  m_nFirst;
+            size_t  m_nLast;
+            std::vector<size_t> m_arrCluster;
+
+            double  m_arrDuration[stream_count][2]; // [stream][0 - w/o finger, 1 - with finger]
+            size_t  m_nError;
+
+        public:
+            WorkThread( CppUnitMini::ThreadPool& pool, Set& s )
+                : CppUnitMini::TestThread( pool )
+                , m_Set( s )
+            {}
+            WorkThread( WorkThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Set( src.m_Set )
+            {}
+
+            Set_Finger&  getTest()
+            {
+                return reinterpret_cast<Set_Finger&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                Set& rSet = m_Set;
+                size_t const nSize = m_nLast - m_nFirst;
+                cds::OS::Timer  timer;
+
+                m_nError = 0;
+                for ( size_t i = 0; i < stream_count; ++i )
+                    m_arrDuration[i][0] = m_arrDuration[i][1] = 0;
+
+                m_arrCluster.resize( c_nClusterSize );
+                for ( size_t i = 0; i < c_nClusterSize; ++i )
+                    m_arrCluster[i] = i;
+                std::random_shuffle( m_arrCluster.begin(), m_arrCluster.end() );
+
+                for ( size_t nPass = 0; nPass < c_nPassCount; ++nPass ) {
+                    {
+                        typename Set::finger f;
+                        bool const bFinger = (nPass & 1) != 0;
+
+                        // sequential insert
+                        timer.reset();
+                        if ( bFinger ) {
+                            for ( size_t nKey = m_nFirst; nKey < m_nLast; ++nKey ) {
+                                if ( !rSet.insert( f, nKey ))
+                                    ++m_nError;
+                            }
+                        }
+                        else {
+                            for ( size_t nKey = m_nFirst; nKey < m_nLast; ++nKey ) {
+                                if ( !rSet.insert( nKey ))
+                                    ++m_nError;
+                            }
+                        }
+                        m_arrDuration[seq_insert][bFinger ? 1 : 0] += timer.duration();
+
+                        // sequential find; w/o finger and with finger in turn
+                        for ( size_t k = 0; k < 2; ++k ) {
+                            timer.reset();
+                            if ( k ) {
+                                f.reset();
+                                for ( size_t nKey = m_nFirst; nKey < m_nLast; ++nKey ) {
+                                    if ( !rSet.find( f, nKey ))
+                                        ++m_nError;
+                                }
+                            }
+                            else {
+                                for ( size_t nKey = m_nFirst; nKey < m_nLast; ++nKey ) {
+                                    if ( !rSet.find( nKey ))
+                                        ++m_nError;
+                                }
+                            }
+                            m_arrDuration[seq_find][k] += timer.duration();
+                        }
+
+                        // clustered find
+                        size_t const nClusterEnd = nSize - nSize % c_nClusterSize;
+                        for ( size_t k = 0; k < 2; ++k ) {
+                            timer.reset();
+                            if ( k ) {
+                                f.reset();
+                                for ( size_t i = 0; i < nClusterEnd; ++i ) {
+                                    if ( !rSet.find( f, cluster_key( i )))
+                                        ++m_nError;
+                                }
+                            }
+                            else {
+                                for ( size_t i = 0; i < nClusterEnd; ++i ) {
+                                    if ( !rSet.find( cluster_key( i )))
+                                        ++m_nError;
+                                }
+                            }
+                            m_arrDuration[cluster_find][k] += timer.duration();
+                        }
+                    }
+
+                    // erase
+                    timer.reset();
+                    for ( size_t nKey = m_nFirst; nKey < m_nLast; ++nKey ) {
+                        if ( !rSet.erase( nKey ))
+                            ++m_nError;
+                    }
+                    m_arrDuration[seq_erase][0] += timer.duration();
+                }
+            }
+        };
+
+    protected:
+        template <class Set>
+        void do_test( Set& testSet )
+        {
+            typedef WorkThread<Set> work_thread;
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new work_thread( pool, testSet ), c_nThreadCount );
+
+            size_t const nRange = c_nSetSize / c_nThreadCount;
+            size_t nFirst = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                work_thread * pThread = static_cast<work_thread *>( *it );
+                pThread->m_nFirst = nFirst;
+                pThread->m_nLast = nFirst += nRange;
+            }
+
+            pool.run();
+            CPPUNIT_MSG( "   Duration=" << pool.avgDuration() );
+
+            double arrDuration[stream_count][2];
+            for ( size_t i = 0; i < stream_count; ++i )
+                arrDuration[i][0] = arrDuration[i][1] = 0;
+            size_t nError = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                work_thread * pThread = static_cast<work_thread *>( *it );
+                for ( size_t i = 0; i < stream_count; ++i ) {
+                    arrDuration[i][0] += pThread->m_arrDuration[i][0];
+                    arrDuration[i][1] += pThread->m_arrDuration[i][1];
+                }
+                nError += pThread->m_nError;
+            }
+
+            // The duration is the sum over the threads, each insert stream is processed in half of the passes
+            CPPUNIT_MSG( "  Thread durations (w/o finger / with finger): \n\t"
+                      << "    Sequential insert=" << arrDuration[seq_insert][0]   << " / " << arrDuration[seq_insert][1]   << "\n\t"
+                      << "      Sequential find=" << arrDuration[seq_find][0]     << " / " << arrDuration[seq_find][1]     << "\n\t"
+                      << "       Clustered find=" << arrDuration[cluster_find][0] << " / " << arrDuration[cluster_find][1] << "\n\t"
+                      << "                Erase=" << arrDuration[seq_erase][0]
+                );
+
+            CPPUNIT_CHECK_EX( nError == 0, "Errors: " << nError );
+            CPPUNIT_CHECK( testSet.empty() );
+
+            additional_check( testSet );
+            print_stat( testSet );
+            additional_cleanup( testSet );
+        }
+
+        template <class Set>
+        void test()
+        {
+            CPPUNIT_MSG( "Thread count=" << c_nThreadCount
+                << " set size=" << c_nSetSize
+                << " pass count=" << c_nPassCount
+                << " cluster size=" << c_nClusterSize
+                );
+
+            Set s;
+            do_test( s );
+            if ( c_bPrintGCState )
+                print_gc_state();
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            c_nSetSize = cfg.getULong("SetSize", 500000 );
+            c_nThreadCount = cfg.getULong("ThreadCount", 4 );
+            c_nPassCount = cfg.getULong("PassCount", 4 );
+            c_nClusterSize = cfg.getULong("ClusterSize", 16 );
+            c_bPrintGCState = cfg.getBool("PrintGCStateFlag", true );
+
+            if ( c_nThreadCount == 0 )
+                c_nThreadCount = cds::OS::topology::processor_count();
+            if ( c_nClusterSize == 0 )
+                c_nClusterSize = 1;
+        }
+
+        TEST_SET(SkipListSet_hp_less_pascal)
+        TEST_SET(SkipListSet_hp_cmp_pascal_stat)
+        TEST_SET(SkipListSet_hp_less_xorshift)
+        TEST_SET(SkipListSet_hp_cmp_xorshift_stat)
+        TEST_SET(SkipListSet_ptb_less_pascal)
+        TEST_SET(SkipListSet_ptb_cmp_pascal_stat)
+        TEST_SET(SkipListSet_ptb_less_xorshift)
+        TEST_SET(SkipListSet_ptb_cmp_xorshift_stat)
+
+        CPPUNIT_TEST_SUITE( Set_Finger )
+            CPPUNIT_TEST(SkipListSet_hp_less_pascal)
+            CPPUNIT_TEST(SkipListSet_hp_cmp_pascal_stat)
+            CPPUNIT_TEST(SkipListSet_hp_less_xorshift)
+            CPPUNIT_TEST(SkipListSet_hp_cmp_xorshift_stat)
+            CPPUNIT_TEST(SkipListSet_ptb_less_pascal)
+            CPPUNIT_TEST(SkipListSet_ptb_cmp_pascal_stat)
+            CPPUNIT_TEST(SkipListSet_ptb_less_xorshift)
+            CPPUNIT_TEST(SkipListSet_ptb_cmp_xorshift_stat)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+    CPPUNIT_TEST_SUITE_REGISTRATION( Set_Finger );
+} // namespace set2